@@ -0,0 +1,763 @@
+// rlgl benchmarks (Google Benchmark)
+// NOTE: Runs headless on an EGL surfaceless context (i.e. Mesa llvmpipe), rendering goes to an offscreen
+// framebuffer. GPU work is waited for outside of the timed regions unless the benchmark measures it.
+// Results comparable across commits: rlgl_bench --benchmark_out=results.json --benchmark_out_format=json
+// Built with RLGL_NULL_GL, GL calls go to the null backend (no EGL, no GPU): only the CPU cost of
+// rlgl is measured and the GL calls of every benchmark are reported as counters.
+
+#include "rlComputePrimitives.hpp"
+#include "rlVirtualTexture.hpp"
+#include "rlTrace.hpp"
+#include "rlgl.hpp"
+
+#if !defined(RLGL_NULL_GL)
+    #include <EGL/egl.h>
+    #include <EGL/eglext.h>
+#endif
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace rlgl;
+
+namespace {
+
+    constexpr int FRAMEBUFFER_SIZE = 1024;          // Offscreen framebuffer width and height
+
+    // Benchmark shader (default shader attributes and uniforms)
+    constexpr const char *BENCH_VERTEX_CODE =
+        "#version 330\n"
+        "in vec3 vertexPosition;\n"
+        "in vec2 vertexTexCoord;\n"
+        "in vec4 vertexColor;\n"
+        "out vec2 fragTexCoord;\n"
+        "out vec4 fragColor;\n"
+        "uniform mat4 mvp;\n"
+        "void main()\n"
+        "{\n"
+        "    fragTexCoord = vertexTexCoord;\n"
+        "    fragColor = vertexColor;\n"
+        "    gl_Position = mvp*vec4(vertexPosition, 1.0);\n"
+        "}\n";
+
+    constexpr const char *BENCH_FRAGMENT_CODE =
+        "#version 330\n"
+        "in vec2 fragTexCoord;\n"
+        "in vec4 fragColor;\n"
+        "out vec4 finalColor;\n"
+        "uniform sampler2D texture0;\n"
+        "uniform vec4 colDiffuse;\n"
+        "void main()\n"
+        "{\n"
+        "    finalColor = texture(texture0, fragTexCoord)*colDiffuse*fragColor;\n"
+        "}\n";
+
+    //----------------------------------------------------------------------------------
+
+    std::unique_ptr<Context> rlCtx;                 // Context shared by all the benchmarks
+    uint32_t framebuffer = 0;                       // Offscreen framebuffer
+    uint32_t colorTexture = 0;                      // Offscreen framebuffer color attachment
+    uint32_t textures[2] = { 0, 0 };                // Small textures used to break batches
+
+#if defined(RLGL_NULL_GL)
+
+    void *LoadProc(const char *name)
+    {
+        return NullGLLoader(name);
+    }
+
+    // No context needed by the null backend
+    bool InitEGL()
+    {
+        return true;
+    }
+
+#else
+
+    void *LoadProc(const char *name)
+    {
+        return reinterpret_cast<void*>(eglGetProcAddress(name));
+    }
+
+    // Create a surfaceless OpenGL context and make it current
+    bool InitEGL()
+    {
+        auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+        EGLDisplay display = (getPlatformDisplay != nullptr) ? getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr)
+                                                             : eglGetDisplay(EGL_DEFAULT_DISPLAY);
+
+        if ((display == EGL_NO_DISPLAY) || !eglInitialize(display, nullptr, nullptr)) return false;
+        if (!eglBindAPI(EGL_OPENGL_API)) return false;
+
+#   if defined(GRAPHICS_API_OPENGL_43)
+        const EGLint major = 4, minor = 3;
+#   else
+        const EGLint major = 3, minor = 3;
+#   endif
+
+        const EGLint configAttribs[] = { EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT, EGL_NONE };
+        EGLConfig config = nullptr;
+        EGLint configCount = 0;
+        eglChooseConfig(display, configAttribs, &config, 1, &configCount);
+
+        const EGLint contextAttribs[] = {
+            EGL_CONTEXT_MAJOR_VERSION, major, EGL_CONTEXT_MINOR_VERSION, minor,
+            EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT, EGL_NONE
+        };
+
+        EGLContext context = eglCreateContext(display, (configCount > 0) ? config : nullptr, EGL_NO_CONTEXT, contextAttribs);
+        if (context == EGL_NO_CONTEXT) return false;
+
+        return eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context);
+    }
+
+#endif
+
+    // Load the context and the offscreen framebuffer
+    bool InitContext()
+    {
+        if (!InitEGL()) return false;
+
+        rlCtx = std::make_unique<Context>(FRAMEBUFFER_SIZE, FRAMEBUFFER_SIZE, LoadProc);
+
+        framebuffer = rlCtx->LoadFramebuffer(FRAMEBUFFER_SIZE, FRAMEBUFFER_SIZE);
+        colorTexture = rlCtx->LoadTexture(nullptr, FRAMEBUFFER_SIZE, FRAMEBUFFER_SIZE, PixelFormat::R8G8B8A8, 1);
+        rlCtx->FramebufferAttach(framebuffer, colorTexture, FramebufferAttachType::ColorChannel0, FramebufferAttachTextureType::Texture2D, 0);
+        if (!rlCtx->FramebufferComplete(framebuffer)) return false;
+
+        const std::vector<uint8_t> pixels(16*16*4, 255);
+        for (uint32_t& texture : textures) texture = rlCtx->LoadTexture(pixels.data(), 16, 16, PixelFormat::R8G8B8A8, 1);
+
+        rlCtx->EnableFramebuffer(framebuffer);
+        rlCtx->Viewport(0, 0, FRAMEBUFFER_SIZE, FRAMEBUFFER_SIZE);
+        rlCtx->MatrixMode(MatrixMode::Projection);
+        rlCtx->LoadIdentity();
+        rlCtx->Ortho(0, FRAMEBUFFER_SIZE, FRAMEBUFFER_SIZE, 0, -1, 1);
+        rlCtx->MatrixMode(MatrixMode::ModelView);
+        rlCtx->LoadIdentity();
+
+        return true;
+    }
+
+    void CloseContext()
+    {
+        for (uint32_t texture : textures) rlCtx->UnloadTexture(texture);
+        rlCtx->UnloadFramebuffer(framebuffer);
+        rlCtx->UnloadTexture(colorTexture);
+        rlCtx.reset();
+    }
+
+    // Draw the pending batch and wait for the GPU (called outside of the timed regions)
+    void FinishFrame()
+    {
+        rlCtx->DrawRenderBatchActive();
+        glFinish();
+    }
+
+    // Report the GL calls of a benchmark per iteration (null backend only), untimed calls included
+    struct GLCallsReport
+    {
+        explicit GLCallsReport(benchmark::State& state)
+        : state(state)
+#   if defined(RLGL_NULL_GL)
+        , start(GetNullGLCounters())
+#   endif
+        { }
+
+        ~GLCallsReport()
+        {
+#   if defined(RLGL_NULL_GL)
+            const NullGLCounters &end = GetNullGLCounters();
+            const auto perIteration = benchmark::Counter::kAvgIterations;
+
+            state.counters["gl_calls"] = benchmark::Counter(static_cast<double>(end.calls - start.calls), perIteration);
+            state.counters["gl_draws"] = benchmark::Counter(static_cast<double>(end.drawCalls - start.drawCalls), perIteration);
+            state.counters["gl_bytes"] = benchmark::Counter(static_cast<double>(end.bytesUploaded - start.bytesUploaded), perIteration);
+            if (end.errors != start.errors)
+            {
+                std::fprintf(stderr, "rlgl_bench: Invalid GL call: %s\n", GetNullGLLastError());
+                state.SkipWithError("Invalid GL calls (see the null backend errors)");
+            }
+#   endif
+        }
+
+        benchmark::State& state;
+#   if defined(RLGL_NULL_GL)
+        NullGLCounters start;
+#   endif
+    };
+
+    void EmitQuad(float x, float y, float size)
+    {
+        rlCtx->TexCoord(0.0f, 0.0f); rlCtx->Vertex(x, y);
+        rlCtx->TexCoord(0.0f, 1.0f); rlCtx->Vertex(x, y + size);
+        rlCtx->TexCoord(1.0f, 1.0f); rlCtx->Vertex(x + size, y + size);
+        rlCtx->TexCoord(1.0f, 0.0f); rlCtx->Vertex(x + size, y);
+    }
+
+    // Procedural virtual texture source (the same pixels on every run, no file needed)
+    bool LoadProceduralPage(int level, int x, int y, int width, int height, uint8_t *pixels)
+    {
+        for (int j = 0; j < height; j++)
+        {
+            for (int i = 0; i < width; i++)
+            {
+                const uint32_t px = static_cast<uint32_t>(std::max(x + i, 0));
+                const uint32_t py = static_cast<uint32_t>(std::max(y + j, 0));
+                uint8_t *pixel = pixels + (j*width + i)*4;
+
+                pixel[0] = static_cast<uint8_t>(px ^ py);
+                pixel[1] = static_cast<uint8_t>((px >> 4) + (py >> 4));
+                pixel[2] = static_cast<uint8_t>(level*32);
+                pixel[3] = 255;
+            }
+        }
+
+        return true;
+    }
+
+#if defined(GRAPHICS_API_OPENGL_43)
+
+    // Random 32 bit values (the same on every run)
+    std::vector<uint32_t> GenRandomValues(int count, uint32_t seed)
+    {
+        std::mt19937 random(seed);
+        std::vector<uint32_t> values(count);
+        for (uint32_t& value : values) value = static_cast<uint32_t>(random());
+        return values;
+    }
+
+    // Compare the content of a shader buffer with the CPU reference
+    // NOTE: The null backend does not run the shaders, results are not checked
+    bool MatchesReference(uint32_t buffer, const std::vector<uint32_t>& reference)
+    {
+#   if defined(RLGL_NULL_GL)
+        (void)buffer; (void)reference;
+        return true;
+#   else
+        std::vector<uint32_t> result(reference.size());
+        rlCtx->ReadShaderBuffer(buffer, result.data(), static_cast<uint32_t>(result.size()*sizeof(uint32_t)), 0);
+        return (result == reference);
+#   endif
+    }
+
+#endif
+
+}
+
+//----------------------------------------------------------------------------------
+// Immediate mode and render batch
+//----------------------------------------------------------------------------------
+
+// Vertices submitted to the render batch (flushes included when the batch is full)
+void BM_Vertex(benchmark::State& state)
+{
+    const int quads = static_cast<int>(state.range(0));
+
+    GLCallsReport report(state);
+    for (auto _ : state)
+    {
+        rlCtx->Begin(DrawMode::Quads);
+        rlCtx->Color(static_cast<uint8_t>(255), static_cast<uint8_t>(255), static_cast<uint8_t>(255), static_cast<uint8_t>(255));
+        for (int i = 0; i < quads; i++) EmitQuad(static_cast<float>(i%FRAMEBUFFER_SIZE), static_cast<float>(i/FRAMEBUFFER_SIZE%FRAMEBUFFER_SIZE), 1.0f);
+        rlCtx->End();
+
+        state.PauseTiming();
+        FinishFrame();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations()*quads*4);
+}
+BENCHMARK(BM_Vertex)->Arg(1024)->Arg(8192)->Arg(32768);
+
+// Draw mode switches between primitives (every switch starts a new draw call)
+void BM_BeginEndSwitch(benchmark::State& state)
+{
+    const int switches = static_cast<int>(state.range(0));
+
+    GLCallsReport report(state);
+    for (auto _ : state)
+    {
+        for (int i = 0; i < switches; i++)
+        {
+            const float x = static_cast<float>(i%FRAMEBUFFER_SIZE);
+
+            switch (i%3)
+            {
+                case 0: rlCtx->Begin(DrawMode::Lines); rlCtx->Vertex(x, 0.0f); rlCtx->Vertex(x, 8.0f); rlCtx->End(); break;
+                case 1: rlCtx->Begin(DrawMode::Triangles); rlCtx->Vertex(x, 0.0f); rlCtx->Vertex(x, 8.0f); rlCtx->Vertex(x + 8.0f, 8.0f); rlCtx->End(); break;
+                default: rlCtx->Begin(DrawMode::Quads); EmitQuad(x, 0.0f, 8.0f); rlCtx->End(); break;
+            }
+        }
+
+        state.PauseTiming();
+        FinishFrame();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations()*switches);
+}
+BENCHMARK(BM_BeginEndSwitch)->Arg(256)->Arg(4096);
+
+// Texture changes between quads (every change starts a new draw call)
+void BM_SetTextureBreak(benchmark::State& state)
+{
+    const int quads = static_cast<int>(state.range(0));
+
+    GLCallsReport report(state);
+    for (auto _ : state)
+    {
+        for (int i = 0; i < quads; i++)
+        {
+            rlCtx->SetTexture(textures[i%2]);
+            rlCtx->Begin(DrawMode::Quads);
+            EmitQuad(static_cast<float>(i%FRAMEBUFFER_SIZE), 0.0f, 8.0f);
+            rlCtx->End();
+        }
+
+        rlCtx->SetTexture(0);
+
+        state.PauseTiming();
+        FinishFrame();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations()*quads);
+}
+BENCHMARK(BM_SetTextureBreak)->Arg(256)->Arg(4096);
+
+// Render batch flush: vertex upload and draw calls submission (CPU side)
+void BM_RenderBatchFlush(benchmark::State& state)
+{
+    const int quads = static_cast<int>(state.range(0));
+    const int textureBreaks = static_cast<int>(state.range(1));
+
+    GLCallsReport report(state);
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        for (int i = 0; i < quads; i++)
+        {
+            if (textureBreaks > 0) rlCtx->SetTexture(textures[(i*textureBreaks/quads)%2]);
+            rlCtx->Begin(DrawMode::Quads);
+            EmitQuad(static_cast<float>(i%FRAMEBUFFER_SIZE), 0.0f, 1.0f);
+            rlCtx->End();
+        }
+        rlCtx->SetTexture(0);
+        state.ResumeTiming();
+
+        rlCtx->DrawRenderBatchActive();
+
+        state.PauseTiming();
+        glFinish();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations()*quads);
+}
+BENCHMARK(BM_RenderBatchFlush)->Args({ 64, 0 })->Args({ 4096, 0 })->Args({ 8000, 0 })->Args({ 8000, 200 });
+
+//----------------------------------------------------------------------------------
+// Matrices
+//----------------------------------------------------------------------------------
+
+void BM_MatrixMultiply(benchmark::State& state)
+{
+    Matrix a = Matrix::RotateXYZ(0.1f, 0.2f, 0.3f);
+    const Matrix b = Matrix::Translate(1.0f, 2.0f, 3.0f);
+
+    for (auto _ : state)
+    {
+        a = a*b;
+        benchmark::DoNotOptimize(a);
+    }
+}
+BENCHMARK(BM_MatrixMultiply);
+
+void BM_MatrixInvert(benchmark::State& state)
+{
+    const Matrix a = Matrix::RotateXYZ(0.1f, 0.2f, 0.3f)*Matrix::Translate(1.0f, 2.0f, 3.0f);
+
+    for (auto _ : state)
+    {
+        Matrix inverse = a.Invert();
+        benchmark::DoNotOptimize(inverse);
+    }
+}
+BENCHMARK(BM_MatrixInvert);
+
+// Matrix stack operations of the context (push, transform, pop)
+void BM_MatrixStack(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        rlCtx->PushMatrix();
+        rlCtx->Translate(1.0f, 2.0f, 0.0f);
+        rlCtx->Rotate(45.0f, 0.0f, 0.0f, 1.0f);
+        rlCtx->Scale(2.0f, 2.0f, 1.0f);
+        rlCtx->PopMatrix();
+    }
+}
+BENCHMARK(BM_MatrixStack);
+
+//----------------------------------------------------------------------------------
+// GPU transfers and resources
+//----------------------------------------------------------------------------------
+
+// Framebuffer readback (synchronous, includes the vertical flip)
+void BM_ReadScreenPixels(benchmark::State& state)
+{
+    const int size = static_cast<int>(state.range(0));
+    std::vector<uint8_t> pixels(size*size*4);
+
+    GLCallsReport report(state);
+    for (auto _ : state)
+    {
+        rlCtx->ReadScreenPixels(pixels.data(), size, size, true);
+        benchmark::DoNotOptimize(pixels.data());
+    }
+
+    state.SetBytesProcessed(state.iterations()*size*size*4);
+}
+BENCHMARK(BM_ReadScreenPixels)->Arg(256)->Arg(1024);
+
+// Texture sub-image upload (waits for the GPU copy)
+void BM_TextureUpload(benchmark::State& state)
+{
+    const int size = static_cast<int>(state.range(0));
+    const std::vector<uint8_t> pixels(size*size*4, 127);
+    const uint32_t texture = rlCtx->LoadTexture(nullptr, size, size, PixelFormat::R8G8B8A8, 1);
+
+    GLCallsReport report(state);
+    for (auto _ : state)
+    {
+        rlCtx->UpdateTexture(texture, 0, 0, size, size, PixelFormat::R8G8B8A8, pixels.data());
+        glFinish();
+    }
+
+    rlCtx->UnloadTexture(texture);
+    state.SetBytesProcessed(state.iterations()*size*size*4);
+}
+BENCHMARK(BM_TextureUpload)->Arg(256)->Arg(1024);
+
+// Texture creation with initial data and deletion
+void BM_TextureLoad(benchmark::State& state)
+{
+    const int size = static_cast<int>(state.range(0));
+    const std::vector<uint8_t> pixels(size*size*4, 127);
+
+    GLCallsReport report(state);
+    for (auto _ : state)
+    {
+        const uint32_t texture = rlCtx->LoadTexture(pixels.data(), size, size, PixelFormat::R8G8B8A8, 1);
+        rlCtx->UnloadTexture(texture);
+    }
+
+    state.SetBytesProcessed(state.iterations()*size*size*4);
+}
+BENCHMARK(BM_TextureLoad)->Arg(256);
+
+// Shader compilation and linking
+void BM_ShaderLoad(benchmark::State& state)
+{
+    GLCallsReport report(state);
+    for (auto _ : state)
+    {
+        const uint32_t shader = rlCtx->LoadShaderCode(BENCH_VERTEX_CODE, BENCH_FRAGMENT_CODE);
+        if (shader == 0)
+        {
+            state.SkipWithError("Shader failed to load");
+            break;
+        }
+        rlCtx->UnloadShaderProgram(shader);
+    }
+}
+BENCHMARK(BM_ShaderLoad);
+
+//----------------------------------------------------------------------------------
+// Compute primitives (OpenGL 4.3)
+// NOTE: Results are checked against a CPU reference before timing, every timed iteration waits for the GPU
+//----------------------------------------------------------------------------------
+
+#if defined(GRAPHICS_API_OPENGL_43)
+
+// Exclusive prefix sum of 32 bit unsigned integers
+void BM_ExclusiveScan(benchmark::State& state)
+{
+    const int count = static_cast<int>(state.range(0));
+
+    ComputePrimitives primitives(*rlCtx);
+    if (!primitives.IsReady()) { state.SkipWithError("Compute shaders not supported"); return; }
+
+    std::vector<uint32_t> values = GenRandomValues(count, 1);
+    for (uint32_t& value : values) value &= 0xff;
+
+    std::vector<uint32_t> reference(count);
+    uint32_t sum = 0;
+    for (int i = 0; i < count; i++) { reference[i] = sum; sum += values[i]; }
+
+    const uint32_t input = rlCtx->LoadShaderBuffer(count*sizeof(uint32_t), values.data(), BufferUsage::StaticDraw);
+    const uint32_t output = rlCtx->LoadShaderBuffer(count*sizeof(uint32_t), nullptr, BufferUsage::DynamicCopy);
+
+    primitives.ExclusiveScan(input, output, count);
+    if (!MatchesReference(output, reference)) state.SkipWithError("Scan result does not match the CPU reference");
+
+    GLCallsReport report(state);
+    for (auto _ : state)
+    {
+        primitives.ExclusiveScan(input, output, count);
+        glFinish();
+    }
+
+    rlCtx->UnloadShaderBuffer(input);
+    rlCtx->UnloadShaderBuffer(output);
+    state.SetItemsProcessed(state.iterations()*count);
+}
+BENCHMARK(BM_ExclusiveScan)->Arg(1 << 16)->Arg(1 << 20)->Unit(benchmark::kMicrosecond);
+
+// Sum of 32 bit unsigned integers (wraps around like the CPU reference)
+void BM_Reduce(benchmark::State& state)
+{
+    const int count = static_cast<int>(state.range(0));
+
+    ComputePrimitives primitives(*rlCtx);
+    if (!primitives.IsReady()) { state.SkipWithError("Compute shaders not supported"); return; }
+
+    const std::vector<uint32_t> values = GenRandomValues(count, 2);
+
+    uint32_t sum = 0;
+    for (uint32_t value : values) sum += value;
+
+    const uint32_t input = rlCtx->LoadShaderBuffer(count*sizeof(uint32_t), values.data(), BufferUsage::StaticDraw);
+    const uint32_t result = rlCtx->LoadShaderBuffer(sizeof(uint32_t), nullptr, BufferUsage::DynamicCopy);
+
+    primitives.Reduce(input, count, ReduceType::UInt, ReduceOp::Sum, result);
+    if (!MatchesReference(result, { sum })) state.SkipWithError("Reduction result does not match the CPU reference");
+
+    GLCallsReport report(state);
+    for (auto _ : state)
+    {
+        primitives.Reduce(input, count, ReduceType::UInt, ReduceOp::Sum, result);
+        glFinish();
+    }
+
+    rlCtx->UnloadShaderBuffer(input);
+    rlCtx->UnloadShaderBuffer(result);
+    state.SetItemsProcessed(state.iterations()*count);
+}
+BENCHMARK(BM_Reduce)->Arg(1 << 16)->Arg(1 << 20)->Unit(benchmark::kMicrosecond);
+
+// Radix sort of 32 bit keys with their index as value (the unsorted keys are uploaded again outside of the timed region)
+void BM_SortPairs(benchmark::State& state)
+{
+    const int count = static_cast<int>(state.range(0));
+
+    ComputePrimitives primitives(*rlCtx);
+    if (!primitives.IsReady()) { state.SkipWithError("Compute shaders not supported"); return; }
+
+    const std::vector<uint32_t> keys = GenRandomValues(count, 3);
+    std::vector<uint32_t> values(count);
+    for (int i = 0; i < count; i++) values[i] = static_cast<uint32_t>(i);
+
+    // Stable sort of the indices by key
+    std::vector<uint32_t> referenceValues = values;
+    std::stable_sort(referenceValues.begin(), referenceValues.end(), [&keys](uint32_t a, uint32_t b) { return keys[a] < keys[b]; });
+    std::vector<uint32_t> referenceKeys(count);
+    for (int i = 0; i < count; i++) referenceKeys[i] = keys[referenceValues[i]];
+
+    const uint32_t keyBuffer = rlCtx->LoadShaderBuffer(count*sizeof(uint32_t), keys.data(), BufferUsage::DynamicCopy);
+    const uint32_t valueBuffer = rlCtx->LoadShaderBuffer(count*sizeof(uint32_t), values.data(), BufferUsage::DynamicCopy);
+
+    primitives.SortPairs(keyBuffer, valueBuffer, count);
+    if (!MatchesReference(keyBuffer, referenceKeys) || !MatchesReference(valueBuffer, referenceValues)) state.SkipWithError("Sort result does not match the CPU reference");
+
+    GLCallsReport report(state);
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        rlCtx->UpdateShaderBuffer(keyBuffer, keys.data(), count*sizeof(uint32_t), 0);
+        rlCtx->UpdateShaderBuffer(valueBuffer, values.data(), count*sizeof(uint32_t), 0);
+        glFinish();
+        state.ResumeTiming();
+
+        primitives.SortPairs(keyBuffer, valueBuffer, count);
+        glFinish();
+    }
+
+    rlCtx->UnloadShaderBuffer(keyBuffer);
+    rlCtx->UnloadShaderBuffer(valueBuffer);
+    state.SetItemsProcessed(state.iterations()*count);
+}
+BENCHMARK(BM_SortPairs)->Arg(1 << 16)->Arg(1 << 20)->Unit(benchmark::kMicrosecond);
+
+// Stream compaction of 32 bit elements, about half of them kept
+void BM_Compact(benchmark::State& state)
+{
+    const int count = static_cast<int>(state.range(0));
+
+    ComputePrimitives primitives(*rlCtx);
+    if (!primitives.IsReady()) { state.SkipWithError("Compute shaders not supported"); return; }
+
+    const std::vector<uint32_t> elements = GenRandomValues(count, 4);
+    std::vector<uint32_t> flags = GenRandomValues(count, 5);
+    for (uint32_t& flag : flags) flag &= 1;
+
+    std::vector<uint32_t> reference;
+    for (int i = 0; i < count; i++) if (flags[i] != 0) reference.push_back(elements[i]);
+    const uint32_t keptCount = static_cast<uint32_t>(reference.size());
+
+    const uint32_t input = rlCtx->LoadShaderBuffer(count*sizeof(uint32_t), elements.data(), BufferUsage::StaticDraw);
+    const uint32_t flagBuffer = rlCtx->LoadShaderBuffer(count*sizeof(uint32_t), flags.data(), BufferUsage::StaticDraw);
+    const uint32_t output = rlCtx->LoadShaderBuffer(count*sizeof(uint32_t), nullptr, BufferUsage::DynamicCopy);
+    const uint32_t countBuffer = rlCtx->LoadShaderBuffer(sizeof(uint32_t), nullptr, BufferUsage::DynamicCopy);
+
+    primitives.Compact(input, flagBuffer, output, count, sizeof(uint32_t), countBuffer);
+    if (!MatchesReference(countBuffer, { keptCount }) || !MatchesReference(output, reference)) state.SkipWithError("Compaction result does not match the CPU reference");
+
+    GLCallsReport report(state);
+    for (auto _ : state)
+    {
+        primitives.Compact(input, flagBuffer, output, count, sizeof(uint32_t), countBuffer);
+        glFinish();
+    }
+
+    for (uint32_t buffer : { input, flagBuffer, output, countBuffer }) rlCtx->UnloadShaderBuffer(buffer);
+    state.SetItemsProcessed(state.iterations()*count);
+}
+BENCHMARK(BM_Compact)->Arg(1 << 16)->Arg(1 << 20)->Unit(benchmark::kMicrosecond);
+
+#endif
+
+//----------------------------------------------------------------------------------
+// Virtual texture streaming
+//----------------------------------------------------------------------------------
+
+// Virtual texture frame on a procedural source (width and height: range 0, 32768 is one gigapixel)
+// The screen shows a level 0 window of the virtual texture, panned by a few texels every frame (range 1: 0)
+// or moved to a random location every frame (range 1: 1). Counters are per frame: 'feedback_us' is the
+// feedback pass (draw and readback start), 'update_us' is Update() (feedback processing, page uploads and
+// indirection update) and 'pages' the number of pages uploaded. Pages are loaded by the loader thread of
+// the virtual texture while the GPU is waited for.
+void BM_VirtualTexture(benchmark::State& state)
+{
+    const int size = static_cast<int>(state.range(0));
+    const bool jump = (state.range(1) != 0);
+
+    VirtualTextureDesc desc;
+    desc.width = size;
+    desc.height = size;
+
+    VirtualTexture vt(*rlCtx, desc, LoadProceduralPage);
+
+    if (vt.GetCacheTexture() == 0)
+    {
+        state.SkipWithError("Virtual texture failed to load");
+        return;
+    }
+
+    const std::string fragmentCode = std::string(
+        "#version 330\n"
+        "in vec2 fragTexCoord;\n"
+        "in vec4 fragColor;\n"
+        "out vec4 finalColor;\n") + VirtualTexture::GetShaderCode() +
+        "void main()\n"
+        "{\n"
+        "    finalColor = vtFeedback(fragTexCoord);\n"
+        "}\n";
+
+    const uint32_t shader = rlCtx->LoadShaderCode(BENCH_VERTEX_CODE, fragmentCode.c_str());
+
+    if (shader == 0)
+    {
+        state.SkipWithError("Feedback shader failed to load");
+        return;
+    }
+
+    int locs[RL_MAX_SHADER_LOCATIONS];
+    std::fill(std::begin(locs), std::end(locs), -1);
+    locs[LocMatrixMVP] = rlCtx->GetLocationUniform(shader, "mvp");
+
+    // Window of the screen in the virtual texture (one texel per screen pixel)
+    const float screen = static_cast<float>(FRAMEBUFFER_SIZE);
+    const float window = screen/size;
+    std::mt19937 random(1234);
+    std::uniform_real_distribution<float> location(0.0f, 1.0f - window);
+    float u = 0.0f, v = 0.0f;
+
+    uint64_t feedbackTime = 0, updateTime = 0, pages = 0;
+
+    GLCallsReport report(state);
+    for (auto _ : state)
+    {
+        const uint64_t feedbackStart = GetTraceTime();
+
+        vt.BeginFeedback(FRAMEBUFFER_SIZE, FRAMEBUFFER_SIZE);
+        rlCtx->SetShader(shader, locs);
+        vt.SetShaderValues(shader);
+
+        rlCtx->Begin(DrawMode::Quads);
+        rlCtx->Color(static_cast<uint8_t>(255), static_cast<uint8_t>(255), static_cast<uint8_t>(255), static_cast<uint8_t>(255));
+        rlCtx->TexCoord(u, v); rlCtx->Vertex(0.0f, 0.0f);
+        rlCtx->TexCoord(u, v + window); rlCtx->Vertex(0.0f, screen);
+        rlCtx->TexCoord(u + window, v + window); rlCtx->Vertex(screen, screen);
+        rlCtx->TexCoord(u + window, v); rlCtx->Vertex(screen, 0.0f);
+        rlCtx->End();
+
+        vt.EndFeedback();
+        rlCtx->SetShader(rlCtx->GetShaderIdDefault(), rlCtx->GetShaderLocsDefault());
+
+        const uint64_t updateStart = GetTraceTime();
+        const uint64_t uploaded = vt.GetUploadedPageCount();
+
+        vt.Update();
+
+        const uint64_t updateEnd = GetTraceTime();
+        feedbackTime += updateStart - feedbackStart;
+        updateTime += updateEnd - updateStart;
+        pages += vt.GetUploadedPageCount() - uploaded;
+
+        state.PauseTiming();
+        glFinish();
+
+        // NOTE: The feedback pass ends on the default framebuffer
+        rlCtx->EnableFramebuffer(framebuffer);
+        rlCtx->Viewport(0, 0, FRAMEBUFFER_SIZE, FRAMEBUFFER_SIZE);
+
+        if (jump) { u = location(random); v = location(random); }
+        else { u = std::min(u + 4.0f/size, 1.0f - window); v = std::min(v + 2.0f/size, 1.0f - window); }
+        state.ResumeTiming();
+    }
+
+    rlCtx->UnloadShaderProgram(shader);
+
+    const auto perIteration = benchmark::Counter::kAvgIterations;
+    state.counters["feedback_us"] = benchmark::Counter(feedbackTime/1000.0, perIteration);
+    state.counters["update_us"] = benchmark::Counter(updateTime/1000.0, perIteration);
+    state.counters["pages"] = benchmark::Counter(static_cast<double>(pages), perIteration);
+}
+BENCHMARK(BM_VirtualTexture)->Args({ 32768, 0 })->Args({ 32768, 1 })->Args({ 131072, 1 })->Unit(benchmark::kMicrosecond);
+
+int main(int argc, char **argv)
+{
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+
+    if (!InitContext())
+    {
+        std::fprintf(stderr, "rlgl_bench: Failed to create a surfaceless OpenGL context\n");
+        return 1;
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    CloseContext();
+
+    return 0;
+}
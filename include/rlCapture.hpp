@@ -0,0 +1,494 @@
+#ifndef RLGL_CAPTURE_HPP
+#define RLGL_CAPTURE_HPP
+
+#include "./rlConfig.hpp"
+#include "./rlEnums.hpp"
+#include "./rlMath.hpp"
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+#include <type_traits>
+
+// Record the calls of the context to the attached frame capture (removed unless RLGL_ENABLE_CAPTURE is defined)
+// NOTE: Only the outermost call is recorded, calls made by another call of the context are replayed by it.
+// RLGL_CAPTURE_SCOPE() and RLGL_CAPTURE_RECORD() are used separately when the call returns an object id,
+// the command is recorded once the id is known, with the id as first argument.
+#if defined(RLGL_FRAME_CAPTURE)
+    #define RLGL_CAPTURE_SCOPE() rlgl::CaptureScope rlCaptureScope(frameCapture)
+    #define RLGL_CAPTURE_RECORD(...) do { if (rlCaptureScope.IsRecording()) frameCapture->Record(rlgl::CaptureCommand::__VA_ARGS__); } while (0)
+    #define RLGL_CAPTURE(...) RLGL_CAPTURE_SCOPE(); RLGL_CAPTURE_RECORD(__VA_ARGS__)
+#else
+    #define RLGL_CAPTURE_SCOPE() (void)0
+    #define RLGL_CAPTURE_RECORD(...) (void)0
+    #define RLGL_CAPTURE(...) (void)0
+#endif
+
+// Commands of a capture, one per recorded call of the context (overloads with different arguments are separate commands)
+// NOTE: Commands are stored by index in capture files, new commands must be added at the end
+#define RLGL_CAPTURE_COMMANDS(X) \
+    X(MatrixMode) X(PushMatrix) X(PopMatrix) X(LoadIdentity) X(Translate) X(Rotate) X(Scale) X(MultMatrix) \
+    X(Frustum) X(Ortho) X(Viewport) \
+    X(Begin) X(End) X(Vertex2i) X(Vertex2f) X(Vertex3f) X(TexCoord) X(Normal) X(Color4ub) X(Color3f) X(Color4f) \
+    X(EnableVertexArray) X(DisableVertexArray) X(EnableVertexBuffer) X(DisableVertexBuffer) \
+    X(EnableVertexBufferElement) X(DisableVertexBufferElement) X(EnableVertexAttribute) X(DisableVertexAttribute) \
+    X(EnableStatePointer) X(DisableStatePointer) \
+    X(ActiveTextureSlot) X(EnableTexture) X(DisableTexture) X(EnableTextureCubemap) X(DisableTextureCubemap) \
+    X(TextureParameterWrap) X(TextureParameterFilter) X(TextureParameterFloat) \
+    X(CubemapParameterWrap) X(CubemapParameterFilter) X(CubemapParameterFloat) \
+    X(EnableShader) X(DisableShader) X(EnableFramebuffer) X(DisableFramebuffer) X(ActiveDrawBuffers) X(BlitFramebuffer) \
+    X(EnableColorBlend) X(DisableColorBlend) X(EnableDepthTest) X(DisableDepthTest) X(EnableDepthMask) X(DisableDepthMask) \
+    X(EnableBackfaceCulling) X(DisableBackfaceCulling) X(SetCullFace) X(EnableScissorTest) X(DisableScissorTest) X(Scissor) \
+    X(EnableWireMode) X(EnablePointMode) X(DisableWireMode) X(SetLineWidth) X(EnableSmoothLines) X(DisableSmoothLines) \
+    X(EnableStereoRender) X(DisableStereoRender) X(ClearColor) X(ClearScreenBuffers) \
+    X(SetBlendMode) X(SetBlendFactors) X(SetBlendFactorsSeparate) X(SetFramebufferWidth) X(SetFramebufferHeight) \
+    X(DrawRenderBatch) X(SetRenderBatchActive) X(DrawRenderBatchActive) X(CheckRenderBatchLimit) X(SetTexture) \
+    X(LoadVertexArray) X(LoadVertexBuffer) X(LoadVertexBufferElement) X(UpdateVertexBuffer) X(UpdateVertexBufferElements) \
+    X(UnloadVertexArray) X(UnloadVertexBuffer) X(SetVertexAttribute) X(SetVertexAttributeDivisor) X(SetVertexAttributeDefault) \
+    X(DrawVertexArray) X(DrawVertexArrayElements) X(DrawVertexArrayInstanced) X(DrawVertexArrayElementsInstanced) \
+    X(DrawVertexArrayInstancedIndirect) \
+    X(LoadTexture) X(LoadTextureDepth) X(LoadTextureCubemap) X(UpdateTexture) X(UpdateTextureAsync) X(UnloadTexture) \
+    X(GenTextureMipmaps) X(GenTextureMipmapsData) \
+    X(ReadTexturePixels) X(ReadScreenPixels) X(ReadTexturePixelsAsync) X(ReadScreenPixelsAsync) \
+    X(LoadFramebuffer) X(FramebufferAttach) X(FramebufferComplete) X(UnloadFramebuffer) \
+    X(LoadShaderCode) X(CompileShader) X(LoadShaderProgram) X(UnloadShaderProgram) \
+    X(SetUniform) X(SetUniformMatrix) X(SetUniformSampler) X(SetShader) \
+    X(LoadComputeShaderProgram) X(ComputeShaderDispatch) X(ComputeShaderDispatchIndirect) X(ComputeShaderBarrier) \
+    X(LoadShaderBuffer) X(UnloadShaderBuffer) X(UpdateShaderBuffer) X(BindShaderBuffer) X(ReadShaderBuffer) \
+    X(ReadShaderBufferAsync) X(CopyShaderBuffer) X(BindImageTexture) \
+    X(SetMatrixProjection) X(SetMatrixModelview) X(SetMatrixProjectionStereo) X(SetMatrixViewOffsetStereo) \
+    X(LoadDrawCube) X(LoadDrawCubeInstanced) X(LoadDrawQuad) X(LoadDrawQuadInstanced) X(DrawFullscreenTriangle)
+
+namespace rlgl {
+
+    // Frame capture and replay
+    // NOTE: A frame capture records the calls of the context into a compact binary command stream (variable
+    // length integers, raw floats) that can be saved to a file and replayed later without the application,
+    // i.e. headless by the rlgl_replay tool to profile a frame offline or compare timings between builds.
+    // Data given to the calls (vertices, pixels, uniforms, shader code...) is stored once per content, blocks
+    // are identified by their hash. While attached the capture keeps a log of the resource commands (loads,
+    // updates, parameters, vertex array setup...) so the resources used by a captured frame can be recreated
+    // before it is replayed: commands of unloaded objects are dropped from the log and an update replaces
+    // the previous update of the same region. Object ids returned by the context are remapped on replay,
+    // uniform and attribute locations are replayed as captured (same shaders give the same locations on
+    // the same driver). Calls using client memory owned by the application (EnableStatePointer(), user
+    // render batches) are recorded but can not be replayed, they are counted as skipped commands.
+
+    enum class CaptureCommand : uint8_t
+    {
+#define RLGL_CAPTURE_ENUM(name) name,
+        RLGL_CAPTURE_COMMANDS(RLGL_CAPTURE_ENUM)
+#undef RLGL_CAPTURE_ENUM
+        Count
+    };
+
+    /**
+     * @brief Get the name of a capture command.
+     *
+     * @param command The capture command.
+     * @return The command name (the name of the context function, with the overload arguments suffix).
+     */
+    const char *GetCaptureCommandName(CaptureCommand command);
+
+    /**
+     * @brief Get the size of the values given to Context::SetUniform().
+     *
+     * @param uniformType The type of the uniform values.
+     * @param count The number of values.
+     * @return The size of the values in bytes.
+     */
+    std::size_t GetUniformDataSize(ShaderUniformType uniformType, int count);
+
+    // Memory block given to a recorded call (stored once per content in the capture)
+
+    struct CaptureData
+    {
+        const void *data        = nullptr;  ///< Pointer to the data (nullptr is recorded as no data)
+        std::size_t size        = 0;        ///< Data size in bytes
+    };
+
+    // Frame capture (command stream recorder)
+    // NOTE: The capture registers itself to the context, it should be created right after the context so the
+    // resources used by the captured frames are known. Call BeginFrame() and EndFrame() around the rendering
+    // of every frame, CaptureFrames() then records the next frames, call Save() once they are captured.
+
+    struct FrameCapture
+    {
+      public:
+        FrameCapture(class Context& rlCtx);
+        ~FrameCapture();
+
+        FrameCapture(const FrameCapture&) = delete;
+        FrameCapture& operator=(const FrameCapture&) = delete;
+
+        FrameCapture(FrameCapture&& other) noexcept;
+        FrameCapture& operator=(FrameCapture&& other) noexcept;
+
+        /**
+         * @brief Begin a frame, the frame is recorded if a capture was requested.
+         */
+        void BeginFrame();
+
+        /**
+         * @brief End the current frame.
+         */
+        void EndFrame();
+
+        /**
+         * @brief Request the capture of the next frames, frames captured before are discarded.
+         *
+         * Calls made between two captured frames are recorded with the next frame.
+         *
+         * @param count The number of frames to capture.
+         */
+        void CaptureFrames(int count = 1);
+
+        /**
+         * @brief Check if the requested frames are being captured or waiting for the next BeginFrame().
+         */
+        bool IsCapturing() const
+        {
+            return (requestedFrames > 0);
+        }
+
+        /**
+         * @brief Get the number of frames completely captured.
+         */
+        int GetCapturedFrameCount() const
+        {
+            return capturedFrames;
+        }
+
+        /**
+         * @brief Serialize the captured frames, with the resource log and state at the capture start.
+         *
+         * @return The capture file content (empty if no frame was captured).
+         */
+        std::vector<uint8_t> Serialize() const;
+
+        /**
+         * @brief Save the captured frames to a file (see Serialize()).
+         *
+         * @param fileName The capture file path.
+         * @return True if the file was written, false otherwise.
+         */
+        bool Save(const std::string& fileName) const;
+
+        /**
+         * @brief Discard the captured frames, the resource log is kept.
+         */
+        void ClearFrames();
+
+        /**
+         * @brief Get the memory used by the resource log, the captured frames and their data.
+         *
+         * @return The memory used (in bytes).
+         */
+        std::size_t GetMemoryUsage() const;
+
+        /**
+         * @brief Record a call of the context (called by the context, see RLGL_CAPTURE()).
+         *
+         * @param command The call command.
+         * @param args The call arguments, in the order read by the replay.
+         */
+        template<typename... Args>
+        void Record(CaptureCommand command, const Args&... args)
+        {
+            if (!BeginRecord(command)) return;
+            const int expand[] = { 0, (Write(args), 0)... };
+            (void)expand;
+            EndRecord(command);
+        }
+
+      private:
+        friend struct CaptureScope;
+
+        // Command stream (resources at the capture start or frame)
+        struct Stream
+        {
+            std::vector<uint8_t> data;          ///< Encoded commands
+            std::vector<uint32_t> blobs;        ///< Data blocks referenced by the commands
+        };
+
+        // Logged resource command
+        struct LogRecord
+        {
+            CaptureCommand command;             ///< Command
+            uint8_t objectType;                 ///< Type of the object the command applies to
+            uint32_t object;                    ///< Object the command applies to
+            uint64_t signature;                 ///< Hash of the command arguments (data blocks excluded)
+            std::vector<uint8_t> data;          ///< Encoded arguments
+            std::vector<uint32_t> blobs;        ///< Data blocks referenced by the arguments
+        };
+
+        // Data block stored once per content
+        struct Blob
+        {
+            uint64_t hash       = 0;            ///< Content hash
+            std::vector<uint8_t> data;          ///< Content
+            int references      = 0;            ///< Log records and streams referencing the block
+        };
+
+        bool BeginRecord(CaptureCommand command);
+        void EndRecord(CaptureCommand command);
+        void AppendLog(CaptureCommand command, uint8_t objectType, uint32_t object);
+        void RecordState();
+        void ReleaseStream(Stream& stream);
+        void ReleaseRecord(LogRecord& record);
+        uint32_t AddBlob(const void *data, std::size_t size);
+        void ReleaseBlob(uint32_t index);
+        void Unload();
+
+        template<typename T>
+        void Write(T value)
+        {
+            WriteValue(value, std::is_enum<T>(), std::is_floating_point<T>(), std::is_signed<T>());
+        }
+
+        void Write(bool value)
+        {
+            WriteUnsigned(value? 1 : 0);
+        }
+
+        template<typename T, typename Float, typename Signed>
+        void WriteValue(T value, std::true_type /* enum */, Float, Signed)
+        {
+            WriteSigned(static_cast<int64_t>(value));
+        }
+
+        template<typename T, typename Signed>
+        void WriteValue(T value, std::false_type, std::true_type /* floating point */, Signed)
+        {
+            WriteBytes(&value, sizeof(T));
+        }
+
+        template<typename T>
+        void WriteValue(T value, std::false_type, std::false_type, std::true_type /* signed */)
+        {
+            WriteSigned(value);
+        }
+
+        template<typename T>
+        void WriteValue(T value, std::false_type, std::false_type, std::false_type)
+        {
+            WriteUnsigned(value);
+        }
+
+        void Write(const Matrix& mat);
+        void Write(const CaptureData& data);
+        void Write(const char *str);
+        void Write(const struct TextureDesc& desc);
+        void WriteUnsigned(uint64_t value);
+        void WriteSigned(int64_t value);
+        void WriteBytes(const void *bytes, std::size_t size);
+
+      private:
+        class Context *rlCtx;                   ///< Context recorded by the capture
+        int depth;                              ///< Context calls in progress (only the outermost call is recorded)
+
+        std::vector<uint8_t> args;              ///< Encoded arguments of the command being recorded
+        std::vector<uint32_t> argBlobs;         ///< Data blocks referenced by the command being recorded
+        uint64_t argSignature;                  ///< Hash of the arguments of the command being recorded (data blocks excluded)
+        bool recordLog;                         ///< Command being recorded goes to the resource log
+
+        std::vector<LogRecord> log;             ///< Resource commands needed to recreate the live objects
+        std::vector<Blob> blobs;                ///< Data blocks (released blocks are reused)
+        std::vector<uint32_t> freeBlobs;        ///< Released data blocks
+        std::unordered_map<uint64_t, uint32_t> blobIndices;    ///< Data blocks by content hash
+
+        uint32_t vertexArray;                   ///< Vertex array bound by the recorded calls
+        std::unordered_set<uint32_t> frameVertexArrays;         ///< Vertex arrays loaded during the current frame
+
+        bool frameActive;                       ///< Between BeginFrame() and EndFrame()
+        bool recordingState;                    ///< Recording the state at the capture start (not logged)
+        int requestedFrames;                    ///< Frames left to capture (including the frame being captured)
+        int capturedFrames;                     ///< Frames completely captured
+        Stream setup;                           ///< Resource log and state at the capture start
+        std::vector<Stream> frames;             ///< Captured frames (the last one is being captured)
+        Stream *stream;                         ///< Stream receiving the recorded commands (nullptr if not capturing)
+        int frameWidth;                         ///< Framebuffer width at the capture start
+        int frameHeight;                        ///< Framebuffer height at the capture start
+    };
+
+    // Context call being recorded, nested calls of the context are not recorded
+
+    struct CaptureScope
+    {
+      public:
+        explicit CaptureScope(FrameCapture *capture)
+        : capture(capture)
+        {
+            if (capture != nullptr) capture->depth++;
+        }
+
+        ~CaptureScope()
+        {
+            if (capture != nullptr) capture->depth--;
+        }
+
+        CaptureScope(const CaptureScope&) = delete;
+        CaptureScope& operator=(const CaptureScope&) = delete;
+
+        bool IsRecording() const
+        {
+            return (capture != nullptr) && (capture->depth == 1);
+        }
+
+      private:
+        FrameCapture *capture;                  ///< Capture attached to the context (nullptr if none)
+    };
+
+    // Replay time of a command
+
+    struct CaptureCallTiming
+    {
+        CaptureCommand command;                 ///< Replayed command
+        uint64_t duration       = 0;            ///< Time spent in the context call (in nanoseconds)
+    };
+
+    // Replay times of all the calls of a command
+
+    struct CaptureCommandStats
+    {
+        uint64_t count          = 0;            ///< Number of calls
+        uint64_t totalTime      = 0;            ///< Time spent in the calls (in nanoseconds)
+        uint64_t minTime        = 0;            ///< Fastest call (in nanoseconds)
+        uint64_t maxTime        = 0;            ///< Slowest call (in nanoseconds)
+    };
+
+    // Capture replay
+    // NOTE: The captured calls are made again on the given context, every call is timed (steady clock,
+    // arguments decoding excluded). Replay the setup (resources and state at the capture start) once,
+    // then the frames as many times as needed; GPU work is not waited for, call glFinish() between frames
+    // to measure it separately.
+
+    struct CaptureReplay
+    {
+      public:
+        CaptureReplay(class Context& rlCtx);
+
+        /**
+         * @brief Load a capture file.
+         *
+         * @param fileName The capture file path.
+         * @return True if the capture was loaded, false otherwise.
+         */
+        bool Load(const std::string& fileName);
+
+        /**
+         * @brief Load a capture from memory (see FrameCapture::Serialize()).
+         *
+         * @param data The capture file content.
+         * @return True if the capture was loaded, false otherwise.
+         */
+        bool Load(const std::vector<uint8_t>& data);
+
+        /**
+         * @brief Check if a capture is loaded.
+         */
+        bool IsReady() const
+        {
+            return ready;
+        }
+
+        int GetFrameCount() const
+        {
+            return static_cast<int>(frames.size());
+        }
+
+        /**
+         * @brief Get the framebuffer width at the capture start.
+         */
+        int GetWidth() const
+        {
+            return width;
+        }
+
+        /**
+         * @brief Get the framebuffer height at the capture start.
+         */
+        int GetHeight() const
+        {
+            return height;
+        }
+
+        /**
+         * @brief Recreate the resources and the state at the capture start (calls are not timed).
+         *
+         * @return True if the commands were replayed, false if the capture is corrupted.
+         */
+        bool ReplaySetup();
+
+        /**
+         * @brief Replay a captured frame, call times are added to the command statistics.
+         *
+         * @param index The frame index.
+         * @param calls Optional vector receiving the time of every call of the frame.
+         * @return True if the frame was replayed, false if the capture is corrupted.
+         */
+        bool ReplayFrame(int index, std::vector<CaptureCallTiming> *calls = nullptr);
+
+        /**
+         * @brief Get the replay times of the commands since the last reset.
+         *
+         * @return The statistics of every command (indexed by CaptureCommand).
+         */
+        const std::vector<CaptureCommandStats>& GetCommandStats() const
+        {
+            return stats;
+        }
+
+        /**
+         * @brief Reset the command statistics.
+         */
+        void ResetStats();
+
+        /**
+         * @brief Get the number of object ids used by the capture and unknown to it.
+         *
+         * Objects loaded before the capture was created are not known, their ids are used as captured.
+         */
+        uint64_t GetUnresolvedIds() const
+        {
+            return unresolvedIds;
+        }
+
+        /**
+         * @brief Get the number of calls that could not be replayed (client memory of the application).
+         */
+        uint64_t GetSkippedCommands() const
+        {
+            return skippedCommands;
+        }
+
+      private:
+        struct Reader;
+
+        bool Replay(const std::vector<uint8_t>& stream, bool timed, std::vector<CaptureCallTiming> *calls);
+        bool Execute(CaptureCommand command, Reader& reader, uint64_t& duration);
+        uint32_t MapId(uint8_t objectType, uint32_t id);
+        void BindId(uint8_t objectType, uint32_t capturedId, uint32_t id);
+        const uint8_t *GetBlob(uint64_t index, std::size_t *size) const;
+
+      private:
+        class Context *rlCtx;                   ///< Context replaying the capture
+        bool ready;                             ///< Capture loaded
+        int width;                              ///< Framebuffer width at the capture start
+        int height;                             ///< Framebuffer height at the capture start
+
+        std::unordered_map<uint32_t, std::vector<uint8_t>> blobs;      ///< Data blocks by index (aligned copies)
+        std::vector<uint8_t> setup;             ///< Resource log and state at the capture start
+        std::vector<std::vector<uint8_t>> frames;   ///< Captured frames
+
+        std::unordered_map<uint64_t, uint32_t> ids;     ///< Replayed object ids by type and captured id
+        std::vector<CaptureCommandStats> stats; ///< Replay times by command
+        uint64_t unresolvedIds;                 ///< Unknown object ids used by the capture
+        uint64_t skippedCommands;               ///< Calls not replayed
+    };
+
+}
+
+#endif //RLGL_CAPTURE_HPP
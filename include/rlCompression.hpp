@@ -0,0 +1,147 @@
+#ifndef RLGL_COMPRESSION_HPP
+#define RLGL_COMPRESSION_HPP
+
+#include "./rlEnums.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace rlgl {
+
+    /**
+     * @brief Check if the CPU encoder can produce a compressed pixel format.
+     *
+     * Supported formats are DXT1_RGB, DXT1_RGBA, DXT3_RGBA, DXT5_RGBA, ETC1_RGB, ETC2_RGB and ETC2_EAC_RGBA.
+     *
+     * @param format The compressed pixel format.
+     *
+     * @return True if CompressImage() supports the format.
+     */
+    bool IsCompressionFormatSupported(PixelFormat format);
+
+    /**
+     * @brief Get the best compressed format supported by both the driver and the CPU encoder.
+     *
+     * DXT formats are preferred when available, then ETC2 and ETC1 (without alpha only).
+     *
+     * @param alpha If true, the format must store an alpha channel (DXT5_RGBA or ETC2_EAC_RGBA).
+     *
+     * @return The compressed pixel format, R8G8B8A8 if none is available.
+     */
+    PixelFormat GetCompressionFormat(bool alpha);
+
+    /**
+     * @brief Compress an image on the CPU.
+     *
+     * The source must be R8G8B8A8 data, it is split into 4x4 blocks (border blocks replicate the last row and column)
+     * encoded by multiple threads. DXT1 uses the principal axis of the block colors (bounding box with the fast quality)
+     * refined by least squares, DXT1_RGBA uses the 3-color mode for blocks with transparent pixels (alpha < 128).
+     * ETC1/ETC2 search the individual and differential modes for both subblock orientations, ETC2 also tries the planar mode
+     * (T and H modes are not generated). Alpha of DXT5 and ETC2_EAC is encoded as an independent single channel block.
+     * Destination must hold at least GetPixelDataSize(width, height, format) bytes.
+     *
+     * @param data A pointer to the R8G8B8A8 source pixels.
+     * @param width The width of the image.
+     * @param height The height of the image.
+     * @param format The compressed pixel format to produce.
+     * @param dest A pointer to the destination memory.
+     * @param quality The quality/speed trade-off of the encoder.
+     *
+     * @return True if the image was compressed, false if the format is not supported.
+     */
+    bool CompressImage(const void *data, int width, int height, PixelFormat format, void *dest,
+        CompressionQuality quality = CompressionQuality::Normal);
+
+    /**
+     * @brief Compress an image on the CPU.
+     *
+     * @param data A pointer to the R8G8B8A8 source pixels.
+     * @param width The width of the image.
+     * @param height The height of the image.
+     * @param format The compressed pixel format to produce.
+     * @param quality The quality/speed trade-off of the encoder.
+     *
+     * @return A vector containing the compressed blocks, empty if the format is not supported.
+     */
+    std::vector<uint8_t> CompressImage(const void *data, int width, int height, PixelFormat format,
+        CompressionQuality quality = CompressionQuality::Normal);
+
+    /**
+     * @brief Compress every level of an R8G8B8A8 mipmap chain.
+     *
+     * Levels are read and written one after the other as expected by Context::LoadTexture(), the source
+     * chain can be produced by GenMipmapChain().
+     *
+     * @param data A pointer to the R8G8B8A8 mipmap chain.
+     * @param width The width of the base level.
+     * @param height The height of the base level.
+     * @param mipmapCount The number of levels, base level included.
+     * @param format The compressed pixel format to produce.
+     * @param quality The quality/speed trade-off of the encoder.
+     *
+     * @return A vector containing all the compressed levels, empty if the format is not supported.
+     */
+    std::vector<uint8_t> CompressMipmapChain(const void *data, int width, int height, int mipmapCount, PixelFormat format,
+        CompressionQuality quality = CompressionQuality::Normal);
+
+    /**
+     * @brief Check if the CPU decoder can decode a compressed pixel format.
+     *
+     * Supported formats are the ones of the CPU encoder plus ASTC_4x4_RGBA and ASTC_8x8_RGBA (LDR profile).
+     *
+     * @param format The compressed pixel format.
+     *
+     * @return True if DecompressImage() supports the format.
+     */
+    bool IsDecompressionFormatSupported(PixelFormat format);
+
+    /**
+     * @brief Decompress an image on the CPU.
+     *
+     * Blocks are decoded by multiple threads, partial blocks on the borders are clipped. ASTC blocks using
+     * HDR endpoint modes or invalid encodings are decoded with the error color (magenta).
+     * Destination must hold at least GetPixelDataSize(width, height, destFormat) bytes.
+     *
+     * @param data A pointer to the compressed blocks.
+     * @param width The width of the image.
+     * @param height The height of the image.
+     * @param format The compressed pixel format of the data.
+     * @param dest A pointer to the destination memory.
+     * @param destFormat The format of the decoded pixels, R8G8B8A8 or R5G6B5 (alpha discarded).
+     *
+     * @return True if the image was decompressed, false if a format is not supported.
+     */
+    bool DecompressImage(const void *data, int width, int height, PixelFormat format, void *dest,
+        PixelFormat destFormat = PixelFormat::R8G8B8A8);
+
+    /**
+     * @brief Decompress an image on the CPU.
+     *
+     * @param data A pointer to the compressed blocks.
+     * @param width The width of the image.
+     * @param height The height of the image.
+     * @param format The compressed pixel format of the data.
+     * @param destFormat The format of the decoded pixels, R8G8B8A8 or R5G6B5 (alpha discarded).
+     *
+     * @return A vector containing the decoded pixels, empty if a format is not supported.
+     */
+    std::vector<uint8_t> DecompressImage(const void *data, int width, int height, PixelFormat format,
+        PixelFormat destFormat = PixelFormat::R8G8B8A8);
+
+    /**
+     * @brief Decompress every level of a compressed mipmap chain.
+     *
+     * @param data A pointer to the compressed mipmap chain.
+     * @param width The width of the base level.
+     * @param height The height of the base level.
+     * @param mipmapCount The number of levels, base level included.
+     * @param format The compressed pixel format of the data.
+     * @param destFormat The format of the decoded pixels, R8G8B8A8 or R5G6B5 (alpha discarded).
+     *
+     * @return A vector containing all the decoded levels, empty if a format is not supported.
+     */
+    std::vector<uint8_t> DecompressMipmapChain(const void *data, int width, int height, int mipmapCount, PixelFormat format,
+        PixelFormat destFormat = PixelFormat::R8G8B8A8);
+
+}
+
+#endif //RLGL_COMPRESSION_HPP
@@ -0,0 +1,136 @@
+#ifndef RLGL_COMPUTE_PRIMITIVES_HPP
+#define RLGL_COMPUTE_PRIMITIVES_HPP
+
+#include <cstdint>
+#include <cstddef>
+
+namespace rlgl {
+
+    // Reduction operations and element types
+
+    enum class ReduceOp
+    {
+        Sum = 0,                ///< Sum of the elements (0 if empty)
+        Min,                    ///< Smallest element (largest representable value if empty)
+        Max                     ///< Largest element (smallest representable value if empty)
+    };
+
+    enum class ReduceType
+    {
+        UInt = 0,               ///< 32 bit unsigned integers
+        Int,                    ///< 32 bit signed integers
+        Float                   ///< 32 bit floats
+    };
+
+    // Parallel primitives on shader storage buffers (compute shaders, OpenGL 4.3)
+    // NOTE: Every function records compute dispatches on the GPU and returns without waiting, dispatch sizes
+    // are computed from the element count and memory barriers are issued between the passes and after the
+    // last one, so the results can be used by the next compute dispatch, draw call or buffer read.
+    // Scratch buffers are owned by the primitives and grow with the largest element count used. Element counts
+    // are limited by the 65535 work groups of a dispatch (about 33M elements to scan, 16M to sort or compact).
+
+    struct ComputePrimitives
+    {
+      public:
+        ComputePrimitives(class Context& rlCtx);
+        ~ComputePrimitives();
+
+        ComputePrimitives(const ComputePrimitives&) = delete;
+        ComputePrimitives& operator=(const ComputePrimitives&) = delete;
+
+        ComputePrimitives(ComputePrimitives&& other) noexcept;
+        ComputePrimitives& operator=(ComputePrimitives&& other) noexcept;
+
+        /**
+         * @brief Check if the primitives are loaded (compute shaders are supported).
+         */
+        bool IsReady() const
+        {
+            return ready;
+        }
+
+        /**
+         * @brief Exclusive prefix sum of 32 bit unsigned integers (work-efficient, 512 elements per work group).
+         *
+         * The input and output buffers can be the same buffer (in-place scan).
+         *
+         * @param inputBuffer The ID of the shader buffer holding the values.
+         * @param outputBuffer The ID of the shader buffer receiving the prefix sums.
+         * @param count The number of elements.
+         * @return True if the scan was dispatched.
+         */
+        bool ExclusiveScan(uint32_t inputBuffer, uint32_t outputBuffer, uint32_t count);
+
+        /**
+         * @brief Reduce an array to a single value.
+         *
+         * @param inputBuffer The ID of the shader buffer holding the elements.
+         * @param count The number of elements.
+         * @param type The type of the elements.
+         * @param op The reduction operation.
+         * @param resultBuffer The ID of the shader buffer receiving the result.
+         * @param resultOffset The offset of the result in bytes (multiple of 4).
+         * @return True if the reduction was dispatched.
+         */
+        bool Reduce(uint32_t inputBuffer, uint32_t count, ReduceType type, ReduceOp op, uint32_t resultBuffer, uint32_t resultOffset = 0);
+
+        /**
+         * @brief Stable radix sort of 32 bit unsigned keys and their values (4 bits per pass), in place.
+         *
+         * @param keyBuffer The ID of the shader buffer holding the keys.
+         * @param valueBuffer The ID of the shader buffer holding the 32 bit values, 0 to sort the keys only.
+         * @param count The number of elements.
+         * @param keyBits The number of low bits of the keys to sort on (1 to 32, fewer bits need fewer passes).
+         * @return True if the sort was dispatched.
+         */
+        bool SortPairs(uint32_t keyBuffer, uint32_t valueBuffer, uint32_t count, int keyBits = 32);
+
+        /**
+         * @brief Stream compaction, copy the elements with a non-zero flag to the start of the output buffer (order is kept).
+         *
+         * @param inputBuffer The ID of the shader buffer holding the elements.
+         * @param flagBuffer The ID of the shader buffer holding one 32 bit flag per element.
+         * @param outputBuffer The ID of the shader buffer receiving the kept elements (different from the input buffer).
+         * @param count The number of elements.
+         * @param elementSize The size of an element in bytes (multiple of 4).
+         * @param countBuffer The ID of the shader buffer receiving the number of kept elements, 0 to ignore it.
+         * @param countOffset The offset of the number of kept elements in bytes.
+         * @return True if the compaction was dispatched.
+         */
+        bool Compact(uint32_t inputBuffer, uint32_t flagBuffer, uint32_t outputBuffer, uint32_t count, uint32_t elementSize,
+                     uint32_t countBuffer = 0, uint32_t countOffset = 0);
+
+      private:
+        void ScanLevels(uint32_t inputBuffer, uint32_t outputBuffer, uint32_t count, bool flagInput);
+        uint32_t GetReduceProgram(ReduceType type, ReduceOp op);
+        void ReserveBuffer(uint32_t& id, uint32_t& size, uint32_t required);
+        void Unload();
+
+      private:
+        class Context *rlCtx;                       ///< Context used to run the shaders
+        bool ready;                                 ///< Compute shaders loaded
+
+        uint32_t scanProgram;                       ///< Compute program: block exclusive scan
+        uint32_t scanAddProgram;                    ///< Compute program: block offsets propagation
+        uint32_t reducePrograms[3][3];              ///< Compute programs: block reduction (by type and operation, loaded on first use)
+        uint32_t histogramProgram;                  ///< Compute program: radix digit counts per block
+        uint32_t sortScatterProgram;                ///< Compute program: radix digit scatter
+        uint32_t compactProgram;                    ///< Compute program: flagged elements scatter
+
+        uint32_t scanScratch;                       ///< Scan total and block sums of every level
+        uint32_t scanScratchSize;                   ///< Size of the scan scratch buffer (in bytes)
+        uint32_t reduceScratch;                     ///< Partial results of the reduction levels
+        uint32_t reduceScratchSize;                 ///< Size of the reduction scratch buffer (in bytes)
+        uint32_t sortKeys;                          ///< Sort ping-pong keys
+        uint32_t sortKeysSize;                      ///< Size of the sort keys buffer (in bytes)
+        uint32_t sortValues;                        ///< Sort ping-pong values
+        uint32_t sortValuesSize;                    ///< Size of the sort values buffer (in bytes)
+        uint32_t histogram;                         ///< Radix digit counts (digit major), scanned in place
+        uint32_t histogramSize;                     ///< Size of the histogram buffer (in bytes)
+        uint32_t offsets;                           ///< Compaction output indices
+        uint32_t offsetsSize;                       ///< Size of the compaction indices buffer (in bytes)
+    };
+
+}
+
+#endif //RLGL_COMPUTE_PRIMITIVES_HPP
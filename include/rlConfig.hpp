@@ -124,16 +124,131 @@
         #define RL_DEFAULT_BATCH_BUFFER_ELEMENTS  2048
     #endif
 #endif
+#ifndef RL_MAX_BATCH_BUFFER_ELEMENTS
+    #if defined(GRAPHICS_API_OPENGL_ES2)
+        #define RL_MAX_BATCH_BUFFER_ELEMENTS     16384      // Maximum elements (quads) per batch buffer, indices are 16 bit on OpenGL ES 2.0
+    #else
+        #define RL_MAX_BATCH_BUFFER_ELEMENTS    262144      // Maximum elements (quads) per batch buffer
+    #endif
+#endif
 #ifndef RL_DEFAULT_BATCH_BUFFERS
     #define RL_DEFAULT_BATCH_BUFFERS                 1      // Default number of batch buffers (multi-buffering)
 #endif
 #ifndef RL_DEFAULT_BATCH_DRAWCALLS
     #define RL_DEFAULT_BATCH_DRAWCALLS             256      // Default number of batch draw calls (by state changes: mode, texture)
 #endif
+#ifndef RL_MAX_BATCH_DRAWCALLS
+    #define RL_MAX_BATCH_DRAWCALLS                8192      // Maximum number of batch draw calls reached by the auto-tuning
+#endif
+#ifndef RL_BATCH_TUNE_SHRINK_FRAMES
+    #define RL_BATCH_TUNE_SHRINK_FRAMES            120      // Frames using less than a quarter of the batch before the auto-tuning shrinks it
+#endif
 #ifndef RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS
     #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS       4      // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
 #endif
 
+// Streaming texture uploads and readbacks (pixel buffers)
+#ifndef RL_DEFAULT_UPLOAD_BUFFERS
+    #define RL_DEFAULT_UPLOAD_BUFFERS                2      // Default number of upload staging buffers (double-buffering)
+#endif
+#ifndef RL_DEFAULT_READBACK_BUFFERS
+    #define RL_DEFAULT_READBACK_BUFFERS              3      // Default number of readback staging buffers (frames in flight)
+#endif
+#ifndef RL_READBACK_FENCE_TIMEOUT
+    #define RL_READBACK_FENCE_TIMEOUT             1000      // Maximum time waited for a readback to complete (in milliseconds) before it is reported as failed
+#endif
+
+// Render target pool (transient framebuffers)
+#ifndef RL_DEFAULT_TARGET_POOL_UNUSED_FRAMES
+    #define RL_DEFAULT_TARGET_POOL_UNUSED_FRAMES     3      // Default number of frames a pooled render target can stay unused before being unloaded
+#endif
+
+// Texture residency manager (texture memory budget)
+#ifndef RL_DEFAULT_TEXTURE_BUDGET
+    #define RL_DEFAULT_TEXTURE_BUDGET    (256*1024*1024)    // Default texture memory budget of the residency manager (in bytes)
+#endif
+#ifndef RL_DEFAULT_TEXTURE_DROPPED_LEVELS
+    #define RL_DEFAULT_TEXTURE_DROPPED_LEVELS        2      // Default number of top mipmap levels dropped from a texture before evicting it (0: evict only)
+#endif
+
+// Instanced sprite renderer
+#ifndef RL_DEFAULT_SPRITE_BATCH_CAPACITY
+    #define RL_DEFAULT_SPRITE_BATCH_CAPACITY     16384      // Default maximum number of sprites drawn per instanced draw call
+#endif
+
+// GPU particle system (compute shaders, OpenGL 4.3)
+#ifndef RL_DEFAULT_PARTICLE_CAPACITY
+    #define RL_DEFAULT_PARTICLE_CAPACITY        262144      // Default maximum number of particles of a particle system (32 bytes per particle, two buffers)
+#endif
+
+// Dynamic texture atlas (glyphs, icons and sprites)
+#ifndef RL_DEFAULT_ATLAS_PAGE_SIZE
+    #define RL_DEFAULT_ATLAS_PAGE_SIZE            1024      // Default texture atlas page width and height (in pixels)
+#endif
+#ifndef RL_DEFAULT_ATLAS_MAX_PAGES
+    #define RL_DEFAULT_ATLAS_MAX_PAGES               4      // Default maximum number of texture atlas pages
+#endif
+#ifndef RL_DEFAULT_ATLAS_PADDING
+    #define RL_DEFAULT_ATLAS_PADDING                 1      // Default padding around texture atlas images (in pixels, edges are repeated)
+#endif
+
+// Virtual texture (page streaming)
+#ifndef RL_DEFAULT_VT_PAGE_SIZE
+    #define RL_DEFAULT_VT_PAGE_SIZE                128      // Default virtual texture page size (in pixels, without borders)
+#endif
+#ifndef RL_DEFAULT_VT_PAGE_BORDER
+    #define RL_DEFAULT_VT_PAGE_BORDER                1      // Default virtual texture page border (in pixels, required for bilinear filtering)
+#endif
+#ifndef RL_DEFAULT_VT_CACHE_PAGES
+    #define RL_DEFAULT_VT_CACHE_PAGES               16      // Default virtual texture page cache size (in pages per side)
+#endif
+#ifndef RL_DEFAULT_VT_FEEDBACK_SCALE
+    #define RL_DEFAULT_VT_FEEDBACK_SCALE             8      // Default virtual texture feedback buffer downscale relative to the screen
+#endif
+#ifndef RL_DEFAULT_VT_UPLOADS_PER_FRAME
+    #define RL_DEFAULT_VT_UPLOADS_PER_FRAME         16      // Default maximum number of virtual texture pages uploaded per frame
+#endif
+
+// GPU profiler (timer queries)
+#ifndef RL_DEFAULT_GPU_PROFILER_LATENCY
+    #define RL_DEFAULT_GPU_PROFILER_LATENCY          4      // Default number of frames of queries in flight before their results are dropped
+#endif
+#ifndef RL_DEFAULT_GPU_PROFILER_HISTORY
+    #define RL_DEFAULT_GPU_PROFILER_HISTORY        120      // Default number of collected frames kept for the trace export
+#endif
+
+// CPU tracing (zones are only recorded when RLGL_ENABLE_TRACING is defined)
+#ifndef RL_TRACE_BUFFER_EVENTS
+    #define RL_TRACE_BUFFER_EVENTS               16384      // Trace events kept per thread (ring buffer, 24 bytes per event)
+#endif
+
+// Software decoding of compressed textures not supported by the driver
+#ifndef RL_DECODE_COMPRESSED_TEXTURES
+    #define RL_DECODE_COMPRESSED_TEXTURES            1      // Decode unsupported compressed formats on the CPU when loading textures (0: loading fails)
+#endif
+#ifndef RL_DECODE_OPAQUE_TO_R5G6B5
+    #define RL_DECODE_OPAQUE_TO_R5G6B5               0      // Decode compressed formats without alpha to R5G6B5 instead of R8G8B8A8 (half the memory)
+#endif
+
+// SIMD instruction sets used by the CPU image processing (can be disabled with RLGL_NO_SIMD)
+#if !defined(RLGL_NO_SIMD)
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #define RLGL_SIMD_SSE2
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #define RLGL_SIMD_NEON
+    #endif
+#endif
+
+// Frame statistics counters (can be removed with RLGL_NO_FRAME_STATS)
+#if !defined(RLGL_NO_FRAME_STATS)
+    #define RLGL_FRAME_STATS
+#endif
+
+// Frame capture hooks of the context calls (only compiled when RLGL_ENABLE_CAPTURE is defined)
+#if defined(RLGL_ENABLE_CAPTURE)
+    #define RLGL_FRAME_CAPTURE
+#endif
+
 // Internal Matrix stack
 #ifndef RL_MAX_MATRIX_STACK_SIZE
     #define RL_MAX_MATRIX_STACK_SIZE                32      // Maximum size of Matrix stack
@@ -231,6 +346,9 @@
 #ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_MVP
     #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
 #endif
+#ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_MVP_STEREO
+    #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP_STEREO  "mvpStereo"         // model-view-projection matrices of both eyes (single-pass stereo, mat4[2])
+#endif
 #ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW
     #define RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW        "matView"           // view matrix
 #endif
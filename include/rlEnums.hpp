@@ -83,6 +83,19 @@ namespace rlgl {
         MipLinear               = 0x2703    ///< GL_LINEAR_MIPMAP_LINEAR
     };
 
+    enum class MipmapFilter
+    {
+        Box,                                ///< Box filter (average of the source pixels covered)
+        Kaiser                              ///< Kaiser-windowed sinc filter (sharper, less aliasing)
+    };
+
+    enum class CompressionQuality
+    {
+        Fast,                               ///< Bounding box endpoints, no search (fastest)
+        Normal,                             ///< Principal axis endpoints, one refinement, limited search
+        High                                ///< Iterative refinement and exhaustive mode search (slowest)
+    };
+
     enum class BlendingFactor
     {
         Zero                    = 0,        ///< GL_ZERO
@@ -167,7 +180,8 @@ namespace rlgl {
         LocMapCubemap           = 22,       ///< Shader location: samplerCube texture: cubemap
         LocMapIrradiance        = 23,       ///< Shader location: samplerCube texture: irradiance
         LocMapPrefilter         = 24,       ///< Shader location: samplerCube texture: prefilter
-        LocMapBRDF              = 25        ///< Shader location: sampler2d texture: brdf
+        LocMapBRDF              = 25,       ///< Shader location: sampler2d texture: brdf
+        LocMatrixMVPStereo      = 26        ///< Shader location: matrix array uniform: model-view-projection of both eyes (single-pass stereo)
     };
 
     enum class ShaderUniformType
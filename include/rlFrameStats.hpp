@@ -0,0 +1,52 @@
+#ifndef RLGL_FRAME_STATS_HPP
+#define RLGL_FRAME_STATS_HPP
+
+#include "./rlConfig.hpp"
+#include <cstdint>
+
+// Increment frame statistics counters (removed when RLGL_NO_FRAME_STATS is defined)
+#if defined(RLGL_FRAME_STATS)
+    #define RLGL_STAT(expr) (void)(expr)
+#else
+    #define RLGL_STAT(expr) (void)0
+#endif
+
+namespace rlgl {
+
+    // Reasons for a render batch to be drawn
+
+    enum class FlushReason
+    {
+        Explicit = 0,           ///< DrawRenderBatch() or DrawRenderBatchActive() called by the user
+        VertexLimit,            ///< Batch vertex buffer full (CheckRenderBatchLimit())
+        DrawCallLimit,          ///< Batch draw calls queue full
+        ShaderChange,           ///< Current shader changed (SetShader())
+        BlendModeChange,        ///< Blending mode changed (SetBlendMode())
+        BatchChange,            ///< Active render batch changed (SetRenderBatchActive())
+        Count                   ///< Number of flush reasons
+    };
+
+    // Rendering counters accumulated by the context until ResetFrameStats()
+    // NOTE: Only the work going through the context is counted (render batch, draw, update, bind and state functions),
+    // GL calls issued directly by the user are not seen. Counters stay at zero when RLGL_NO_FRAME_STATS is defined.
+
+    struct FrameStats
+    {
+        uint32_t flushes                = 0;        ///< Render batches drawn with vertex data
+        uint32_t flushReasons[static_cast<int>(FlushReason::Count)] = { 0 };   ///< Render batches drawn by reason (indexed by FlushReason)
+        uint32_t drawCalls              = 0;        ///< Draw calls issued (render batch and vertex array draws)
+        uint64_t vertices               = 0;        ///< Vertices (or indices) submitted by the draw calls, all instances included
+        uint64_t bytesUploaded          = 0;        ///< Bytes uploaded to vertex, shader storage buffers and textures
+        uint32_t textureBinds           = 0;        ///< Texture binds
+        uint32_t stateChanges           = 0;        ///< Render state changes (shader, framebuffer, blending, depth, culling, scissor, viewport)
+        uint32_t batchResizes           = 0;        ///< Default render batch reallocations by the auto-tuning (Context::TuneRenderBatch())
+
+        uint32_t GetFlushes(FlushReason reason) const
+        {
+            return flushReasons[static_cast<int>(reason)];
+        }
+    };
+
+}
+
+#endif //RLGL_FRAME_STATS_HPP
@@ -35,6 +35,9 @@ namespace rlgl {
         bool texAnisoFilter = false;                ///< Anisotropic texture filtering support (GL_EXT_texture_filter_anisotropic)
         bool computeShader  = false;                ///< Compute shaders support (GL_ARB_compute_shader)
         bool ssbo           = false;                ///< Shader storage buffer object support (GL_ARB_shader_storage_buffer_object)
+        bool texStorage     = false;                ///< Immutable texture storage support (GL_ARB_texture_storage, OpenGL 4.2, OpenGL ES 3.0)
+        bool copyImage      = false;                ///< Texture copies between texture objects support (GL_ARB_copy_image, OpenGL 4.3)
+        bool timerQuery     = false;                ///< GPU timestamp queries support (GL_ARB_timer_query, GL_EXT_disjoint_timer_query)
 
         float maxAnisotropyLevel = 0;               ///< Maximum anisotropy level supported (minimum is 2.0f)
         int maxDepthBits         = 0;               ///< Maximum bits for depth component
@@ -0,0 +1,162 @@
+#ifndef RLGL_GPU_PROFILER_HPP
+#define RLGL_GPU_PROFILER_HPP
+
+#include "./rlConfig.hpp"
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <deque>
+
+namespace rlgl {
+
+    // GPU time spent in a named region of a frame
+
+    struct GpuProfileScope
+    {
+        std::string name;                   ///< Region name
+        int depth               = 0;        ///< Nesting level (0 for the outermost regions)
+        uint64_t start          = 0;        ///< Start time relative to the frame start (in nanoseconds)
+        uint64_t duration       = 0;        ///< GPU time of the region (in nanoseconds)
+    };
+
+    // GPU times of a profiled frame
+
+    struct GpuProfileFrame
+    {
+        uint64_t index          = 0;        ///< Frame index (counted from the profiler creation)
+        uint64_t timestamp      = 0;        ///< GPU timestamp of the frame start (in nanoseconds)
+        uint64_t duration       = 0;        ///< GPU time between BeginFrame() and EndFrame() (in nanoseconds)
+        std::vector<GpuProfileScope> scopes;    ///< Regions of the frame, in begin order
+    };
+
+    // GPU profiler (timestamp queries)
+    // NOTE: Every region records a GPU timestamp when it begins and when it ends (glQueryCounter), so regions
+    // can be nested, which time elapsed queries do not allow. Queries of a frame are read a few frames later,
+    // once they are available, so the profiler never waits for the GPU; frames still pending when their query
+    // pool is needed again are dropped. The profiler registers itself to the context and every render batch
+    // draw is measured as a "RenderBatch" region. Supported on OpenGL 3.3 and OpenGL ES with
+    // GL_EXT_disjoint_timer_query (results of disjoint frames are discarded).
+
+    struct GpuProfiler
+    {
+      public:
+        GpuProfiler(class Context& rlCtx, int latency = RL_DEFAULT_GPU_PROFILER_LATENCY, int historySize = RL_DEFAULT_GPU_PROFILER_HISTORY);
+        ~GpuProfiler();
+
+        GpuProfiler(const GpuProfiler&) = delete;
+        GpuProfiler& operator=(const GpuProfiler&) = delete;
+
+        GpuProfiler(GpuProfiler&& other) noexcept;
+        GpuProfiler& operator=(GpuProfiler&& other) noexcept;
+
+        /**
+         * @brief Check if the profiler is available (timestamp queries are supported).
+         */
+        bool IsReady() const
+        {
+            return ready;
+        }
+
+        /**
+         * @brief Begin profiling a frame.
+         *
+         * Regions are only recorded between BeginFrame() and EndFrame().
+         */
+        void BeginFrame();
+
+        /**
+         * @brief End the current frame and collect the results of the previous frames available on the GPU.
+         *
+         * Regions left open are closed.
+         */
+        void EndFrame();
+
+        /**
+         * @brief Begin a named region, regions can be nested.
+         *
+         * @param name The name of the region.
+         */
+        void BeginScope(const char *name);
+
+        /**
+         * @brief End the last region begun.
+         */
+        void EndScope();
+
+        /**
+         * @brief Get the collected frames, oldest first.
+         *
+         * @return The collected frames (at most the history size).
+         */
+        const std::deque<GpuProfileFrame>& GetFrames() const
+        {
+            return frames;
+        }
+
+        /**
+         * @brief Get the last collected frame.
+         *
+         * @return The last collected frame, nullptr if no frame has been collected yet.
+         */
+        const GpuProfileFrame *GetLastFrame() const
+        {
+            return frames.empty() ? nullptr : &frames.back();
+        }
+
+        /**
+         * @brief Remove the collected frames.
+         */
+        void ClearFrames()
+        {
+            frames.clear();
+        }
+
+        /**
+         * @brief Export the collected frames to the Chrome trace event format.
+         *
+         * The JSON document can be opened by chrome://tracing or Perfetto, times are relative
+         * to the start of the first collected frame.
+         *
+         * @return The JSON trace document.
+         */
+        std::string ExportChromeTrace() const;
+
+      private:
+        struct Scope
+        {
+            std::string name;                   ///< Region name
+            int depth           = 0;            ///< Nesting level
+            int beginQuery      = 0;            ///< Index of the begin timestamp query in the frame pool
+            int endQuery        = -1;           ///< Index of the end timestamp query in the frame pool (-1 while open)
+        };
+
+        struct FrameQueries
+        {
+            std::vector<uint32_t> queries;      ///< Timestamp queries pool (grows with the regions of the frame)
+            int queryCount      = 0;            ///< Queries used by the frame
+            std::vector<Scope> scopes;          ///< Regions of the frame
+            uint64_t index      = 0;            ///< Frame index
+            bool pending        = false;        ///< Frame ended, results not collected yet
+        };
+
+        int RecordTimestamp(FrameQueries& frame);
+        bool CollectFrame(FrameQueries& frame);
+        void Unload();
+
+      private:
+        class Context *rlCtx;                   ///< Context measured by the profiler
+        bool ready;                             ///< Timestamp queries supported
+        int historySize;                        ///< Number of collected frames kept
+
+        std::vector<FrameQueries> pools;        ///< Query pools of the frames in flight
+        std::vector<int> openScopes;            ///< Regions begun and not ended yet (indices in the current frame)
+        uint64_t frameCounter;                  ///< Index of the next frame
+        bool frameActive;                       ///< Between BeginFrame() and EndFrame()
+
+        std::deque<GpuProfileFrame> frames;     ///< Collected frames
+    };
+
+}
+
+#endif //RLGL_GPU_PROFILER_HPP
@@ -0,0 +1,78 @@
+#ifndef RLGL_MIPMAPS_HPP
+#define RLGL_MIPMAPS_HPP
+
+#include "./rlEnums.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace rlgl {
+
+    /**
+     * @brief Get the number of levels of a complete mipmap chain.
+     *
+     * @param width The width of the base level.
+     * @param height The height of the base level.
+     *
+     * @return The number of mipmap levels, base level included.
+     */
+    int GetMipmapCount(int width, int height);
+
+    /**
+     * @brief Get the size of a mipmap chain in bytes.
+     *
+     * Levels are stored one after the other, each level being half the size of the
+     * previous one (minimum 1 pixel), as expected by Context::LoadTexture().
+     *
+     * @param width The width of the base level.
+     * @param height The height of the base level.
+     * @param format The pixel format of the data.
+     * @param mipmapCount The number of levels, base level included.
+     *
+     * @return The size of the mipmap chain data in bytes, 0 if a level is not valid or the size does not fit in an int.
+     */
+    int GetMipmapChainDataSize(int width, int height, PixelFormat format, int mipmapCount);
+
+    /**
+     * @brief Generate a mipmap chain on the CPU.
+     *
+     * This function copies the base level into the destination and computes every following level from the previous one
+     * with a separable filter, rows being processed by multiple threads. Pixels are filtered as floating point RGBA, colors
+     * of 8-bit formats can be converted from sRGB to linear space before filtering (and back after), alpha is always linear.
+     * NPOT sizes are supported, each filter tap is weighted by its coverage of the destination pixel.
+     * Compressed formats are not supported.
+     *
+     * @param data A pointer to the base level pixel data.
+     * @param width The width of the base level.
+     * @param height The height of the base level.
+     * @param format The pixel format of the data.
+     * @param mipmapCount The number of levels to generate, base level included.
+     * @param dest A pointer to the destination memory (at least GetMipmapChainDataSize() bytes).
+     * @param filter The filter used to downsample the levels.
+     * @param srgb If true, color channels of 8-bit formats are filtered in linear space.
+     *
+     * @return True if the mipmap chain was generated, false if the format is not supported.
+     */
+    bool GenMipmapChain(const void *data, int width, int height, PixelFormat format, int mipmapCount, void *dest,
+        MipmapFilter filter = MipmapFilter::Box, bool srgb = false);
+
+    /**
+     * @brief Generate a complete mipmap chain on the CPU.
+     *
+     * The result can be given directly to Context::LoadTexture() with the returned mipmap count.
+     *
+     * @param data A pointer to the base level pixel data.
+     * @param width The width of the base level.
+     * @param height The height of the base level.
+     * @param format The pixel format of the data.
+     * @param mipmapCount Pointer receiving the number of levels generated, base level included.
+     * @param filter The filter used to downsample the levels.
+     * @param srgb If true, color channels of 8-bit formats are filtered in linear space.
+     *
+     * @return A vector containing all the levels, empty if the format is not supported.
+     */
+    std::vector<uint8_t> GenMipmapChain(const void *data, int width, int height, PixelFormat format, int *mipmapCount,
+        MipmapFilter filter = MipmapFilter::Box, bool srgb = false);
+
+}
+
+#endif //RLGL_MIPMAPS_HPP
@@ -0,0 +1,94 @@
+#ifndef RLGL_NULL_GL_HPP
+#define RLGL_NULL_GL_HPP
+
+#include "./rlConfig.hpp"
+#include <cstdint>
+
+#if defined(RLGL_NULL_GL) && !defined(GRAPHICS_API_OPENGL_33)
+    #error "The null GL backend requires the desktop OpenGL loader (GRAPHICS_API_OPENGL_33, GRAPHICS_API_OPENGL_43 or GRAPHICS_API_OPENGL_21)"
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_33)
+
+namespace rlgl {
+
+    // Null GL backend
+    // NOTE: NullGLLoader() resolves every GL function used by rlgl to a function that records the call
+    // and does nothing else: no GL driver or context is needed, so the CPU cost of batching, state tracking
+    // and uploads can be measured and tested alone. The backend emulates what rlgl reads back (object names,
+    // buffer mappings, compile and link status, framebuffer completeness...) and validates the arguments
+    // of the calls against the objects it tracks, errors are returned by glGetError() like a driver does.
+    // Build with RLGL_NULL_GL defined (CMake option RLGL_NULL_GL) to route the GL calls of every context
+    // to the null backend, the loader given to the context is then ignored.
+
+    // Counters of the GL calls received by the null backend
+
+    struct NullGLCounters
+    {
+        uint64_t calls          = 0;        ///< GL calls received
+        uint64_t drawCalls      = 0;        ///< Draw calls (glDrawArrays, glDrawElements and their variants)
+        uint64_t bytesUploaded  = 0;        ///< Bytes sent from CPU memory (buffer and texture data)
+        uint64_t errors         = 0;        ///< Calls with invalid arguments (see glGetError())
+    };
+
+    /**
+     * @brief Callback receiving the command stream of the null backend.
+     *
+     * @param command The call and its arguments (i.e. "glBindBuffer(34962, 3)").
+     * @param userData The user data given to SetNullGLLogCallback().
+     */
+    using NullGLLogCallback = void (*)(const char *command, void *userData);
+
+    /**
+     * @brief Loader of the null backend functions, to give to the context or LoadExtensions().
+     *
+     * @param name The GL function name.
+     * @return The null backend function, nullptr if the function is not used by rlgl.
+     */
+    void *NullGLLoader(const char *name);
+
+    /**
+     * @brief Get the counters of the calls received by the null backend.
+     *
+     * @return The counters since the last reset.
+     */
+    const NullGLCounters& GetNullGLCounters();
+
+    /**
+     * @brief Get the last invalid call received by the null backend.
+     *
+     * @return The function and the validation message (i.e. "glBindBuffer: Object name not generated"),
+     *         an empty string if no invalid call was received since the last reset.
+     */
+    const char *GetNullGLLastError();
+
+    /**
+     * @brief Get the number of calls of a GL function received by the null backend.
+     *
+     * @param function The GL function name (i.e. "glDrawElements").
+     * @return The number of calls since the last reset (0 for unknown functions).
+     */
+    uint64_t GetNullGLCallCount(const char *function);
+
+    /**
+     * @brief Set the callback receiving every call of the null backend with its arguments.
+     *
+     * Calls are only formatted while a callback is set.
+     *
+     * @param callback The callback (nullptr to stop logging).
+     * @param userData The user data given to the callback.
+     */
+    void SetNullGLLogCallback(NullGLLogCallback callback, void *userData = nullptr);
+
+    /**
+     * @brief Reset the counters and the last error of the null backend.
+     *
+     * Objects created through the backend are kept.
+     */
+    void ResetNullGLCounters();
+
+}
+
+#endif  // GRAPHICS_API_OPENGL_33
+
+#endif //RLGL_NULL_GL_HPP
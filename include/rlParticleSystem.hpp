@@ -0,0 +1,161 @@
+#ifndef RLGL_PARTICLE_SYSTEM_HPP
+#define RLGL_PARTICLE_SYSTEM_HPP
+
+#include "./rlConfig.hpp"
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace rlgl {
+
+    // Particle emitter parameters (new particles are randomized in the given ranges)
+
+    struct ParticleEmitter
+    {
+        float position[3]           = { 0.0f, 0.0f, 0.0f };             ///< Emitter position
+        float positionSpread[3]     = { 0.0f, 0.0f, 0.0f };             ///< Random position offset range (+/-)
+        float velocity[3]           = { 0.0f, 1.0f, 0.0f };             ///< Initial velocity
+        float velocitySpread[3]     = { 0.5f, 0.5f, 0.5f };             ///< Random velocity offset range (+/-)
+        float lifeMin               = 1.0f;                             ///< Minimum particle life (in seconds)
+        float lifeMax               = 2.0f;                             ///< Maximum particle life (in seconds)
+        float colorStart[4]         = { 1.0f, 1.0f, 1.0f, 1.0f };       ///< Particle color when emitted
+        float colorEnd[4]           = { 1.0f, 1.0f, 1.0f, 0.0f };       ///< Particle color at the end of its life
+        float sizeStart             = 1.0f;                             ///< Particle size when emitted
+        float sizeEnd               = 0.0f;                             ///< Particle size at the end of its life
+    };
+
+    // GPU particle system (compute shaders, OpenGL 4.3)
+    // NOTE: Particles live in shader storage buffers and never go through the CPU. Every update emits the new
+    // particles after the alive ones, simulates them, then compacts the dead ones away with a prefix sum into
+    // a second buffer (particles keep their order). Dispatch sizes and the draw instance count are written by
+    // the GPU and consumed by indirect dispatches and an indirect instanced draw (camera facing quads).
+
+    struct ParticleSystem
+    {
+      public:
+        ParticleSystem(class Context& rlCtx, int capacity = RL_DEFAULT_PARTICLE_CAPACITY);
+        ~ParticleSystem();
+
+        ParticleSystem(const ParticleSystem&) = delete;
+        ParticleSystem& operator=(const ParticleSystem&) = delete;
+
+        ParticleSystem(ParticleSystem&& other) noexcept;
+        ParticleSystem& operator=(ParticleSystem&& other) noexcept;
+
+        /**
+         * @brief Check if the particle system is loaded (compute shaders are supported).
+         */
+        bool IsReady() const
+        {
+            return ready;
+        }
+
+        /**
+         * @brief Request new particles, they are emitted by the next Update().
+         *
+         * Particles exceeding the capacity are not emitted.
+         *
+         * @param count The number of particles to emit.
+         */
+        void Emit(int count);
+
+        /**
+         * @brief Emit the requested particles, simulate the particles and remove the dead ones.
+         *
+         * @param deltaTime The time step (in seconds).
+         */
+        void Update(float deltaTime);
+
+        /**
+         * @brief Draw the particles with the current modelview and projection matrices.
+         *
+         * The internal render batch is drawn first, blending and depth states are not modified.
+         *
+         * @param textureId The ID of the particle texture (0 for the default white texture).
+         */
+        void Draw(uint32_t textureId = 0);
+
+        void SetEmitter(const ParticleEmitter& emitter)
+        {
+            this->emitter = emitter;
+        }
+
+        const ParticleEmitter& GetEmitter() const
+        {
+            return emitter;
+        }
+
+        void SetGravity(float x, float y, float z)
+        {
+            gravity[0] = x;
+            gravity[1] = y;
+            gravity[2] = z;
+        }
+
+        void SetDrag(float drag)
+        {
+            this->drag = drag;
+        }
+
+        int GetCapacity() const
+        {
+            return capacity;
+        }
+
+        /**
+         * @brief Read the number of alive particles back from the GPU.
+         *
+         * NOTE: This function waits for the GPU, it is meant for debugging and statistics.
+         *
+         * @return The number of alive particles after the last update.
+         */
+        int ReadAliveCount() const;
+
+        /**
+         * @brief Get the shader storage buffer holding the alive particles.
+         *
+         * Particles are stored as two vec4 (position and remaining life, velocity and total life),
+         * the buffer changes after every update.
+         *
+         * @return The ID of the shader storage buffer.
+         */
+        uint32_t GetParticleBuffer() const
+        {
+            return particleBuffers[current];
+        }
+
+      private:
+        void Unload();
+
+      private:
+        class Context *rlCtx;                       ///< Context used to run the shaders
+        int capacity;                               ///< Maximum number of particles
+        bool ready;                                 ///< Particle system loaded
+
+        ParticleEmitter emitter;                    ///< Emitter parameters
+        float gravity[3];                           ///< Acceleration applied to all particles
+        float drag;                                 ///< Velocity damping factor (per second)
+        int pendingEmit;                            ///< Particles to emit on next update
+        uint32_t frameSeed;                         ///< Random seed of the current update
+
+        uint32_t particleBuffers[2];                ///< Particle buffers (alive particles and compaction target)
+        int current;                                ///< Index of the buffer holding the alive particles
+        uint32_t scanBuffer;                        ///< Alive flags and block sums of every scan level
+        uint32_t stateBuffer;                       ///< Counters, indirect draw and dispatch parameters
+        std::vector<uint32_t> scanLevelOffsets;     ///< Offset of every scan level in the scan buffer
+
+        uint32_t prepareProgram;                    ///< Compute program: counts and dispatch sizes
+        uint32_t simulateProgram;                   ///< Compute program: emission, simulation and alive flags
+        uint32_t scanProgram;                       ///< Compute program: block exclusive scan
+        uint32_t addProgram;                        ///< Compute program: block offsets propagation
+        uint32_t scatterProgram;                    ///< Compute program: alive particles compaction
+        uint32_t finalizeProgram;                   ///< Compute program: alive count and draw parameters
+
+        uint32_t drawShader;                        ///< Particle billboard shader
+        uint32_t vaoId;                             ///< Quad vertex array
+        uint32_t quadVboId;                         ///< Quad corners vertex buffer
+    };
+
+}
+
+#endif //RLGL_PARTICLE_SYSTEM_HPP
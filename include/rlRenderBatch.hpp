@@ -2,11 +2,12 @@
 #define RLGL_RENDER_BATCH_HPP
 
 #include "./rlVertexBuffer.hpp"
+#include "./rlFrameStats.hpp"
 #include "./rlConfig.hpp"
 #include "./rlEnums.hpp"
 #include "rlUtils.hpp"
 #include <cstdint>
-#include <queue>
+#include <vector>
 
 namespace rlgl {
 
@@ -32,7 +33,23 @@ namespace rlgl {
         DrawCall(uint32_t _textureId)
             : textureId(_textureId) { }
 
-        void Render(int& vertexOffset);
+        void Render(int& vertexOffset, int instances = 1);   // Instances > 1 used by single-pass stereo
+    };
+
+    // Configuration of the default render batch of a context
+    // NOTE: With auto-tuning the batch buffers are grown when a frame overflows them and shrunk when frames
+    // keep using less than a quarter of them, between minBufferElements and maxBufferElements. Resizing is
+    // done by Context::TuneRenderBatch(), called between frames, never in the middle of a frame.
+
+    struct BatchConfig
+    {
+        int bufferCount         = RL_DEFAULT_BATCH_BUFFERS;             ///< Number of vertex buffers (multi-buffering)
+        int bufferElements      = RL_DEFAULT_BATCH_BUFFER_ELEMENTS;     ///< Elements (quads) per vertex buffer
+        int drawCallsLimit      = RL_DEFAULT_BATCH_DRAWCALLS;           ///< Draw calls queued before the batch is drawn
+
+        bool autoTune           = false;                                ///< Resize the batch from the usage of the frames (see Context::TuneRenderBatch())
+        int minBufferElements   = RL_DEFAULT_BATCH_BUFFER_ELEMENTS/8;   ///< Smallest vertex buffers of the auto-tuning
+        int maxBufferElements   = RL_DEFAULT_BATCH_BUFFER_ELEMENTS*8;   ///< Largest vertex buffers of the auto-tuning (clamped to RL_MAX_BATCH_BUFFER_ELEMENTS)
     };
 
     // Render batch management
@@ -69,7 +86,7 @@ namespace rlgl {
         // NOTE: This problem should change in the future
         DrawCall* NewDrawCall(uint32_t defaultTextureId)
         {
-            drawQueue.emplace(defaultTextureId);
+            drawQueue.emplace_back(defaultTextureId);
             return &drawQueue.back();
         }
 
@@ -97,13 +114,28 @@ namespace rlgl {
             currentDepth += depth;
         }
 
-        void Draw(struct Context& rlCtx);
+        /**
+         * @brief Get the number of elements (quads) of each vertex buffer of the batch.
+         *
+         * Used by the auto-tuning to know the current size of the batch (see Context::TuneRenderBatch()).
+         *
+         * @return The elements per vertex buffer, 0 if the batch has no buffer.
+         */
+        int GetBufferElements() const
+        {
+            return vertexBuffer.empty()? 0 : vertexBuffer.front().elementCount;
+        }
+
+        void Draw(struct Context& rlCtx, FrameStats *stats = nullptr);    // Stats receive the draw calls, vertices, uploads and binds (can be nullptr)
+
+        // WARNING: Vertex buffers are reallocated, the batch must be empty (drawn)
+        void Resize(const class Context& rlCtx, int bufferElements, int drawCallsLimit);
 
       private:
         std::vector<VertexBuffer> vertexBuffer;     ///< Dynamic buffer(s) for vertex data
         int currentBuffer;                          ///< Current buffer tracking in case of multi-buffering
 
-        std::queue<DrawCall> drawQueue;             ///< Draw calls queue, depends on textureId
+        std::vector<DrawCall> drawQueue;            ///< Draw calls queue, depends on textureId (walked once per eye)
         int drawQueueLimit;                         ///< Limit draw calls to the queue
         float currentDepth;                         ///< Current depth value for next draw
     };
@@ -0,0 +1,131 @@
+#ifndef RLGL_RENDER_TARGET_POOL_HPP
+#define RLGL_RENDER_TARGET_POOL_HPP
+
+#include "./rlConfig.hpp"
+#include "./rlEnums.hpp"
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace rlgl {
+
+    // Render target (framebuffer with its attachments)
+
+    struct RenderTarget
+    {
+        uint32_t framebuffer    = 0;                        ///< OpenGL framebuffer object id
+        uint32_t colorTexture   = 0;                        ///< Color attachment texture id
+        uint32_t depthTexture   = 0;                        ///< Depth attachment texture/renderbuffer id (0 if no depth)
+        int width               = 0;                        ///< Render target width
+        int height              = 0;                        ///< Render target height
+        PixelFormat format      = PixelFormat::R8G8B8A8;    ///< Color attachment pixel format
+
+        bool IsValid() const
+        {
+            return framebuffer != 0;
+        }
+    };
+
+    // Render target pool (transient render targets)
+    // NOTE: Targets are keyed by (width, height, format, depth), a target acquired during a frame
+    // is given back to the pool by Release() or automatically at EndFrame(), so the next pass
+    // (or the next frame) requesting the same key reuses it instead of allocating new GL objects.
+    // Targets that were not used for a few frames are unloaded.
+
+    struct RenderTargetPool
+    {
+      public:
+        RenderTargetPool(class Context& rlCtx, int maxUnusedFrames = RL_DEFAULT_TARGET_POOL_UNUSED_FRAMES);
+        ~RenderTargetPool();
+
+        RenderTargetPool(const RenderTargetPool&) = delete;
+        RenderTargetPool& operator=(const RenderTargetPool&) = delete;
+
+        RenderTargetPool(RenderTargetPool&& other) noexcept;
+        RenderTargetPool& operator=(RenderTargetPool&& other) noexcept;
+
+        /**
+         * @brief Acquire a render target from the pool.
+         *
+         * This function returns a free pooled render target matching the requested key, or loads a new one
+         * (framebuffer, color texture and optional depth attachment) if none is available. The target stays
+         * reserved until it is released or until the end of the frame.
+         *
+         * @param width The width of the render target.
+         * @param height The height of the render target.
+         * @param format The pixel format of the color attachment.
+         * @param depth If true, a depth attachment is added (texture if supported, renderbuffer otherwise).
+         *
+         * @return The acquired render target, invalid on failure.
+         */
+        RenderTarget Acquire(int width, int height, PixelFormat format = PixelFormat::R8G8B8A8, bool depth = false);
+
+        /**
+         * @brief Give a render target back to the pool before the end of the frame.
+         *
+         * Once released, the target can be acquired again in the same frame by a pass requesting the same key,
+         * so intermediate targets with non-overlapping lifetimes share the same GPU memory.
+         *
+         * @param target The render target to release.
+         */
+        void Release(const RenderTarget& target);
+
+        /**
+         * @brief Begin a new frame.
+         *
+         * This function releases the targets still acquired and unloads the targets
+         * that have not been used for more than the maximum number of unused frames.
+         */
+        void BeginFrame();
+
+        /**
+         * @brief End the current frame.
+         *
+         * This function releases all the targets acquired during the frame.
+         */
+        void EndFrame();
+
+        /**
+         * @brief Unload all pooled render targets.
+         */
+        void Clear();
+
+        std::size_t GetTargetCount() const
+        {
+            return targets.size();
+        }
+
+        std::size_t GetMemoryUsage() const
+        {
+            return memoryUsage;
+        }
+
+        std::size_t GetPeakMemoryUsage() const
+        {
+            return peakMemoryUsage;
+        }
+
+      private:
+        struct Entry
+        {
+            RenderTarget target;                ///< Pooled render target
+            bool depth          = false;        ///< Render target has a depth attachment
+            bool inUse          = false;        ///< Render target is currently acquired
+            uint64_t lastFrame  = 0;            ///< Last frame the render target was acquired
+            std::size_t size    = 0;            ///< Estimated GPU memory size (in bytes)
+        };
+
+        void UnloadEntry(Entry& entry);
+
+      private:
+        class Context *rlCtx;                   ///< Context used to load and unload targets
+        std::vector<Entry> targets;             ///< Pooled render targets
+        int maxUnusedFrames;                    ///< Number of frames a target can stay unused before being unloaded
+        uint64_t frameCounter;                  ///< Current frame index
+        std::size_t memoryUsage;                ///< Estimated GPU memory of all pooled targets (in bytes)
+        std::size_t peakMemoryUsage;            ///< Highest memory usage reached
+    };
+
+}
+
+#endif //RLGL_RENDER_TARGET_POOL_HPP
@@ -0,0 +1,132 @@
+#ifndef RLGL_SPRITE_BATCH_HPP
+#define RLGL_SPRITE_BATCH_HPP
+
+#include "./rlConfig.hpp"
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace rlgl {
+
+    // Sprite instance (per-instance vertex data, 48 bytes)
+
+    struct SpriteInstance
+    {
+        float x             = 0.0f;                     ///< Sprite position X (location of the origin)
+        float y             = 0.0f;                     ///< Sprite position Y (location of the origin)
+        float width         = 0.0f;                     ///< Sprite width
+        float height        = 0.0f;                     ///< Sprite height
+        float originX       = 0.0f;                     ///< Rotation origin X (relative to the sprite top-left corner)
+        float originY       = 0.0f;                     ///< Rotation origin Y (relative to the sprite top-left corner)
+        float rotation      = 0.0f;                     ///< Rotation around the origin (in degrees)
+        float u0            = 0.0f;                     ///< Left texture coordinate
+        float v0            = 0.0f;                     ///< Top texture coordinate
+        float u1            = 1.0f;                     ///< Right texture coordinate
+        float v1            = 1.0f;                     ///< Bottom texture coordinate
+        uint8_t color[4]    = { 255, 255, 255, 255 };   ///< Sprite tint color (RGBA)
+    };
+
+    // Instanced sprite renderer
+    // NOTE: Sprites are stored as instances and expanded to quads by the vertex shader (one static unit quad
+    // buffer + one per-instance buffer), so each sprite costs one instance write instead of four vertices
+    // transformed on the CPU. Sprites are drawn with the current modelview and projection matrices, the
+    // internal render batch is drawn first to keep the drawing order.
+
+    struct SpriteBatch
+    {
+      public:
+        SpriteBatch(class Context& rlCtx, int capacity = RL_DEFAULT_SPRITE_BATCH_CAPACITY);
+        ~SpriteBatch();
+
+        SpriteBatch(const SpriteBatch&) = delete;
+        SpriteBatch& operator=(const SpriteBatch&) = delete;
+
+        SpriteBatch(SpriteBatch&& other) noexcept;
+        SpriteBatch& operator=(SpriteBatch&& other) noexcept;
+
+        /**
+         * @brief Set the texture of the next sprites.
+         *
+         * Pending sprites are drawn if the texture changes.
+         *
+         * @param id The ID of the texture (0 for the default white texture).
+         */
+        void SetTexture(uint32_t id);
+
+        /**
+         * @brief Add a sprite, pending sprites are drawn first if the batch is full.
+         *
+         * @param sprite The sprite instance.
+         */
+        void Draw(const SpriteInstance& sprite);
+
+        /**
+         * @brief Add an array of sprites, pending sprites are drawn every time the batch is full.
+         *
+         * @param sprites The sprite instances.
+         * @param count The number of sprites.
+         */
+        void Draw(const SpriteInstance *sprites, int count);
+
+        /**
+         * @brief Draw the pending sprites with one instanced draw call.
+         */
+        void Flush();
+
+        /**
+         * @brief Set the shader used to draw the sprites.
+         *
+         * The shader must be compiled with the vertex shader of GetVertexShaderCode() (same attribute names).
+         *
+         * @param shaderId The ID of the shader, 0 to use the default sprite shader.
+         */
+        void SetShader(uint32_t shaderId);
+
+        /**
+         * @brief Get the GLSL code of the default sprite vertex shader (GLSL 330 or GLSL 100).
+         *
+         * @return The vertex shader code, it outputs fragTexCoord and fragColor as the default shader.
+         */
+        static const char *GetVertexShaderCode();
+
+        int GetSpriteCount() const
+        {
+            return static_cast<int>(instances.size());
+        }
+
+        int GetCapacity() const
+        {
+            return capacity;
+        }
+
+        uint64_t GetDrawCallCount() const
+        {
+            return drawCalls;
+        }
+
+      private:
+        void LoadShader(uint32_t shaderId);
+        void BindAttributes() const;
+
+      private:
+        class Context *rlCtx;                           ///< Context used to draw the sprites
+        std::vector<SpriteInstance> instances;          ///< Pending sprite instances
+        int capacity;                                   ///< Maximum number of sprites per draw call
+        uint32_t textureId;                             ///< Texture of the pending sprites
+
+        uint32_t defaultShaderId;                       ///< Default sprite shader
+        uint32_t shaderId;                              ///< Current sprite shader
+        int locMVP;                                     ///< Shader location: model-view-projection matrix
+        int locColor;                                   ///< Shader location: diffuse color
+        int locTexture;                                 ///< Shader location: texture sampler
+        int locAttribs[5];                              ///< Shader locations: corner, rect, transform, texcoords and color attributes
+
+        uint32_t vaoId;                                 ///< Vertex array object (0 if not supported)
+        uint32_t quadVboId;                             ///< Unit quad vertex buffer (static)
+        uint32_t instanceVboId;                         ///< Instance vertex buffer (streamed)
+        uint64_t drawCalls;                             ///< Number of instanced draw calls issued
+    };
+
+}
+
+#endif //RLGL_SPRITE_BATCH_HPP
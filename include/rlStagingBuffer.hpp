@@ -0,0 +1,225 @@
+#ifndef RLGL_STAGING_BUFFER_HPP
+#define RLGL_STAGING_BUFFER_HPP
+
+#include "./rlConfig.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace rlgl {
+
+    // Upload staging buffers (ring of pixel unpack buffers)
+    // NOTE: Every upload maps the next buffer of the ring, so the CPU always writes into a buffer
+    // that is not being read by a previous transfer, the GL copy from the buffer is asynchronous
+
+    struct UploadBuffer
+    {
+      public:
+        UploadBuffer(int numBuffers = RL_DEFAULT_UPLOAD_BUFFERS);
+        ~UploadBuffer();
+
+        UploadBuffer(const UploadBuffer&) = delete;
+        UploadBuffer& operator=(const UploadBuffer&) = delete;
+
+        UploadBuffer(UploadBuffer&& other) noexcept;
+        UploadBuffer& operator=(UploadBuffer&& other) noexcept;
+
+        /**
+         * @brief Map the next staging buffer of the ring for writing.
+         *
+         * This function selects the next buffer of the ring, orphans its previous storage
+         * (so the driver does not have to wait for a pending transfer) and maps it for writing.
+         * On OpenGL ES 2.0 pixel buffers are not available, a CPU memory block is returned instead.
+         *
+         * @param size The number of bytes required.
+         * @return A pointer to the mapped staging memory, nullptr on failure.
+         */
+        void *Map(uint32_t size);
+
+        /**
+         * @brief Unmap the currently mapped staging buffer.
+         *
+         * After this call the staging buffer stays bound to GL_PIXEL_UNPACK_BUFFER, so the
+         * pixel pointer to give to glTexSubImage2D() is the one returned by GetPixels().
+         *
+         * @return True if the staging data is valid, false if it was corrupted while mapped.
+         */
+        bool Unmap();
+
+        /**
+         * @brief Unbind the staging buffer from GL_PIXEL_UNPACK_BUFFER.
+         */
+        void Unbind() const;
+
+        /**
+         * @brief Get the pixel pointer to pass to the GL upload function.
+         *
+         * It is an offset (zero) into the bound pixel unpack buffer, or a pointer
+         * to the CPU memory block when pixel buffers are not available.
+         *
+         * @return Pixel pointer to use for the GL copy.
+         */
+        const void *GetPixels() const;
+
+        bool IsMapped() const
+        {
+            return mapped != nullptr;
+        }
+
+        int GetBufferCount() const
+        {
+            return static_cast<int>(pboId.size());
+        }
+
+      private:
+        std::vector<uint32_t> pboId;        ///< OpenGL pixel unpack buffer objects id
+        std::vector<uint32_t> pboSize;      ///< Allocated size of each buffer object (in bytes)
+        std::vector<uint8_t> memory;        ///< CPU staging memory (fallback without pixel buffers)
+        int currentBuffer;                  ///< Current buffer of the ring
+        void *mapped;                       ///< Currently mapped pointer (nullptr if not mapped)
+    };
+
+    struct ReadbackBuffer;
+
+    // Handle to an asynchronous readback (future-like)
+    // NOTE: The handle refers to a slot of a ReadbackBuffer ring, once the ring wrapped around
+    // and reused the slot for a newer readback the handle becomes invalid (result dropped)
+
+    struct Readback
+    {
+      public:
+        Readback() = default;
+
+        /**
+         * @brief Check if the handle still refers to a pending readback.
+         *
+         * @return True if the result can still be resolved, false if it was already
+         * resolved, never requested or dropped by a newer readback using the same slot.
+         */
+        bool IsValid() const;
+
+        /**
+         * @brief Check if the GPU finished writing the readback data (non-blocking).
+         *
+         * This function only polls the fence of the readback, it never waits for the GPU.
+         *
+         * @return True if the data is available and Resolve() will not stall.
+         */
+        bool IsReady() const;
+
+        /**
+         * @brief Copy the readback data to the destination memory and release the slot.
+         *
+         * If the GPU did not finish yet, this function waits for it (prefer to check IsReady() first),
+         * up to RL_READBACK_FENCE_TIMEOUT milliseconds. Destination memory must hold at least GetDataSize() bytes.
+         *
+         * @param dest Pointer to the destination memory.
+         * @return True if the data was copied, false if the handle is not valid or the wait timed out.
+         */
+        bool Resolve(void *dest);
+
+        /**
+         * @brief Copy the readback data into a new vector and release the slot.
+         *
+         * @return The readback data, empty if the handle is not valid or the wait timed out.
+         */
+        std::vector<uint8_t> Resolve();
+
+        int GetWidth() const;
+        int GetHeight() const;
+        uint32_t GetDataSize() const;
+
+      private:
+        friend struct ReadbackBuffer;
+
+        ReadbackBuffer *owner = nullptr;    ///< Readback buffer ring owning the slot
+        int slot = -1;                      ///< Slot of the ring holding the data
+        uint32_t serial = 0;                ///< Serial of the readback (detects slot reuse)
+    };
+
+    // Readback staging buffers (ring of pixel pack buffers with fences)
+    // NOTE: Every readback (pixels or buffer range) writes into the next buffer of the ring and inserts a fence after the copy,
+    // with N buffers the data of the frame N-1 or N-2 can be mapped without stalling the pipeline
+
+    struct ReadbackBuffer
+    {
+      public:
+        ReadbackBuffer(int numBuffers = RL_DEFAULT_READBACK_BUFFERS);
+        ~ReadbackBuffer();
+
+        ReadbackBuffer(const ReadbackBuffer&) = delete;
+        ReadbackBuffer& operator=(const ReadbackBuffer&) = delete;
+
+        ReadbackBuffer(ReadbackBuffer&&) = delete;              ///< Handles keep a pointer to the ring
+        ReadbackBuffer& operator=(ReadbackBuffer&&) = delete;
+
+        /**
+         * @brief Read pixels from the current read framebuffer into the next buffer of the ring.
+         *
+         * This function issues glReadPixels() into a pixel pack buffer and returns immediately.
+         * On OpenGL ES 2.0 pixel buffers are not available, the read is done synchronously.
+         *
+         * @param x The X-axis coordinate of the lower left corner to read.
+         * @param y The Y-axis coordinate of the lower left corner to read.
+         * @param width The width of the area to read.
+         * @param height The height of the area to read.
+         * @param glFormat The OpenGL pixel format of the data (i.e. GL_RGBA).
+         * @param glType The OpenGL pixel type of the data (i.e. GL_UNSIGNED_BYTE).
+         * @param pixelSize The size of a pixel in bytes for the given format and type.
+         * @param flipY If true, rows are flipped on resolve (top-left origin).
+         * @param opaque If true, alpha is forced to 255 on resolve (8-bit RGBA only).
+         *
+         * @return The handle of the readback.
+         */
+        Readback ReadPixels(int x, int y, int width, int height, uint32_t glFormat, uint32_t glType, int pixelSize, bool flipY, bool opaque);
+
+        /**
+         * @brief Copy a range of a buffer object into the next buffer of the ring.
+         *
+         * This function issues glCopyBufferSubData() into the staging buffer and returns immediately,
+         * the handle reports a width of the range size in bytes and a height of 1.
+         * Buffer copies require OpenGL 3.3 or OpenGL ES 3.0, an invalid handle is returned otherwise.
+         *
+         * @param bufferId The ID of the buffer object to read from (any target).
+         * @param offset The offset of the range in bytes.
+         * @param size The size of the range in bytes.
+         *
+         * @return The handle of the readback, invalid on failure.
+         */
+        Readback ReadBuffer(uint32_t bufferId, uint32_t offset, uint32_t size);
+
+        int GetBufferCount() const
+        {
+            return static_cast<int>(slots.size());
+        }
+
+      private:
+        friend struct Readback;
+
+        struct Slot
+        {
+            uint32_t pboId      = 0;        ///< OpenGL pixel pack buffer object id
+            uint32_t capacity   = 0;        ///< Allocated size of the buffer object (in bytes)
+            void *fence         = nullptr;  ///< Fence inserted after the copy (GLsync)
+            uint32_t serial     = 0;        ///< Serial of the pending readback (0 if none)
+            int width           = 0;        ///< Width of the read area
+            int height          = 0;        ///< Height of the read area
+            int rowSize         = 0;        ///< Size of a row in bytes
+            bool flipY          = false;    ///< Flip rows on resolve
+            bool opaque         = false;    ///< Force alpha to 255 on resolve
+            std::vector<uint8_t> memory;    ///< CPU memory (fallback without pixel buffers)
+        };
+
+        Readback Push(int width, int height, int rowSize, bool flipY, bool opaque);
+        bool Poll(int slot, uint32_t serial) const;
+        bool Resolve(int slot, uint32_t serial, void *dest);
+        void Release(int slot);
+
+      private:
+        std::vector<Slot> slots;            ///< Ring of readback slots
+        int currentSlot;                    ///< Last used slot of the ring
+        uint32_t serialCounter;             ///< Serial given to the last readback
+    };
+
+}
+
+#endif //RLGL_STAGING_BUFFER_HPP
@@ -0,0 +1,173 @@
+#ifndef RLGL_TEXTURE_ATLAS_HPP
+#define RLGL_TEXTURE_ATLAS_HPP
+
+#include "./rlConfig.hpp"
+#include "./rlEnums.hpp"
+#include <unordered_map>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace rlgl {
+
+    // Texture atlas region (location of an image in the atlas)
+
+    struct AtlasRegion
+    {
+        uint32_t textureId      = 0;                        ///< Atlas page texture id (0 if not found)
+        int x                   = 0;                        ///< Region X position in the page (in pixels, padding excluded)
+        int y                   = 0;                        ///< Region Y position in the page (in pixels, padding excluded)
+        int width               = 0;                        ///< Region width
+        int height              = 0;                        ///< Region height
+        float u0                = 0.0f;                     ///< Left texture coordinate
+        float v0                = 0.0f;                     ///< Top texture coordinate
+        float u1                = 0.0f;                     ///< Right texture coordinate
+        float v1                = 0.0f;                     ///< Bottom texture coordinate
+
+        bool IsValid() const
+        {
+            return textureId != 0;
+        }
+    };
+
+    // Dynamic texture atlas (glyphs, icons and sprites)
+    // NOTE: Images are packed into page textures with a skyline bottom-left packer and uploaded through the
+    // upload staging buffers, so many small images can be drawn from a few textures without breaking batches.
+    // Images are referenced by a user key (glyph code and size, icon id...). A skyline cannot reuse the space
+    // of a single image, so when every page is full the least recently used page not used during the current
+    // frame is cleared and its images have to be inserted again.
+
+    struct TextureAtlas
+    {
+      public:
+        TextureAtlas(class Context& rlCtx, int pageSize = RL_DEFAULT_ATLAS_PAGE_SIZE, int maxPages = RL_DEFAULT_ATLAS_MAX_PAGES,
+            PixelFormat format = PixelFormat::R8G8B8A8, int padding = RL_DEFAULT_ATLAS_PADDING);
+        ~TextureAtlas();
+
+        TextureAtlas(const TextureAtlas&) = delete;
+        TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+        TextureAtlas(TextureAtlas&& other) noexcept;
+        TextureAtlas& operator=(TextureAtlas&& other) noexcept;
+
+        /**
+         * @brief Insert an image in the atlas.
+         *
+         * The image is packed in the first page it fits in, a new page is loaded if none has room, then the least
+         * recently used page is cleared. The image edges are repeated in the padding to avoid filtering bleeding.
+         * If the key is already in the atlas, its region is returned and the image is not uploaded.
+         *
+         * @param key The user key of the image.
+         * @param width The width of the image.
+         * @param height The height of the image.
+         * @param pixels The pixels of the image, in the atlas pixel format.
+         *
+         * @return The region of the image, not valid if the image does not fit.
+         */
+        AtlasRegion Insert(uint64_t key, int width, int height, const void *pixels);
+
+        /**
+         * @brief Find an image and mark it as used during the current frame.
+         *
+         * Pages with images used during the current frame are never cleared.
+         *
+         * @param key The user key of the image.
+         *
+         * @return The region of the image, not valid if the image is not in the atlas.
+         */
+        AtlasRegion Find(uint64_t key);
+
+        /**
+         * @brief Remove an image from the atlas.
+         *
+         * The space is reclaimed once all the images of the page are removed.
+         *
+         * @param key The user key of the image.
+         */
+        void Remove(uint64_t key);
+
+        /**
+         * @brief End the current frame.
+         */
+        void EndFrame();
+
+        /**
+         * @brief Remove all the images and unload all the pages.
+         */
+        void Clear();
+
+        bool Contains(uint64_t key) const
+        {
+            return (entries.find(key) != entries.end());
+        }
+
+        int GetPageCount() const
+        {
+            return static_cast<int>(pages.size());
+        }
+
+        uint32_t GetPageTexture(int index) const
+        {
+            return ((index >= 0) && (index < static_cast<int>(pages.size())))? pages[index].textureId : 0;
+        }
+
+        int GetPageSize() const
+        {
+            return pageSize;
+        }
+
+        int GetEntryCount() const
+        {
+            return static_cast<int>(entries.size());
+        }
+
+        uint64_t GetEvictionCount() const
+        {
+            return evictionCount;
+        }
+
+        float GetOccupancy() const;                         // Get ratio of the page area used by images (padding included)
+
+      private:
+        struct SkylineNode
+        {
+            int x       = 0;                                ///< Segment start
+            int y       = 0;                                ///< Segment height
+            int width   = 0;                                ///< Segment width
+        };
+
+        struct Page
+        {
+            uint32_t textureId      = 0;                    ///< Page texture id
+            std::vector<SkylineNode> skyline;               ///< Skyline segments (sorted by x)
+            int entryCount          = 0;                    ///< Number of images in the page
+            std::size_t usedArea    = 0;                    ///< Area of the images in the page (in pixels)
+            uint64_t lastFrame      = 0;                    ///< Last frame an image of the page was used
+        };
+
+        struct Entry
+        {
+            int page                = 0;                    ///< Page index
+            AtlasRegion region;                             ///< Image region
+        };
+
+        bool PackRect(Page& page, int width, int height, int *x, int *y);
+        int FindSkylinePosition(const Page& page, int index, int width, int height) const;
+        void ResetPage(int index);
+
+      private:
+        class Context *rlCtx;                               ///< Context used to load and update the pages
+        std::vector<Page> pages;                            ///< Atlas pages
+        std::unordered_map<uint64_t, Entry> entries;        ///< Images of the atlas by key
+        std::vector<uint8_t> uploadBuffer;                  ///< Padded image pixels
+        PixelFormat format;                                 ///< Pages pixel format (uncompressed)
+        int pageSize;                                       ///< Pages width and height
+        int maxPages;                                       ///< Maximum number of pages
+        int padding;                                        ///< Padding around the images (in pixels)
+        uint64_t frameCounter;                              ///< Current frame index
+        uint64_t evictionCount;                             ///< Number of pages cleared to make room
+    };
+
+}
+
+#endif //RLGL_TEXTURE_ATLAS_HPP
@@ -0,0 +1,142 @@
+#ifndef RLGL_TEXTURE_FILE_HPP
+#define RLGL_TEXTURE_FILE_HPP
+
+#include "./rlEnums.hpp"
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace rlgl {
+
+    // Texture container file (KTX2 or DDS)
+    // NOTE: The file is memory mapped and only the headers are parsed, the level pointers refer directly
+    // to the mapping so pages are read from disk when the driver copies them (no intermediate copy).
+    // Mapped pages belong to the file cache, the memory is given back to the system by Unload().
+
+    struct TextureFile
+    {
+      public:
+        TextureFile() = default;
+        TextureFile(const char *fileName);
+        ~TextureFile();
+
+        TextureFile(const TextureFile&) = delete;
+        TextureFile& operator=(const TextureFile&) = delete;
+
+        TextureFile(TextureFile&& other) noexcept;
+        TextureFile& operator=(TextureFile&& other) noexcept;
+
+        /**
+         * @brief Map a texture container file and parse its headers.
+         *
+         * Supported containers are KTX2 (2D textures without supercompression) and DDS (2D textures,
+         * FourCC DXT1/DXT3/DXT5, DX10 header and uncompressed RGB/luminance layouts). Formats are mapped
+         * to the closest PixelFormat, sRGB formats are loaded as their linear equivalent (see IsSrgb()).
+         * DDS files storing BGR(A) pixels are converted on load, this is the only case where pixels are copied.
+         *
+         * @param fileName The path of the file.
+         *
+         * @return True if the file was loaded, false on failure (previous content is unloaded).
+         */
+        bool Load(const char *fileName);
+
+        /**
+         * @brief Parse a texture container from memory.
+         *
+         * The memory is not copied and must stay valid as long as the texture file is used.
+         *
+         * @param data A pointer to the file content.
+         * @param size The size of the file content in bytes.
+         *
+         * @return True if the content was parsed, false on failure.
+         */
+        bool LoadFromMemory(const void *data, size_t size);
+
+        /**
+         * @brief Unmap the file and reset the texture file.
+         */
+        void Unload();
+
+        bool IsValid() const
+        {
+            return !levels.empty();
+        }
+
+        int GetWidth() const
+        {
+            return width;
+        }
+
+        int GetHeight() const
+        {
+            return height;
+        }
+
+        PixelFormat GetFormat() const
+        {
+            return format;
+        }
+
+        int GetMipmapCount() const
+        {
+            return static_cast<int>(levels.size());
+        }
+
+        bool IsSrgb() const
+        {
+            return srgb;
+        }
+
+        /**
+         * @brief Get the data pointers of all the mipmap levels.
+         *
+         * The array can be used as TextureDesc::levels to load the texture with Context::LoadTextures().
+         *
+         * @return A pointer to the array of level data pointers, base level first (nullptr if not valid).
+         */
+        const void *const *GetLevels() const
+        {
+            return levels.empty()? nullptr : levels.data();
+        }
+
+        /**
+         * @brief Get the data of a mipmap level.
+         *
+         * @param level The mipmap level, 0 being the base level.
+         *
+         * @return A pointer to the level data, nullptr if the level does not exist.
+         */
+        const void *GetLevelData(int level) const;
+
+        /**
+         * @brief Get the size of a mipmap level.
+         *
+         * @param level The mipmap level, 0 being the base level.
+         *
+         * @return The size of the level data in bytes, 0 if the level does not exist.
+         */
+        uint32_t GetLevelSize(int level) const;
+
+      private:
+        bool ParseKTX2(const uint8_t *data, size_t size);
+        bool ParseDDS(const uint8_t *data, size_t size);
+        bool ConvertDDS(const uint8_t *data, size_t size, size_t offset, int levelCount, int bitCount, const uint32_t masks[4]);
+        bool SetLevels(const uint8_t *data, size_t size, size_t offset, int levelCount);
+
+      private:
+        void *mapped            = nullptr;                  ///< Mapped file memory (nullptr if not mapped)
+        size_t mappedSize       = 0;                        ///< Size of the mapping in bytes
+
+        std::vector<const void*> levels;                    ///< Data of each mipmap level, base level first
+        std::vector<uint32_t> levelSizes;                   ///< Size of each mipmap level (in bytes)
+        std::vector<uint8_t> converted;                     ///< Converted pixels (DDS BGR(A) layouts only)
+
+        int width               = 0;                        ///< Base level width
+        int height              = 0;                        ///< Base level height
+        PixelFormat format      = PixelFormat::R8G8B8A8;    ///< Pixel format of the data
+        bool srgb               = false;                    ///< Data is stored in an sRGB format
+    };
+
+}
+
+#endif //RLGL_TEXTURE_FILE_HPP
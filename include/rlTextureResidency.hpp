@@ -0,0 +1,194 @@
+#ifndef RLGL_TEXTURE_RESIDENCY_HPP
+#define RLGL_TEXTURE_RESIDENCY_HPP
+
+#include "./rlConfig.hpp"
+#include "./rlEnums.hpp"
+#include <functional>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace rlgl {
+
+    // Texture residency manager (texture memory budget)
+    // NOTE: Textures are referenced by handles because their OpenGL id changes when top mipmap levels
+    // are dropped and becomes 0 when they are evicted. When the memory usage exceeds the budget, textures
+    // not used during the current frame lose their top levels first (if supported), least recently used
+    // first, then are evicted in the same order. Evicted textures have to be reloaded with Reload().
+
+    struct TextureResidency
+    {
+      public:
+        using RemapCallback = std::function<void(uint32_t handle, uint32_t oldId, uint32_t newId)>;
+
+        TextureResidency(class Context& rlCtx, std::size_t budget = RL_DEFAULT_TEXTURE_BUDGET,
+            int maxDroppedLevels = RL_DEFAULT_TEXTURE_DROPPED_LEVELS);
+        ~TextureResidency();
+
+        TextureResidency(const TextureResidency&) = delete;
+        TextureResidency& operator=(const TextureResidency&) = delete;
+
+        TextureResidency(TextureResidency&& other) noexcept;
+        TextureResidency& operator=(TextureResidency&& other) noexcept;
+
+        /**
+         * @brief Load a texture and track its memory.
+         *
+         * Least recently used textures are trimmed or evicted beforehand if the texture does not fit in the budget.
+         *
+         * @param desc The description of the texture (see Context::LoadTexture()).
+         *
+         * @return The handle of the texture, 0 on failure.
+         */
+        uint32_t Load(const struct TextureDesc& desc);
+
+        /**
+         * @brief Load a texture from a texture file and track its memory.
+         *
+         * @param file The texture file (see TextureFile::Load()).
+         *
+         * @return The handle of the texture, 0 on failure.
+         */
+        uint32_t Load(const struct TextureFile& file);
+
+        /**
+         * @brief Track the memory of an already loaded texture.
+         *
+         * The residency manager takes ownership of the texture, it is unloaded when evicted.
+         *
+         * @param id The OpenGL id of the texture.
+         * @param width The width of the texture base level.
+         * @param height The height of the texture base level.
+         * @param format The pixel format of the texture.
+         * @param mipmapCount The number of mipmap levels of the texture.
+         *
+         * @return The handle of the texture, 0 if the id is not valid.
+         */
+        uint32_t Register(uint32_t id, int width, int height, PixelFormat format, int mipmapCount);
+
+        /**
+         * @brief Load again an evicted or trimmed texture.
+         *
+         * The current texture (if any) is replaced, the remap callback is called with the new id.
+         *
+         * @param handle The handle of the texture.
+         * @param desc The description of the texture to load.
+         *
+         * @return True if the texture was loaded.
+         */
+        bool Reload(uint32_t handle, const struct TextureDesc& desc);
+
+        /**
+         * @brief Unload a texture and release its handle.
+         *
+         * @param handle The handle of the texture.
+         */
+        void Unload(uint32_t handle);
+
+        /**
+         * @brief Get the OpenGL id of a texture used in the current frame.
+         *
+         * Textures used during the current frame are never trimmed nor evicted.
+         *
+         * @param handle The handle of the texture.
+         *
+         * @return The OpenGL id of the texture, 0 if it is evicted.
+         */
+        uint32_t Use(uint32_t handle);
+
+        /**
+         * @brief End the current frame.
+         *
+         * This function trims and evicts textures until the memory usage fits in the budget.
+         */
+        void EndFrame();
+
+        /**
+         * @brief Unload all the textures and release all the handles.
+         */
+        void Clear();
+
+        /**
+         * @brief Set the callback called when the OpenGL id of a texture changes.
+         *
+         * It is called when top levels are dropped, when a texture is evicted (new id is 0) and reloaded.
+         *
+         * @param callback The callback, it receives the handle, the old id and the new id.
+         */
+        void SetRemapCallback(RemapCallback callback);
+
+        /**
+         * @brief Set the texture memory budget.
+         *
+         * @param budget The budget in bytes, textures are trimmed or evicted at the end of the frame if needed.
+         */
+        void SetBudget(std::size_t budget);
+
+        uint32_t GetTextureId(uint32_t handle) const;           // Get texture id without marking it as used (0 if evicted)
+        bool IsResident(uint32_t handle) const;                 // Check if a texture is loaded in GPU memory
+        int GetDroppedLevels(uint32_t handle) const;            // Get number of top mipmap levels dropped from a texture
+
+        std::size_t GetBudget() const
+        {
+            return budget;
+        }
+
+        std::size_t GetMemoryUsage() const
+        {
+            return memoryUsage;
+        }
+
+        std::size_t GetPeakMemoryUsage() const
+        {
+            return peakMemoryUsage;
+        }
+
+        int GetTextureCount() const
+        {
+            return static_cast<int>(textures.size() - freeHandles.size());
+        }
+
+        int GetResidentCount() const;
+
+        uint64_t GetEvictionCount() const
+        {
+            return evictionCount;
+        }
+
+      private:
+        struct Entry
+        {
+            uint32_t id         = 0;                        ///< OpenGL texture id (0 if evicted)
+            int width           = 0;                        ///< Current base level width
+            int height          = 0;                        ///< Current base level height
+            PixelFormat format  = PixelFormat::R8G8B8A8;    ///< Texture pixel format
+            int mipmapCount     = 1;                        ///< Current number of mipmap levels
+            int droppedLevels   = 0;                        ///< Number of top mipmap levels dropped
+            uint64_t lastFrame  = 0;                        ///< Last frame the texture was used
+            std::size_t size    = 0;                        ///< GPU memory size (in bytes)
+            bool registered     = false;                    ///< Handle is in use
+        };
+
+        Entry *GetEntry(uint32_t handle);
+        const Entry *GetEntry(uint32_t handle) const;
+        uint32_t AddEntry(uint32_t id, int width, int height, PixelFormat format, int mipmapCount);
+        void MakeRoom(std::size_t size);
+        bool DropTopLevel(uint32_t handle);
+        void Evict(uint32_t handle);
+
+      private:
+        class Context *rlCtx;                   ///< Context used to load and unload textures
+        std::vector<Entry> textures;            ///< Tracked textures (handle is index + 1)
+        std::vector<uint32_t> freeHandles;      ///< Released handles
+        RemapCallback remapCallback;            ///< Called when the id of a texture changes
+        std::size_t budget;                     ///< Texture memory budget (in bytes)
+        int maxDroppedLevels;                   ///< Maximum number of top levels dropped before evicting a texture
+        uint64_t frameCounter;                  ///< Current frame index
+        uint64_t evictionCount;                 ///< Number of textures evicted
+        std::size_t memoryUsage;                ///< Memory of all resident textures (in bytes)
+        std::size_t peakMemoryUsage;            ///< Highest memory usage reached
+    };
+
+}
+
+#endif //RLGL_TEXTURE_RESIDENCY_HPP
@@ -0,0 +1,88 @@
+#ifndef RLGL_TRACE_HPP
+#define RLGL_TRACE_HPP
+
+#include "./rlConfig.hpp"
+#include <cstdint>
+#include <string>
+
+// Trace zones (removed unless RLGL_ENABLE_TRACING is defined)
+// NOTE: The zone name must be a string literal, only its pointer is stored
+#if defined(RLGL_ENABLE_TRACING)
+    #define RLGL_TRACE_CONCAT_INNER(a, b) a##b
+    #define RLGL_TRACE_CONCAT(a, b) RLGL_TRACE_CONCAT_INNER(a, b)
+    #define RLGL_TRACE_ZONE(name) rlgl::TraceZone RLGL_TRACE_CONCAT(rlTraceZone, __LINE__)(name)
+#else
+    #define RLGL_TRACE_ZONE(name) (void)0
+#endif
+
+namespace rlgl {
+
+    // CPU tracing
+    // NOTE: Every thread records its zones in its own ring buffer (no locking, the oldest events are
+    // overwritten when full), buffers are kept after their thread exits until the trace is cleared.
+    // Times come from std::chrono::steady_clock, so the trace can be merged with engine traces using
+    // the same clock. Export or clear the trace while the traced threads are not recording.
+
+    /**
+     * @brief Get the current trace time.
+     *
+     * @return The steady clock time (in nanoseconds).
+     */
+    uint64_t GetTraceTime();
+
+    /**
+     * @brief Record a completed zone in the ring buffer of the calling thread.
+     *
+     * @param name The zone name (string literal, only the pointer is stored).
+     * @param start The start time of the zone (in nanoseconds).
+     * @param duration The duration of the zone (in nanoseconds).
+     */
+    void RecordTraceEvent(const char *name, uint64_t start, uint64_t duration);
+
+    /**
+     * @brief Set the name of the calling thread in the trace.
+     *
+     * @param name The thread name.
+     */
+    void SetTraceThreadName(const char *name);
+
+    /**
+     * @brief Export the recorded zones of all threads to the Chrome trace event format.
+     *
+     * Times are written in microseconds of the steady clock, the JSON document can be opened
+     * by chrome://tracing or Perfetto.
+     *
+     * @return The JSON trace document.
+     */
+    std::string ExportTrace();
+
+    /**
+     * @brief Remove the recorded zones of all threads (and the buffers of the exited threads).
+     */
+    void ClearTrace();
+
+    // Scoped trace zone, the zone is recorded when the object is destroyed
+
+    struct TraceZone
+    {
+      public:
+        explicit TraceZone(const char *name)
+        : name(name), start(GetTraceTime())
+        { }
+
+        ~TraceZone()
+        {
+            RecordTraceEvent(name, start, GetTraceTime() - start);
+        }
+
+        TraceZone(const TraceZone&) = delete;
+        TraceZone& operator=(const TraceZone&) = delete;
+
+      private:
+        const char *name;                   ///< Zone name
+        uint64_t start;                     ///< Zone start time (in nanoseconds)
+    };
+
+}
+
+#endif //RLGL_TRACE_HPP
@@ -2,14 +2,33 @@
 #define RLGL_UTILS_HPP
 
 #include "./rlEnums.hpp"
+#include <functional>
+#include <string>
 
 namespace rlgl {
 
+    class Context;
+
     GlVersion GetVersion();  
 
     const char *GetPixelFormatName(PixelFormat format);                                                              // Get current OpenGL version
-    int GetPixelDataSize(int width, int height, PixelFormat format);                                                 // Get pixel data size in bytes (image or texture)
+    int GetPixelDataSize(int width, int height, PixelFormat format);                                                 // Get pixel data size in bytes (image or texture), 0 if not valid or too large
     void GetGlTextureFormats(PixelFormat format, uint32_t *glInternalFormat, uint32_t *glFormat, uint32_t *glType);  // Get OpenGL internal formats
+    uint32_t GetGlSizedInternalFormat(PixelFormat format);                                                           // Get OpenGL sized internal format (0 if none, required by immutable storage)
+
+    void FlipPixelsVertical(void *pixels, int rowSize, int height);                                                 // Flip image rows in place (row swapping, no allocation)
+    void CopyPixelsFlipped(void *dest, const void *src, int rowSize, int height);                                   // Copy image rows in reverse order
+    void SetPixelsOpaque(uint8_t *pixels, int pixelCount);                                                           // Set alpha of R8G8B8A8 pixels to 255 (SIMD when available)
+
+    void ParallelFor(int count, const std::function<void(int begin, int end)>& job, int numThreads = 0);             // Split [0, count) over multiple threads (0: hardware concurrency)
+
+    void AppendJsonString(std::string& json, const char *str);                                                       // Append a string to a JSON document (quoted and escaped)
+
+    void SetUniformInt(Context& rlCtx, uint32_t programId, const char *name, int value);                             // Set an int uniform by name (shader must be enabled)
+
+#   if defined(GRAPHICS_API_OPENGL_43)
+    uint32_t LoadComputeProgram(Context& rlCtx, const char *header, const char *defines, const char *code);          // Compile and link a compute shader from its header, defines and code (0 on failure)
+#   endif
 
 #   if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_SHOW_GL_DETAILS_INFO)
     const char *GetCompressedFormatName(int format); // Get compressed format official GL identifier name
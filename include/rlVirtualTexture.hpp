@@ -0,0 +1,198 @@
+#ifndef RLGL_VIRTUAL_TEXTURE_HPP
+#define RLGL_VIRTUAL_TEXTURE_HPP
+
+#include "./rlStagingBuffer.hpp"
+#include "./rlConfig.hpp"
+#include <condition_variable>
+#include <unordered_map>
+#include <functional>
+#include <cstdint>
+#include <cstddef>
+#include <thread>
+#include <vector>
+#include <mutex>
+
+namespace rlgl {
+
+    // Virtual texture description
+
+    struct VirtualTextureDesc
+    {
+        int width               = 0;                                ///< Virtual texture width (in pixels)
+        int height              = 0;                                ///< Virtual texture height (in pixels)
+        int pageSize            = RL_DEFAULT_VT_PAGE_SIZE;          ///< Page content size (in pixels, without borders)
+        int pageBorder          = RL_DEFAULT_VT_PAGE_BORDER;        ///< Page border size for filtering (in pixels)
+        int cachePages          = RL_DEFAULT_VT_CACHE_PAGES;        ///< Page cache texture size (in pages per side)
+        int feedbackScale       = RL_DEFAULT_VT_FEEDBACK_SCALE;     ///< Feedback buffer downscale relative to the screen
+        int uploadsPerFrame     = RL_DEFAULT_VT_UPLOADS_PER_FRAME;  ///< Maximum number of pages uploaded by Update()
+    };
+
+    // Virtual texture (page streaming)
+    // NOTE: The virtual texture is split into pages for every level, resident pages are stored in a page cache texture
+    // and an indirection texture (one texel per page, one mipmap level per virtual level) maps every page to the closest
+    // resident page. A feedback pass renders the pages required by the visible pixels into a small framebuffer which is
+    // read back asynchronously, missing pages are then loaded by a loader thread and uploaded to the least recently used
+    // cache slots. Shaders sample the virtual texture with the functions of GetShaderCode().
+
+    struct VirtualTexture
+    {
+      public:
+        /**
+         * @brief Page loader, called from the loader thread.
+         *
+         * It fills the R8G8B8A8 pixels of a region of a level, the region includes the page borders so
+         * it can start before the level origin and end after the level size (pixels must be clamped).
+         *
+         * @param level The level of the page (level size is the virtual size divided by 2^level).
+         * @param x The X coordinate of the region in the level (in pixels).
+         * @param y The Y coordinate of the region in the level (in pixels).
+         * @param width The width of the region.
+         * @param height The height of the region.
+         * @param pixels The destination pixels (width*height*4 bytes).
+         *
+         * @return True if the page was loaded, false if the page is not available.
+         */
+        using PageLoader = std::function<bool(int level, int x, int y, int width, int height, uint8_t *pixels)>;
+
+        VirtualTexture(class Context& rlCtx, const VirtualTextureDesc& desc, PageLoader loader);
+        ~VirtualTexture();
+
+        VirtualTexture(const VirtualTexture&) = delete;
+        VirtualTexture& operator=(const VirtualTexture&) = delete;
+
+        VirtualTexture(VirtualTexture&&) = delete;              ///< The loader thread keeps a pointer to the virtual texture
+        VirtualTexture& operator=(VirtualTexture&&) = delete;
+
+        /**
+         * @brief Begin the feedback pass.
+         *
+         * This function binds the feedback framebuffer (the screen size divided by the feedback scale) and clears it,
+         * the scene is then drawn with a shader writing vtFeedback() (see GetShaderCode()) as the fragment color.
+         *
+         * @param screenWidth The width of the screen the virtual texture is rendered to.
+         * @param screenHeight The height of the screen the virtual texture is rendered to.
+         */
+        void BeginFeedback(int screenWidth, int screenHeight);
+
+        /**
+         * @brief End the feedback pass.
+         *
+         * This function binds the default framebuffer back (viewport is set to the framebuffer size) and starts
+         * the asynchronous readback of the feedback, unless the previous one is not processed yet.
+         */
+        void EndFeedback();
+
+        /**
+         * @brief Update the page cache.
+         *
+         * This function processes the feedback readback once available, requests the missing pages to the loader
+         * thread (coarser levels first), uploads the loaded pages and updates the indirection texture.
+         */
+        void Update();
+
+        /**
+         * @brief Set the shader uniforms of the virtual texture.
+         *
+         * The shader must use the code of GetShaderCode(), it is enabled and the page cache and the
+         * indirection textures are activated for the next batch draw (see SetUniformSampler()).
+         *
+         * @param shaderId The ID of the shader.
+         */
+        void SetShaderValues(uint32_t shaderId);
+
+        /**
+         * @brief Get the GLSL code sampling the virtual texture (GLSL 330, GLSL ES 300).
+         *
+         * The code declares the uniforms set by SetShaderValues() and the functions vtSample(uv), returning the
+         * filtered color, and vtFeedback(uv), returning the encoded page to write in the feedback pass.
+         *
+         * @return The GLSL code to insert before the main function of the fragment shaders.
+         */
+        static const char *GetShaderCode();
+
+        uint32_t GetCacheTexture() const
+        {
+            return cacheTexture;
+        }
+
+        uint32_t GetIndirectionTexture() const
+        {
+            return indirectionTexture;
+        }
+
+        int GetLevelCount() const
+        {
+            return levelCount;
+        }
+
+        int GetResidentPageCount() const
+        {
+            return static_cast<int>(pageSlots.size());
+        }
+
+        int GetPendingPageCount() const;
+
+        uint64_t GetUploadedPageCount() const
+        {
+            return uploadedPages;
+        }
+
+      private:
+        struct Slot
+        {
+            uint64_t page       = UINT64_MAX;           ///< Page stored in the slot (UINT64_MAX if free)
+            uint64_t lastFrame  = 0;                    ///< Last frame the page was required
+        };
+
+        struct LoadedPage
+        {
+            uint64_t page       = 0;                    ///< Loaded page
+            std::vector<uint8_t> pixels;                ///< Page pixels (with borders), empty if not available
+        };
+
+        uint64_t GetPageKey(int level, int x, int y) const;
+        void ProcessFeedback(const uint8_t *pixels, int count);
+        void UploadPage(const LoadedPage& loaded);
+        void FillIndirection(int level, int x, int y, uint32_t entry);
+        void LoaderThread();
+
+      private:
+        class Context *rlCtx;                           ///< Context used to load and update the textures
+        VirtualTextureDesc desc;                        ///< Virtual texture description
+        PageLoader loader;                              ///< Page loader callback
+
+        int levelCount;                                 ///< Number of levels (the last one is a single page)
+        int pagesX, pagesY;                             ///< Indirection size (power of two number of pages of the first level)
+        int pageStride;                                 ///< Size of a page with borders (in pixels)
+
+        uint32_t cacheTexture;                          ///< Page cache texture
+        uint32_t indirectionTexture;                    ///< Indirection texture (RGBA: cache slot x, y, page level)
+        std::vector<std::vector<uint32_t>> indirection; ///< Indirection texels of each level
+        std::vector<bool> indirectionDirty;             ///< Indirection levels to upload
+
+        std::vector<Slot> slots;                        ///< Page cache slots
+        std::unordered_map<uint64_t, int> pageSlots;    ///< Cache slot of each resident page
+        uint64_t frameCounter;                          ///< Current frame index
+        uint64_t uploadedPages;                         ///< Number of pages uploaded
+
+        uint32_t feedbackFramebuffer;                   ///< Feedback framebuffer (color and depth)
+        uint32_t feedbackTexture;                       ///< Feedback color attachment
+        int feedbackWidth, feedbackHeight;              ///< Feedback framebuffer size
+        Readback feedbackReadback;                      ///< Pending feedback readback
+        std::vector<uint8_t> feedbackPixels;            ///< Resolved feedback pixels
+        float clearColor[4];                            ///< Clear color saved during the feedback pass
+        bool colorBlend;                                ///< Color blending state saved during the feedback pass
+
+        std::thread thread;                             ///< Page loader thread
+        mutable std::mutex mutex;                       ///< Protects the loader queues
+        std::condition_variable condition;              ///< Wakes up the loader thread
+        std::vector<uint64_t> requests;                 ///< Pages requested to the loader thread
+        std::vector<LoadedPage> loadedPages;            ///< Pages loaded by the loader thread, waiting for upload
+        std::vector<uint64_t> failedPages;              ///< Pages not available (never requested again)
+        uint64_t loadingPage;                           ///< Page being loaded (UINT64_MAX if none)
+        bool stopThread;                                ///< Request the loader thread to exit
+    };
+
+}
+
+#endif //RLGL_VIRTUAL_TEXTURE_HPP
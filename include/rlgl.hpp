@@ -1,7 +1,22 @@
 #ifndef RLGL_HPP
 #define RLGL_HPP
 
+#include "./rlRenderTargetPool.hpp"
+#include "./rlTextureFile.hpp"
+#include "./rlTextureResidency.hpp"
+#include "./rlVirtualTexture.hpp"
+#include "./rlTextureAtlas.hpp"
+#include "./rlSpriteBatch.hpp"
+#include "./rlParticleSystem.hpp"
+#include "./rlComputePrimitives.hpp"
+#include "./rlGpuProfiler.hpp"
+#include "./rlTrace.hpp"
+#include "./rlNullGL.hpp"
+#include "./rlCompression.hpp"
+#include "./rlMipmaps.hpp"
+#include "./rlStagingBuffer.hpp"
 #include "./rlRenderBatch.hpp"
+#include "./rlFrameStats.hpp"
 #include "./rlConfig.hpp"
 #include "./rlEnums.hpp"
 #include "./rlGLExt.hpp"
@@ -12,6 +27,22 @@
 
 namespace rlgl {
 
+    struct FrameCapture;
+
+    // Texture description used to load multiple textures at once
+
+    struct TextureDesc
+    {
+        const void *data        = nullptr;                  ///< Pixel data of all the mipmap levels (can be nullptr)
+        const void *const *levels = nullptr;                ///< Pixel data of each mipmap level, overrides data for non contiguous levels (can be nullptr)
+        int width               = 0;                        ///< Texture base width
+        int height              = 0;                        ///< Texture base height
+        PixelFormat format      = PixelFormat::R8G8B8A8;    ///< Texture pixel format
+        int mipmapCount         = 1;                        ///< Number of mipmap levels in data
+        bool immutable          = true;                     ///< Use immutable storage when supported (glTexStorage2D)
+        bool reserveMipmaps     = false;                    ///< Allocate the complete mipmap chain with immutable storage (for GenTextureMipmaps())
+    };
+
     class Context
     {
       public:
@@ -41,6 +72,9 @@ namespace rlgl {
             const int *currentShaderLocs;                                       ///< Current shader locations pointer to be used on rendering (by default, defaultShaderLocs)
 
             bool stereoRender;                                                  ///< Stereo rendering flag
+            bool stereoSinglePass;                                              ///< Stereo rendering draws both eyes with one instanced draw per draw call
+            uint32_t defaultStereoShaderId;                                     ///< Default single-pass stereo shader program id (loaded on first use)
+            int defaultStereoShaderLocs[RL_MAX_SHADER_LOCATIONS];               ///< Default single-pass stereo shader locations
             Matrix projectionStereo[2];                                         ///< VR stereo rendering eyes projection matrices
             Matrix viewOffsetStereo[2];                                         ///< VR stereo rendering eyes view offset matrices
 
@@ -78,8 +112,9 @@ namespace rlgl {
          * @param width The width of the rendering context.
          * @param height The height of the rendering context.
          * @param extLoader A function pointer to a custom loader that loads OpenGL extensions (optional).
+         * @param config The configuration of the default render batch (optional, see BatchConfig).
          */
-        Context(int width, int height, void *extLoader(const char *) = nullptr);
+        Context(int width, int height, void *extLoader(const char *) = nullptr, const BatchConfig& config = BatchConfig());
 
         /**
          * @brief Destructor for the rendering context.
@@ -727,9 +762,17 @@ namespace rlgl {
         /**
          * @brief Enable stereo rendering mode.
          *
-         * This function enables stereo rendering mode.
+         * This function enables stereo rendering mode, each eye is drawn on one half of the framebuffer.
+         *
+         * In single-pass mode, every batch draw call is issued once with two instances, the vertex shader
+         * selects the eye matrix with gl_InstanceID and clips the vertex to the eye half of the framebuffer.
+         * The default shader is replaced by its stereo variant, custom shaders need a mat4[2] uniform at
+         * location LocMatrixMVPStereo (see GetShaderStereoVertexCode()), the batch falls back to one pass
+         * per eye otherwise. Single-pass stereo requires OpenGL 3.3.
+         *
+         * @param singlePass If true, both eyes are drawn at once (instanced), one pass per eye otherwise.
          */
-        void EnableStereoRender();
+        void EnableStereoRender(bool singlePass = false);
 
         /**
          * @brief Disable stereo rendering mode.
@@ -747,6 +790,16 @@ namespace rlgl {
          */
         bool IsStereoRenderEnabled();
 
+        /**
+         * @brief Get the GLSL code of the default single-pass stereo vertex shader (GLSL 330).
+         *
+         * Custom stereo shaders can start from this code: the eye is gl_InstanceID, the vertex is
+         * transformed by mvpStereo[eye], moved to the eye half of the clip space and clipped with gl_ClipDistance[0].
+         *
+         * @return The vertex shader code, nullptr if single-pass stereo is not supported.
+         */
+        static const char *GetShaderStereoVertexCode();
+
         /**
          * @brief Clear the color buffer with a specified color.
          *
@@ -911,6 +964,26 @@ namespace rlgl {
          */
         bool CheckRenderBatchLimit(int vCount);
 
+        /**
+         * @brief Resize the default render batch from the usage observed since the last call.
+         *
+         * Only done when auto-tuning is enabled in the batch configuration, to be called once per
+         * frame after its last draw. Vertex buffers are grown to hold the vertices the frame had
+         * to flush for lack of space, the draw calls limit is grown the same way, and vertex
+         * buffers are shrunk after RL_BATCH_TUNE_SHRINK_FRAMES frames using less than a quarter
+         * of them. The batch is not resized while it holds vertices not drawn yet.
+         *
+         * @return true if the default render batch was resized, false otherwise.
+         */
+        bool TuneRenderBatch();
+
+        /**
+         * @brief Get the configuration of the default render batch.
+         *
+         * @return The configuration, with the current sizes when auto-tuning resized the batch.
+         */
+        const BatchConfig& GetBatchConfig() const;
+
         /**
          * @brief Set the current texture for the render batch and check buffer limits.
          *
@@ -1083,6 +1156,17 @@ namespace rlgl {
          */
         void DrawVertexArrayElementsInstanced(int offset, int count, const void *buffer, int instances);
 
+        /**
+         * @brief Draw vertex array instanced with the draw parameters read from a GPU buffer.
+         *
+         * The buffer holds a DrawArraysIndirectCommand (count, instanceCount, first, baseInstance) at
+         * the given offset, it can be written by a compute shader (see ComputeShaderBarrier()).
+         *
+         * @param bufferId The ID of the buffer holding the draw parameters.
+         * @param offset The offset of the parameters in the buffer (multiple of 4).
+         */
+        void DrawVertexArrayInstancedIndirect(uint32_t bufferId, uint32_t offset);
+
         /* Textures management */
 
         /**
@@ -1090,6 +1174,8 @@ namespace rlgl {
          *
          * This function loads a texture into GPU memory with the specified data, width, height,
          * pixel format, and mipmap count.
+         * Compressed formats not supported by the driver are decoded on the CPU and loaded uncompressed
+         * (see RL_DECODE_COMPRESSED_TEXTURES and DecompressImage()).
          *
          * @param data A pointer to the texture data.
          * @param width The width of the texture.
@@ -1101,6 +1187,56 @@ namespace rlgl {
          */
         uint32_t LoadTexture(const void *data, int width, int height, PixelFormat format, int mipmapCount);
 
+        /**
+         * @brief Load a described texture into GPU memory.
+         *
+         * Levels are read from TextureDesc::levels when given, from the contiguous TextureDesc::data otherwise.
+         *
+         * @param desc The description of the texture.
+         *
+         * @return The ID of the loaded texture.
+         */
+        uint32_t LoadTexture(const TextureDesc& desc);
+
+        /**
+         * @brief Load a texture from a KTX2 or DDS texture file into GPU memory.
+         *
+         * Each mipmap level is uploaded directly from the file mapping, the texture file can be unloaded afterwards.
+         * A texture pack can be loaded with LoadTextures() using TextureFile::GetLevels() as TextureDesc::levels.
+         *
+         * @param file The texture file, see TextureFile::Load().
+         *
+         * @return The ID of the loaded texture, 0 if the file is not valid.
+         */
+        uint32_t LoadTexture(const TextureFile& file);
+
+        /**
+         * @brief Load multiple textures into GPU memory.
+         *
+         * This function loads all the described textures at once: texture ids are generated in a single call and,
+         * when supported (OpenGL 4.2, GL_ARB_texture_storage, OpenGL ES 3.0), the storage of every texture is allocated
+         * once with glTexStorage2D() and a sized format before uploading each level with glTexSubImage2D().
+         * Immutable textures are validated once by the driver and cannot be reallocated, so use TextureDesc::reserveMipmaps
+         * if mipmaps have to be generated later with GenTextureMipmaps().
+         *
+         * @param descs A pointer to the array of texture descriptions.
+         * @param count The number of textures to load.
+         * @param ids A pointer to the array receiving the IDs of the loaded textures (0 for failed textures).
+         */
+        void LoadTextures(const TextureDesc *descs, int count, uint32_t *ids);
+
+        /**
+         * @brief Get the pixel format a texture is stored with once loaded.
+         *
+         * Compressed formats not supported by the driver are decoded on the CPU (see RL_DECODE_COMPRESSED_TEXTURES),
+         * the returned format is then the decoded one (R8G8B8A8, or R5G6B5 with RL_DECODE_OPAQUE_TO_R5G6B5).
+         *
+         * @param format The pixel format of the texture data.
+         *
+         * @return The pixel format of the loaded texture.
+         */
+        PixelFormat GetTextureLoadFormat(PixelFormat format) const;
+
         /**
          * @brief Load a depth texture or renderbuffer into GPU memory.
          *
@@ -1143,6 +1279,49 @@ namespace rlgl {
          */
         void UpdateTexture(uint32_t id, int offsetX, int offsetY, int width, int height, PixelFormat format, const void *data);
 
+        /**
+         * @brief Begin a streaming update of a GPU texture.
+         *
+         * This function maps the next upload staging buffer (pixel unpack buffer) and returns it,
+         * the caller writes the new pixels directly into it and calls EndUpdateTexture() to issue
+         * the GL copy. Staging buffers are multi-buffered (RL_DEFAULT_UPLOAD_BUFFERS), so the copy
+         * of the previous update can still be in flight while the next one is written.
+         *
+         * @param id The ID of the texture to update.
+         * @param offsetX The X-axis offset in the texture.
+         * @param offsetY The Y-axis offset in the texture.
+         * @param width The width of the data to update.
+         * @param height The height of the data to update.
+         * @param format The pixel format of the data (compressed formats not supported).
+         *
+         * @return A pointer to the staging memory (GetPixelDataSize(width, height, format) bytes), nullptr on failure.
+         */
+        void *BeginUpdateTexture(uint32_t id, int offsetX, int offsetY, int width, int height, PixelFormat format);
+
+        /**
+         * @brief End a streaming texture update.
+         *
+         * This function unmaps the staging buffer returned by BeginUpdateTexture() and issues
+         * the GL copy to the texture, the transfer is done asynchronously by the driver.
+         */
+        void EndUpdateTexture();
+
+        /**
+         * @brief Update a GPU texture through the upload staging buffers.
+         *
+         * This function copies the data into the next upload staging buffer and issues
+         * the GL copy from it, so the render thread does not wait for the transfer.
+         *
+         * @param id The ID of the texture to update.
+         * @param offsetX The X-axis offset in the texture.
+         * @param offsetY The Y-axis offset in the texture.
+         * @param width The width of the data to update.
+         * @param height The height of the data to update.
+         * @param format The pixel format of the data.
+         * @param data A pointer to the new data.
+         */
+        void UpdateTextureAsync(uint32_t id, int offsetX, int offsetY, int width, int height, PixelFormat format, const void *data);
+
         /**
          * @brief Unload a texture from GPU memory.
          *
@@ -1166,6 +1345,25 @@ namespace rlgl {
          */
         void GenTextureMipmaps(uint32_t id, int width, int height, PixelFormat format, int *mipmaps);
 
+        /**
+         * @brief Generate mipmap data for a selected texture on the CPU.
+         *
+         * This function builds the mipmap chain from the base level data with GenMipmapChain() and uploads
+         * the generated levels to the texture, it does not require GPU mipmap generation (OpenGL 1.1,
+         * NPOT textures on OpenGL ES 2.0) and gives control over the filter and the color space.
+         *
+         * @param id The ID of the texture.
+         * @param data A pointer to the base level pixel data of the texture.
+         * @param width The width of the texture.
+         * @param height The height of the texture.
+         * @param format The pixel format of the texture (compressed formats not supported).
+         * @param mipmaps A pointer to store the mipmap count.
+         * @param filter The filter used to downsample the levels.
+         * @param srgb If true, color channels of 8-bit formats are filtered in linear space.
+         */
+        void GenTextureMipmaps(uint32_t id, const void *data, int width, int height, PixelFormat format, int *mipmaps,
+            MipmapFilter filter = MipmapFilter::Box, bool srgb = false);
+
         /**
          * @brief Read pixel data from a texture.
          *
@@ -1192,6 +1390,51 @@ namespace rlgl {
          */
         std::vector<uint8_t> ReadScreenPixels(int width, int height);
 
+        /**
+         * @brief Read pixel data from the screen buffer into the given memory.
+         *
+         * This function reads pixel data (R8G8B8A8) from the screen buffer directly into the destination
+         * memory without any allocation, the flip is done in place by swapping rows and the alpha is set
+         * to 255 with a SIMD mask when available.
+         *
+         * @param dest Pointer to the destination memory (at least width*height*4 bytes).
+         * @param width The width of the screen buffer.
+         * @param height The height of the screen buffer.
+         * @param flipY If true, the image is flipped vertically (top-left origin), if false rows are kept in OpenGL order.
+         */
+        void ReadScreenPixels(uint8_t *dest, int width, int height, bool flipY = true);
+
+        /**
+         * @brief Read pixel data from a texture asynchronously.
+         *
+         * This function binds the texture to an internal read framebuffer (reused between calls) and
+         * copies its pixels into the next readback staging buffer (pixel pack buffer), without waiting
+         * for the GPU. The data is retrieved later through the returned handle, ideally one or two
+         * frames later, once Readback::IsReady() returns true.
+         *
+         * @param id The ID of the texture (must be color-renderable).
+         * @param width The width of the texture.
+         * @param height The height of the texture.
+         * @param format The pixel format of the texture (read as R8G8B8A8 on OpenGL ES).
+         *
+         * @return The handle of the readback, invalid on failure.
+         */
+        Readback ReadTexturePixelsAsync(uint32_t id, int width, int height, PixelFormat format);
+
+        /**
+         * @brief Read pixel data from the screen buffer asynchronously.
+         *
+         * This function copies the pixels of the current framebuffer into the next readback staging buffer
+         * (pixel pack buffer), without waiting for the GPU. On resolve the data is flipped vertically and
+         * the alpha is set to 255, so the result matches ReadScreenPixels().
+         *
+         * @param width The width of the screen buffer.
+         * @param height The height of the screen buffer.
+         *
+         * @return The handle of the readback.
+         */
+        Readback ReadScreenPixelsAsync(int width, int height);
+
         /* Framebuffer management (FBO) */
 
         /**
@@ -1379,6 +1622,25 @@ namespace rlgl {
          */
         void ComputeShaderDispatch(uint32_t groupX, uint32_t groupY, uint32_t groupZ);
 
+        /**
+         * @brief Dispatch a compute shader with group dimensions read from a GPU buffer.
+         *
+         * The buffer holds three uint32_t values (groupX, groupY, groupZ) at the given offset,
+         * it can be written by a previous compute shader (see ComputeShaderBarrier()).
+         *
+         * @param bufferId The ID of the buffer holding the dispatch parameters.
+         * @param offset The offset of the parameters in the buffer (multiple of 4).
+         */
+        void ComputeShaderDispatchIndirect(uint32_t bufferId, uint32_t offset);
+
+        /**
+         * @brief Make compute shader writes visible to the next commands.
+         *
+         * This function must be called between a compute shader writing a buffer and the next shader reading
+         * it, or the next indirect dispatch, indirect draw or vertex fetch using it.
+         */
+        void ComputeShaderBarrier();
+
         /* Shader buffer storage object management (SSBO) */
 
         /**
@@ -1436,6 +1698,22 @@ namespace rlgl {
          */
         void ReadShaderBuffer(uint32_t id, void *dest, uint32_t count, uint32_t offset);
 
+        /**
+         * @brief Read data from a shader storage buffer object (SSBO) asynchronously.
+         *
+         * This function copies the range into the next readback staging buffer and inserts a fence,
+         * without waiting for the GPU (ReadShaderBuffer() waits for all the previous GPU work).
+         * Compute shader writes issued before the call are visible to the copy. The data is retrieved
+         * later through the returned handle, ideally one or two frames later, once Readback::IsReady() returns true.
+         *
+         * @param id The ID of the SSBO to read from.
+         * @param count The number of bytes to read.
+         * @param offset The offset within the SSBO to start reading from.
+         *
+         * @return The handle of the readback, invalid on failure.
+         */
+        Readback ReadShaderBufferAsync(uint32_t id, uint32_t count, uint32_t offset);
+
         /**
          * @brief Copy data between shader storage buffer objects (SSBOs).
          *
@@ -1560,34 +1838,115 @@ namespace rlgl {
          */
         void SetMatrixViewOffsetStereo(const Matrix& right, const Matrix& left);
 
-        /* Quick and dirty cube/quad buffers load->draw->unloa */
+        /* Utility cube/quad geometry (loaded on first use, kept until the context is destroyed) */
 
         /**
-         * @brief Load and draw a cube.
+         * @brief Draw a cube.
          *
-         * This function loads a cube into the context and draws it.
-         * The cube is drawn with the currently active transformations (modelview and view).
+         * This function draws a cube in NDC (-1..1) with positions, normals and texcoords
+         * at attribute locations 0, 1 and 2, with the currently enabled shader.
+         * The geometry is loaded on the first call and reused by the next ones.
          */
         void LoadDrawCube();
 
         /**
-         * @brief Load and draw a quad.
+         * @brief Draw instances of a cube.
          *
-         * This function loads a quad (a rectangle) into the context and draws it.
-         * The quad is drawn with the currently active transformations (modelview and view).
+         * Same geometry as LoadDrawCube(), drawn with a single instanced draw call
+         * (i.e. the six faces of a cubemap selected by gl_InstanceID in a layered render).
+         *
+         * @param instances The number of instances to draw.
+         */
+        void LoadDrawCubeInstanced(int instances);
+
+        /**
+         * @brief Draw a quad.
+         *
+         * This function draws a quad covering NDC (-1..1) as a triangle strip, with positions and
+         * texcoords at attribute locations 0 and 1, with the currently enabled shader.
+         * The geometry is loaded on the first call and reused by the next ones.
          */
         void LoadDrawQuad();
 
+        /**
+         * @brief Draw instances of a quad.
+         *
+         * Same geometry as LoadDrawQuad(), drawn with a single instanced draw call.
+         *
+         * @param instances The number of instances to draw.
+         */
+        void LoadDrawQuadInstanced(int instances);
+
+        /**
+         * @brief Draw a triangle covering the whole NDC square.
+         *
+         * This function uses the same vertex layout as LoadDrawQuad() (texcoords are 0..1 over the
+         * screen), so post-processing shaders work unchanged. A single triangle avoids the pixels
+         * shaded twice along the quad diagonal.
+         */
+        void DrawFullscreenTriangle();
+
       private:
 #     if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
         void LoadShaderDefault();      // Load default shader
         void UnloadShaderDefault();    // Unload default shader
+        uint32_t GetReadFramebuffer(); // Get internal framebuffer used to read textures (created on first use)
+        uint32_t GetDrawQuadArray();   // Get vertex array of the utility quad and triangle (created on first use)
+        uint32_t GetDrawCubeArray();   // Get vertex array of the utility cube (created on first use)
+        void LoadShaderStereo();       // Load default single-pass stereo shader
+        void DrawRenderBatch(RenderBatch* batch, FlushReason reason);  // Draw render batch and count the flush reason
 #     endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
+        bool IsTextureFormatSupported(PixelFormat format) const;   // Check texture format support (compressed formats)
+        bool DecodeTextureFallback(TextureDesc& desc, std::vector<uint8_t>& pixels) const;  // Decode unsupported compressed texture on the CPU
+        void LoadTextureLevels(const TextureDesc& desc);            // Allocate and upload levels of the bound texture
+
+      private:
+        struct TextureUpdate
+        {
+            uint32_t id             = 0;                        ///< Texture id to update (0 if no update in progress)
+            int offsetX             = 0;                        ///< Update area X-axis offset
+            int offsetY             = 0;                        ///< Update area Y-axis offset
+            int width               = 0;                        ///< Update area width
+            int height              = 0;                        ///< Update area height
+            PixelFormat format      = PixelFormat::R8G8B8A8;    ///< Update data pixel format
+            void *pixels            = nullptr;                  ///< Mapped staging memory
+        };
+
+        // Usage of the default render batch observed by the auto-tuning
+        struct BatchUsage
+        {
+            int runVertices         = 0;        ///< Vertices of the current run of batch draws (chained by limit flushes)
+            int runDrawCalls        = 0;        ///< Draw calls of the current run of batch draws
+            int peakVertices        = 0;        ///< Most vertices of a run since the last tuning
+            int peakDrawCalls       = 0;        ///< Most draw calls of a run since the last tuning
+            int vertexOverflows     = 0;        ///< Batch draws forced by the vertex buffer limit since the last tuning
+            int drawCallOverflows   = 0;        ///< Batch draws forced by the draw calls limit since the last tuning
+            int idleFrames          = 0;        ///< Consecutive frames using less than a quarter of the vertex buffers
+            int idlePeakVertices    = 0;        ///< Most vertices of a run during the idle frames
+        };
+
       private:
         State state;                                    ///< Renderer state
         RenderBatch *currentBatch;                      ///< Pointer to the current render batch
         std::unique_ptr<RenderBatch> defaultBatch;      ///< Default internal render batch
+        BatchConfig batchConfig;                        ///< Default render batch configuration (current sizes)
+        BatchUsage batchUsage;                          ///< Default render batch usage since the last auto-tuning
+
+        std::unique_ptr<UploadBuffer> uploadBuffer;     ///< Texture upload staging buffers (created on first streaming update)
+        TextureUpdate pendingTextureUpdate;             ///< Streaming texture update in progress
+
+        std::unique_ptr<ReadbackBuffer> readbackBuffer; ///< Readback staging buffers (created on first asynchronous readback)
+        uint32_t readFramebuffer = 0;                   ///< Internal framebuffer used to read textures
+
+        uint32_t drawQuadVao = 0;                       ///< Utility quad and fullscreen triangle vertex array
+        uint32_t drawQuadVbo = 0;                       ///< Utility quad and fullscreen triangle vertex buffer
+        uint32_t drawCubeVao = 0;                       ///< Utility cube vertex array
+        uint32_t drawCubeVbo = 0;                       ///< Utility cube vertex buffer
+
+        FrameStats frameStats;                          ///< Rendering counters since the last reset
+        GpuProfiler *gpuProfiler = nullptr;             ///< GPU profiler measuring the render batch draws (not owned)
+        FrameCapture *frameCapture = nullptr;           ///< Frame capture recording the context calls (not owned)
 
       public:
         /**
@@ -1603,6 +1962,64 @@ namespace rlgl {
         {
             return state;
         }
+
+        /**
+         * @brief Get the rendering counters accumulated since the last ResetFrameStats().
+         *
+         * Counters include the render batch flushes and their reasons, draw calls, vertices,
+         * bytes uploaded, texture binds and render state changes. They stay at zero when the
+         * library is built with RLGL_NO_FRAME_STATS.
+         *
+         * @return A constant reference to the frame statistics.
+         */
+        const FrameStats& GetFrameStats() const
+        {
+            return frameStats;
+        }
+
+        /**
+         * @brief Reset the rendering counters, usually called once per frame.
+         */
+        void ResetFrameStats()
+        {
+            frameStats = FrameStats();
+        }
+
+        /**
+         * @brief Set the GPU profiler measuring the render batch draws.
+         *
+         * GPU profilers register themselves when they are created, every render batch draw is
+         * then measured as a "RenderBatch" region.
+         *
+         * @param profiler The GPU profiler (nullptr to stop measuring).
+         */
+        void SetGpuProfiler(GpuProfiler *profiler)
+        {
+            gpuProfiler = profiler;
+        }
+
+        GpuProfiler *GetGpuProfiler() const
+        {
+            return gpuProfiler;
+        }
+
+        /**
+         * @brief Set the frame capture recording the context calls.
+         *
+         * Frame captures register themselves when they are created, the calls of the context
+         * are then recorded while a capture is in progress.
+         *
+         * @param capture The frame capture (nullptr to stop recording).
+         */
+        void SetFrameCapture(FrameCapture *capture)
+        {
+            frameCapture = capture;
+        }
+
+        FrameCapture *GetFrameCapture() const
+        {
+            return frameCapture;
+        }
     };
 
 }
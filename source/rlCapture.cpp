@@ -0,0 +1,1550 @@
+#include "rlCapture.hpp"
+#include "rlGLExt.hpp"
+#include "rlMipmaps.hpp"
+#include "rlUtils.hpp"
+#include "rlTrace.hpp"
+#include "rlgl.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+
+using namespace rlgl;
+
+namespace {
+
+    constexpr char CAPTURE_MAGIC[8] = { 'R', 'L', 'G', 'L', 'C', 'A', 'P', '\0' };
+    constexpr uint64_t CAPTURE_VERSION = 1;
+
+    constexpr uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ull;
+    constexpr uint64_t FNV_PRIME = 0x100000001b3ull;
+
+    // Type of the objects identified by the command arguments (object ids are remapped on replay)
+    enum ObjectType : uint8_t
+    {
+        OBJECT_NONE = 0,
+        OBJECT_TEXTURE,
+        OBJECT_RENDERBUFFER,
+        OBJECT_BUFFER,
+        OBJECT_VERTEX_ARRAY,
+        OBJECT_FRAMEBUFFER,
+        OBJECT_SHADER                       // Shaders and programs share their ids
+    };
+
+    // How the commands are kept in the resource log
+    enum CommandFlags : uint8_t
+    {
+        COMMAND_LOGGED          = 1 << 0,   // Logged while the capture is attached, the first argument is the object id
+        COMMAND_VERTEX_STATE    = 1 << 1,   // Logged when it configures a vertex array loaded outside of the current frame
+        COMMAND_UNLOAD          = 1 << 2,   // Removes the logged commands of the object
+        COMMAND_UPDATE          = 1 << 3    // Replaces the logged command with the same arguments (same object and region)
+    };
+
+    struct CommandInfo
+    {
+        uint8_t flags;
+        ObjectType objectType;
+    };
+
+    const char *const COMMAND_NAMES[] = {
+#define RLGL_CAPTURE_NAME(name) #name,
+        RLGL_CAPTURE_COMMANDS(RLGL_CAPTURE_NAME)
+#undef RLGL_CAPTURE_NAME
+    };
+
+    static_assert(sizeof(COMMAND_NAMES)/sizeof(COMMAND_NAMES[0]) == static_cast<std::size_t>(CaptureCommand::Count), "Missing capture command names");
+    static_assert(sizeof(Matrix) == 16*sizeof(float), "Matrix is written as 16 floats");
+
+    //----------------------------------------------------------------------------------
+
+    CommandInfo GetCommandInfo(CaptureCommand command)
+    {
+        switch (command)
+        {
+            case CaptureCommand::LoadTexture:
+            case CaptureCommand::LoadTextureDepth:
+            case CaptureCommand::LoadTextureCubemap:
+            case CaptureCommand::GenTextureMipmaps:
+            case CaptureCommand::GenTextureMipmapsData: return { COMMAND_LOGGED, OBJECT_TEXTURE };
+            case CaptureCommand::UpdateTexture:
+            case CaptureCommand::UpdateTextureAsync:
+            case CaptureCommand::TextureParameterWrap:
+            case CaptureCommand::TextureParameterFilter:
+            case CaptureCommand::TextureParameterFloat:
+            case CaptureCommand::CubemapParameterWrap:
+            case CaptureCommand::CubemapParameterFilter:
+            case CaptureCommand::CubemapParameterFloat: return { COMMAND_LOGGED | COMMAND_UPDATE, OBJECT_TEXTURE };
+            case CaptureCommand::UnloadTexture: return { COMMAND_LOGGED | COMMAND_UNLOAD, OBJECT_TEXTURE };
+
+            case CaptureCommand::LoadVertexBuffer:
+            case CaptureCommand::LoadVertexBufferElement:
+            case CaptureCommand::LoadShaderBuffer:
+            case CaptureCommand::CopyShaderBuffer: return { COMMAND_LOGGED, OBJECT_BUFFER };
+            case CaptureCommand::UpdateVertexBuffer:
+            case CaptureCommand::UpdateVertexBufferElements:
+            case CaptureCommand::UpdateShaderBuffer: return { COMMAND_LOGGED | COMMAND_UPDATE, OBJECT_BUFFER };
+            case CaptureCommand::UnloadVertexBuffer:
+            case CaptureCommand::UnloadShaderBuffer: return { COMMAND_LOGGED | COMMAND_UNLOAD, OBJECT_BUFFER };
+
+            case CaptureCommand::LoadVertexArray: return { COMMAND_LOGGED, OBJECT_VERTEX_ARRAY };
+            case CaptureCommand::UnloadVertexArray: return { COMMAND_LOGGED | COMMAND_UNLOAD, OBJECT_VERTEX_ARRAY };
+            case CaptureCommand::EnableVertexArray:
+            case CaptureCommand::DisableVertexArray:
+            case CaptureCommand::EnableVertexBuffer:
+            case CaptureCommand::DisableVertexBuffer:
+            case CaptureCommand::EnableVertexBufferElement:
+            case CaptureCommand::DisableVertexBufferElement:
+            case CaptureCommand::EnableVertexAttribute:
+            case CaptureCommand::DisableVertexAttribute:
+            case CaptureCommand::SetVertexAttribute:
+            case CaptureCommand::SetVertexAttributeDivisor: return { COMMAND_VERTEX_STATE, OBJECT_VERTEX_ARRAY };
+
+            case CaptureCommand::LoadFramebuffer:
+            case CaptureCommand::FramebufferAttach: return { COMMAND_LOGGED, OBJECT_FRAMEBUFFER };
+            case CaptureCommand::UnloadFramebuffer: return { COMMAND_LOGGED | COMMAND_UNLOAD, OBJECT_FRAMEBUFFER };
+
+            case CaptureCommand::LoadShaderCode:
+            case CaptureCommand::CompileShader:
+            case CaptureCommand::LoadShaderProgram:
+            case CaptureCommand::LoadComputeShaderProgram: return { COMMAND_LOGGED, OBJECT_SHADER };
+            case CaptureCommand::UnloadShaderProgram: return { COMMAND_LOGGED | COMMAND_UNLOAD, OBJECT_SHADER };
+
+            default: return { 0, OBJECT_NONE };
+        }
+    }
+
+    uint64_t HashBytes(uint64_t hash, const void *bytes, std::size_t size)
+    {
+        const uint8_t *data = static_cast<const uint8_t*>(bytes);
+        for (std::size_t i = 0; i < size; i++) hash = (hash ^ data[i])*FNV_PRIME;
+        return hash;
+    }
+
+    // Append an unsigned integer (LEB128, 7 bits per byte)
+    void AppendUnsigned(std::vector<uint8_t>& data, uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            data.push_back(static_cast<uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+
+        data.push_back(static_cast<uint8_t>(value));
+    }
+
+    // Read the first argument of an encoded command (object id of the logged commands)
+    uint32_t ReadFirstArgument(const std::vector<uint8_t>& args)
+    {
+        uint64_t value = 0;
+
+        for (std::size_t i = 0, shift = 0; (i < args.size()) && (shift < 64); i++, shift += 7)
+        {
+            value |= static_cast<uint64_t>(args[i] & 0x7f) << shift;
+            if ((args[i] & 0x80) == 0) break;
+        }
+
+        return static_cast<uint32_t>(value);
+    }
+
+    // Size of the pixel data of a texture description (all the levels)
+    std::size_t GetLevelDataSize(int width, int height, PixelFormat format, int level)
+    {
+        return GetPixelDataSize(std::max(width >> level, 1), std::max(height >> level, 1), format);
+    }
+
+    bool WriteFile(const std::string& fileName, const std::vector<uint8_t>& data)
+    {
+        std::FILE *file = std::fopen(fileName.c_str(), "wb");
+        if (file == nullptr) return false;
+
+        const bool written = (std::fwrite(data.data(), 1, data.size(), file) == data.size());
+        return (std::fclose(file) == 0) && written;
+    }
+
+    bool ReadFile(const std::string& fileName, std::vector<uint8_t>& data)
+    {
+        std::FILE *file = std::fopen(fileName.c_str(), "rb");
+        if (file == nullptr) return false;
+
+        uint8_t buffer[65536];
+        std::size_t count = 0;
+        while ((count = std::fread(buffer, 1, sizeof(buffer), file)) > 0) data.insert(data.end(), buffer, buffer + count);
+
+        const bool read = (std::ferror(file) == 0);
+        std::fclose(file);
+        return read;
+    }
+
+}
+
+const char *rlgl::GetCaptureCommandName(CaptureCommand command)
+{
+    return (command < CaptureCommand::Count)? COMMAND_NAMES[static_cast<int>(command)] : "Unknown";
+}
+
+std::size_t rlgl::GetUniformDataSize(ShaderUniformType uniformType, int count)
+{
+    const std::size_t valueCount = static_cast<std::size_t>(std::max(count, 0));
+
+    switch (uniformType)
+    {
+        case ShaderUniformType::Vec2:
+        case ShaderUniformType::IVec2: return 2*sizeof(float)*valueCount;
+        case ShaderUniformType::Vec3:
+        case ShaderUniformType::IVec3: return 3*sizeof(float)*valueCount;
+        case ShaderUniformType::Vec4:
+        case ShaderUniformType::IVec4: return 4*sizeof(float)*valueCount;
+        default: return sizeof(float)*valueCount;
+    }
+}
+
+/* FRAME CAPTURE IMPLEMENTATION */
+
+FrameCapture::FrameCapture(Context& rlCtx)
+: rlCtx(&rlCtx), depth(0), argSignature(FNV_OFFSET_BASIS), recordLog(false), vertexArray(0)
+, frameActive(false), recordingState(false), requestedFrames(0), capturedFrames(0), stream(nullptr)
+, frameWidth(0), frameHeight(0)
+{
+    rlCtx.SetFrameCapture(this);
+
+    TRACELOG(LogInfo, "CAPTURE: Frame capture attached to the context");
+}
+
+FrameCapture::~FrameCapture()
+{
+    Unload();
+}
+
+FrameCapture::FrameCapture(FrameCapture&& other) noexcept
+: rlCtx(other.rlCtx), depth(0), argSignature(FNV_OFFSET_BASIS), recordLog(false)
+, log(std::move(other.log)), blobs(std::move(other.blobs)), freeBlobs(std::move(other.freeBlobs))
+, blobIndices(std::move(other.blobIndices)), vertexArray(other.vertexArray), frameVertexArrays(std::move(other.frameVertexArrays))
+, frameActive(other.frameActive), recordingState(false), requestedFrames(other.requestedFrames), capturedFrames(other.capturedFrames)
+, setup(std::move(other.setup)), frames(std::move(other.frames)), stream(nullptr)
+, frameWidth(other.frameWidth), frameHeight(other.frameHeight)
+{
+    // NOTE: Moved vectors keep their storage, the captured frame stays valid
+    if (other.stream == &other.setup) stream = &setup;
+    else if (other.stream != nullptr) stream = &frames.back();
+
+    if ((rlCtx != nullptr) && (rlCtx->GetFrameCapture() == &other)) rlCtx->SetFrameCapture(this);
+
+    other.rlCtx = nullptr;
+    other.stream = nullptr;
+    other.requestedFrames = 0;
+    other.capturedFrames = 0;
+}
+
+FrameCapture& FrameCapture::operator=(FrameCapture&& other) noexcept
+{
+    if (this != &other)
+    {
+        Unload();
+
+        rlCtx = other.rlCtx;
+        log = std::move(other.log);
+        blobs = std::move(other.blobs);
+        freeBlobs = std::move(other.freeBlobs);
+        blobIndices = std::move(other.blobIndices);
+        vertexArray = other.vertexArray;
+        frameVertexArrays = std::move(other.frameVertexArrays);
+        frameActive = other.frameActive;
+        requestedFrames = other.requestedFrames;
+        capturedFrames = other.capturedFrames;
+        setup = std::move(other.setup);
+        frames = std::move(other.frames);
+        frameWidth = other.frameWidth;
+        frameHeight = other.frameHeight;
+
+        stream = nullptr;
+        if (other.stream == &other.setup) stream = &setup;
+        else if (other.stream != nullptr) stream = &frames.back();
+
+        if ((rlCtx != nullptr) && (rlCtx->GetFrameCapture() == &other)) rlCtx->SetFrameCapture(this);
+
+        other.rlCtx = nullptr;
+        other.stream = nullptr;
+        other.requestedFrames = 0;
+        other.capturedFrames = 0;
+    }
+    return *this;
+}
+
+void FrameCapture::Unload()
+{
+    if ((rlCtx != nullptr) && (rlCtx->GetFrameCapture() == this)) rlCtx->SetFrameCapture(nullptr);
+}
+
+void FrameCapture::BeginFrame()
+{
+    if (frameActive) EndFrame();
+
+    frameActive = true;
+    frameVertexArrays.clear();
+
+    if ((requestedFrames == 0) || (stream != nullptr)) return;
+
+    // Capture start: commands of the live resources, then the current state
+    const Context::State &state = rlCtx->GetState();
+    frameWidth = state.framebufferWidth;
+    frameHeight = state.framebufferHeight;
+
+    for (const LogRecord& record : log)
+    {
+        AppendUnsigned(setup.data, static_cast<uint64_t>(record.command));
+        setup.data.insert(setup.data.end(), record.data.begin(), record.data.end());
+
+        for (uint32_t index : record.blobs)
+        {
+            blobs[index].references++;
+            setup.blobs.push_back(index);
+        }
+    }
+
+    stream = &setup;
+    recordingState = true;
+    RecordState();
+    recordingState = false;
+
+    frames.emplace_back();
+    stream = &frames.back();
+}
+
+void FrameCapture::EndFrame()
+{
+    if (!frameActive) return;
+
+    frameActive = false;
+
+    if (stream == nullptr) return;
+
+    capturedFrames++;
+    requestedFrames--;
+
+    // Calls made until the next frame are recorded with it
+    if (requestedFrames > 0)
+    {
+        frames.emplace_back();
+        stream = &frames.back();
+    }
+    else
+    {
+        stream = nullptr;
+        TRACELOG(LogInfo, "CAPTURE: %i frames captured (%i KB)", capturedFrames, static_cast<int>(GetMemoryUsage()/1024));
+    }
+}
+
+void FrameCapture::CaptureFrames(int count)
+{
+    ClearFrames();
+    requestedFrames = std::max(count, 0);
+}
+
+void FrameCapture::ClearFrames()
+{
+    ReleaseStream(setup);
+    for (Stream& frame : frames) ReleaseStream(frame);
+
+    frames.clear();
+    stream = nullptr;
+    requestedFrames = 0;
+    capturedFrames = 0;
+}
+
+std::vector<uint8_t> FrameCapture::Serialize() const
+{
+    if (capturedFrames == 0) return std::vector<uint8_t>();
+
+    std::vector<uint8_t> file(CAPTURE_MAGIC, CAPTURE_MAGIC + sizeof(CAPTURE_MAGIC));
+    AppendUnsigned(file, CAPTURE_VERSION);
+    AppendUnsigned(file, static_cast<uint64_t>(frameWidth));
+    AppendUnsigned(file, static_cast<uint64_t>(frameHeight));
+    AppendUnsigned(file, rlCtx->GetState().defaultTextureId);
+    AppendUnsigned(file, rlCtx->GetState().defaultShaderId);
+
+    // Data blocks used by the captured commands, stored with their index
+    std::vector<uint32_t> used = setup.blobs;
+    for (int i = 0; i < capturedFrames; i++) used.insert(used.end(), frames[i].blobs.begin(), frames[i].blobs.end());
+
+    std::sort(used.begin(), used.end());
+    used.erase(std::unique(used.begin(), used.end()), used.end());
+
+    AppendUnsigned(file, used.size());
+
+    for (uint32_t index : used)
+    {
+        const std::vector<uint8_t> &data = blobs[index].data;
+
+        AppendUnsigned(file, index);
+        AppendUnsigned(file, data.size());
+        file.insert(file.end(), data.begin(), data.end());
+    }
+
+    AppendUnsigned(file, setup.data.size());
+    file.insert(file.end(), setup.data.begin(), setup.data.end());
+
+    AppendUnsigned(file, static_cast<uint64_t>(capturedFrames));
+
+    for (int i = 0; i < capturedFrames; i++)
+    {
+        AppendUnsigned(file, frames[i].data.size());
+        file.insert(file.end(), frames[i].data.begin(), frames[i].data.end());
+    }
+
+    return file;
+}
+
+bool FrameCapture::Save(const std::string& fileName) const
+{
+    if (capturedFrames == 0)
+    {
+        TRACELOG(LogWarning, "CAPTURE: No frame captured, [%s] not saved", fileName.c_str());
+        return false;
+    }
+
+    if (!WriteFile(fileName, Serialize()))
+    {
+        TRACELOG(LogWarning, "CAPTURE: [%s] Failed to write capture file", fileName.c_str());
+        return false;
+    }
+
+    TRACELOG(LogInfo, "CAPTURE: [%s] Capture saved (%i frames)", fileName.c_str(), capturedFrames);
+    return true;
+}
+
+std::size_t FrameCapture::GetMemoryUsage() const
+{
+    std::size_t size = setup.data.capacity() + setup.blobs.capacity()*sizeof(uint32_t);
+
+    for (const Stream& frame : frames) size += frame.data.capacity() + frame.blobs.capacity()*sizeof(uint32_t);
+    for (const LogRecord& record : log) size += sizeof(LogRecord) + record.data.capacity() + record.blobs.capacity()*sizeof(uint32_t);
+    for (const Blob& blob : blobs) size += sizeof(Blob) + blob.data.capacity();
+
+    return size;
+}
+
+bool FrameCapture::BeginRecord(CaptureCommand command)
+{
+    const CommandInfo info = GetCommandInfo(command);
+
+    recordLog = !recordingState && ((info.flags & (COMMAND_LOGGED | COMMAND_VERTEX_STATE)) != 0);
+    if ((stream == nullptr) && !recordLog) return false;
+
+    args.clear();
+    argBlobs.clear();
+    argSignature = FNV_OFFSET_BASIS;
+
+    return true;
+}
+
+void FrameCapture::EndRecord(CaptureCommand command)
+{
+    if (stream != nullptr)
+    {
+        AppendUnsigned(stream->data, static_cast<uint64_t>(command));
+        stream->data.insert(stream->data.end(), args.begin(), args.end());
+
+        for (uint32_t index : argBlobs)
+        {
+            blobs[index].references++;
+            stream->blobs.push_back(index);
+        }
+    }
+
+    if (recordLog)
+    {
+        const CommandInfo info = GetCommandInfo(command);
+
+        if ((info.flags & COMMAND_VERTEX_STATE) != 0)
+        {
+            // Vertex array setup is logged with the vertex array it configures
+            if (command == CaptureCommand::EnableVertexArray) vertexArray = ReadFirstArgument(args);
+
+            const uint32_t object = vertexArray;
+            if (command == CaptureCommand::DisableVertexArray) vertexArray = 0;
+
+            if ((object != 0) && (!frameActive || (frameVertexArrays.count(object) > 0))) AppendLog(command, info.objectType, object);
+        }
+        else
+        {
+            const uint32_t object = ReadFirstArgument(args);
+            ObjectType objectType = info.objectType;
+
+            if (command == CaptureCommand::LoadVertexArray) frameVertexArrays.insert(object);
+            else if (command == CaptureCommand::UnloadVertexArray)
+            {
+                frameVertexArrays.erase(object);
+                if (vertexArray == object) vertexArray = 0;
+            }
+            else if ((command == CaptureCommand::LoadTextureDepth) && (args.back() != 0)) objectType = OBJECT_RENDERBUFFER;     // Last argument: useRenderBuffer
+
+            AppendLog(command, objectType, object);
+        }
+    }
+
+    // Data blocks not referenced by the stream or the log
+    for (uint32_t index : argBlobs)
+    {
+        if (blobs[index].references == 0) ReleaseBlob(index);
+    }
+}
+
+void FrameCapture::AppendLog(CaptureCommand command, uint8_t objectType, uint32_t object)
+{
+    const CommandInfo info = GetCommandInfo(command);
+
+    auto isObjectRecord = [&](const LogRecord& record) { return (record.objectType == objectType) && (record.object == object); };
+
+    if ((info.flags & COMMAND_UNLOAD) != 0)
+    {
+        for (LogRecord& record : log)
+        {
+            if (isObjectRecord(record)) ReleaseRecord(record);
+        }
+
+        log.erase(std::remove_if(log.begin(), log.end(), isObjectRecord), log.end());
+        return;
+    }
+
+    if ((info.flags & COMMAND_UPDATE) != 0)
+    {
+        for (std::size_t i = log.size(); i > 0; i--)
+        {
+            LogRecord &record = log[i - 1];
+
+            if ((record.command == command) && isObjectRecord(record) && (record.signature == argSignature))
+            {
+                ReleaseRecord(record);
+                log.erase(log.begin() + (i - 1));
+                break;
+            }
+        }
+    }
+
+    LogRecord record;
+    record.command = command;
+    record.objectType = objectType;
+    record.object = object;
+    record.signature = argSignature;
+    record.data = args;
+    record.blobs = argBlobs;
+
+    for (uint32_t index : record.blobs) blobs[index].references++;
+
+    log.push_back(std::move(record));
+}
+
+// Record the state of the context at the capture start (the frame may not set it)
+void FrameCapture::RecordState()
+{
+    const Context::State &state = rlCtx->GetState();
+
+    Record(CaptureCommand::SetFramebufferWidth, state.framebufferWidth);
+    Record(CaptureCommand::SetFramebufferHeight, state.framebufferHeight);
+    Record(CaptureCommand::SetMatrixProjection, state.projection);
+    Record(CaptureCommand::SetMatrixModelview, state.modelview);
+    Record(CaptureCommand::MatrixMode, state.currentMatrixMode);
+
+    if (state.stereoRender)
+    {
+        Record(CaptureCommand::SetMatrixProjectionStereo, state.projectionStereo[0], state.projectionStereo[1]);
+        Record(CaptureCommand::SetMatrixViewOffsetStereo, state.viewOffsetStereo[0], state.viewOffsetStereo[1]);
+        Record(CaptureCommand::EnableStereoRender, state.stereoSinglePass);
+    }
+
+    if ((state.currentBlendMode == BlendMode::Custom) || (state.currentBlendMode == BlendMode::CustomSeparate))
+    {
+        Record(CaptureCommand::SetBlendFactors, state.glBlendSrcFactor, state.glBlendDstFactor, state.glBlendEquation);
+        Record(CaptureCommand::SetBlendFactorsSeparate, state.glBlendSrcFactorRGB, state.glBlendDestFactorRGB,
+            state.glBlendSrcFactorAlpha, state.glBlendDestFactorAlpha, state.glBlendEquationRGB, state.glBlendEquationAlpha);
+    }
+
+    Record(CaptureCommand::SetBlendMode, state.currentBlendMode);
+
+    if (state.currentShaderId != state.defaultShaderId)
+    {
+        Record(CaptureCommand::SetShader, state.currentShaderId, CaptureData{ state.currentShaderLocs, RL_MAX_SHADER_LOCATIONS*sizeof(int) });
+    }
+
+    Record(CaptureCommand::Color4ub, state.colorr, state.colorg, state.colorb, state.colora);
+    Record(CaptureCommand::TexCoord, state.texcoordx, state.texcoordy);
+    Record(CaptureCommand::Normal, state.normalx, state.normaly, state.normalz);
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    GLint viewport[4] = { 0, 0, 0, 0 };
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    Record(CaptureCommand::Viewport, viewport[0], viewport[1], viewport[2], viewport[3]);
+
+    Record(glIsEnabled(GL_BLEND)? CaptureCommand::EnableColorBlend : CaptureCommand::DisableColorBlend);
+    Record(glIsEnabled(GL_DEPTH_TEST)? CaptureCommand::EnableDepthTest : CaptureCommand::DisableDepthTest);
+    Record(glIsEnabled(GL_CULL_FACE)? CaptureCommand::EnableBackfaceCulling : CaptureCommand::DisableBackfaceCulling);
+
+    if (glIsEnabled(GL_SCISSOR_TEST))
+    {
+        GLint scissor[4] = { 0, 0, 0, 0 };
+        glGetIntegerv(GL_SCISSOR_BOX, scissor);
+        Record(CaptureCommand::EnableScissorTest);
+        Record(CaptureCommand::Scissor, scissor[0], scissor[1], scissor[2], scissor[3]);
+    }
+    else Record(CaptureCommand::DisableScissorTest);
+
+    GLfloat clearColor[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    glGetFloatv(GL_COLOR_CLEAR_VALUE, clearColor);
+    auto toByte = [](float value) { return static_cast<uint8_t>(std::clamp(value, 0.0f, 1.0f)*255.0f + 0.5f); };
+    Record(CaptureCommand::ClearColor, toByte(clearColor[0]), toByte(clearColor[1]), toByte(clearColor[2]), toByte(clearColor[3]));
+
+    GLfloat lineWidth = 1.0f;
+    glGetFloatv(GL_LINE_WIDTH, &lineWidth);
+    Record(CaptureCommand::SetLineWidth, lineWidth);
+
+    GLint framebuffer = 0;
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &framebuffer);
+    if (framebuffer != 0) Record(CaptureCommand::EnableFramebuffer, static_cast<uint32_t>(framebuffer));
+    else Record(CaptureCommand::DisableFramebuffer);
+#endif
+}
+
+void FrameCapture::ReleaseStream(Stream& stream)
+{
+    for (uint32_t index : stream.blobs) ReleaseBlob(index);
+
+    stream.data.clear();
+    stream.data.shrink_to_fit();
+    stream.blobs.clear();
+    stream.blobs.shrink_to_fit();
+}
+
+void FrameCapture::ReleaseRecord(LogRecord& record)
+{
+    for (uint32_t index : record.blobs) ReleaseBlob(index);
+    record.blobs.clear();
+}
+
+uint32_t FrameCapture::AddBlob(const void *data, std::size_t size)
+{
+    const uint64_t hash = HashBytes(FNV_OFFSET_BASIS, data, size);
+
+    const auto it = blobIndices.find(hash);
+    if (it != blobIndices.end())
+    {
+        const Blob &blob = blobs[it->second];
+        if ((blob.data.size() == size) && ((size == 0) || (std::memcmp(blob.data.data(), data, size) == 0))) return it->second;
+    }
+
+    uint32_t index = 0;
+    if (!freeBlobs.empty())
+    {
+        index = freeBlobs.back();
+        freeBlobs.pop_back();
+    }
+    else
+    {
+        index = static_cast<uint32_t>(blobs.size());
+        blobs.emplace_back();
+    }
+
+    Blob &blob = blobs[index];
+    blob.hash = hash;
+    blob.data.assign(static_cast<const uint8_t*>(data), static_cast<const uint8_t*>(data) + size);
+    blob.references = 0;
+
+    // NOTE: Blocks with a colliding hash are stored but not shared
+    if (it == blobIndices.end()) blobIndices[hash] = index;
+
+    return index;
+}
+
+void FrameCapture::ReleaseBlob(uint32_t index)
+{
+    Blob &blob = blobs[index];
+
+    if (blob.references < 0) return;        // Already released
+    if ((blob.references > 0) && (--blob.references > 0)) return;
+
+    const auto it = blobIndices.find(blob.hash);
+    if ((it != blobIndices.end()) && (it->second == index)) blobIndices.erase(it);
+
+    std::vector<uint8_t>().swap(blob.data);
+    blob.references = -1;
+    freeBlobs.push_back(index);
+}
+
+void FrameCapture::Write(const Matrix& mat)
+{
+    WriteBytes(&mat, sizeof(Matrix));
+}
+
+void FrameCapture::Write(const CaptureData& data)
+{
+    // NOTE: Data blocks are written by index (0 for no data), excluded from the arguments signature
+    if (data.data == nullptr)
+    {
+        AppendUnsigned(args, 0);
+        return;
+    }
+
+    const uint32_t index = AddBlob(data.data, data.size);
+    argBlobs.push_back(index);
+    AppendUnsigned(args, static_cast<uint64_t>(index) + 1);
+}
+
+void FrameCapture::Write(const char *str)
+{
+    Write(CaptureData{ str, (str != nullptr)? std::strlen(str) + 1 : 0 });
+}
+
+void FrameCapture::Write(const TextureDesc& desc)
+{
+    const int mipmapCount = std::max(desc.mipmapCount, 1);
+
+    Write(desc.width);
+    Write(desc.height);
+    Write(desc.format);
+    Write(desc.mipmapCount);
+    Write(desc.immutable);
+    Write(desc.reserveMipmaps);
+    Write(desc.levels != nullptr);
+
+    if (desc.levels != nullptr)
+    {
+        for (int i = 0; i < mipmapCount; i++) Write(CaptureData{ desc.levels[i], GetLevelDataSize(desc.width, desc.height, desc.format, i) });
+    }
+    else Write(CaptureData{ desc.data, static_cast<std::size_t>(GetMipmapChainDataSize(desc.width, desc.height, desc.format, mipmapCount)) });
+}
+
+void FrameCapture::WriteUnsigned(uint64_t value)
+{
+    uint8_t bytes[10];
+    std::size_t size = 0;
+
+    while (value >= 0x80)
+    {
+        bytes[size++] = static_cast<uint8_t>(value | 0x80);
+        value >>= 7;
+    }
+
+    bytes[size++] = static_cast<uint8_t>(value);
+    WriteBytes(bytes, size);
+}
+
+void FrameCapture::WriteSigned(int64_t value)
+{
+    // Zigzag encoding, small negative values stay small
+    WriteUnsigned((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+}
+
+void FrameCapture::WriteBytes(const void *bytes, std::size_t size)
+{
+    args.insert(args.end(), static_cast<const uint8_t*>(bytes), static_cast<const uint8_t*>(bytes) + size);
+    argSignature = HashBytes(argSignature, bytes, size);
+}
+
+/* CAPTURE REPLAY IMPLEMENTATION */
+
+// Decoder of an encoded command stream
+struct CaptureReplay::Reader
+{
+    const CaptureReplay *replay;
+    const uint8_t *data;
+    const uint8_t *end;
+    bool failed = false;
+
+    bool IsEnd() const
+    {
+        return failed || (data >= end);
+    }
+
+    uint64_t Unsigned()
+    {
+        uint64_t value = 0;
+
+        for (int shift = 0; (data < end) && (shift < 64); shift += 7)
+        {
+            const uint8_t byte = *data++;
+            value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0) return value;
+        }
+
+        failed = true;
+        return 0;
+    }
+
+    int64_t Signed()
+    {
+        const uint64_t value = Unsigned();
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    void Bytes(void *dest, std::size_t size)
+    {
+        if (static_cast<std::size_t>(end - data) < size)
+        {
+            failed = true;
+            std::memset(dest, 0, size);
+            return;
+        }
+
+        std::memcpy(dest, data, size);
+        data += size;
+    }
+
+    uint32_t U32() { return static_cast<uint32_t>(Unsigned()); }
+    int Int() { return static_cast<int>(Signed()); }
+    uint8_t U8() { return static_cast<uint8_t>(Unsigned()); }
+    bool Bool() { return (Unsigned() != 0); }
+    float Float() { float value = 0.0f; Bytes(&value, sizeof(value)); return value; }
+    double Double() { double value = 0.0; Bytes(&value, sizeof(value)); return value; }
+    Matrix Mat() { Matrix mat; Bytes(&mat, sizeof(mat)); return mat; }
+
+    template<typename T>
+    T Enum() { return static_cast<T>(Signed()); }
+
+    const void *Data(std::size_t *size = nullptr)
+    {
+        const uint64_t index = Unsigned();
+        std::size_t blobSize = 0;
+        const uint8_t *blob = (index == 0)? nullptr : replay->GetBlob(index - 1, &blobSize);
+
+        if ((index != 0) && (blob == nullptr)) failed = true;
+        if (size != nullptr) *size = blobSize;
+
+        return blob;
+    }
+
+    // Check that a data block holds the bytes read by the replayed call (truncated or corrupted capture otherwise)
+    bool Fits(std::size_t blockSize, int64_t required)
+    {
+        if ((required < 0) || (blockSize < static_cast<uint64_t>(required))) failed = true;
+        return !failed;
+    }
+
+    const char *String()
+    {
+        std::size_t size = 0;
+        const char *str = static_cast<const char*>(Data(&size));
+
+        // NOTE: Strings are captured with their terminator
+        if ((str != nullptr) && ((size == 0) || (str[size - 1] != '\0'))) failed = true;
+
+        return failed? nullptr : str;
+    }
+};
+
+CaptureReplay::CaptureReplay(Context& rlCtx)
+: rlCtx(&rlCtx), ready(false), width(0), height(0)
+, stats(static_cast<std::size_t>(CaptureCommand::Count)), unresolvedIds(0), skippedCommands(0)
+{ }
+
+bool CaptureReplay::Load(const std::string& fileName)
+{
+    std::vector<uint8_t> data;
+
+    if (!ReadFile(fileName, data))
+    {
+        TRACELOG(LogWarning, "CAPTURE: [%s] Failed to read capture file", fileName.c_str());
+        return false;
+    }
+
+    return Load(data);
+}
+
+bool CaptureReplay::Load(const std::vector<uint8_t>& data)
+{
+    ready = false;
+    blobs.clear();
+    setup.clear();
+    frames.clear();
+    ids.clear();
+
+    if ((data.size() < sizeof(CAPTURE_MAGIC)) || (std::memcmp(data.data(), CAPTURE_MAGIC, sizeof(CAPTURE_MAGIC)) != 0))
+    {
+        TRACELOG(LogWarning, "CAPTURE: Not a capture file");
+        return false;
+    }
+
+    Reader reader{ this, data.data() + sizeof(CAPTURE_MAGIC), data.data() + data.size() };
+
+    const uint64_t version = reader.Unsigned();
+    if (version != CAPTURE_VERSION)
+    {
+        TRACELOG(LogWarning, "CAPTURE: Capture file version %i not supported", static_cast<int>(version));
+        return false;
+    }
+
+    width = static_cast<int>(reader.Unsigned());
+    height = static_cast<int>(reader.Unsigned());
+    const uint32_t defaultTextureId = reader.U32();
+    const uint32_t defaultShaderId = reader.U32();
+
+    // Read a stream or data block (size and content)
+    auto readBlock = [&reader](std::vector<uint8_t>& block)
+    {
+        const uint64_t size = reader.Unsigned();
+        if (reader.failed || (size > static_cast<uint64_t>(reader.end - reader.data))) { reader.failed = true; return; }
+
+        block.assign(reader.data, reader.data + size);
+        reader.data += size;
+    };
+
+    const uint64_t blobCount = reader.Unsigned();
+    for (uint64_t i = 0; (i < blobCount) && !reader.failed; i++)
+    {
+        const uint32_t index = reader.U32();
+        readBlock(blobs[index]);
+    }
+
+    readBlock(setup);
+
+    const uint64_t frameCount = reader.Unsigned();
+    for (uint64_t i = 0; (i < frameCount) && !reader.failed; i++)
+    {
+        frames.emplace_back();
+        readBlock(frames.back());
+    }
+
+    if (reader.failed)
+    {
+        TRACELOG(LogWarning, "CAPTURE: Capture file truncated");
+        frames.clear();
+        return false;
+    }
+
+    // Objects of the context created before the capture
+    const Context::State &state = rlCtx->GetState();
+    BindId(OBJECT_TEXTURE, defaultTextureId, state.defaultTextureId);
+    BindId(OBJECT_SHADER, defaultShaderId, state.defaultShaderId);
+
+    ready = true;
+    TRACELOG(LogInfo, "CAPTURE: Capture loaded (%ix%i, %i frames, %i data blocks)", width, height, static_cast<int>(frames.size()), static_cast<int>(blobs.size()));
+
+    return true;
+}
+
+bool CaptureReplay::ReplaySetup()
+{
+    return ready && Replay(setup, false, nullptr);
+}
+
+bool CaptureReplay::ReplayFrame(int index, std::vector<CaptureCallTiming> *calls)
+{
+    if (!ready || (index < 0) || (index >= static_cast<int>(frames.size()))) return false;
+
+    return Replay(frames[index], true, calls);
+}
+
+void CaptureReplay::ResetStats()
+{
+    stats.assign(static_cast<std::size_t>(CaptureCommand::Count), CaptureCommandStats());
+    unresolvedIds = 0;
+    skippedCommands = 0;
+}
+
+bool CaptureReplay::Replay(const std::vector<uint8_t>& stream, bool timed, std::vector<CaptureCallTiming> *calls)
+{
+    Reader reader{ this, stream.data(), stream.data() + stream.size() };
+
+    while (!reader.IsEnd())
+    {
+        const uint64_t code = reader.Unsigned();
+        if (code >= static_cast<uint64_t>(CaptureCommand::Count)) reader.failed = true;
+        if (reader.failed) break;
+
+        const CaptureCommand command = static_cast<CaptureCommand>(code);
+        uint64_t duration = 0;
+
+        if (!Execute(command, reader, duration)) continue;     // Not replayed
+
+        if (timed)
+        {
+            CaptureCommandStats &commandStats = stats[static_cast<std::size_t>(command)];
+            commandStats.minTime = (commandStats.count == 0)? duration : std::min(commandStats.minTime, duration);
+            commandStats.maxTime = std::max(commandStats.maxTime, duration);
+            commandStats.totalTime += duration;
+            commandStats.count++;
+
+            if (calls != nullptr) calls->push_back({ command, duration });
+        }
+    }
+
+    if (reader.failed) TRACELOG(LogWarning, "CAPTURE: Capture stream corrupted, replay stopped");
+
+    return !reader.failed;
+}
+
+// Time a call of the context (arguments are decoded before)
+#define REPLAY_CALL(call) do { const uint64_t start = GetTraceTime(); call; duration = GetTraceTime() - start; } while (0)
+
+bool CaptureReplay::Execute(CaptureCommand command, Reader& r, uint64_t& duration)
+{
+    Context &ctx = *rlCtx;
+
+    switch (command)
+    {
+        // Matrices
+        case CaptureCommand::MatrixMode: { const auto mode = r.Enum<MatrixMode>(); REPLAY_CALL(ctx.MatrixMode(mode)); } break;
+        case CaptureCommand::PushMatrix: REPLAY_CALL(ctx.PushMatrix()); break;
+        case CaptureCommand::PopMatrix: REPLAY_CALL(ctx.PopMatrix()); break;
+        case CaptureCommand::LoadIdentity: REPLAY_CALL(ctx.LoadIdentity()); break;
+        case CaptureCommand::Translate: { const float x = r.Float(), y = r.Float(), z = r.Float(); REPLAY_CALL(ctx.Translate(x, y, z)); } break;
+        case CaptureCommand::Rotate: { const float angle = r.Float(), x = r.Float(), y = r.Float(), z = r.Float(); REPLAY_CALL(ctx.Rotate(angle, x, y, z)); } break;
+        case CaptureCommand::Scale: { const float x = r.Float(), y = r.Float(), z = r.Float(); REPLAY_CALL(ctx.Scale(x, y, z)); } break;
+        case CaptureCommand::MultMatrix:
+        {
+            std::size_t blockSize = 0;
+            const float *matf = static_cast<const float*>(r.Data(&blockSize));
+            if ((matf == nullptr) || !r.Fits(blockSize, 16*sizeof(float))) return false;
+            REPLAY_CALL(ctx.MultMatrix(matf));
+        } break;
+        case CaptureCommand::Frustum:
+        {
+            const double left = r.Double(), right = r.Double(), bottom = r.Double(), top = r.Double(), znear = r.Double(), zfar = r.Double();
+            REPLAY_CALL(ctx.Frustum(left, right, bottom, top, znear, zfar));
+        } break;
+        case CaptureCommand::Ortho:
+        {
+            const double left = r.Double(), right = r.Double(), bottom = r.Double(), top = r.Double(), znear = r.Double(), zfar = r.Double();
+            REPLAY_CALL(ctx.Ortho(left, right, bottom, top, znear, zfar));
+        } break;
+        case CaptureCommand::Viewport: { const int x = r.Int(), y = r.Int(), w = r.Int(), h = r.Int(); REPLAY_CALL(ctx.Viewport(x, y, w, h)); } break;
+
+        // Immediate mode
+        case CaptureCommand::Begin: { const auto mode = r.Enum<DrawMode>(); REPLAY_CALL(ctx.Begin(mode)); } break;
+        case CaptureCommand::End: REPLAY_CALL(ctx.End()); break;
+        case CaptureCommand::Vertex2i: { const int x = r.Int(), y = r.Int(); REPLAY_CALL(ctx.Vertex(x, y)); } break;
+        case CaptureCommand::Vertex2f: { const float x = r.Float(), y = r.Float(); REPLAY_CALL(ctx.Vertex(x, y)); } break;
+        case CaptureCommand::Vertex3f: { const float x = r.Float(), y = r.Float(), z = r.Float(); REPLAY_CALL(ctx.Vertex(x, y, z)); } break;
+        case CaptureCommand::TexCoord: { const float x = r.Float(), y = r.Float(); REPLAY_CALL(ctx.TexCoord(x, y)); } break;
+        case CaptureCommand::Normal: { const float x = r.Float(), y = r.Float(), z = r.Float(); REPLAY_CALL(ctx.Normal(x, y, z)); } break;
+        case CaptureCommand::Color4ub: { const uint8_t cr = r.U8(), cg = r.U8(), cb = r.U8(), ca = r.U8(); REPLAY_CALL(ctx.Color(cr, cg, cb, ca)); } break;
+        case CaptureCommand::Color3f: { const float x = r.Float(), y = r.Float(), z = r.Float(); REPLAY_CALL(ctx.Color(x, y, z)); } break;
+        case CaptureCommand::Color4f: { const float x = r.Float(), y = r.Float(), z = r.Float(), w = r.Float(); REPLAY_CALL(ctx.Color(x, y, z, w)); } break;
+
+        // Vertex arrays state
+        case CaptureCommand::EnableVertexArray: { const uint32_t id = MapId(OBJECT_VERTEX_ARRAY, r.U32()); REPLAY_CALL(ctx.EnableVertexArray(id)); } break;
+        case CaptureCommand::DisableVertexArray: REPLAY_CALL(ctx.DisableVertexArray()); break;
+        case CaptureCommand::EnableVertexBuffer: { const uint32_t id = MapId(OBJECT_BUFFER, r.U32()); REPLAY_CALL(ctx.EnableVertexBuffer(id)); } break;
+        case CaptureCommand::DisableVertexBuffer: REPLAY_CALL(ctx.DisableVertexBuffer()); break;
+        case CaptureCommand::EnableVertexBufferElement: { const uint32_t id = MapId(OBJECT_BUFFER, r.U32()); REPLAY_CALL(ctx.EnableVertexBufferElement(id)); } break;
+        case CaptureCommand::DisableVertexBufferElement: REPLAY_CALL(ctx.DisableVertexBufferElement()); break;
+        case CaptureCommand::EnableVertexAttribute: { const uint32_t index = r.U32(); REPLAY_CALL(ctx.EnableVertexAttribute(index)); } break;
+        case CaptureCommand::DisableVertexAttribute: { const uint32_t index = r.U32(); REPLAY_CALL(ctx.DisableVertexAttribute(index)); } break;
+        case CaptureCommand::EnableStatePointer: r.Int(); skippedCommands++; return false;     // Client memory of the application
+#   if defined(GRAPHICS_API_OPENGL_11)
+        case CaptureCommand::DisableStatePointer: { const int type = r.Int(); REPLAY_CALL(ctx.DisableStatePointer(type)); } break;
+#   else
+        case CaptureCommand::DisableStatePointer: r.Int(); skippedCommands++; return false;
+#   endif
+
+        // Textures state
+        case CaptureCommand::ActiveTextureSlot: { const int slot = r.Int(); REPLAY_CALL(ctx.ActiveTextureSlot(slot)); } break;
+        case CaptureCommand::EnableTexture: { const uint32_t id = MapId(OBJECT_TEXTURE, r.U32()); REPLAY_CALL(ctx.EnableTexture(id)); } break;
+        case CaptureCommand::DisableTexture: REPLAY_CALL(ctx.DisableTexture()); break;
+        case CaptureCommand::EnableTextureCubemap: { const uint32_t id = MapId(OBJECT_TEXTURE, r.U32()); REPLAY_CALL(ctx.EnableTextureCubemap(id)); } break;
+        case CaptureCommand::DisableTextureCubemap: REPLAY_CALL(ctx.DisableTextureCubemap()); break;
+        case CaptureCommand::TextureParameterWrap:
+        {
+            const uint32_t id = MapId(OBJECT_TEXTURE, r.U32());
+            const auto param = r.Enum<TextureParam>();
+            const auto wrap = r.Enum<TextureWrap>();
+            REPLAY_CALL(ctx.TextureParameters(id, param, wrap));
+        } break;
+        case CaptureCommand::TextureParameterFilter:
+        {
+            const uint32_t id = MapId(OBJECT_TEXTURE, r.U32());
+            const auto param = r.Enum<TextureParam>();
+            const auto filter = r.Enum<TextureFilter>();
+            REPLAY_CALL(ctx.TextureParameters(id, param, filter));
+        } break;
+        case CaptureCommand::TextureParameterFloat:
+        {
+            const uint32_t id = MapId(OBJECT_TEXTURE, r.U32());
+            const auto param = r.Enum<TextureParam>();
+            const float value = r.Float();
+            REPLAY_CALL(ctx.TextureParameters(id, param, value));
+        } break;
+        case CaptureCommand::CubemapParameterWrap:
+        {
+            const uint32_t id = MapId(OBJECT_TEXTURE, r.U32());
+            const auto param = r.Enum<TextureParam>();
+            const auto wrap = r.Enum<TextureWrap>();
+            REPLAY_CALL(ctx.CubemapParameters(id, param, wrap));
+        } break;
+        case CaptureCommand::CubemapParameterFilter:
+        {
+            const uint32_t id = MapId(OBJECT_TEXTURE, r.U32());
+            const auto param = r.Enum<TextureParam>();
+            const auto filter = r.Enum<TextureFilter>();
+            REPLAY_CALL(ctx.CubemapParameters(id, param, filter));
+        } break;
+        case CaptureCommand::CubemapParameterFloat:
+        {
+            const uint32_t id = MapId(OBJECT_TEXTURE, r.U32());
+            const auto param = r.Enum<TextureParam>();
+            const float value = r.Float();
+            REPLAY_CALL(ctx.CubemapParameters(id, param, value));
+        } break;
+
+        // Shader and framebuffer state
+        case CaptureCommand::EnableShader: { const uint32_t id = MapId(OBJECT_SHADER, r.U32()); REPLAY_CALL(ctx.EnableShader(id)); } break;
+        case CaptureCommand::DisableShader: REPLAY_CALL(ctx.DisableShader()); break;
+        case CaptureCommand::EnableFramebuffer: { const uint32_t id = MapId(OBJECT_FRAMEBUFFER, r.U32()); REPLAY_CALL(ctx.EnableFramebuffer(id)); } break;
+        case CaptureCommand::DisableFramebuffer: REPLAY_CALL(ctx.DisableFramebuffer()); break;
+        case CaptureCommand::ActiveDrawBuffers: { const int count = r.Int(); REPLAY_CALL(ctx.ActiveDrawBuffers(count)); } break;
+        case CaptureCommand::BlitFramebuffer:
+        {
+            const int srcX = r.Int(), srcY = r.Int(), srcWidth = r.Int(), srcHeight = r.Int();
+            const int dstX = r.Int(), dstY = r.Int(), dstWidth = r.Int(), dstHeight = r.Int(), bufferMask = r.Int();
+            REPLAY_CALL(ctx.BlitFramebuffer(srcX, srcY, srcWidth, srcHeight, dstX, dstY, dstWidth, dstHeight, bufferMask));
+        } break;
+
+        // Render state
+        case CaptureCommand::EnableColorBlend: REPLAY_CALL(ctx.EnableColorBlend()); break;
+        case CaptureCommand::DisableColorBlend: REPLAY_CALL(ctx.DisableColorBlend()); break;
+        case CaptureCommand::EnableDepthTest: REPLAY_CALL(ctx.EnableDepthTest()); break;
+        case CaptureCommand::DisableDepthTest: REPLAY_CALL(ctx.DisableDepthTest()); break;
+        case CaptureCommand::EnableDepthMask: REPLAY_CALL(ctx.EnableDepthMask()); break;
+        case CaptureCommand::DisableDepthMask: REPLAY_CALL(ctx.DisableDepthMask()); break;
+        case CaptureCommand::EnableBackfaceCulling: REPLAY_CALL(ctx.EnableBackfaceCulling()); break;
+        case CaptureCommand::DisableBackfaceCulling: REPLAY_CALL(ctx.DisableBackfaceCulling()); break;
+        case CaptureCommand::SetCullFace: { const auto mode = r.Enum<CullMode>(); REPLAY_CALL(ctx.SetCullFace(mode)); } break;
+        case CaptureCommand::EnableScissorTest: REPLAY_CALL(ctx.EnableScissorTest()); break;
+        case CaptureCommand::DisableScissorTest: REPLAY_CALL(ctx.DisableScissorTest()); break;
+        case CaptureCommand::Scissor: { const int x = r.Int(), y = r.Int(), w = r.Int(), h = r.Int(); REPLAY_CALL(ctx.Scissor(x, y, w, h)); } break;
+        case CaptureCommand::EnableWireMode: REPLAY_CALL(ctx.EnableWireMode()); break;
+        case CaptureCommand::EnablePointMode: REPLAY_CALL(ctx.EnablePointMode()); break;
+        case CaptureCommand::DisableWireMode: REPLAY_CALL(ctx.DisableWireMode()); break;
+        case CaptureCommand::SetLineWidth: { const float lineWidth = r.Float(); REPLAY_CALL(ctx.SetLineWidth(lineWidth)); } break;
+        case CaptureCommand::EnableSmoothLines: REPLAY_CALL(ctx.EnableSmoothLines()); break;
+        case CaptureCommand::DisableSmoothLines: REPLAY_CALL(ctx.DisableSmoothLines()); break;
+        case CaptureCommand::EnableStereoRender: { const bool singlePass = r.Bool(); REPLAY_CALL(ctx.EnableStereoRender(singlePass)); } break;
+        case CaptureCommand::DisableStereoRender: REPLAY_CALL(ctx.DisableStereoRender()); break;
+        case CaptureCommand::ClearColor: { const uint8_t cr = r.U8(), cg = r.U8(), cb = r.U8(), ca = r.U8(); REPLAY_CALL(ctx.ClearColor(cr, cg, cb, ca)); } break;
+        case CaptureCommand::ClearScreenBuffers: REPLAY_CALL(ctx.ClearScreenBuffers()); break;
+        case CaptureCommand::SetBlendMode: { const auto mode = r.Enum<BlendMode>(); REPLAY_CALL(ctx.SetBlendMode(mode)); } break;
+        case CaptureCommand::SetBlendFactors: { const int src = r.Int(), dst = r.Int(), equation = r.Int(); REPLAY_CALL(ctx.SetBlendFactors(src, dst, equation)); } break;
+        case CaptureCommand::SetBlendFactorsSeparate:
+        {
+            const int srcRGB = r.Int(), dstRGB = r.Int(), srcAlpha = r.Int(), dstAlpha = r.Int(), eqRGB = r.Int(), eqAlpha = r.Int();
+            REPLAY_CALL(ctx.SetBlendFactorsSeparate(srcRGB, dstRGB, srcAlpha, dstAlpha, eqRGB, eqAlpha));
+        } break;
+        case CaptureCommand::SetFramebufferWidth: { const int w = r.Int(); REPLAY_CALL(ctx.SetFramebufferWidth(w)); } break;
+        case CaptureCommand::SetFramebufferHeight: { const int h = r.Int(); REPLAY_CALL(ctx.SetFramebufferHeight(h)); } break;
+
+        // Render batch
+        case CaptureCommand::DrawRenderBatch:
+        case CaptureCommand::SetRenderBatchActive: skippedCommands++; return false;     // Render batch of the application
+        case CaptureCommand::DrawRenderBatchActive: REPLAY_CALL(ctx.DrawRenderBatchActive()); break;
+        case CaptureCommand::CheckRenderBatchLimit: { const int count = r.Int(); REPLAY_CALL(ctx.CheckRenderBatchLimit(count)); } break;
+        case CaptureCommand::SetTexture: { const uint32_t id = MapId(OBJECT_TEXTURE, r.U32()); REPLAY_CALL(ctx.SetTexture(id)); } break;
+
+        // Vertex buffers
+        case CaptureCommand::LoadVertexArray:
+        {
+            const uint32_t capturedId = r.U32();
+            uint32_t id = 0;
+            REPLAY_CALL(id = ctx.LoadVertexArray());
+            BindId(OBJECT_VERTEX_ARRAY, capturedId, id);
+        } break;
+        case CaptureCommand::LoadVertexBuffer:
+        case CaptureCommand::LoadVertexBufferElement:
+        {
+            const uint32_t capturedId = r.U32();
+            std::size_t blockSize = 0;
+            const void *buffer = r.Data(&blockSize);
+            const int size = r.Int();
+            const bool dynamic = r.Bool();
+            uint32_t id = 0;
+            if ((buffer != nullptr) && !r.Fits(blockSize, size)) return false;
+            if (command == CaptureCommand::LoadVertexBuffer) REPLAY_CALL(id = ctx.LoadVertexBuffer(buffer, size, dynamic));
+            else REPLAY_CALL(id = ctx.LoadVertexBufferElement(buffer, size, dynamic));
+            BindId(OBJECT_BUFFER, capturedId, id);
+        } break;
+        case CaptureCommand::UpdateVertexBuffer:
+        case CaptureCommand::UpdateVertexBufferElements:
+        {
+            const uint32_t id = MapId(OBJECT_BUFFER, r.U32());
+            std::size_t blockSize = 0;
+            const void *data = r.Data(&blockSize);
+            const int dataSize = r.Int();
+            const int offset = r.Int();
+            if ((data == nullptr) || !r.Fits(blockSize, dataSize)) return false;
+            if (command == CaptureCommand::UpdateVertexBuffer) REPLAY_CALL(ctx.UpdateVertexBuffer(id, data, dataSize, offset));
+            else REPLAY_CALL(ctx.UpdateVertexBufferElements(id, data, dataSize, offset));
+        } break;
+        case CaptureCommand::UnloadVertexArray: { const uint32_t id = MapId(OBJECT_VERTEX_ARRAY, r.U32()); REPLAY_CALL(ctx.UnloadVertexArray(id)); } break;
+        case CaptureCommand::UnloadVertexBuffer: { const uint32_t id = MapId(OBJECT_BUFFER, r.U32()); REPLAY_CALL(ctx.UnloadVertexBuffer(id)); } break;
+        case CaptureCommand::SetVertexAttribute:
+        {
+            const uint32_t index = r.U32();
+            const int compSize = r.Int();
+            const auto type = r.Enum<DataType>();
+            const bool normalized = r.Bool();
+            const int stride = r.Int();
+            const void *pointer = reinterpret_cast<const void*>(static_cast<uintptr_t>(r.Unsigned()));    // Offset in the bound buffer
+            REPLAY_CALL(ctx.SetVertexAttribute(index, compSize, type, normalized, stride, pointer));
+        } break;
+        case CaptureCommand::SetVertexAttributeDivisor: { const uint32_t index = r.U32(); const int divisor = r.Int(); REPLAY_CALL(ctx.SetVertexAttributeDivisor(index, divisor)); } break;
+        case CaptureCommand::SetVertexAttributeDefault:
+        {
+            const int locIndex = r.Int();
+            std::size_t blockSize = 0;
+            const void *value = r.Data(&blockSize);
+            const auto attribType = r.Enum<ShaderAttributeType>();
+            const int count = r.Int();
+            if ((value == nullptr) || !r.Fits(blockSize, static_cast<int64_t>(sizeof(float))*count)) return false;
+            REPLAY_CALL(ctx.SetVertexAttributeDefault(locIndex, value, attribType, count));
+        } break;
+        case CaptureCommand::DrawVertexArray: { const int offset = r.Int(), count = r.Int(); REPLAY_CALL(ctx.DrawVertexArray(offset, count)); } break;
+        case CaptureCommand::DrawVertexArrayElements:
+        {
+            const int offset = r.Int(), count = r.Int();
+            const void *buffer = reinterpret_cast<const void*>(static_cast<uintptr_t>(r.Unsigned()));
+            REPLAY_CALL(ctx.DrawVertexArrayElements(offset, count, buffer));
+        } break;
+        case CaptureCommand::DrawVertexArrayInstanced:
+        {
+            const int offset = r.Int(), count = r.Int(), instances = r.Int();
+            REPLAY_CALL(ctx.DrawVertexArrayInstanced(offset, count, instances));
+        } break;
+        case CaptureCommand::DrawVertexArrayElementsInstanced:
+        {
+            const int offset = r.Int(), count = r.Int();
+            const void *buffer = reinterpret_cast<const void*>(static_cast<uintptr_t>(r.Unsigned()));
+            const int instances = r.Int();
+            REPLAY_CALL(ctx.DrawVertexArrayElementsInstanced(offset, count, buffer, instances));
+        } break;
+        case CaptureCommand::DrawVertexArrayInstancedIndirect:
+        {
+            const uint32_t id = MapId(OBJECT_BUFFER, r.U32());
+            const uint32_t offset = r.U32();
+            REPLAY_CALL(ctx.DrawVertexArrayInstancedIndirect(id, offset));
+        } break;
+
+        // Textures
+        case CaptureCommand::LoadTexture:
+        {
+            const uint32_t capturedId = r.U32();
+
+            TextureDesc desc;
+            desc.width = r.Int();
+            desc.height = r.Int();
+            desc.format = r.Enum<PixelFormat>();
+            desc.mipmapCount = r.Int();
+            desc.immutable = r.Bool();
+            desc.reserveMipmaps = r.Bool();
+
+            std::vector<const void*> levels;
+            std::size_t blockSize = 0;
+            if (r.Bool())
+            {
+                for (int i = 0; (i < std::max(desc.mipmapCount, 1)) && !r.failed; i++)
+                {
+                    levels.push_back(r.Data(&blockSize));
+                    if (levels.back() != nullptr) r.Fits(blockSize, GetLevelDataSize(desc.width, desc.height, desc.format, i));
+                }
+                desc.levels = levels.data();
+            }
+            else
+            {
+                desc.data = r.Data(&blockSize);
+                if (desc.data != nullptr) r.Fits(blockSize, GetMipmapChainDataSize(desc.width, desc.height, desc.format, std::max(desc.mipmapCount, 1)));
+            }
+
+            if (r.failed) return false;
+
+            uint32_t id = 0;
+            REPLAY_CALL(id = ctx.LoadTexture(desc));
+            BindId(OBJECT_TEXTURE, capturedId, id);
+        } break;
+        case CaptureCommand::LoadTextureDepth:
+        {
+            const uint32_t capturedId = r.U32();
+            const int w = r.Int(), h = r.Int();
+            const bool useRenderBuffer = r.Bool();
+            uint32_t id = 0;
+            REPLAY_CALL(id = ctx.LoadTextureDepth(w, h, useRenderBuffer));
+            BindId(useRenderBuffer? OBJECT_RENDERBUFFER : OBJECT_TEXTURE, capturedId, id);
+        } break;
+        case CaptureCommand::LoadTextureCubemap:
+        {
+            const uint32_t capturedId = r.U32();
+            std::size_t blockSize = 0;
+            const void *data = r.Data(&blockSize);
+            const int size = r.Int();
+            const auto format = r.Enum<PixelFormat>();
+            uint32_t id = 0;
+            if ((data != nullptr) && !r.Fits(blockSize, 6*static_cast<int64_t>(GetPixelDataSize(size, size, format)))) return false;
+            REPLAY_CALL(id = ctx.LoadTextureCubemap(data, size, format));
+            BindId(OBJECT_TEXTURE, capturedId, id);
+        } break;
+        case CaptureCommand::UpdateTexture:
+        case CaptureCommand::UpdateTextureAsync:
+        {
+            const uint32_t id = MapId(OBJECT_TEXTURE, r.U32());
+            const int offsetX = r.Int(), offsetY = r.Int(), w = r.Int(), h = r.Int();
+            const auto format = r.Enum<PixelFormat>();
+            std::size_t blockSize = 0;
+            const void *data = r.Data(&blockSize);
+            if ((data == nullptr) || !r.Fits(blockSize, GetPixelDataSize(w, h, format))) return false;
+            if (command == CaptureCommand::UpdateTexture) REPLAY_CALL(ctx.UpdateTexture(id, offsetX, offsetY, w, h, format, data));
+            else REPLAY_CALL(ctx.UpdateTextureAsync(id, offsetX, offsetY, w, h, format, data));
+        } break;
+        case CaptureCommand::UnloadTexture: { const uint32_t id = MapId(OBJECT_TEXTURE, r.U32()); REPLAY_CALL(ctx.UnloadTexture(id)); } break;
+        case CaptureCommand::GenTextureMipmaps:
+        {
+            const uint32_t id = MapId(OBJECT_TEXTURE, r.U32());
+            const int w = r.Int(), h = r.Int();
+            const auto format = r.Enum<PixelFormat>();
+            int mipmaps = 0;
+            REPLAY_CALL(ctx.GenTextureMipmaps(id, w, h, format, &mipmaps));
+        } break;
+        case CaptureCommand::GenTextureMipmapsData:
+        {
+            const uint32_t id = MapId(OBJECT_TEXTURE, r.U32());
+            std::size_t blockSize = 0;
+            const void *data = r.Data(&blockSize);
+            const int w = r.Int(), h = r.Int();
+            const auto format = r.Enum<PixelFormat>();
+            const auto filter = r.Enum<MipmapFilter>();
+            const bool srgb = r.Bool();
+            int mipmaps = 0;
+            if ((data == nullptr) || !r.Fits(blockSize, GetPixelDataSize(w, h, format))) return false;
+            REPLAY_CALL(ctx.GenTextureMipmaps(id, data, w, h, format, &mipmaps, filter, srgb));
+        } break;
+
+        // Readbacks (results dropped)
+        case CaptureCommand::ReadTexturePixels:
+        {
+            const uint32_t id = MapId(OBJECT_TEXTURE, r.U32());
+            const int w = r.Int(), h = r.Int();
+            const auto format = r.Enum<PixelFormat>();
+            REPLAY_CALL(ctx.ReadTexturePixels(id, w, h, format));
+        } break;
+        case CaptureCommand::ReadScreenPixels:
+        {
+            const int w = r.Int(), h = r.Int();
+            const bool flipY = r.Bool();
+            std::vector<uint8_t> pixels(static_cast<std::size_t>(std::max(w, 0))*std::max(h, 0)*4);
+            REPLAY_CALL(ctx.ReadScreenPixels(pixels.data(), w, h, flipY));
+        } break;
+        case CaptureCommand::ReadTexturePixelsAsync:
+        {
+            const uint32_t id = MapId(OBJECT_TEXTURE, r.U32());
+            const int w = r.Int(), h = r.Int();
+            const auto format = r.Enum<PixelFormat>();
+            REPLAY_CALL(ctx.ReadTexturePixelsAsync(id, w, h, format));
+        } break;
+        case CaptureCommand::ReadScreenPixelsAsync: { const int w = r.Int(), h = r.Int(); REPLAY_CALL(ctx.ReadScreenPixelsAsync(w, h)); } break;
+
+        // Framebuffers
+        case CaptureCommand::LoadFramebuffer:
+        {
+            const uint32_t capturedId = r.U32();
+            const int w = r.Int(), h = r.Int();
+            uint32_t id = 0;
+            REPLAY_CALL(id = ctx.LoadFramebuffer(w, h));
+            BindId(OBJECT_FRAMEBUFFER, capturedId, id);
+        } break;
+        case CaptureCommand::FramebufferAttach:
+        {
+            const uint32_t fboId = MapId(OBJECT_FRAMEBUFFER, r.U32());
+            const uint32_t capturedTexId = r.U32();
+            const auto attachType = r.Enum<FramebufferAttachType>();
+            const auto texType = r.Enum<FramebufferAttachTextureType>();
+            const int mipLevel = r.Int();
+            const uint32_t texId = MapId((texType == FramebufferAttachTextureType::RenderBuffer)? OBJECT_RENDERBUFFER : OBJECT_TEXTURE, capturedTexId);
+            REPLAY_CALL(ctx.FramebufferAttach(fboId, texId, attachType, texType, mipLevel));
+        } break;
+        case CaptureCommand::FramebufferComplete: { const uint32_t id = MapId(OBJECT_FRAMEBUFFER, r.U32()); REPLAY_CALL(ctx.FramebufferComplete(id)); } break;
+        case CaptureCommand::UnloadFramebuffer: { const uint32_t id = MapId(OBJECT_FRAMEBUFFER, r.U32()); REPLAY_CALL(ctx.UnloadFramebuffer(id)); } break;
+
+        // Shaders
+        case CaptureCommand::LoadShaderCode:
+        {
+            const uint32_t capturedId = r.U32();
+            const char *vsCode = r.String();
+            const char *fsCode = r.String();
+            uint32_t id = 0;
+            if (r.failed) return false;
+            REPLAY_CALL(id = ctx.LoadShaderCode(vsCode, fsCode));
+            BindId(OBJECT_SHADER, capturedId, id);
+        } break;
+        case CaptureCommand::CompileShader:
+        {
+            const uint32_t capturedId = r.U32();
+            const char *shaderCode = r.String();
+            const int type = r.Int();
+            uint32_t id = 0;
+            if (shaderCode == nullptr) return false;
+            REPLAY_CALL(id = ctx.CompileShader(shaderCode, type));
+            BindId(OBJECT_SHADER, capturedId, id);
+        } break;
+        case CaptureCommand::LoadShaderProgram:
+        {
+            const uint32_t capturedId = r.U32();
+            const uint32_t vShaderId = MapId(OBJECT_SHADER, r.U32());
+            const uint32_t fShaderId = MapId(OBJECT_SHADER, r.U32());
+            uint32_t id = 0;
+            REPLAY_CALL(id = ctx.LoadShaderProgram(vShaderId, fShaderId));
+            BindId(OBJECT_SHADER, capturedId, id);
+        } break;
+        case CaptureCommand::UnloadShaderProgram: { const uint32_t id = MapId(OBJECT_SHADER, r.U32()); REPLAY_CALL(ctx.UnloadShaderProgram(id)); } break;
+        case CaptureCommand::SetUniform:
+        {
+            const int locIndex = r.Int();
+            std::size_t blockSize = 0;
+            const void *value = r.Data(&blockSize);
+            const auto uniformType = r.Enum<ShaderUniformType>();
+            const int count = r.Int();
+            if ((value == nullptr) || !r.Fits(blockSize, GetUniformDataSize(uniformType, count))) return false;
+            REPLAY_CALL(ctx.SetUniform(locIndex, value, uniformType, count));
+        } break;
+        case CaptureCommand::SetUniformMatrix: { const int locIndex = r.Int(); const Matrix mat = r.Mat(); REPLAY_CALL(ctx.SetUniformMatrix(locIndex, mat)); } break;
+        case CaptureCommand::SetUniformSampler:
+        {
+            const int locIndex = r.Int();
+            const uint32_t textureId = MapId(OBJECT_TEXTURE, r.U32());
+            REPLAY_CALL(ctx.SetUniformSampler(locIndex, textureId));
+        } break;
+        case CaptureCommand::SetShader:
+        {
+            const uint32_t id = MapId(OBJECT_SHADER, r.U32());
+            std::size_t blockSize = 0;
+            const int *locs = static_cast<const int*>(r.Data(&blockSize));
+            if ((locs != nullptr) && !r.Fits(blockSize, RL_MAX_SHADER_LOCATIONS*sizeof(int))) return false;
+
+            // NOTE: Locations of the default shader are the ones of the replay context
+            if (id == ctx.GetState().defaultShaderId) locs = ctx.GetState().defaultShaderLocs;
+
+            REPLAY_CALL(ctx.SetShader(id, locs));
+        } break;
+        case CaptureCommand::LoadComputeShaderProgram:
+        {
+            const uint32_t capturedId = r.U32();
+            const uint32_t shaderId = MapId(OBJECT_SHADER, r.U32());
+            uint32_t id = 0;
+            REPLAY_CALL(id = ctx.LoadComputeShaderProgram(shaderId));
+            BindId(OBJECT_SHADER, capturedId, id);
+        } break;
+        case CaptureCommand::ComputeShaderDispatch:
+        {
+            const uint32_t groupX = r.U32(), groupY = r.U32(), groupZ = r.U32();
+            REPLAY_CALL(ctx.ComputeShaderDispatch(groupX, groupY, groupZ));
+        } break;
+        case CaptureCommand::ComputeShaderDispatchIndirect:
+        {
+            const uint32_t id = MapId(OBJECT_BUFFER, r.U32());
+            const uint32_t offset = r.U32();
+            REPLAY_CALL(ctx.ComputeShaderDispatchIndirect(id, offset));
+        } break;
+        case CaptureCommand::ComputeShaderBarrier: REPLAY_CALL(ctx.ComputeShaderBarrier()); break;
+
+        // Shader storage buffers
+        case CaptureCommand::LoadShaderBuffer:
+        {
+            const uint32_t capturedId = r.U32();
+            const uint32_t size = r.U32();
+            std::size_t blockSize = 0;
+            const void *data = r.Data(&blockSize);
+            const auto usageHint = r.Enum<BufferUsage>();
+            uint32_t id = 0;
+            if ((data != nullptr) && !r.Fits(blockSize, size)) return false;
+            REPLAY_CALL(id = ctx.LoadShaderBuffer(size, data, usageHint));
+            BindId(OBJECT_BUFFER, capturedId, id);
+        } break;
+        case CaptureCommand::UnloadShaderBuffer: { const uint32_t id = MapId(OBJECT_BUFFER, r.U32()); REPLAY_CALL(ctx.UnloadShaderBuffer(id)); } break;
+        case CaptureCommand::UpdateShaderBuffer:
+        {
+            const uint32_t id = MapId(OBJECT_BUFFER, r.U32());
+            std::size_t blockSize = 0;
+            const void *data = r.Data(&blockSize);
+            const uint32_t dataSize = r.U32();
+            const uint32_t offset = r.U32();
+            if ((data == nullptr) || !r.Fits(blockSize, dataSize)) return false;
+            REPLAY_CALL(ctx.UpdateShaderBuffer(id, data, dataSize, offset));
+        } break;
+        case CaptureCommand::BindShaderBuffer:
+        {
+            const uint32_t id = MapId(OBJECT_BUFFER, r.U32());
+            const uint32_t index = r.U32();
+            REPLAY_CALL(ctx.BindShaderBuffer(id, index));
+        } break;
+        case CaptureCommand::ReadShaderBuffer:
+        {
+            const uint32_t id = MapId(OBJECT_BUFFER, r.U32());
+            const uint32_t count = r.U32(), offset = r.U32();
+            std::vector<uint8_t> data(count);
+            REPLAY_CALL(ctx.ReadShaderBuffer(id, data.data(), count, offset));
+        } break;
+        case CaptureCommand::ReadShaderBufferAsync:
+        {
+            const uint32_t id = MapId(OBJECT_BUFFER, r.U32());
+            const uint32_t count = r.U32(), offset = r.U32();
+            REPLAY_CALL(ctx.ReadShaderBufferAsync(id, count, offset));
+        } break;
+        case CaptureCommand::CopyShaderBuffer:
+        {
+            const uint32_t destId = MapId(OBJECT_BUFFER, r.U32());
+            const uint32_t srcId = MapId(OBJECT_BUFFER, r.U32());
+            const uint32_t destOffset = r.U32(), srcOffset = r.U32(), count = r.U32();
+            REPLAY_CALL(ctx.CopyShaderBuffer(destId, srcId, destOffset, srcOffset, count));
+        } break;
+        case CaptureCommand::BindImageTexture:
+        {
+            const uint32_t id = MapId(OBJECT_TEXTURE, r.U32());
+            const uint32_t index = r.U32();
+            const int format = r.Int();
+            const bool readonly = r.Bool();
+            REPLAY_CALL(ctx.BindImageTexture(id, index, format, readonly));
+        } break;
+
+        // Matrices state
+        case CaptureCommand::SetMatrixProjection: { const Matrix proj = r.Mat(); REPLAY_CALL(ctx.SetMatrixProjection(proj)); } break;
+        case CaptureCommand::SetMatrixModelview: { const Matrix view = r.Mat(); REPLAY_CALL(ctx.SetMatrixModelview(view)); } break;
+        case CaptureCommand::SetMatrixProjectionStereo: { const Matrix right = r.Mat(), left = r.Mat(); REPLAY_CALL(ctx.SetMatrixProjectionStereo(right, left)); } break;
+        case CaptureCommand::SetMatrixViewOffsetStereo: { const Matrix right = r.Mat(), left = r.Mat(); REPLAY_CALL(ctx.SetMatrixViewOffsetStereo(right, left)); } break;
+
+        // Draw helpers
+        case CaptureCommand::LoadDrawCube: REPLAY_CALL(ctx.LoadDrawCube()); break;
+        case CaptureCommand::LoadDrawCubeInstanced: { const int instances = r.Int(); REPLAY_CALL(ctx.LoadDrawCubeInstanced(instances)); } break;
+        case CaptureCommand::LoadDrawQuad: REPLAY_CALL(ctx.LoadDrawQuad()); break;
+        case CaptureCommand::LoadDrawQuadInstanced: { const int instances = r.Int(); REPLAY_CALL(ctx.LoadDrawQuadInstanced(instances)); } break;
+        case CaptureCommand::DrawFullscreenTriangle: REPLAY_CALL(ctx.DrawFullscreenTriangle()); break;
+
+        default: r.failed = true; return false;
+    }
+
+    return !r.failed;
+}
+
+#undef REPLAY_CALL
+
+uint32_t CaptureReplay::MapId(uint8_t objectType, uint32_t id)
+{
+    if (id == 0) return 0;
+
+    const auto it = ids.find((static_cast<uint64_t>(objectType) << 32) | id);
+    if (it != ids.end()) return it->second;
+
+    // Object created before the capture: used as captured
+    unresolvedIds++;
+    return id;
+}
+
+void CaptureReplay::BindId(uint8_t objectType, uint32_t capturedId, uint32_t id)
+{
+    if (capturedId != 0) ids[(static_cast<uint64_t>(objectType) << 32) | capturedId] = id;
+}
+
+const uint8_t *CaptureReplay::GetBlob(uint64_t index, std::size_t *size) const
+{
+    const auto it = blobs.find(static_cast<uint32_t>(index));
+    if (it == blobs.end()) return nullptr;
+
+    *size = it->second.size();
+
+    // NOTE: Empty blocks are valid data, a non null pointer is returned
+    static const uint8_t empty = 0;
+    return it->second.empty()? &empty : it->second.data();
+}
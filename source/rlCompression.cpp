@@ -0,0 +1,1139 @@
+#include "rlCompression.hpp"
+#include "rlConfig.hpp"
+#include "rlGLExt.hpp"
+#include "rlMipmaps.hpp"
+#include "rlUtils.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <cfloat>
+#include <cmath>
+
+#if defined(RLGL_SIMD_SSE2)
+    #include <emmintrin.h>
+#elif defined(RLGL_SIMD_NEON)
+    #include <arm_neon.h>
+#endif
+
+using namespace rlgl;
+
+namespace {
+
+    // ETC1 intensity modifier tables (codewords), positive values of the 4 modifiers
+    // NOTE: Pixel index (msb << 1 | lsb) selects +a, +b, -a, -b
+    constexpr int ETC_MODIFIERS[8][2] = {
+        { 2, 8 }, { 5, 17 }, { 9, 29 }, { 13, 42 }, { 18, 60 }, { 24, 80 }, { 33, 106 }, { 47, 183 }
+    };
+
+    // EAC alpha modifier tables
+    constexpr int EAC_MODIFIERS[16][8] = {
+        { -3, -6, -9, -15, 2, 5, 8, 14 }, { -3, -7, -10, -13, 2, 6, 9, 12 },
+        { -2, -5, -8, -13, 1, 4, 7, 12 }, { -2, -4, -6, -13, 1, 3, 5, 12 },
+        { -3, -6, -8, -12, 2, 5, 7, 11 }, { -3, -7, -9, -11, 2, 6, 8, 10 },
+        { -4, -7, -8, -11, 3, 6, 7, 10 }, { -3, -5, -8, -11, 2, 4, 7, 10 },
+        { -2, -6, -8, -10, 1, 5, 7, 9 },  { -2, -5, -8, -10, 1, 4, 7, 9 },
+        { -2, -4, -8, -10, 1, 3, 7, 9 },  { -2, -5, -7, -10, 1, 4, 6, 9 },
+        { -3, -4, -7, -10, 2, 3, 6, 9 },  { -1, -2, -3, -10, 0, 1, 2, 9 },
+        { -4, -6, -8, -9, 3, 5, 7, 8 },   { -3, -5, -7, -9, 2, 4, 6, 8 }
+    };
+
+    // Pixels (row-major, y*4 + x) of each ETC subblock, for both orientations (flip bit)
+    constexpr int ETC_SUBBLOCK_PIXELS[2][2][8] = {
+        { { 0, 1, 4, 5, 8, 9, 12, 13 }, { 2, 3, 6, 7, 10, 11, 14, 15 } },     // 2x4 subblocks, side by side
+        { { 0, 1, 2, 3, 4, 5, 6, 7 }, { 8, 9, 10, 11, 12, 13, 14, 15 } }      // 4x2 subblocks, on top of each other
+    };
+
+    // DXT1 palette weights of the first and second endpoint, for the 4-color and 3-color modes
+    constexpr float BC1_WEIGHTS[2][4][2] = {
+        { { 1.0f, 0.0f }, { 0.0f, 1.0f }, { 2.0f/3.0f, 1.0f/3.0f }, { 1.0f/3.0f, 2.0f/3.0f } },
+        { { 1.0f, 0.0f }, { 0.0f, 1.0f }, { 0.5f, 0.5f }, { 0.0f, 0.0f } }
+    };
+
+    // Block pixels in structure of arrays layout (row-major), distances are computed 4 pixels at a time
+    struct BlockPixels
+    {
+        alignas(16) float r[16];
+        alignas(16) float g[16];
+        alignas(16) float b[16];
+        uint8_t a[16];
+    };
+
+    template <typename T>
+    T Clamp(T value, T min, T max)
+    {
+        return std::min(std::max(value, min), max);
+    }
+
+    int Quantize(float value, int max)
+    {
+        return Clamp(static_cast<int>(value*max/255.0f + 0.5f), 0, max);
+    }
+
+    // Fetch a 4x4 block of R8G8B8A8 pixels, replicating the last row and column on the borders
+    void FetchBlock(const uint8_t *pixels, int width, int height, int bx, int by, BlockPixels &block)
+    {
+        for (int y = 0; y < 4; y++)
+        {
+            const uint8_t *row = pixels + std::min(by*4 + y, height - 1)*width*4;
+
+            for (int x = 0; x < 4; x++)
+            {
+                const uint8_t *p = row + std::min(bx*4 + x, width - 1)*4;
+                const int i = y*4 + x;
+
+                block.r[i] = p[0];
+                block.g[i] = p[1];
+                block.b[i] = p[2];
+                block.a[i] = p[3];
+            }
+        }
+    }
+
+    // Find the nearest palette color of each pixel (count must be a multiple of 4)
+    // NOTE: Pixels with a zero mask value are not included in the returned squared error
+    float SelectIndices(const float *r, const float *g, const float *b, int count, const float (*palette)[3], int paletteSize,
+        const float *mask, uint8_t *indices)
+    {
+        float error = 0.0f;
+
+    #if defined(RLGL_SIMD_SSE2)
+        __m128 sum = _mm_setzero_ps();
+
+        for (int i = 0; i < count; i += 4)
+        {
+            const __m128 pr = _mm_loadu_ps(r + i);
+            const __m128 pg = _mm_loadu_ps(g + i);
+            const __m128 pb = _mm_loadu_ps(b + i);
+
+            __m128 best = _mm_set1_ps(FLT_MAX);
+            __m128i bestIndex = _mm_setzero_si128();
+
+            for (int p = 0; p < paletteSize; p++)
+            {
+                const __m128 dr = _mm_sub_ps(pr, _mm_set1_ps(palette[p][0]));
+                const __m128 dg = _mm_sub_ps(pg, _mm_set1_ps(palette[p][1]));
+                const __m128 db = _mm_sub_ps(pb, _mm_set1_ps(palette[p][2]));
+                const __m128 d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dr, dr), _mm_mul_ps(dg, dg)), _mm_mul_ps(db, db));
+
+                const __m128i less = _mm_castps_si128(_mm_cmplt_ps(d, best));
+                bestIndex = _mm_or_si128(_mm_and_si128(less, _mm_set1_epi32(p)), _mm_andnot_si128(less, bestIndex));
+                best = _mm_min_ps(d, best);
+            }
+
+            if (mask != nullptr) best = _mm_mul_ps(best, _mm_loadu_ps(mask + i));
+            sum = _mm_add_ps(sum, best);
+
+            alignas(16) int32_t index[4];
+            _mm_store_si128(reinterpret_cast<__m128i*>(index), bestIndex);
+            for (int k = 0; k < 4; k++) indices[i + k] = static_cast<uint8_t>(index[k]);
+        }
+
+        alignas(16) float lanes[4];
+        _mm_store_ps(lanes, sum);
+        error = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    #elif defined(RLGL_SIMD_NEON)
+        float32x4_t sum = vdupq_n_f32(0.0f);
+
+        for (int i = 0; i < count; i += 4)
+        {
+            const float32x4_t pr = vld1q_f32(r + i);
+            const float32x4_t pg = vld1q_f32(g + i);
+            const float32x4_t pb = vld1q_f32(b + i);
+
+            float32x4_t best = vdupq_n_f32(FLT_MAX);
+            uint32x4_t bestIndex = vdupq_n_u32(0);
+
+            for (int p = 0; p < paletteSize; p++)
+            {
+                const float32x4_t dr = vsubq_f32(pr, vdupq_n_f32(palette[p][0]));
+                const float32x4_t dg = vsubq_f32(pg, vdupq_n_f32(palette[p][1]));
+                const float32x4_t db = vsubq_f32(pb, vdupq_n_f32(palette[p][2]));
+                const float32x4_t d = vmlaq_f32(vmlaq_f32(vmulq_f32(dr, dr), dg, dg), db, db);
+
+                const uint32x4_t less = vcltq_f32(d, best);
+                bestIndex = vbslq_u32(less, vdupq_n_u32(p), bestIndex);
+                best = vminq_f32(d, best);
+            }
+
+            if (mask != nullptr) best = vmulq_f32(best, vld1q_f32(mask + i));
+            sum = vaddq_f32(sum, best);
+
+            uint32_t index[4];
+            vst1q_u32(index, bestIndex);
+            for (int k = 0; k < 4; k++) indices[i + k] = static_cast<uint8_t>(index[k]);
+        }
+
+        float lanes[4];
+        vst1q_f32(lanes, sum);
+        error = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    #else
+        for (int i = 0; i < count; i++)
+        {
+            float best = FLT_MAX;
+
+            for (int p = 0; p < paletteSize; p++)
+            {
+                const float dr = r[i] - palette[p][0];
+                const float dg = g[i] - palette[p][1];
+                const float db = b[i] - palette[p][2];
+                const float d = dr*dr + dg*dg + db*db;
+
+                if (d < best)
+                {
+                    best = d;
+                    indices[i] = static_cast<uint8_t>(p);
+                }
+            }
+
+            error += (mask != nullptr) ? best*mask[i] : best;
+        }
+    #endif
+
+        return error;
+    }
+
+    // DXT1 (BC1) color block encoder
+    //-----------------------------------------------------------------------------------------
+
+    struct Bc1Block
+    {
+        uint16_t color0 = 0;
+        uint16_t color1 = 0;
+        uint8_t indices[16] = { 0 };
+        float error = FLT_MAX;
+    };
+
+    uint16_t PackColor565(const float color[3])
+    {
+        return static_cast<uint16_t>((Quantize(color[0], 31) << 11) | (Quantize(color[1], 63) << 5) | Quantize(color[2], 31));
+    }
+
+    void UnpackColor565(uint16_t value, float color[3])
+    {
+        const int r = (value >> 11) & 0x1f;
+        const int g = (value >> 5) & 0x3f;
+        const int b = value & 0x1f;
+
+        color[0] = static_cast<float>((r << 3) | (r >> 2));
+        color[1] = static_cast<float>((g << 2) | (g >> 4));
+        color[2] = static_cast<float>((b << 3) | (b >> 2));
+    }
+
+    // Quantize the endpoints and select the pixel indices
+    // NOTE: The 4-color mode requires color0 > color1, the 3-color mode (index 3 black or transparent) color0 <= color1
+    Bc1Block EvaluateBc1(const BlockPixels &block, const float *mask, bool transparent, bool allowBlack,
+        const float endpoint0[3], const float endpoint1[3], bool threeColor)
+    {
+        Bc1Block result;
+        result.color0 = PackColor565(endpoint0);
+        result.color1 = PackColor565(endpoint1);
+
+        if (threeColor == (result.color0 > result.color1)) std::swap(result.color0, result.color1);
+
+        float palette[4][3] = { { 0.0f } };
+        UnpackColor565(result.color0, palette[0]);
+        UnpackColor565(result.color1, palette[1]);
+
+        int paletteSize = 4;
+
+        if (result.color0 > result.color1)
+        {
+            for (int c = 0; c < 3; c++)
+            {
+                palette[2][c] = (2.0f*palette[0][c] + palette[1][c])/3.0f;
+                palette[3][c] = (palette[0][c] + 2.0f*palette[1][c])/3.0f;
+            }
+        }
+        else
+        {
+            for (int c = 0; c < 3; c++) palette[2][c] = (palette[0][c] + palette[1][c])*0.5f;
+            if (!allowBlack) paletteSize = 3;
+        }
+
+        result.error = SelectIndices(block.r, block.g, block.b, 16, palette, paletteSize, mask, result.indices);
+
+        if (transparent)
+        {
+            for (int i = 0; i < 16; i++) if (mask[i] == 0.0f) result.indices[i] = 3;
+        }
+
+        return result;
+    }
+
+    // Solve the endpoints minimizing the squared error for the current indices (least squares)
+    bool RefineBc1(const BlockPixels &block, const float *mask, const Bc1Block &current, float endpoint0[3], float endpoint1[3])
+    {
+        const int mode = (current.color0 > current.color1)? 0 : 1;
+        float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+        float ax[3] = { 0.0f }, bx[3] = { 0.0f };
+
+        for (int i = 0; i < 16; i++)
+        {
+            if ((mask != nullptr) && (mask[i] == 0.0f)) continue;
+
+            const float a = BC1_WEIGHTS[mode][current.indices[i]][0];
+            const float b = BC1_WEIGHTS[mode][current.indices[i]][1];
+            const float pixel[3] = { block.r[i], block.g[i], block.b[i] };
+
+            aa += a*a;
+            ab += a*b;
+            bb += b*b;
+
+            for (int c = 0; c < 3; c++)
+            {
+                ax[c] += a*pixel[c];
+                bx[c] += b*pixel[c];
+            }
+        }
+
+        const float det = aa*bb - ab*ab;
+        if (std::fabs(det) < 1e-6f) return false;
+
+        for (int c = 0; c < 3; c++)
+        {
+            endpoint0[c] = Clamp((bb*ax[c] - ab*bx[c])/det, 0.0f, 255.0f);
+            endpoint1[c] = Clamp((aa*bx[c] - ab*ax[c])/det, 0.0f, 255.0f);
+        }
+
+        return true;
+    }
+
+    // Compute initial endpoints: bounding box diagonal (fast) or extent of the colors along the principal axis
+    void ComputeBc1Endpoints(const BlockPixels &block, const float *mask, CompressionQuality quality, float endpoint0[3], float endpoint1[3])
+    {
+        float min[3] = { 255.0f, 255.0f, 255.0f };
+        float max[3] = { 0.0f, 0.0f, 0.0f };
+        float mean[3] = { 0.0f };
+        float count = 0.0f;
+
+        for (int i = 0; i < 16; i++)
+        {
+            if ((mask != nullptr) && (mask[i] == 0.0f)) continue;
+
+            const float pixel[3] = { block.r[i], block.g[i], block.b[i] };
+
+            for (int c = 0; c < 3; c++)
+            {
+                min[c] = std::min(min[c], pixel[c]);
+                max[c] = std::max(max[c], pixel[c]);
+                mean[c] += pixel[c];
+            }
+
+            count += 1.0f;
+        }
+
+        if (quality == CompressionQuality::Fast)
+        {
+            // Inset the bounding box to reduce the error of the extreme colors
+            for (int c = 0; c < 3; c++)
+            {
+                const float inset = (max[c] - min[c])/16.0f;
+                endpoint0[c] = max[c] - inset;
+                endpoint1[c] = min[c] + inset;
+            }
+
+            return;
+        }
+
+        for (int c = 0; c < 3; c++) mean[c] /= count;
+
+        float covariance[6] = { 0.0f };     // xx, xy, xz, yy, yz, zz
+
+        for (int i = 0; i < 16; i++)
+        {
+            if ((mask != nullptr) && (mask[i] == 0.0f)) continue;
+
+            const float d[3] = { block.r[i] - mean[0], block.g[i] - mean[1], block.b[i] - mean[2] };
+
+            covariance[0] += d[0]*d[0];
+            covariance[1] += d[0]*d[1];
+            covariance[2] += d[0]*d[2];
+            covariance[3] += d[1]*d[1];
+            covariance[4] += d[1]*d[2];
+            covariance[5] += d[2]*d[2];
+        }
+
+        // Principal axis by power iteration, starting from the bounding box diagonal
+        float axis[3] = { max[0] - min[0], max[1] - min[1], max[2] - min[2] };
+
+        for (int k = 0; k < 8; k++)
+        {
+            const float x = covariance[0]*axis[0] + covariance[1]*axis[1] + covariance[2]*axis[2];
+            const float y = covariance[1]*axis[0] + covariance[3]*axis[1] + covariance[4]*axis[2];
+            const float z = covariance[2]*axis[0] + covariance[4]*axis[1] + covariance[5]*axis[2];
+            const float length = std::max(std::max(std::fabs(x), std::fabs(y)), std::fabs(z));
+
+            if (length < 1e-6f) break;
+
+            axis[0] = x/length;
+            axis[1] = y/length;
+            axis[2] = z/length;
+        }
+
+        const float length2 = axis[0]*axis[0] + axis[1]*axis[1] + axis[2]*axis[2];
+
+        if (length2 < 1e-6f)
+        {
+            for (int c = 0; c < 3; c++) endpoint0[c] = endpoint1[c] = mean[c];
+            return;
+        }
+
+        float tmin = FLT_MAX, tmax = -FLT_MAX;
+
+        for (int i = 0; i < 16; i++)
+        {
+            if ((mask != nullptr) && (mask[i] == 0.0f)) continue;
+
+            const float t = ((block.r[i] - mean[0])*axis[0] + (block.g[i] - mean[1])*axis[1] + (block.b[i] - mean[2])*axis[2])/length2;
+            tmin = std::min(tmin, t);
+            tmax = std::max(tmax, t);
+        }
+
+        for (int c = 0; c < 3; c++)
+        {
+            endpoint0[c] = Clamp(mean[c] + axis[c]*tmax, 0.0f, 255.0f);
+            endpoint1[c] = Clamp(mean[c] + axis[c]*tmin, 0.0f, 255.0f);
+        }
+    }
+
+    // Encode a DXT1 color block (8 bytes)
+    // NOTE: punchThrough enables 1-bit alpha (DXT1_RGBA), DXT3/DXT5 color blocks must use the 4-color mode
+    void EncodeBlockBc1(const BlockPixels &block, uint8_t *out, CompressionQuality quality, bool punchThrough, bool allowThreeColor)
+    {
+        float mask[16];
+        int opaqueCount = 0;
+
+        for (int i = 0; i < 16; i++)
+        {
+            mask[i] = (!punchThrough || (block.a[i] >= 128))? 1.0f : 0.0f;
+            if (mask[i] != 0.0f) opaqueCount++;
+        }
+
+        const bool transparent = (opaqueCount < 16);
+
+        if (opaqueCount == 0)
+        {
+            // Fully transparent block, 3-color mode with every index transparent
+            std::memset(out, 0, 4);
+            std::memset(out + 4, 0xff, 4);
+            return;
+        }
+
+        const bool allowBlack = !punchThrough && allowThreeColor;
+
+        float endpoint0[3], endpoint1[3];
+        ComputeBc1Endpoints(block, mask, quality, endpoint0, endpoint1);
+
+        Bc1Block best = EvaluateBc1(block, mask, transparent, allowBlack, endpoint0, endpoint1, transparent);
+
+        const int iterations = (quality == CompressionQuality::Fast)? 0 : (quality == CompressionQuality::Normal)? 1 : 4;
+
+        for (int k = 0; (k < iterations) && (best.error > 0.0f); k++)
+        {
+            if (!RefineBc1(block, mask, best, endpoint0, endpoint1)) break;
+
+            const Bc1Block candidate = EvaluateBc1(block, mask, transparent, allowBlack, endpoint0, endpoint1, transparent);
+            if (candidate.error < best.error) best = candidate;
+            else break;
+        }
+
+        if ((quality == CompressionQuality::High) && !transparent && allowThreeColor && (best.error > 0.0f))
+        {
+            // The 3-color mode (and black) can fit some blocks better
+            ComputeBc1Endpoints(block, mask, quality, endpoint0, endpoint1);
+            Bc1Block candidate = EvaluateBc1(block, mask, false, allowBlack, endpoint0, endpoint1, true);
+
+            if (RefineBc1(block, mask, candidate, endpoint0, endpoint1))
+            {
+                const Bc1Block refined = EvaluateBc1(block, mask, false, allowBlack, endpoint0, endpoint1, true);
+                if (refined.error < candidate.error) candidate = refined;
+            }
+
+            if (candidate.error < best.error) best = candidate;
+        }
+
+        uint32_t indices = 0;
+        for (int i = 0; i < 16; i++) indices |= static_cast<uint32_t>(best.indices[i]) << (2*i);
+
+        out[0] = best.color0 & 0xff;
+        out[1] = best.color0 >> 8;
+        out[2] = best.color1 & 0xff;
+        out[3] = best.color1 >> 8;
+        out[4] = indices & 0xff;
+        out[5] = (indices >> 8) & 0xff;
+        out[6] = (indices >> 16) & 0xff;
+        out[7] = indices >> 24;
+    }
+
+    // DXT3/DXT5 alpha block encoders
+    //-----------------------------------------------------------------------------------------
+
+    // Encode an explicit 4-bit alpha block (8 bytes)
+    void EncodeBlockBc2Alpha(const BlockPixels &block, uint8_t *out)
+    {
+        std::memset(out, 0, 8);
+
+        for (int i = 0; i < 16; i++)
+        {
+            const int alpha = (block.a[i]*15 + 127)/255;
+            out[i/2] |= static_cast<uint8_t>(alpha << (4*(i & 1)));
+        }
+    }
+
+    // Select the nearest interpolated alpha of each pixel, returns the squared error
+    int EvaluateBc3Alpha(const BlockPixels &block, int alpha0, int alpha1, uint8_t *indices)
+    {
+        int palette[8] = { alpha0, alpha1 };
+
+        if (alpha0 > alpha1)
+        {
+            for (int i = 1; i < 7; i++) palette[i + 1] = ((7 - i)*alpha0 + i*alpha1 + 3)/7;
+        }
+        else
+        {
+            for (int i = 1; i < 5; i++) palette[i + 1] = ((5 - i)*alpha0 + i*alpha1 + 2)/5;
+            palette[6] = 0;
+            palette[7] = 255;
+        }
+
+        int error = 0;
+
+        for (int i = 0; i < 16; i++)
+        {
+            int best = INT32_MAX;
+
+            for (int p = 0; p < 8; p++)
+            {
+                const int d = block.a[i] - palette[p];
+                if (d*d < best)
+                {
+                    best = d*d;
+                    indices[i] = static_cast<uint8_t>(p);
+                }
+            }
+
+            error += best;
+        }
+
+        return error;
+    }
+
+    // Encode an interpolated alpha block (8 bytes)
+    void EncodeBlockBc3Alpha(const BlockPixels &block, uint8_t *out, CompressionQuality quality)
+    {
+        int min = 255, max = 0;             // Range of all the values
+        int innerMin = 255, innerMax = 0;   // Range excluding 0 and 255 (6-alpha mode)
+
+        for (int i = 0; i < 16; i++)
+        {
+            min = std::min(min, static_cast<int>(block.a[i]));
+            max = std::max(max, static_cast<int>(block.a[i]));
+
+            if ((block.a[i] != 0) && (block.a[i] != 255))
+            {
+                innerMin = std::min(innerMin, static_cast<int>(block.a[i]));
+                innerMax = std::max(innerMax, static_cast<int>(block.a[i]));
+            }
+        }
+
+        int alpha0 = max, alpha1 = min;
+        uint8_t indices[16] = { 0 };
+        int error = EvaluateBc3Alpha(block, alpha0, alpha1, indices);
+
+        auto tryEndpoints = [&](int a0, int a1) {
+            uint8_t candidate[16];
+            const int candidateError = EvaluateBc3Alpha(block, a0, a1, candidate);
+
+            if (candidateError < error)
+            {
+                error = candidateError;
+                alpha0 = a0;
+                alpha1 = a1;
+                std::memcpy(indices, candidate, 16);
+            }
+        };
+
+        if ((quality != CompressionQuality::Fast) && (error > 0))
+        {
+            if (innerMin <= innerMax) tryEndpoints(innerMin, innerMax);
+
+            if (quality == CompressionQuality::High)
+            {
+                for (int a0 = max; a0 >= std::max(max - 3, min + 1); a0--)
+                {
+                    for (int a1 = min; a1 <= std::min(min + 3, a0 - 1); a1++) tryEndpoints(a0, a1);
+                }
+            }
+        }
+
+        uint64_t bits = 0;
+        for (int i = 0; i < 16; i++) bits |= static_cast<uint64_t>(indices[i]) << (3*i);
+
+        out[0] = static_cast<uint8_t>(alpha0);
+        out[1] = static_cast<uint8_t>(alpha1);
+        for (int i = 0; i < 6; i++) out[2 + i] = static_cast<uint8_t>(bits >> (8*i));
+    }
+
+    // ETC1/ETC2 color block encoder
+    //-----------------------------------------------------------------------------------------
+
+    struct EtcBlock
+    {
+        bool differential = false;
+        bool flip = false;
+        int base[2][3] = { { 0 } };         ///< Quantized base colors (4 or 5 bits) of each subblock
+        int table[2] = { 0 };               ///< Modifier table of each subblock
+        uint8_t indices[16] = { 0 };        ///< Modifier index of each pixel (row-major)
+        float subblockError[2] = { 0.0f };  ///< Squared error of each subblock
+        float error = FLT_MAX;
+    };
+
+    int Expand4(int value) { return (value << 4) | value; }
+    int Expand5(int value) { return (value << 3) | (value >> 2); }
+    int Expand6(int value) { return (value << 2) | (value >> 4); }
+    int Expand7(int value) { return (value << 1) | (value >> 6); }
+
+    // Find the best modifier table of a subblock for an expanded base color
+    float FitEtcSubblock(const BlockPixels &block, int flip, int subblock, const int base[3], int &table, uint8_t *indices)
+    {
+        alignas(16) float r[8], g[8], b[8];
+
+        for (int k = 0; k < 8; k++)
+        {
+            const int i = ETC_SUBBLOCK_PIXELS[flip][subblock][k];
+            r[k] = block.r[i];
+            g[k] = block.g[i];
+            b[k] = block.b[i];
+        }
+
+        float best = FLT_MAX;
+        uint8_t candidate[8];
+
+        for (int t = 0; t < 8; t++)
+        {
+            float palette[4][3];
+
+            for (int p = 0; p < 4; p++)
+            {
+                const int modifier = ((p & 2)? -1 : 1)*ETC_MODIFIERS[t][p & 1];
+                for (int c = 0; c < 3; c++) palette[p][c] = static_cast<float>(Clamp(base[c] + modifier, 0, 255));
+            }
+
+            const float error = SelectIndices(r, g, b, 8, palette, 4, nullptr, candidate);
+
+            if (error < best)
+            {
+                best = error;
+                table = t;
+                for (int k = 0; k < 8; k++) indices[ETC_SUBBLOCK_PIXELS[flip][subblock][k]] = candidate[k];
+                if (error == 0.0f) break;
+            }
+        }
+
+        return best;
+    }
+
+    // Evaluate a subblock of a candidate with its quantized base color
+    void EvaluateEtcSubblock(const BlockPixels &block, EtcBlock &candidate, int subblock)
+    {
+        int base[3];
+        for (int c = 0; c < 3; c++) base[c] = candidate.differential? Expand5(candidate.base[subblock][c]) : Expand4(candidate.base[subblock][c]);
+
+        candidate.subblockError[subblock] = FitEtcSubblock(block, candidate.flip, subblock, base, candidate.table[subblock], candidate.indices);
+        candidate.error = candidate.subblockError[0] + candidate.subblockError[1];
+    }
+
+    void EvaluateEtc(const BlockPixels &block, EtcBlock &candidate)
+    {
+        EvaluateEtcSubblock(block, candidate, 0);
+        EvaluateEtcSubblock(block, candidate, 1);
+    }
+
+    // Search the base colors around the current ones (one step on each channel)
+    // NOTE: Only the modified subblock is fitted again, the other one keeps its table and indices
+    void RefineEtc(const BlockPixels &block, EtcBlock &best)
+    {
+        const int max = best.differential? 31 : 15;
+
+        for (int s = 0; s < 2; s++)
+        {
+            const EtcBlock current = best;
+
+            for (int d = 0; d < 27; d++)
+            {
+                if (d == 13) continue;      // Current base color
+
+                EtcBlock candidate = current;
+                const int offset[3] = { d%3 - 1, (d/3)%3 - 1, d/9 - 1 };
+                bool valid = true;
+
+                for (int c = 0; c < 3; c++)
+                {
+                    candidate.base[s][c] += offset[c];
+                    if ((candidate.base[s][c] < 0) || (candidate.base[s][c] > max)) valid = false;
+
+                    const int delta = candidate.base[1][c] - candidate.base[0][c];
+                    if (candidate.differential && ((delta < -4) || (delta > 3))) valid = false;
+                }
+
+                if (!valid) continue;
+
+                EvaluateEtcSubblock(block, candidate, s);
+                if (candidate.error < best.error) best = candidate;
+            }
+        }
+    }
+
+    // Find the best individual/differential mode block
+    EtcBlock EncodeEtc1(const BlockPixels &block, CompressionQuality quality)
+    {
+        EtcBlock best;
+
+        for (int flip = 0; flip < 2; flip++)
+        {
+            float average[2][3] = { { 0.0f } };
+
+            for (int s = 0; s < 2; s++)
+            {
+                for (int k = 0; k < 8; k++)
+                {
+                    const int i = ETC_SUBBLOCK_PIXELS[flip][s][k];
+                    average[s][0] += block.r[i];
+                    average[s][1] += block.g[i];
+                    average[s][2] += block.b[i];
+                }
+
+                for (int c = 0; c < 3; c++) average[s][c] /= 8.0f;
+            }
+
+            // Differential mode, second base color clamped to the delta range
+            EtcBlock differential;
+            differential.differential = true;
+            differential.flip = (flip != 0);
+
+            bool fits = true;
+
+            for (int c = 0; c < 3; c++)
+            {
+                differential.base[0][c] = Quantize(average[0][c], 31);
+                const int quantized = Quantize(average[1][c], 31);
+                differential.base[1][c] = Clamp(quantized, differential.base[0][c] - 4, differential.base[0][c] + 3);
+
+                if (differential.base[1][c] != quantized) fits = false;
+            }
+
+            EvaluateEtc(block, differential);
+            if (differential.error < best.error) best = differential;
+
+            // Individual mode, only if the colors are too different for the fast quality
+            if ((quality != CompressionQuality::Fast) || !fits)
+            {
+                EtcBlock individual;
+                individual.flip = (flip != 0);
+
+                for (int s = 0; s < 2; s++)
+                {
+                    for (int c = 0; c < 3; c++) individual.base[s][c] = Quantize(average[s][c], 15);
+                }
+
+                EvaluateEtc(block, individual);
+                if (individual.error < best.error) best = individual;
+            }
+        }
+
+        if ((quality == CompressionQuality::High) && (best.error > 0.0f)) RefineEtc(block, best);
+
+        return best;
+    }
+
+    void PackEtc1(const EtcBlock &block, uint8_t *out)
+    {
+        uint32_t high = 0;
+
+        if (block.differential)
+        {
+            for (int c = 0; c < 3; c++)
+            {
+                const int delta = block.base[1][c] - block.base[0][c];
+                high |= static_cast<uint32_t>((block.base[0][c] << 3) | (delta & 7)) << (24 - 8*c);
+            }
+        }
+        else
+        {
+            for (int c = 0; c < 3; c++) high |= static_cast<uint32_t>((block.base[0][c] << 4) | block.base[1][c]) << (24 - 8*c);
+        }
+
+        high |= (block.table[0] << 5) | (block.table[1] << 2) | ((block.differential? 1 : 0) << 1) | (block.flip? 1 : 0);
+
+        // NOTE: Pixel indices are stored in column-major order, most significant bits first
+        uint32_t low = 0;
+
+        for (int i = 0; i < 16; i++)
+        {
+            const int bit = (i & 3)*4 + i/4;
+            low |= ((block.indices[i] >> 1) & 1u) << (16 + bit);
+            low |= (block.indices[i] & 1u) << bit;
+        }
+
+        for (int i = 0; i < 4; i++)
+        {
+            out[i] = static_cast<uint8_t>(high >> (24 - 8*i));
+            out[4 + i] = static_cast<uint8_t>(low >> (24 - 8*i));
+        }
+    }
+
+    // ETC2 planar mode, colors are interpolated from the origin, horizontal and vertical colors
+    struct PlanarBlock
+    {
+        int origin[3] = { 0 };              ///< Origin color (6:7:6 bits)
+        int horizontal[3] = { 0 };          ///< Color at x = 4 (6:7:6 bits)
+        int vertical[3] = { 0 };            ///< Color at y = 4 (6:7:6 bits)
+        float error = FLT_MAX;
+    };
+
+    void EvaluatePlanar(const BlockPixels &block, PlanarBlock &planar)
+    {
+        int o[3], h[3], v[3];
+
+        for (int c = 0; c < 3; c++)
+        {
+            o[c] = (c == 1)? Expand7(planar.origin[c]) : Expand6(planar.origin[c]);
+            h[c] = (c == 1)? Expand7(planar.horizontal[c]) : Expand6(planar.horizontal[c]);
+            v[c] = (c == 1)? Expand7(planar.vertical[c]) : Expand6(planar.vertical[c]);
+        }
+
+        const float *pixels[3] = { block.r, block.g, block.b };
+        float error = 0.0f;
+
+        for (int i = 0; i < 16; i++)
+        {
+            const int x = i & 3;
+            const int y = i >> 2;
+
+            for (int c = 0; c < 3; c++)
+            {
+                const int color = Clamp((x*(h[c] - o[c]) + y*(v[c] - o[c]) + 4*o[c] + 2) >> 2, 0, 255);
+                const float d = pixels[c][i] - color;
+                error += d*d;
+            }
+        }
+
+        planar.error = error;
+    }
+
+    // Fit a plane to each channel (least squares) and quantize the corner colors
+    PlanarBlock EncodePlanar(const BlockPixels &block, CompressionQuality quality)
+    {
+        PlanarBlock planar;
+        const float *pixels[3] = { block.r, block.g, block.b };
+
+        for (int c = 0; c < 3; c++)
+        {
+            float sum = 0.0f, sumX = 0.0f, sumY = 0.0f;
+
+            for (int i = 0; i < 16; i++)
+            {
+                sum += pixels[c][i];
+                sumX += ((i & 3) - 1.5f)*pixels[c][i];
+                sumY += ((i >> 2) - 1.5f)*pixels[c][i];
+            }
+
+            // NOTE: Sum of (x - 1.5)^2 over the 16 pixels is 20
+            const float dx = sumX/20.0f;
+            const float dy = sumY/20.0f;
+            const float origin = sum/16.0f - 1.5f*dx - 1.5f*dy;
+            const int max = (c == 1)? 127 : 63;
+
+            planar.origin[c] = Quantize(origin, max);
+            planar.horizontal[c] = Quantize(origin + 4.0f*dx, max);
+            planar.vertical[c] = Quantize(origin + 4.0f*dy, max);
+        }
+
+        EvaluatePlanar(block, planar);
+
+        if (quality == CompressionQuality::High)
+        {
+            // Greedy search of every quantized component
+            for (int pass = 0; (pass < 2) && (planar.error > 0.0f); pass++)
+            {
+                for (int k = 0; k < 9; k++)
+                {
+                    const int c = k%3;
+                    const int max = (c == 1)? 127 : 63;
+
+                    for (int step = -1; step <= 1; step += 2)
+                    {
+                        PlanarBlock candidate = planar;
+                        int *value = (k < 3)? &candidate.origin[c] : (k < 6)? &candidate.horizontal[c] : &candidate.vertical[c];
+
+                        *value += step;
+                        if ((*value < 0) || (*value > max)) continue;
+
+                        EvaluatePlanar(block, candidate);
+                        if (candidate.error < planar.error) planar = candidate;
+                    }
+                }
+            }
+        }
+
+        return planar;
+    }
+
+    int SignExtend3(int value) { return (value >= 4)? value - 8 : value; }
+
+    // Pack a planar block, the unused bits are set to make the differential blue overflow
+    // NOTE: Red and green must not overflow (T and H modes), returns false if no combination works
+    bool PackPlanar(const PlanarBlock &planar, uint8_t *out)
+    {
+        const int ro = planar.origin[0], go = planar.origin[1], bo = planar.origin[2];
+        const int rh = planar.horizontal[0], gh = planar.horizontal[1], bh = planar.horizontal[2];
+        const int rv = planar.vertical[0], gv = planar.vertical[1], bv = planar.vertical[2];
+
+        const uint32_t high = (ro << 25) | ((go >> 6) << 24) | ((go & 0x3f) << 17) | ((bo >> 5) << 16) |
+            (((bo >> 3) & 3) << 11) | ((bo & 7) << 7) | ((rh >> 1) << 2) | (1 << 1) | (rh & 1);
+        const uint32_t low = (gh << 25) | (bh << 19) | (rv << 13) | (gv << 6) | bv;
+
+        for (uint32_t bits = 0; bits < 64; bits++)
+        {
+            const uint32_t word = high | ((bits & 1) << 31) | (((bits >> 1) & 1) << 23) | (((bits >> 2) & 7) << 13) | ((bits >> 5) << 10);
+
+            const int r = static_cast<int>((word >> 27) & 0x1f) + SignExtend3((word >> 24) & 7);
+            const int g = static_cast<int>((word >> 19) & 0x1f) + SignExtend3((word >> 16) & 7);
+            const int b = static_cast<int>((word >> 11) & 0x1f) + SignExtend3((word >> 8) & 7);
+
+            if ((r >= 0) && (r <= 31) && (g >= 0) && (g <= 31) && ((b < 0) || (b > 31)))
+            {
+                for (int i = 0; i < 4; i++)
+                {
+                    out[i] = static_cast<uint8_t>(word >> (24 - 8*i));
+                    out[4 + i] = static_cast<uint8_t>(low >> (24 - 8*i));
+                }
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    // Encode an ETC1 or ETC2 color block (8 bytes)
+    void EncodeBlockEtc(const BlockPixels &block, uint8_t *out, CompressionQuality quality, bool etc2)
+    {
+        const EtcBlock etc1 = EncodeEtc1(block, quality);
+
+        if (etc2 && (quality != CompressionQuality::Fast) && (etc1.error > 0.0f))
+        {
+            const PlanarBlock planar = EncodePlanar(block, quality);
+            if ((planar.error < etc1.error) && PackPlanar(planar, out)) return;
+        }
+
+        PackEtc1(etc1, out);
+    }
+
+    // Encode an EAC alpha block (8 bytes)
+    void EncodeBlockEac(const BlockPixels &block, uint8_t *out, CompressionQuality quality)
+    {
+        int min = 255, max = 0;
+
+        for (int i = 0; i < 16; i++)
+        {
+            min = std::min(min, static_cast<int>(block.a[i]));
+            max = std::max(max, static_cast<int>(block.a[i]));
+        }
+
+        // Constant block: table 13 has a zero modifier (index 4)
+        int bestBase = min, bestMultiplier = 1, bestTable = 13;
+        uint8_t bestIndices[16];
+        std::memset(bestIndices, 4, 16);
+
+        if (min != max)
+        {
+            const int multiplierRange = (quality == CompressionQuality::Fast)? 0 : (quality == CompressionQuality::Normal)? 1 : 2;
+            const int baseRange = (quality == CompressionQuality::High)? 2 : 0;
+            int bestError = INT32_MAX;
+
+            for (int t = 0; (t < 16) && (bestError > 0); t++)
+            {
+                const int span = EAC_MODIFIERS[t][7] - EAC_MODIFIERS[t][3];
+                const int multiplier = Clamp(((max - min) + span/2)/span, 1, 15);
+
+                for (int m = std::max(multiplier - multiplierRange, 1); m <= std::min(multiplier + multiplierRange, 15); m++)
+                {
+                    const int center = static_cast<int>(std::lround((min + max)*0.5f - (EAC_MODIFIERS[t][3] + EAC_MODIFIERS[t][7])*m*0.5f));
+
+                    for (int base = std::max(center - baseRange, 0); base <= std::min(center + baseRange, 255); base++)
+                    {
+                        int palette[8];
+                        for (int p = 0; p < 8; p++) palette[p] = Clamp(base + EAC_MODIFIERS[t][p]*m, 0, 255);
+
+                        uint8_t indices[16];
+                        int error = 0;
+
+                        for (int i = 0; (i < 16) && (error < bestError); i++)
+                        {
+                            int best = INT32_MAX;
+
+                            for (int p = 0; p < 8; p++)
+                            {
+                                const int d = block.a[i] - palette[p];
+                                if (d*d < best)
+                                {
+                                    best = d*d;
+                                    indices[i] = static_cast<uint8_t>(p);
+                                }
+                            }
+
+                            error += best;
+                        }
+
+                        if (error < bestError)
+                        {
+                            bestError = error;
+                            bestBase = base;
+                            bestMultiplier = m;
+                            bestTable = t;
+                            std::memcpy(bestIndices, indices, 16);
+                        }
+                    }
+                }
+            }
+        }
+
+        // NOTE: Pixel indices are stored in column-major order, first pixel in the most significant bits
+        uint64_t bits = 0;
+        for (int i = 0; i < 16; i++) bits |= static_cast<uint64_t>(bestIndices[i]) << (45 - 3*((i & 3)*4 + i/4));
+
+        out[0] = static_cast<uint8_t>(bestBase);
+        out[1] = static_cast<uint8_t>((bestMultiplier << 4) | bestTable);
+        for (int i = 0; i < 6; i++) out[2 + i] = static_cast<uint8_t>(bits >> (40 - 8*i));
+    }
+
+}
+
+/* TEXTURE COMPRESSION IMPLEMENTATION */
+
+// Check if compressed format can be produced by the CPU encoder
+bool rlgl::IsCompressionFormatSupported(PixelFormat format)
+{
+    switch (format)
+    {
+        case PixelFormat::DXT1_RGB:
+        case PixelFormat::DXT1_RGBA:
+        case PixelFormat::DXT3_RGBA:
+        case PixelFormat::DXT5_RGBA:
+        case PixelFormat::ETC1_RGB:
+        case PixelFormat::ETC2_RGB:
+        case PixelFormat::ETC2_EAC_RGBA:    return true;
+        default:                            return false;
+    }
+}
+
+// Get best compressed format supported by the driver and the CPU encoder
+PixelFormat rlgl::GetCompressionFormat(bool alpha)
+{
+    const GlExtensions& extensions = GetExtensions();
+
+    if (alpha)
+    {
+        if (extensions.texCompDXT) return PixelFormat::DXT5_RGBA;
+        if (extensions.texCompETC2) return PixelFormat::ETC2_EAC_RGBA;
+    }
+    else
+    {
+        if (extensions.texCompDXT) return PixelFormat::DXT1_RGB;
+        if (extensions.texCompETC2) return PixelFormat::ETC2_RGB;
+        if (extensions.texCompETC1) return PixelFormat::ETC1_RGB;
+    }
+
+    return PixelFormat::R8G8B8A8;
+}
+
+// Compress R8G8B8A8 image on the CPU
+// NOTE: Rows of blocks are encoded by multiple threads
+bool rlgl::CompressImage(const void *data, int width, int height, PixelFormat format, void *dest, CompressionQuality quality)
+{
+    if (!IsCompressionFormatSupported(format) || (data == nullptr) || (dest == nullptr) || (width <= 0) || (height <= 0))
+    {
+        TRACELOG(LogWarning, "TEXTURE: CPU compression not supported for pixel format (%i)", format);
+        return false;
+    }
+
+    const uint8_t *pixels = static_cast<const uint8_t*>(data);
+    uint8_t *blocks = static_cast<uint8_t*>(dest);
+
+    const int blocksX = (width + 3)/4;
+    const int blocksY = (height + 3)/4;
+    const int blockSize = GetPixelDataSize(4, 4, format);
+
+    ParallelFor(blocksY, [&](int begin, int end) {
+        BlockPixels block;
+
+        for (int by = begin; by < end; by++)
+        {
+            for (int bx = 0; bx < blocksX; bx++)
+            {
+                uint8_t *out = blocks + (by*blocksX + bx)*blockSize;
+                FetchBlock(pixels, width, height, bx, by, block);
+
+                switch (format)
+                {
+                    case PixelFormat::DXT1_RGB: EncodeBlockBc1(block, out, quality, false, true); break;
+                    case PixelFormat::DXT1_RGBA: EncodeBlockBc1(block, out, quality, true, true); break;
+                    case PixelFormat::DXT3_RGBA:
+                    {
+                        EncodeBlockBc2Alpha(block, out);
+                        EncodeBlockBc1(block, out + 8, quality, false, false);
+                    } break;
+                    case PixelFormat::DXT5_RGBA:
+                    {
+                        EncodeBlockBc3Alpha(block, out, quality);
+                        EncodeBlockBc1(block, out + 8, quality, false, false);
+                    } break;
+                    case PixelFormat::ETC1_RGB: EncodeBlockEtc(block, out, quality, false); break;
+                    case PixelFormat::ETC2_RGB: EncodeBlockEtc(block, out, quality, true); break;
+                    case PixelFormat::ETC2_EAC_RGBA:
+                    {
+                        EncodeBlockEac(block, out, quality);
+                        EncodeBlockEtc(block, out + 8, quality, true);
+                    } break;
+                    default: break;
+                }
+            }
+        }
+    });
+
+    return true;
+}
+
+// Compress R8G8B8A8 image on the CPU
+std::vector<uint8_t> rlgl::CompressImage(const void *data, int width, int height, PixelFormat format, CompressionQuality quality)
+{
+    std::vector<uint8_t> blocks(IsCompressionFormatSupported(format)? GetPixelDataSize(width, height, format) : 0);
+
+    if (!CompressImage(data, width, height, format, blocks.data(), quality)) blocks.clear();
+
+    return blocks;
+}
+
+// Compress every level of R8G8B8A8 mipmap chain
+std::vector<uint8_t> rlgl::CompressMipmapChain(const void *data, int width, int height, int mipmapCount, PixelFormat format, CompressionQuality quality)
+{
+    if (!IsCompressionFormatSupported(format) || (data == nullptr)) return std::vector<uint8_t>();
+
+    std::vector<uint8_t> chain(GetMipmapChainDataSize(width, height, format, mipmapCount));
+
+    const uint8_t *srcPtr = static_cast<const uint8_t*>(data);
+    uint8_t *dstPtr = chain.data();
+
+    for (int i = 0; i < mipmapCount; i++)
+    {
+        CompressImage(srcPtr, width, height, format, dstPtr, quality);
+
+        srcPtr += GetPixelDataSize(width, height, PixelFormat::R8G8B8A8);
+        dstPtr += GetPixelDataSize(width, height, format);
+        width = std::max(width/2, 1);
+        height = std::max(height/2, 1);
+    }
+
+    return chain;
+}
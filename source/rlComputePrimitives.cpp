@@ -0,0 +1,597 @@
+#include "rlComputePrimitives.hpp"
+#include "rlGLExt.hpp"
+#include "rlUtils.hpp"
+#include "rlgl.hpp"
+
+#include <algorithm>
+#include <utility>
+
+using namespace rlgl;
+
+namespace {
+
+    constexpr uint32_t SCAN_BLOCK_SIZE = 512;       // Elements per scan and reduction work group (two per invocation)
+    constexpr uint32_t SORT_BLOCK_SIZE = 256;       // Elements per radix sort and compaction work group
+    constexpr uint32_t SORT_DIGIT_COUNT = 16;       // Radix sort buckets (4 bits per pass)
+    constexpr uint32_t MAX_WORK_GROUPS = 65535;     // Minimum GL_MAX_COMPUTE_WORK_GROUP_COUNT guaranteed on X
+
+    constexpr const char *COMPUTE_HEADER =
+        "#version 430\n"
+        "layout(local_size_x = 256) in;\n";
+
+    // Work-efficient exclusive scan of a 512 elements block (up-sweep then down-sweep), the block sum is
+    // written to the next level (or to the scan total for the last level)
+    constexpr const char *SCAN_CODE =
+        "layout(std430, binding = 0) buffer Input { uint inputData[]; };"
+        "layout(std430, binding = 1) buffer Output { uint outputData[]; };"
+        "layout(std430, binding = 2) buffer Sums { uint blockSums[]; };"
+        "uniform int count;"
+        "uniform int inputOffset;"
+        "uniform int outputOffset;"
+        "uniform int sumsOffset;"
+        "uniform int flagInput;"
+        "shared uint temp[512];"
+        "uint LoadValue(uint i)"
+        "{"
+            "if (i >= uint(count)) return 0u;"
+            "uint value = inputData[uint(inputOffset) + i];"
+            "return (flagInput != 0)? min(value, 1u) : value;"
+        "}"
+        "void main()"
+        "{"
+            "uint li = gl_LocalInvocationID.x;"
+            "uint a = gl_WorkGroupID.x*512u + li;"
+            "uint b = a + 256u;"
+            "temp[li] = LoadValue(a);"
+            "temp[li + 256u] = LoadValue(b);"
+            "uint offset = 1u;"
+            "for (uint d = 256u; d > 0u; d >>= 1)"
+            "{"
+                "barrier();"
+                "if (li < d) temp[offset*(2u*li + 2u) - 1u] += temp[offset*(2u*li + 1u) - 1u];"
+                "offset <<= 1;"
+            "}"
+            "if (li == 0u)"
+            "{"
+                "blockSums[uint(sumsOffset) + gl_WorkGroupID.x] = temp[511];"
+                "temp[511] = 0u;"
+            "}"
+            "for (uint d = 1u; d < 512u; d <<= 1)"
+            "{"
+                "offset >>= 1;"
+                "barrier();"
+                "if (li < d)"
+                "{"
+                    "uint ai = offset*(2u*li + 1u) - 1u;"
+                    "uint bi = offset*(2u*li + 2u) - 1u;"
+                    "uint t = temp[ai];"
+                    "temp[ai] = temp[bi];"
+                    "temp[bi] += t;"
+                "}"
+            "}"
+            "barrier();"
+            "if (a < uint(count)) outputData[uint(outputOffset) + a] = temp[li];"
+            "if (b < uint(count)) outputData[uint(outputOffset) + b] = temp[li + 256u];"
+        "}";
+
+    // Add the scanned block sums of the next level to the elements of a level
+    constexpr const char *SCAN_ADD_CODE =
+        "layout(std430, binding = 1) buffer Output { uint outputData[]; };"
+        "layout(std430, binding = 2) buffer Sums { uint blockSums[]; };"
+        "uniform int count;"
+        "uniform int outputOffset;"
+        "uniform int sumsOffset;"
+        "void main()"
+        "{"
+            "uint sum = blockSums[uint(sumsOffset) + gl_WorkGroupID.x];"
+            "uint a = gl_WorkGroupID.x*512u + gl_LocalInvocationID.x;"
+            "if (a < uint(count)) outputData[uint(outputOffset) + a] += sum;"
+            "if (a + 256u < uint(count)) outputData[uint(outputOffset) + a + 256u] += sum;"
+        "}";
+
+    // Tree reduction of a 512 elements block, T, OP and IDENTITY are defined for every type and operation
+    constexpr const char *REDUCE_CODE =
+        "layout(std430, binding = 0) buffer Input { T inputData[]; };"
+        "layout(std430, binding = 1) buffer Output { T outputData[]; };"
+        "uniform int count;"
+        "uniform int inputOffset;"
+        "uniform int outputOffset;"
+        "shared T temp[256];"
+        "void main()"
+        "{"
+            "uint li = gl_LocalInvocationID.x;"
+            "uint a = gl_WorkGroupID.x*512u + li;"
+            "T va = (a < uint(count))? inputData[uint(inputOffset) + a] : IDENTITY;"
+            "T vb = (a + 256u < uint(count))? inputData[uint(inputOffset) + a + 256u] : IDENTITY;"
+            "temp[li] = OP(va, vb);"
+            "barrier();"
+            "for (uint s = 128u; s > 0u; s >>= 1)"
+            "{"
+                "if (li < s) temp[li] = OP(temp[li], temp[li + s]);"
+                "barrier();"
+            "}"
+            "if (li == 0u) outputData[uint(outputOffset) + gl_WorkGroupID.x] = temp[0];"
+        "}";
+
+    // Radix digit counts of a 256 elements block, stored digit major (digit*blockCount + block)
+    constexpr const char *HISTOGRAM_CODE =
+        "layout(std430, binding = 0) buffer KeysIn { uint keysIn[]; };"
+        "layout(std430, binding = 4) buffer Histogram { uint histogram[]; };"
+        "uniform int count;"
+        "uniform int shift;"
+        "uniform int blockCount;"
+        "shared uint localCounts[16];"
+        "void main()"
+        "{"
+            "uint i = gl_GlobalInvocationID.x;"
+            "uint li = gl_LocalInvocationID.x;"
+            "if (li < 16u) localCounts[li] = 0u;"
+            "barrier();"
+            "if (i < uint(count)) atomicAdd(localCounts[(keysIn[i] >> uint(shift)) & 15u], 1u);"
+            "barrier();"
+            "if (li < 16u) histogram[li*uint(blockCount) + gl_WorkGroupID.x] = localCounts[li];"
+        "}";
+
+    // Stable scatter of a 256 elements block: the rank of an element among the block elements with the same
+    // digit comes from a scan of one-hot digit counters (16 counters of 16 bits packed in two uvec4)
+    constexpr const char *SORT_SCATTER_CODE =
+        "layout(std430, binding = 0) buffer KeysIn { uint keysIn[]; };"
+        "layout(std430, binding = 1) buffer KeysOut { uint keysOut[]; };"
+        "layout(std430, binding = 2) buffer ValuesIn { uint valuesIn[]; };"
+        "layout(std430, binding = 3) buffer ValuesOut { uint valuesOut[]; };"
+        "layout(std430, binding = 4) buffer Histogram { uint histogram[]; };"
+        "uniform int count;"
+        "uniform int shift;"
+        "uniform int blockCount;"
+        "uniform int hasValues;"
+        "shared uvec4 countsLow[256];"
+        "shared uvec4 countsHigh[256];"
+        "void main()"
+        "{"
+            "uint i = gl_GlobalInvocationID.x;"
+            "uint li = gl_LocalInvocationID.x;"
+            "bool valid = (i < uint(count));"
+            "uint key = valid? keysIn[i] : 0u;"
+            "uint digit = (key >> uint(shift)) & 15u;"
+            "uint word = digit >> 1;"
+            "uint bitShift = (digit & 1u)*16u;"
+            "uvec4 low = uvec4(0u);"
+            "uvec4 high = uvec4(0u);"
+            "if (valid)"
+            "{"
+                "if (word < 4u) low[word] = 1u << bitShift;"
+                "else high[word - 4u] = 1u << bitShift;"
+            "}"
+            "countsLow[li] = low;"
+            "countsHigh[li] = high;"
+            "barrier();"
+            "for (uint offset = 1u; offset < 256u; offset <<= 1)"
+            "{"
+                "uvec4 previousLow = (li >= offset)? countsLow[li - offset] : uvec4(0u);"
+                "uvec4 previousHigh = (li >= offset)? countsHigh[li - offset] : uvec4(0u);"
+                "barrier();"
+                "countsLow[li] += previousLow;"
+                "countsHigh[li] += previousHigh;"
+                "barrier();"
+            "}"
+            "if (!valid) return;"
+            "uint counters = (word < 4u)? countsLow[li][word] : countsHigh[li][word - 4u];"
+            "uint rank = ((counters >> bitShift) & 0xFFFFu) - 1u;"
+            "uint dst = histogram[digit*uint(blockCount) + gl_WorkGroupID.x] + rank;"
+            "keysOut[dst] = key;"
+            "if (hasValues != 0) valuesOut[dst] = valuesIn[i];"
+        "}";
+
+    // Copy the flagged elements to their scanned index
+    constexpr const char *COMPACT_CODE =
+        "layout(std430, binding = 0) buffer Input { uint inputData[]; };"
+        "layout(std430, binding = 1) buffer Flags { uint flags[]; };"
+        "layout(std430, binding = 2) buffer Offsets { uint offsets[]; };"
+        "layout(std430, binding = 3) buffer Output { uint outputData[]; };"
+        "uniform int count;"
+        "uniform int elementWords;"
+        "void main()"
+        "{"
+            "uint i = gl_GlobalInvocationID.x;"
+            "if ((i >= uint(count)) || (flags[i] == 0u)) return;"
+            "uint src = i*uint(elementWords);"
+            "uint dst = offsets[i]*uint(elementWords);"
+            "for (uint k = 0u; k < uint(elementWords); k++) outputData[dst + k] = inputData[src + k];"
+        "}";
+
+    // Reduction definitions, indexed by ReduceType then ReduceOp
+    constexpr const char *REDUCE_DEFINES[3][3] = {
+        {
+            "#define T uint\n#define OP(a, b) ((a) + (b))\n#define IDENTITY 0u\n",
+            "#define T uint\n#define OP(a, b) min(a, b)\n#define IDENTITY 0xFFFFFFFFu\n",
+            "#define T uint\n#define OP(a, b) max(a, b)\n#define IDENTITY 0u\n"
+        },
+        {
+            "#define T int\n#define OP(a, b) ((a) + (b))\n#define IDENTITY 0\n",
+            "#define T int\n#define OP(a, b) min(a, b)\n#define IDENTITY 0x7FFFFFFF\n",
+            "#define T int\n#define OP(a, b) max(a, b)\n#define IDENTITY int(0x80000000u)\n"
+        },
+        {
+            "#define T float\n#define OP(a, b) ((a) + (b))\n#define IDENTITY 0.0\n",
+            "#define T float\n#define OP(a, b) min(a, b)\n#define IDENTITY uintBitsToFloat(0x7F800000u)\n",
+            "#define T float\n#define OP(a, b) max(a, b)\n#define IDENTITY uintBitsToFloat(0xFF800000u)\n"
+        }
+    };
+
+    //----------------------------------------------------------------------------------
+
+    uint32_t GetGroupCount(uint32_t count, uint32_t blockSize)
+    {
+        return std::max((count + blockSize - 1)/blockSize, 1u);
+    }
+
+}
+
+/* COMPUTE PRIMITIVES IMPLEMENTATION */
+
+ComputePrimitives::ComputePrimitives(Context& rlCtx)
+: rlCtx(&rlCtx), ready(false), scanProgram(0), scanAddProgram(0), reducePrograms{}
+, histogramProgram(0), sortScatterProgram(0), compactProgram(0)
+, scanScratch(0), scanScratchSize(0), reduceScratch(0), reduceScratchSize(0)
+, sortKeys(0), sortKeysSize(0), sortValues(0), sortValuesSize(0)
+, histogram(0), histogramSize(0), offsets(0), offsetsSize(0)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    if (!GetExtensions().computeShader || !GetExtensions().ssbo)
+    {
+        TRACELOG(LogWarning, "COMPUTE: Compute shaders not supported, compute primitives not loaded");
+        return;
+    }
+
+    scanProgram = LoadComputeProgram(rlCtx, COMPUTE_HEADER, "", SCAN_CODE);
+    scanAddProgram = LoadComputeProgram(rlCtx, COMPUTE_HEADER, "", SCAN_ADD_CODE);
+    histogramProgram = LoadComputeProgram(rlCtx, COMPUTE_HEADER, "", HISTOGRAM_CODE);
+    sortScatterProgram = LoadComputeProgram(rlCtx, COMPUTE_HEADER, "", SORT_SCATTER_CODE);
+    compactProgram = LoadComputeProgram(rlCtx, COMPUTE_HEADER, "", COMPACT_CODE);
+
+    ready = (scanProgram != 0) && (scanAddProgram != 0) && (histogramProgram != 0) &&
+        (sortScatterProgram != 0) && (compactProgram != 0);
+
+    if (ready) TRACELOG(LogInfo, "COMPUTE: Compute primitives loaded successfully");
+    else TRACELOG(LogWarning, "COMPUTE: Failed to load compute primitives shaders");
+#else
+    TRACELOG(LogWarning, "COMPUTE: Compute primitives require OpenGL 4.3 (GRAPHICS_API_OPENGL_43)");
+#endif
+}
+
+ComputePrimitives::~ComputePrimitives()
+{
+    Unload();
+}
+
+ComputePrimitives::ComputePrimitives(ComputePrimitives&& other) noexcept
+: rlCtx(other.rlCtx), ready(other.ready), scanProgram(other.scanProgram), scanAddProgram(other.scanAddProgram), reducePrograms{}
+, histogramProgram(other.histogramProgram), sortScatterProgram(other.sortScatterProgram), compactProgram(other.compactProgram)
+, scanScratch(other.scanScratch), scanScratchSize(other.scanScratchSize), reduceScratch(other.reduceScratch)
+, reduceScratchSize(other.reduceScratchSize), sortKeys(other.sortKeys), sortKeysSize(other.sortKeysSize)
+, sortValues(other.sortValues), sortValuesSize(other.sortValuesSize), histogram(other.histogram)
+, histogramSize(other.histogramSize), offsets(other.offsets), offsetsSize(other.offsetsSize)
+{
+    std::swap(reducePrograms, other.reducePrograms);
+
+    other.ready = false;
+    other.scanProgram = other.scanAddProgram = other.histogramProgram = other.sortScatterProgram = other.compactProgram = 0;
+    other.scanScratch = other.reduceScratch = other.sortKeys = other.sortValues = other.histogram = other.offsets = 0;
+}
+
+ComputePrimitives& ComputePrimitives::operator=(ComputePrimitives&& other) noexcept
+{
+    if (this != &other)
+    {
+        Unload();
+
+        rlCtx = other.rlCtx;
+        std::swap(ready, other.ready);
+        std::swap(scanProgram, other.scanProgram);
+        std::swap(scanAddProgram, other.scanAddProgram);
+        std::swap(reducePrograms, other.reducePrograms);
+        std::swap(histogramProgram, other.histogramProgram);
+        std::swap(sortScatterProgram, other.sortScatterProgram);
+        std::swap(compactProgram, other.compactProgram);
+        std::swap(scanScratch, other.scanScratch);
+        std::swap(scanScratchSize, other.scanScratchSize);
+        std::swap(reduceScratch, other.reduceScratch);
+        std::swap(reduceScratchSize, other.reduceScratchSize);
+        std::swap(sortKeys, other.sortKeys);
+        std::swap(sortKeysSize, other.sortKeysSize);
+        std::swap(sortValues, other.sortValues);
+        std::swap(sortValuesSize, other.sortValuesSize);
+        std::swap(histogram, other.histogram);
+        std::swap(histogramSize, other.histogramSize);
+        std::swap(offsets, other.offsets);
+        std::swap(offsetsSize, other.offsetsSize);
+    }
+    return *this;
+}
+
+bool ComputePrimitives::ExclusiveScan(uint32_t inputBuffer, uint32_t outputBuffer, uint32_t count)
+{
+    if (!ready) return false;
+
+    if (GetGroupCount(count, SCAN_BLOCK_SIZE) > MAX_WORK_GROUPS)
+    {
+        TRACELOG(LogWarning, "COMPUTE: Scan element count too large (%u elements)", count);
+        return false;
+    }
+
+    ScanLevels(inputBuffer, outputBuffer, count, false);
+    rlCtx->DisableShader();
+
+    return true;
+}
+
+bool ComputePrimitives::Reduce(uint32_t inputBuffer, uint32_t count, ReduceType type, ReduceOp op, uint32_t resultBuffer, uint32_t resultOffset)
+{
+    if (!ready) return false;
+
+    if (GetGroupCount(count, SCAN_BLOCK_SIZE) > MAX_WORK_GROUPS)
+    {
+        TRACELOG(LogWarning, "COMPUTE: Reduction element count too large (%u elements)", count);
+        return false;
+    }
+
+    const uint32_t programId = GetReduceProgram(type, op);
+    if (programId == 0) return false;
+
+    // Partial results of every level but the last one are stored one after the other
+    uint32_t scratchCount = 0;
+    for (uint32_t n = GetGroupCount(count, SCAN_BLOCK_SIZE); n > 1; n = GetGroupCount(n, SCAN_BLOCK_SIZE)) scratchCount += n;
+
+    ReserveBuffer(reduceScratch, reduceScratchSize, scratchCount*sizeof(uint32_t));
+
+    rlCtx->EnableShader(programId);
+
+    uint32_t n = count;
+    uint32_t source = inputBuffer;
+    uint32_t sourceOffset = 0;
+    uint32_t scratchOffset = 0;
+
+    while (true)
+    {
+        const uint32_t groups = GetGroupCount(n, SCAN_BLOCK_SIZE);
+        const bool last = (groups == 1);
+
+        rlCtx->BindShaderBuffer(source, 0);
+        rlCtx->BindShaderBuffer(last? resultBuffer : reduceScratch, 1);
+        SetUniformInt(*rlCtx, programId, "count", static_cast<int>(n));
+        SetUniformInt(*rlCtx, programId, "inputOffset", static_cast<int>(sourceOffset));
+        SetUniformInt(*rlCtx, programId, "outputOffset", static_cast<int>(last? resultOffset/sizeof(uint32_t) : scratchOffset));
+        rlCtx->ComputeShaderDispatch(groups, 1, 1);
+        rlCtx->ComputeShaderBarrier();
+
+        if (last) break;
+
+        source = reduceScratch;
+        sourceOffset = scratchOffset;
+        scratchOffset += groups;
+        n = groups;
+    }
+
+    rlCtx->DisableShader();
+
+    return true;
+}
+
+bool ComputePrimitives::SortPairs(uint32_t keyBuffer, uint32_t valueBuffer, uint32_t count, int keyBits)
+{
+    if (!ready) return false;
+    if (count <= 1) return true;
+
+    const uint32_t blockCount = GetGroupCount(count, SORT_BLOCK_SIZE);
+
+    if ((blockCount > MAX_WORK_GROUPS) || (GetGroupCount(blockCount*SORT_DIGIT_COUNT, SCAN_BLOCK_SIZE) > MAX_WORK_GROUPS))
+    {
+        TRACELOG(LogWarning, "COMPUTE: Sort element count too large (%u elements)", count);
+        return false;
+    }
+
+    const bool hasValues = (valueBuffer != 0);
+    const int passCount = (std::min(std::max(keyBits, 1), 32) + 3)/4;
+
+    ReserveBuffer(sortKeys, sortKeysSize, count*sizeof(uint32_t));
+    if (hasValues) ReserveBuffer(sortValues, sortValuesSize, count*sizeof(uint32_t));
+    ReserveBuffer(histogram, histogramSize, blockCount*SORT_DIGIT_COUNT*sizeof(uint32_t));
+
+    uint32_t keysIn = keyBuffer, keysOut = sortKeys;
+    uint32_t valuesIn = valueBuffer, valuesOut = sortValues;
+
+    for (int pass = 0; pass < passCount; pass++)
+    {
+        const int shift = 4*pass;
+
+        // Digit counts per block, scanned into the output index of the first element of every digit and block
+        rlCtx->EnableShader(histogramProgram);
+        rlCtx->BindShaderBuffer(keysIn, 0);
+        rlCtx->BindShaderBuffer(histogram, 4);
+        SetUniformInt(*rlCtx, histogramProgram, "count", static_cast<int>(count));
+        SetUniformInt(*rlCtx, histogramProgram, "shift", shift);
+        SetUniformInt(*rlCtx, histogramProgram, "blockCount", static_cast<int>(blockCount));
+        rlCtx->ComputeShaderDispatch(blockCount, 1, 1);
+        rlCtx->ComputeShaderBarrier();
+
+        ScanLevels(histogram, histogram, blockCount*SORT_DIGIT_COUNT, false);
+
+        // NOTE: Value bindings are set to the key buffers when sorting keys only (never accessed)
+        rlCtx->EnableShader(sortScatterProgram);
+        rlCtx->BindShaderBuffer(keysIn, 0);
+        rlCtx->BindShaderBuffer(keysOut, 1);
+        rlCtx->BindShaderBuffer(hasValues? valuesIn : keysIn, 2);
+        rlCtx->BindShaderBuffer(hasValues? valuesOut : keysOut, 3);
+        rlCtx->BindShaderBuffer(histogram, 4);
+        SetUniformInt(*rlCtx, sortScatterProgram, "count", static_cast<int>(count));
+        SetUniformInt(*rlCtx, sortScatterProgram, "shift", shift);
+        SetUniformInt(*rlCtx, sortScatterProgram, "blockCount", static_cast<int>(blockCount));
+        SetUniformInt(*rlCtx, sortScatterProgram, "hasValues", hasValues? 1 : 0);
+        rlCtx->ComputeShaderDispatch(blockCount, 1, 1);
+        rlCtx->ComputeShaderBarrier();
+
+        std::swap(keysIn, keysOut);
+        std::swap(valuesIn, valuesOut);
+    }
+
+    // An odd number of passes leaves the sorted elements in the scratch buffers
+    if ((passCount%2) != 0)
+    {
+        rlCtx->CopyShaderBuffer(keyBuffer, sortKeys, 0, 0, count*sizeof(uint32_t));
+        if (hasValues) rlCtx->CopyShaderBuffer(valueBuffer, sortValues, 0, 0, count*sizeof(uint32_t));
+        rlCtx->ComputeShaderBarrier();
+    }
+
+    rlCtx->DisableShader();
+
+    return true;
+}
+
+bool ComputePrimitives::Compact(uint32_t inputBuffer, uint32_t flagBuffer, uint32_t outputBuffer, uint32_t count, uint32_t elementSize,
+                                uint32_t countBuffer, uint32_t countOffset)
+{
+    if (!ready) return false;
+
+    if ((elementSize == 0) || ((elementSize%sizeof(uint32_t)) != 0))
+    {
+        TRACELOG(LogWarning, "COMPUTE: Compaction element size must be a multiple of 4 bytes (%u bytes)", elementSize);
+        return false;
+    }
+
+    if (GetGroupCount(count, SORT_BLOCK_SIZE) > MAX_WORK_GROUPS)
+    {
+        TRACELOG(LogWarning, "COMPUTE: Compaction element count too large (%u elements)", count);
+        return false;
+    }
+
+    ReserveBuffer(offsets, offsetsSize, std::max(count, 1u)*sizeof(uint32_t));
+
+    // Output indices, the number of kept elements is the scan total
+    ScanLevels(flagBuffer, offsets, count, true);
+
+    if (count > 0)
+    {
+        rlCtx->EnableShader(compactProgram);
+        rlCtx->BindShaderBuffer(inputBuffer, 0);
+        rlCtx->BindShaderBuffer(flagBuffer, 1);
+        rlCtx->BindShaderBuffer(offsets, 2);
+        rlCtx->BindShaderBuffer(outputBuffer, 3);
+        SetUniformInt(*rlCtx, compactProgram, "count", static_cast<int>(count));
+        SetUniformInt(*rlCtx, compactProgram, "elementWords", static_cast<int>(elementSize/sizeof(uint32_t)));
+        rlCtx->ComputeShaderDispatch(GetGroupCount(count, SORT_BLOCK_SIZE), 1, 1);
+        rlCtx->ComputeShaderBarrier();
+    }
+
+    if (countBuffer != 0)
+    {
+        rlCtx->CopyShaderBuffer(countBuffer, scanScratch, countOffset, 0, sizeof(uint32_t));
+        rlCtx->ComputeShaderBarrier();
+    }
+
+    rlCtx->DisableShader();
+
+    return true;
+}
+
+// Scan the blocks up the levels (block sums of a level are the elements of the next one), then add the
+// scanned block sums down the levels. The scan total is stored at the start of the scratch buffer.
+void ComputePrimitives::ScanLevels(uint32_t inputBuffer, uint32_t outputBuffer, uint32_t count, bool flagInput)
+{
+    uint32_t levelCounts[4] = { count, 0, 0, 0 };
+    uint32_t levelOffsets[4] = { 0, 1, 0, 0 };
+    int levelCount = 1;
+
+    while (levelCounts[levelCount - 1] > SCAN_BLOCK_SIZE)
+    {
+        levelCounts[levelCount] = GetGroupCount(levelCounts[levelCount - 1], SCAN_BLOCK_SIZE);
+        if (levelCount > 1) levelOffsets[levelCount] = levelOffsets[levelCount - 1] + levelCounts[levelCount - 1];
+        levelCount++;
+    }
+
+    ReserveBuffer(scanScratch, scanScratchSize, (levelOffsets[levelCount - 1] + ((levelCount > 1)? levelCounts[levelCount - 1] : 0))*sizeof(uint32_t));
+
+    rlCtx->EnableShader(scanProgram);
+
+    for (int i = 0; i < levelCount; i++)
+    {
+        const bool last = (i + 1 == levelCount);
+
+        rlCtx->BindShaderBuffer((i == 0)? inputBuffer : scanScratch, 0);
+        rlCtx->BindShaderBuffer((i == 0)? outputBuffer : scanScratch, 1);
+        rlCtx->BindShaderBuffer(scanScratch, 2);
+        SetUniformInt(*rlCtx, scanProgram, "count", static_cast<int>(levelCounts[i]));
+        SetUniformInt(*rlCtx, scanProgram, "inputOffset", static_cast<int>(levelOffsets[i]));
+        SetUniformInt(*rlCtx, scanProgram, "outputOffset", static_cast<int>(levelOffsets[i]));
+        SetUniformInt(*rlCtx, scanProgram, "sumsOffset", last? 0 : static_cast<int>(levelOffsets[i + 1]));
+        SetUniformInt(*rlCtx, scanProgram, "flagInput", ((i == 0) && flagInput)? 1 : 0);
+        rlCtx->ComputeShaderDispatch(GetGroupCount(levelCounts[i], SCAN_BLOCK_SIZE), 1, 1);
+        rlCtx->ComputeShaderBarrier();
+    }
+
+    if (levelCount > 1) rlCtx->EnableShader(scanAddProgram);
+
+    for (int i = levelCount - 2; i >= 0; i--)
+    {
+        rlCtx->BindShaderBuffer((i == 0)? outputBuffer : scanScratch, 1);
+        rlCtx->BindShaderBuffer(scanScratch, 2);
+        SetUniformInt(*rlCtx, scanAddProgram, "count", static_cast<int>(levelCounts[i]));
+        SetUniformInt(*rlCtx, scanAddProgram, "outputOffset", static_cast<int>(levelOffsets[i]));
+        SetUniformInt(*rlCtx, scanAddProgram, "sumsOffset", static_cast<int>(levelOffsets[i + 1]));
+        rlCtx->ComputeShaderDispatch(GetGroupCount(levelCounts[i], SCAN_BLOCK_SIZE), 1, 1);
+        rlCtx->ComputeShaderBarrier();
+    }
+}
+
+uint32_t ComputePrimitives::GetReduceProgram(ReduceType type, ReduceOp op)
+{
+    const int typeIndex = static_cast<int>(type);
+    const int opIndex = static_cast<int>(op);
+
+    if ((typeIndex < 0) || (typeIndex > 2) || (opIndex < 0) || (opIndex > 2)) return 0;
+
+    uint32_t& programId = reducePrograms[typeIndex][opIndex];
+#if defined(GRAPHICS_API_OPENGL_43)
+    if (programId == 0) programId = LoadComputeProgram(*rlCtx, COMPUTE_HEADER, REDUCE_DEFINES[typeIndex][opIndex], REDUCE_CODE);
+#endif
+
+    return programId;
+}
+
+// Grow a scratch buffer to the required size (previous content is not kept)
+void ComputePrimitives::ReserveBuffer(uint32_t& id, uint32_t& size, uint32_t required)
+{
+    required = std::max(required, static_cast<uint32_t>(sizeof(uint32_t)));
+    if ((id != 0) && (size >= required)) return;
+
+    if (id != 0) rlCtx->UnloadShaderBuffer(id);
+
+    id = rlCtx->LoadShaderBuffer(required, nullptr, BufferUsage::DynamicCopy);
+    size = required;
+}
+
+void ComputePrimitives::Unload()
+{
+    for (uint32_t *program : { &scanProgram, &scanAddProgram, &histogramProgram, &sortScatterProgram, &compactProgram })
+    {
+        if (*program != 0) rlCtx->UnloadShaderProgram(*program);
+        *program = 0;
+    }
+
+    for (auto& programs : reducePrograms)
+    {
+        for (uint32_t& programId : programs)
+        {
+            if (programId != 0) rlCtx->UnloadShaderProgram(programId);
+            programId = 0;
+        }
+    }
+
+    for (uint32_t *buffer : { &scanScratch, &reduceScratch, &sortKeys, &sortValues, &histogram, &offsets })
+    {
+        if (*buffer != 0) rlCtx->UnloadShaderBuffer(*buffer);
+        *buffer = 0;
+    }
+
+    scanScratchSize = reduceScratchSize = sortKeysSize = sortValuesSize = histogramSize = offsetsSize = 0;
+    ready = false;
+}
@@ -0,0 +1,1091 @@
+#include "rlCompression.hpp"
+#include "rlConfig.hpp"
+#include "rlMipmaps.hpp"
+#include "rlUtils.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace rlgl;
+
+namespace {
+
+    // ETC1 intensity modifier tables, ETC2 T/H modes distances and EAC alpha modifier tables
+    constexpr int ETC_MODIFIERS[8][2] = {
+        { 2, 8 }, { 5, 17 }, { 9, 29 }, { 13, 42 }, { 18, 60 }, { 24, 80 }, { 33, 106 }, { 47, 183 }
+    };
+
+    constexpr int ETC_DISTANCES[8] = { 3, 6, 11, 16, 23, 32, 41, 64 };
+
+    constexpr int EAC_MODIFIERS[16][8] = {
+        { -3, -6, -9, -15, 2, 5, 8, 14 }, { -3, -7, -10, -13, 2, 6, 9, 12 },
+        { -2, -5, -8, -13, 1, 4, 7, 12 }, { -2, -4, -6, -13, 1, 3, 5, 12 },
+        { -3, -6, -8, -12, 2, 5, 7, 11 }, { -3, -7, -9, -11, 2, 6, 8, 10 },
+        { -4, -7, -8, -11, 3, 6, 7, 10 }, { -3, -5, -8, -11, 2, 4, 7, 10 },
+        { -2, -6, -8, -10, 1, 5, 7, 9 },  { -2, -5, -8, -10, 1, 4, 7, 9 },
+        { -2, -4, -8, -10, 1, 3, 7, 9 },  { -2, -5, -7, -10, 1, 4, 6, 9 },
+        { -3, -4, -7, -10, 2, 3, 6, 9 },  { -1, -2, -3, -10, 0, 1, 2, 9 },
+        { -4, -6, -8, -9, 3, 5, 7, 8 },   { -3, -5, -7, -9, 2, 4, 6, 8 }
+    };
+
+    constexpr int ASTC_MAX_BLOCK_TEXELS = 8*8;     ///< Largest supported ASTC block footprint (8x8)
+
+    int Clamp255(int value)
+    {
+        return std::min(std::max(value, 0), 255);
+    }
+
+    void SetTexel(uint8_t *texel, int r, int g, int b, int a)
+    {
+        texel[0] = static_cast<uint8_t>(r);
+        texel[1] = static_cast<uint8_t>(g);
+        texel[2] = static_cast<uint8_t>(b);
+        texel[3] = static_cast<uint8_t>(a);
+    }
+
+    uint32_t ReadBigEndian32(const uint8_t *data)
+    {
+        return (static_cast<uint32_t>(data[0]) << 24) | (static_cast<uint32_t>(data[1]) << 16) | (static_cast<uint32_t>(data[2]) << 8) | data[3];
+    }
+
+    // DXT (BC1, BC2, BC3) block decoders
+    // NOTE: Texels are written in row-major order (4x4 RGBA)
+    //-----------------------------------------------------------------------------------------
+
+    void DecodeBlockBc1(const uint8_t *block, uint8_t *texels, bool punchThrough, bool fourColors)
+    {
+        const int color0 = block[0] | (block[1] << 8);
+        const int color1 = block[2] | (block[3] << 8);
+
+        int palette[4][4];
+
+        for (int i = 0; i < 2; i++)
+        {
+            const int color = (i == 0)? color0 : color1;
+            const int r = (color >> 11) & 0x1f;
+            const int g = (color >> 5) & 0x3f;
+            const int b = color & 0x1f;
+
+            palette[i][0] = (r << 3) | (r >> 2);
+            palette[i][1] = (g << 2) | (g >> 4);
+            palette[i][2] = (b << 3) | (b >> 2);
+            palette[i][3] = 255;
+        }
+
+        if (fourColors || (color0 > color1))
+        {
+            for (int c = 0; c < 3; c++)
+            {
+                palette[2][c] = (2*palette[0][c] + palette[1][c])/3;
+                palette[3][c] = (palette[0][c] + 2*palette[1][c])/3;
+            }
+
+            palette[2][3] = palette[3][3] = 255;
+        }
+        else
+        {
+            for (int c = 0; c < 3; c++)
+            {
+                palette[2][c] = (palette[0][c] + palette[1][c])/2;
+                palette[3][c] = 0;
+            }
+
+            palette[2][3] = 255;
+            palette[3][3] = punchThrough? 0 : 255;
+        }
+
+        const uint32_t indices = block[4] | (block[5] << 8) | (block[6] << 16) | (static_cast<uint32_t>(block[7]) << 24);
+
+        for (int i = 0; i < 16; i++)
+        {
+            const int *color = palette[(indices >> (2*i)) & 3];
+            SetTexel(texels + i*4, color[0], color[1], color[2], color[3]);
+        }
+    }
+
+    void DecodeBlockBc2(const uint8_t *block, uint8_t *texels)
+    {
+        DecodeBlockBc1(block + 8, texels, false, true);
+
+        for (int i = 0; i < 16; i++) texels[i*4 + 3] = static_cast<uint8_t>(((block[i/2] >> (4*(i & 1))) & 0xf)*17);
+    }
+
+    void DecodeBlockBc3(const uint8_t *block, uint8_t *texels)
+    {
+        DecodeBlockBc1(block + 8, texels, false, true);
+
+        const int alpha0 = block[0];
+        const int alpha1 = block[1];
+        int palette[8] = { alpha0, alpha1 };
+
+        if (alpha0 > alpha1)
+        {
+            for (int i = 1; i < 7; i++) palette[i + 1] = ((7 - i)*alpha0 + i*alpha1 + 3)/7;
+        }
+        else
+        {
+            for (int i = 1; i < 5; i++) palette[i + 1] = ((5 - i)*alpha0 + i*alpha1 + 2)/5;
+            palette[6] = 0;
+            palette[7] = 255;
+        }
+
+        uint64_t bits = 0;
+        for (int i = 0; i < 6; i++) bits |= static_cast<uint64_t>(block[2 + i]) << (8*i);
+
+        for (int i = 0; i < 16; i++) texels[i*4 + 3] = static_cast<uint8_t>(palette[(bits >> (3*i)) & 7]);
+    }
+
+    // ETC1, ETC2 and EAC block decoders
+    // NOTE: Pixel indices are stored in column-major order (x*4 + y)
+    //-----------------------------------------------------------------------------------------
+
+    int Expand4(int value) { return (value << 4) | value; }
+    int Expand5(int value) { return (value << 3) | (value >> 2); }
+    int Expand6(int value) { return (value << 2) | (value >> 4); }
+    int Expand7(int value) { return (value << 1) | (value >> 6); }
+    int SignExtend3(int value) { return (value >= 4)? value - 8 : value; }
+
+    // Decode a block with 4 paint colors selected by the pixel indices (T and H modes)
+    void DecodePaintColors(uint32_t low, const int (*paint)[3], uint8_t *texels)
+    {
+        for (int i = 0; i < 16; i++)
+        {
+            const int j = (i & 3)*4 + i/4;
+            const int index = (((low >> (16 + j)) & 1) << 1) | ((low >> j) & 1);
+            SetTexel(texels + i*4, paint[index][0], paint[index][1], paint[index][2], 255);
+        }
+    }
+
+    void DecodeBlockEtc(const uint8_t *block, uint8_t *texels, bool etc2)
+    {
+        const uint32_t high = ReadBigEndian32(block);
+        const uint32_t low = ReadBigEndian32(block + 4);
+        const bool differential = (high & 2) != 0;
+        const bool flip = (high & 1) != 0;
+
+        int base[2][3];
+
+        if (!differential)
+        {
+            for (int c = 0; c < 3; c++)
+            {
+                base[0][c] = Expand4((high >> (28 - 8*c)) & 0xf);
+                base[1][c] = Expand4((high >> (24 - 8*c)) & 0xf);
+            }
+        }
+        else
+        {
+            int value[3], delta[3];
+
+            for (int c = 0; c < 3; c++)
+            {
+                value[c] = (high >> (27 - 8*c)) & 0x1f;
+                delta[c] = SignExtend3((high >> (24 - 8*c)) & 7);
+            }
+
+            const bool overflow[3] = {
+                (value[0] + delta[0] < 0) || (value[0] + delta[0] > 31),
+                (value[1] + delta[1] < 0) || (value[1] + delta[1] > 31),
+                (value[2] + delta[2] < 0) || (value[2] + delta[2] > 31)
+            };
+
+            if (etc2 && overflow[0])
+            {
+                // T mode
+                const int color0[3] = { Expand4((((high >> 27) & 3) << 2) | ((high >> 24) & 3)), Expand4((high >> 20) & 0xf), Expand4((high >> 16) & 0xf) };
+                const int color1[3] = { Expand4((high >> 12) & 0xf), Expand4((high >> 8) & 0xf), Expand4((high >> 4) & 0xf) };
+                const int distance = ETC_DISTANCES[(((high >> 2) & 3) << 1) | (high & 1)];
+
+                int paint[4][3];
+                for (int c = 0; c < 3; c++)
+                {
+                    paint[0][c] = color0[c];
+                    paint[1][c] = Clamp255(color1[c] + distance);
+                    paint[2][c] = color1[c];
+                    paint[3][c] = Clamp255(color1[c] - distance);
+                }
+
+                DecodePaintColors(low, paint, texels);
+                return;
+            }
+
+            if (etc2 && overflow[1])
+            {
+                // H mode
+                const int r0 = (high >> 27) & 0xf;
+                const int g0 = (((high >> 24) & 7) << 1) | ((high >> 20) & 1);
+                const int b0 = (((high >> 19) & 1) << 3) | ((high >> 15) & 7);
+                const int r1 = (high >> 11) & 0xf;
+                const int g1 = (high >> 7) & 0xf;
+                const int b1 = (high >> 3) & 0xf;
+
+                const int order = (((r0 << 8) | (g0 << 4) | b0) >= ((r1 << 8) | (g1 << 4) | b1))? 1 : 0;
+                const int distance = ETC_DISTANCES[(((high >> 2) & 1) << 2) | ((high & 1) << 1) | order];
+                const int color0[3] = { Expand4(r0), Expand4(g0), Expand4(b0) };
+                const int color1[3] = { Expand4(r1), Expand4(g1), Expand4(b1) };
+
+                int paint[4][3];
+                for (int c = 0; c < 3; c++)
+                {
+                    paint[0][c] = Clamp255(color0[c] + distance);
+                    paint[1][c] = Clamp255(color0[c] - distance);
+                    paint[2][c] = Clamp255(color1[c] + distance);
+                    paint[3][c] = Clamp255(color1[c] - distance);
+                }
+
+                DecodePaintColors(low, paint, texels);
+                return;
+            }
+
+            if (etc2 && overflow[2])
+            {
+                // Planar mode
+                const int o[3] = {
+                    Expand6((high >> 25) & 0x3f),
+                    Expand7((((high >> 24) & 1) << 6) | ((high >> 17) & 0x3f)),
+                    Expand6((((high >> 16) & 1) << 5) | (((high >> 11) & 3) << 3) | ((high >> 7) & 7))
+                };
+                const int h[3] = { Expand6((((high >> 2) & 0x1f) << 1) | (high & 1)), Expand7((low >> 25) & 0x7f), Expand6((low >> 19) & 0x3f) };
+                const int v[3] = { Expand6((low >> 13) & 0x3f), Expand7((low >> 6) & 0x7f), Expand6(low & 0x3f) };
+
+                for (int i = 0; i < 16; i++)
+                {
+                    const int x = i & 3;
+                    const int y = i >> 2;
+                    int color[3];
+
+                    for (int c = 0; c < 3; c++) color[c] = Clamp255((x*(h[c] - o[c]) + y*(v[c] - o[c]) + 4*o[c] + 2) >> 2);
+
+                    SetTexel(texels + i*4, color[0], color[1], color[2], 255);
+                }
+
+                return;
+            }
+
+            for (int c = 0; c < 3; c++)
+            {
+                base[0][c] = Expand5(value[c]);
+                base[1][c] = Expand5((value[c] + delta[c]) & 0x1f);
+            }
+        }
+
+        const int table[2] = { static_cast<int>((high >> 5) & 7), static_cast<int>((high >> 2) & 7) };
+
+        for (int i = 0; i < 16; i++)
+        {
+            const int x = i & 3;
+            const int y = i >> 2;
+            const int j = x*4 + y;
+            const int subblock = flip? (y >= 2) : (x >= 2);
+            const int index = (((low >> (16 + j)) & 1) << 1) | ((low >> j) & 1);
+            const int modifier = ((index & 2)? -1 : 1)*ETC_MODIFIERS[table[subblock]][index & 1];
+
+            SetTexel(texels + i*4, Clamp255(base[subblock][0] + modifier), Clamp255(base[subblock][1] + modifier), Clamp255(base[subblock][2] + modifier), 255);
+        }
+    }
+
+    void DecodeBlockEac(const uint8_t *block, uint8_t *texels)
+    {
+        const int base = block[0];
+        const int multiplier = block[1] >> 4;
+        const int *modifiers = EAC_MODIFIERS[block[1] & 0xf];
+
+        uint64_t bits = 0;
+        for (int i = 0; i < 6; i++) bits = (bits << 8) | block[2 + i];
+
+        for (int i = 0; i < 16; i++)
+        {
+            const int j = (i & 3)*4 + i/4;
+            texels[i*4 + 3] = static_cast<uint8_t>(Clamp255(base + modifiers[(bits >> (45 - 3*j)) & 7]*multiplier));
+        }
+    }
+
+    // ASTC block decoder (LDR profile, 2D blocks)
+    // NOTE: Blocks using HDR endpoint modes or invalid encodings are decoded with the error color (magenta)
+    //-----------------------------------------------------------------------------------------
+
+    // Integer sequence encoding of each quantization level: bits, trits, quints
+    constexpr int ASTC_QUANT_COUNT = 21;
+    constexpr int ASTC_QUANT_6 = 4;                 ///< Lowest quantization level allowed for color endpoints
+    constexpr int ASTC_ISE_ENCODING[ASTC_QUANT_COUNT][3] = {
+        { 1, 0, 0 }, { 0, 1, 0 }, { 2, 0, 0 }, { 0, 0, 1 },            // 2, 3, 4, 5 levels
+        { 1, 1, 0 }, { 3, 0, 0 }, { 1, 0, 1 }, { 2, 1, 0 },            // 6, 8, 10, 12 levels
+        { 4, 0, 0 }, { 2, 0, 1 }, { 3, 1, 0 }, { 5, 0, 0 },            // 16, 20, 24, 32 levels
+        { 3, 0, 1 }, { 4, 1, 0 }, { 6, 0, 0 }, { 4, 0, 1 },            // 40, 48, 64, 80 levels
+        { 5, 1, 0 }, { 7, 0, 0 }, { 5, 0, 1 }, { 6, 1, 0 },            // 96, 128, 160, 192 levels
+        { 8, 0, 0 }                                                     // 256 levels
+    };
+
+    int GetIseBitCount(int count, int quant)
+    {
+        const int *encoding = ASTC_ISE_ENCODING[quant];
+        return count*encoding[0] + (encoding[1]? (8*count + 4)/5 : 0) + (encoding[2]? (7*count + 2)/3 : 0);
+    }
+
+    // Bit reader of a 128-bit block, bits at or after the end position are read as zero
+    struct AstcBitReader
+    {
+        const uint8_t *data;
+        int position;
+        int end;
+
+        int Read(int count)
+        {
+            int value = 0;
+
+            for (int i = 0; i < count; i++, position++)
+            {
+                if (position < end) value |= ((data[position >> 3] >> (position & 7)) & 1) << i;
+            }
+
+            return value;
+        }
+    };
+
+    int ReadAstcBits(const uint8_t *data, int position, int count)
+    {
+        AstcBitReader reader = { data, position, 128 };
+        return reader.Read(count);
+    }
+
+    // Decode a sequence of integers, every value is returned as (trit/quint << bits) | bits
+    void DecodeIse(const uint8_t *data, int position, int count, int quant, int *values)
+    {
+        const int bits = ASTC_ISE_ENCODING[quant][0];
+        AstcBitReader reader = { data, position, position + GetIseBitCount(count, quant) };
+
+        if (ASTC_ISE_ENCODING[quant][1])
+        {
+            for (int i = 0; i < count; i += 5)
+            {
+                int m[5];
+                m[0] = reader.Read(bits); int t = reader.Read(2);
+                m[1] = reader.Read(bits); t |= reader.Read(2) << 2;
+                m[2] = reader.Read(bits); t |= reader.Read(1) << 4;
+                m[3] = reader.Read(bits); t |= reader.Read(2) << 5;
+                m[4] = reader.Read(bits); t |= reader.Read(1) << 7;
+
+                int trits[5], c;
+
+                if (((t >> 2) & 7) == 7)
+                {
+                    c = (((t >> 5) & 7) << 2) | (t & 3);
+                    trits[4] = trits[3] = 2;
+                }
+                else
+                {
+                    c = t & 0x1f;
+                    if (((t >> 5) & 3) == 3) { trits[4] = 2; trits[3] = (t >> 7) & 1; }
+                    else { trits[4] = (t >> 7) & 1; trits[3] = (t >> 5) & 3; }
+                }
+
+                if ((c & 3) == 3) { trits[2] = 2; trits[1] = (c >> 4) & 1; trits[0] = (((c >> 3) & 1) << 1) | ((c >> 2) & 1 & ~(c >> 3)); }
+                else if (((c >> 2) & 3) == 3) { trits[2] = 2; trits[1] = 2; trits[0] = c & 3; }
+                else { trits[2] = (c >> 4) & 1; trits[1] = (c >> 2) & 3; trits[0] = (((c >> 1) & 1) << 1) | (c & 1 & ~(c >> 1)); }
+
+                for (int k = 0; (k < 5) && (i + k < count); k++) values[i + k] = (trits[k] << bits) | m[k];
+            }
+        }
+        else if (ASTC_ISE_ENCODING[quant][2])
+        {
+            for (int i = 0; i < count; i += 3)
+            {
+                int m[3];
+                m[0] = reader.Read(bits); int q = reader.Read(3);
+                m[1] = reader.Read(bits); q |= reader.Read(2) << 3;
+                m[2] = reader.Read(bits); q |= reader.Read(2) << 5;
+
+                int quints[3];
+
+                if ((((q >> 1) & 3) == 3) && (((q >> 5) & 3) == 0))
+                {
+                    quints[2] = ((q & 1) << 2) | ((((q >> 4) & 1) & ~q & 1) << 1) | (((q >> 3) & 1) & ~q & 1);
+                    quints[1] = quints[0] = 4;
+                }
+                else
+                {
+                    int c;
+
+                    if (((q >> 1) & 3) == 3) { quints[2] = 4; c = (((q >> 3) & 3) << 3) | ((~(q >> 5) & 3) << 1) | (q & 1); }
+                    else { quints[2] = (q >> 5) & 3; c = q & 0x1f; }
+
+                    if ((c & 7) == 5) { quints[1] = 4; quints[0] = (c >> 3) & 3; }
+                    else { quints[1] = (c >> 3) & 3; quints[0] = c & 7; }
+                }
+
+                for (int k = 0; (k < 3) && (i + k < count); k++) values[i + k] = (quints[k] << bits) | m[k];
+            }
+        }
+        else
+        {
+            for (int i = 0; i < count; i++) values[i] = reader.Read(bits);
+        }
+    }
+
+    int ReplicateBits(int value, int bits, int targetBits)
+    {
+        if (bits == 0) return 0;
+
+        int result = 0;
+        int shift = targetBits;
+
+        while (shift > 0)
+        {
+            shift -= bits;
+            result |= (shift >= 0)? (value << shift) : (value >> -shift);
+        }
+
+        return result & ((1 << targetBits) - 1);
+    }
+
+    // Unquantize a color endpoint value to [0..255]
+    int UnquantizeColor(int value, int quant)
+    {
+        const int bits = ASTC_ISE_ENCODING[quant][0];
+        if (!ASTC_ISE_ENCODING[quant][1] && !ASTC_ISE_ENCODING[quant][2]) return ReplicateBits(value, bits, 8);
+
+        const int m = value & ((1 << bits) - 1);
+        const int d = value >> bits;
+        const int a = (m & 1)? 0x1ff : 0;
+        const int x = m >> 1;
+        int b = 0, c = 0;
+
+        if (ASTC_ISE_ENCODING[quant][1])
+        {
+            switch (bits)
+            {
+                case 1: c = 204; break;
+                case 2: b = (x << 8) | (x << 4) | (x << 2) | (x << 1); c = 93; break;
+                case 3: b = (x << 7) | (x << 2) | x; c = 44; break;
+                case 4: b = (x << 6) | x; c = 22; break;
+                case 5: b = (x << 5) | (x >> 2); c = 11; break;
+                case 6: b = (x << 4) | (x >> 4); c = 5; break;
+                default: break;
+            }
+        }
+        else
+        {
+            switch (bits)
+            {
+                case 1: c = 113; break;
+                case 2: b = (x << 8) | (x << 3) | (x << 2); c = 54; break;
+                case 3: b = (x << 7) | (x << 1) | (x >> 1); c = 26; break;
+                case 4: b = (x << 6) | (x >> 1); c = 13; break;
+                case 5: b = (x << 5) | (x >> 3); c = 6; break;
+                default: break;
+            }
+        }
+
+        const int t = (d*c + b) ^ a;
+        return (a & 0x80) | (t >> 2);
+    }
+
+    // Unquantize a weight value to [0..64]
+    int UnquantizeWeight(int value, int quant)
+    {
+        const int bits = ASTC_ISE_ENCODING[quant][0];
+        int result = 0;
+
+        if (!ASTC_ISE_ENCODING[quant][1] && !ASTC_ISE_ENCODING[quant][2]) result = ReplicateBits(value, bits, 6);
+        else if (bits == 0)
+        {
+            constexpr int tritWeights[3] = { 0, 32, 63 };
+            constexpr int quintWeights[5] = { 0, 16, 32, 47, 63 };
+            result = ASTC_ISE_ENCODING[quant][1]? tritWeights[value] : quintWeights[value];
+        }
+        else
+        {
+            const int m = value & ((1 << bits) - 1);
+            const int d = value >> bits;
+            const int a = (m & 1)? 0x7f : 0;
+            const int x = m >> 1;
+            int b = 0, c = 0;
+
+            if (ASTC_ISE_ENCODING[quant][1])
+            {
+                switch (bits)
+                {
+                    case 1: c = 50; break;
+                    case 2: b = (x << 6) | (x << 2) | x; c = 23; break;
+                    case 3: b = (x << 5) | x; c = 11; break;
+                    default: break;
+                }
+            }
+            else
+            {
+                switch (bits)
+                {
+                    case 1: c = 28; break;
+                    case 2: b = (x << 6) | (x << 1); c = 13; break;
+                    default: break;
+                }
+            }
+
+            const int t = (d*c + b) ^ a;
+            result = (a & 0x20) | (t >> 2);
+        }
+
+        return (result > 32)? result + 1 : result;
+    }
+
+    uint32_t HashPartition(uint32_t p)
+    {
+        p ^= p >> 15; p -= p << 17; p += p << 7; p += p << 4;
+        p ^= p >> 5; p += p << 16; p ^= p >> 7; p ^= p >> 3;
+        p ^= p << 6; p ^= p >> 17;
+        return p;
+    }
+
+    // Get the partition of a texel (ASTC partition hash function)
+    int SelectPartition(int seed, int x, int y, int partitionCount, bool smallBlock)
+    {
+        if (smallBlock)
+        {
+            x <<= 1;
+            y <<= 1;
+        }
+
+        seed += (partitionCount - 1)*1024;
+
+        const uint32_t rnum = HashPartition(seed);
+        int seeds[8];
+        for (int i = 0; i < 8; i++)
+        {
+            seeds[i] = (rnum >> (4*i)) & 0xf;
+            seeds[i] *= seeds[i];
+        }
+
+        int sh1, sh2;
+        if (seed & 1)
+        {
+            sh1 = (seed & 2)? 4 : 5;
+            sh2 = (partitionCount == 3)? 6 : 5;
+        }
+        else
+        {
+            sh1 = (partitionCount == 3)? 6 : 5;
+            sh2 = (seed & 2)? 4 : 5;
+        }
+
+        for (int i = 0; i < 8; i++) seeds[i] >>= (i & 1)? sh2 : sh1;
+
+        // NOTE: z is always 0 for 2D blocks, seeds 9 to 12 are not used
+        int a = (seeds[0]*x + seeds[1]*y + (rnum >> 14)) & 0x3f;
+        int b = (seeds[2]*x + seeds[3]*y + (rnum >> 10)) & 0x3f;
+        int c = (seeds[4]*x + seeds[5]*y + (rnum >> 6)) & 0x3f;
+        int d = (seeds[6]*x + seeds[7]*y + (rnum >> 2)) & 0x3f;
+
+        if (partitionCount < 4) d = 0;
+        if (partitionCount < 3) c = 0;
+
+        if ((a >= b) && (a >= c) && (a >= d)) return 0;
+        else if ((b >= c) && (b >= d)) return 1;
+        else if (c >= d) return 2;
+        return 3;
+    }
+
+    void TransferBitsSigned(int &a, int &b)
+    {
+        b >>= 1;
+        b |= a & 0x80;
+        a >>= 1;
+        a &= 0x3f;
+        if (a & 0x20) a -= 0x40;
+    }
+
+    void BlueContract(int *color)
+    {
+        color[0] = (color[0] + color[2]) >> 1;
+        color[1] = (color[1] + color[2]) >> 1;
+    }
+
+    // Decode the endpoints of a LDR color endpoint mode, returns false for HDR modes
+    bool DecodeEndpoints(int mode, const int *v, int *endpoint0, int *endpoint1)
+    {
+        int e0[4] = { 0, 0, 0, 255 };
+        int e1[4] = { 0, 0, 0, 255 };
+
+        switch (mode)
+        {
+            case 0:     // Luminance, direct
+            {
+                e0[0] = e0[1] = e0[2] = v[0];
+                e1[0] = e1[1] = e1[2] = v[1];
+            } break;
+            case 1:     // Luminance, base + offset
+            {
+                const int l0 = (v[0] >> 2) | (v[1] & 0xc0);
+                const int l1 = std::min(l0 + (v[1] & 0x3f), 255);
+                e0[0] = e0[1] = e0[2] = l0;
+                e1[0] = e1[1] = e1[2] = l1;
+            } break;
+            case 4:     // Luminance + alpha, direct
+            {
+                e0[0] = e0[1] = e0[2] = v[0];
+                e1[0] = e1[1] = e1[2] = v[1];
+                e0[3] = v[2];
+                e1[3] = v[3];
+            } break;
+            case 5:     // Luminance + alpha, base + offset
+            {
+                int v0 = v[0], v1 = v[1], v2 = v[2], v3 = v[3];
+                TransferBitsSigned(v1, v0);
+                TransferBitsSigned(v3, v2);
+                e0[0] = e0[1] = e0[2] = v0;
+                e1[0] = e1[1] = e1[2] = Clamp255(v0 + v1);
+                e0[3] = v2;
+                e1[3] = Clamp255(v2 + v3);
+            } break;
+            case 6:     // RGB, base + scale
+            case 10:    // RGB, base + scale, two alpha
+            {
+                for (int c = 0; c < 3; c++)
+                {
+                    e0[c] = (v[c]*v[3]) >> 8;
+                    e1[c] = v[c];
+                }
+
+                if (mode == 10)
+                {
+                    e0[3] = v[4];
+                    e1[3] = v[5];
+                }
+            } break;
+            case 8:     // RGB, direct
+            case 12:    // RGBA, direct
+            {
+                for (int c = 0; c < 3; c++)
+                {
+                    e0[c] = v[2*c];
+                    e1[c] = v[2*c + 1];
+                }
+
+                if (mode == 12)
+                {
+                    e0[3] = v[6];
+                    e1[3] = v[7];
+                }
+
+                if ((e1[0] + e1[1] + e1[2]) < (e0[0] + e0[1] + e0[2]))
+                {
+                    std::swap(e0, e1);
+                    BlueContract(e0);
+                    BlueContract(e1);
+                }
+            } break;
+            case 9:     // RGB, base + offset
+            case 13:    // RGBA, base + offset
+            {
+                const int count = (mode == 13)? 4 : 3;
+                int base[4] = { 0, 0, 0, 255 };
+                int offset[4] = { 0, 0, 0, 0 };
+
+                for (int c = 0; c < count; c++)
+                {
+                    base[c] = v[2*c];
+                    offset[c] = v[2*c + 1];
+                    TransferBitsSigned(offset[c], base[c]);
+                }
+
+                if ((offset[0] + offset[1] + offset[2]) >= 0)
+                {
+                    for (int c = 0; c < 4; c++)
+                    {
+                        e0[c] = base[c];
+                        e1[c] = base[c] + offset[c];
+                    }
+                }
+                else
+                {
+                    for (int c = 0; c < 4; c++)
+                    {
+                        e0[c] = base[c] + offset[c];
+                        e1[c] = base[c];
+                    }
+
+                    BlueContract(e0);
+                    BlueContract(e1);
+                }
+
+                for (int c = 0; c < 4; c++)
+                {
+                    e0[c] = Clamp255(e0[c]);
+                    e1[c] = Clamp255(e1[c]);
+                }
+            } break;
+            default: return false;      // HDR modes
+        }
+
+        std::memcpy(endpoint0, e0, sizeof(e0));
+        std::memcpy(endpoint1, e1, sizeof(e1));
+
+        return true;
+    }
+
+    void FillAstcErrorColor(uint8_t *texels, int texelCount)
+    {
+        for (int i = 0; i < texelCount; i++) SetTexel(texels + i*4, 255, 0, 255, 255);
+    }
+
+    void DecodeBlockAstc(const uint8_t *block, uint8_t *texels, int blockWidth, int blockHeight)
+    {
+        const int texelCount = blockWidth*blockHeight;
+        const int blockMode = ReadAstcBits(block, 0, 11);
+
+        // Void-extent block (constant color)
+        if ((blockMode & 0x1ff) == 0x1fc)
+        {
+            // NOTE: Extent coordinates are not used, they must be all ones or a valid min/max range
+            const int minS = ReadAstcBits(block, 12, 13), maxS = ReadAstcBits(block, 25, 13);
+            const int minT = ReadAstcBits(block, 38, 13), maxT = ReadAstcBits(block, 51, 13);
+            const bool allOnes = (minS == 0x1fff) && (maxS == 0x1fff) && (minT == 0x1fff) && (maxT == 0x1fff);
+
+            if ((blockMode & 0x200) || (((minS >= maxS) || (minT >= maxT)) && !allOnes))
+            {
+                FillAstcErrorColor(texels, texelCount);     // HDR constant color or invalid extent
+                return;
+            }
+
+            int color[4];
+            for (int c = 0; c < 4; c++) color[c] = ReadAstcBits(block, 64 + 16*c, 16) >> 8;
+
+            for (int i = 0; i < texelCount; i++) SetTexel(texels + i*4, color[0], color[1], color[2], color[3]);
+            return;
+        }
+
+        // Weight grid size, dual plane and weights quantization from the block mode
+        int weightsX = 0, weightsY = 0;
+        int baseQuant = (blockMode >> 4) & 1;
+        int h = (blockMode >> 9) & 1;
+        int d = (blockMode >> 10) & 1;
+        const int a = (blockMode >> 5) & 3;
+
+        if ((blockMode & 3) != 0)
+        {
+            baseQuant |= (blockMode & 3) << 1;
+            int b = (blockMode >> 7) & 3;
+
+            switch ((blockMode >> 2) & 3)
+            {
+                case 0: weightsX = b + 4; weightsY = a + 2; break;
+                case 1: weightsX = b + 8; weightsY = a + 2; break;
+                case 2: weightsX = a + 2; weightsY = b + 8; break;
+                case 3:
+                {
+                    b &= 1;
+                    if (blockMode & 0x100) { weightsX = b + 2; weightsY = a + 2; }
+                    else { weightsX = a + 2; weightsY = b + 6; }
+                } break;
+                default: break;
+            }
+        }
+        else
+        {
+            baseQuant |= ((blockMode >> 2) & 3) << 1;
+
+            if (((blockMode >> 2) & 3) == 0)
+            {
+                FillAstcErrorColor(texels, texelCount);     // Reserved block mode
+                return;
+            }
+
+            const int b = (blockMode >> 9) & 3;
+
+            switch ((blockMode >> 7) & 3)
+            {
+                case 0: weightsX = 12; weightsY = a + 2; break;
+                case 1: weightsX = a + 2; weightsY = 12; break;
+                case 2: weightsX = a + 6; weightsY = b + 6; d = 0; h = 0; break;
+                case 3:
+                {
+                    if (a == 0) { weightsX = 6; weightsY = 10; }
+                    else if (a == 1) { weightsX = 10; weightsY = 6; }
+                } break;
+                default: break;
+            }
+        }
+
+        const bool dualPlane = (d != 0);
+        const int weightQuant = (baseQuant - 2) + 6*h;
+        const int weightCount = weightsX*weightsY*(dualPlane? 2 : 1);
+        const int partitionCount = ReadAstcBits(block, 11, 2) + 1;
+
+        if ((weightsX == 0) || (weightsX > blockWidth) || (weightsY > blockHeight) || (weightCount > 64) ||
+            (dualPlane && (partitionCount == 4)))
+        {
+            FillAstcErrorColor(texels, texelCount);
+            return;
+        }
+
+        const int weightBits = GetIseBitCount(weightCount, weightQuant);
+
+        if ((weightBits < 24) || (weightBits > 96))
+        {
+            FillAstcErrorColor(texels, texelCount);
+            return;
+        }
+
+        // Color endpoint modes
+        int modes[4] = { 0 };
+        int partitionIndex = 0;
+        int configBits = 17;
+        int extraModeBits = 0;
+
+        if (partitionCount == 1) modes[0] = ReadAstcBits(block, 13, 4);
+        else
+        {
+            partitionIndex = ReadAstcBits(block, 13, 10);
+            configBits = 29;
+
+            const int modeField = ReadAstcBits(block, 23, 6);
+
+            if ((modeField & 3) == 0)
+            {
+                for (int p = 0; p < partitionCount; p++) modes[p] = modeField >> 2;
+            }
+            else
+            {
+                // Remaining bits of the modes are stored below the weights
+                extraModeBits = 3*partitionCount - 4;
+                const int encoded = (modeField >> 2) | (ReadAstcBits(block, 128 - weightBits - extraModeBits, extraModeBits) << 4);
+                const int baseClass = (modeField & 3) - 1;
+
+                for (int p = 0; p < partitionCount; p++)
+                {
+                    modes[p] = (baseClass + ((encoded >> p) & 1))*4 + ((encoded >> (partitionCount + 2*p)) & 3);
+                }
+            }
+        }
+
+        int valueCount = 0;
+        for (int p = 0; p < partitionCount; p++) valueCount += ((modes[p] >> 2) + 1)*2;
+
+        const int colorBits = 128 - configBits - weightBits - extraModeBits - (dualPlane? 2 : 0);
+
+        // Highest color quantization level fitting in the remaining bits
+        int colorQuant = -1;
+
+        if (valueCount <= 18)
+        {
+            for (int q = ASTC_QUANT_COUNT - 1; q >= 0; q--)
+            {
+                if (GetIseBitCount(valueCount, q) <= colorBits)
+                {
+                    colorQuant = q;
+                    break;
+                }
+            }
+        }
+
+        if (colorQuant < ASTC_QUANT_6)
+        {
+            FillAstcErrorColor(texels, texelCount);
+            return;
+        }
+
+        int values[18];
+        DecodeIse(block, configBits, valueCount, colorQuant, values);
+        for (int i = 0; i < valueCount; i++) values[i] = UnquantizeColor(values[i], colorQuant);
+
+        int endpoints[4][2][4];
+        bool hdr[4] = { false };
+
+        for (int p = 0, offset = 0; p < partitionCount; p++)
+        {
+            // NOTE: Texels of a partition using an HDR endpoint mode are decoded with the error color
+            hdr[p] = !DecodeEndpoints(modes[p], values + offset, endpoints[p][0], endpoints[p][1]);
+            offset += ((modes[p] >> 2) + 1)*2;
+        }
+
+        const int planeComponent = dualPlane? ReadAstcBits(block, 128 - weightBits - extraModeBits - 2, 2) : -1;
+
+        // Weights are stored in reverse bit order from the end of the block
+        uint8_t reversed[16];
+        for (int i = 0; i < 16; i++)
+        {
+            uint8_t byte = block[15 - i];
+            byte = static_cast<uint8_t>(((byte & 0xf0) >> 4) | ((byte & 0x0f) << 4));
+            byte = static_cast<uint8_t>(((byte & 0xcc) >> 2) | ((byte & 0x33) << 2));
+            byte = static_cast<uint8_t>(((byte & 0xaa) >> 1) | ((byte & 0x55) << 1));
+            reversed[i] = byte;
+        }
+
+        int weights[64 + 2*16] = { 0 };     // NOTE: Padding for the bilinear infill of the last row and column
+        DecodeIse(reversed, 0, weightCount, weightQuant, weights);
+        for (int i = 0; i < weightCount; i++) weights[i] = UnquantizeWeight(weights[i], weightQuant);
+
+        const int planeCount = dualPlane? 2 : 1;
+        const int ds = (1024 + blockWidth/2)/(blockWidth - 1);
+        const int dt = (1024 + blockHeight/2)/(blockHeight - 1);
+
+        for (int y = 0; y < blockHeight; y++)
+        {
+            for (int x = 0; x < blockWidth; x++)
+            {
+                // Bilinear infill of the weight grid
+                const int gs = (ds*x*(weightsX - 1) + 32) >> 6;
+                const int gt = (dt*y*(weightsY - 1) + 32) >> 6;
+                const int js = gs >> 4, fs = gs & 0xf;
+                const int jt = gt >> 4, ft = gt & 0xf;
+                const int w11 = (fs*ft + 8) >> 4;
+                const int w10 = ft - w11;
+                const int w01 = fs - w11;
+                const int w00 = 16 - fs - ft + w11;
+                const int v0 = js + jt*weightsX;
+
+                int texelWeights[2];
+                for (int plane = 0; plane < planeCount; plane++)
+                {
+                    const int p00 = weights[v0*planeCount + plane];
+                    const int p01 = weights[(v0 + 1)*planeCount + plane];
+                    const int p10 = weights[(v0 + weightsX)*planeCount + plane];
+                    const int p11 = weights[(v0 + weightsX + 1)*planeCount + plane];
+
+                    texelWeights[plane] = (p00*w00 + p01*w01 + p10*w10 + p11*w11 + 8) >> 4;
+                }
+
+                const int partition = (partitionCount > 1)? SelectPartition(partitionIndex, x, y, partitionCount, texelCount < 31) : 0;
+                const int *e0 = endpoints[partition][0];
+                const int *e1 = endpoints[partition][1];
+                uint8_t *texel = texels + (y*blockWidth + x)*4;
+
+                if (hdr[partition])
+                {
+                    SetTexel(texel, 255, 0, 255, 255);
+                    continue;
+                }
+
+                for (int c = 0; c < 4; c++)
+                {
+                    const int weight = (c == planeComponent)? texelWeights[1] : texelWeights[0];
+                    const int c0 = (e0[c] << 8) | e0[c];
+                    const int c1 = (e1[c] << 8) | e1[c];
+
+                    texel[c] = static_cast<uint8_t>(((c0*(64 - weight) + c1*weight + 32) >> 6) >> 8);
+                }
+            }
+        }
+    }
+
+    // Decoded block storage
+    //-----------------------------------------------------------------------------------------
+
+    // Write the visible texels of a decoded block, converted to the destination format
+    void StoreBlock(const uint8_t *texels, int blockWidth, int blockHeight, int bx, int by, int width, int height,
+        PixelFormat destFormat, uint8_t *dest)
+    {
+        const int countX = std::min(blockWidth, width - bx*blockWidth);
+        const int countY = std::min(blockHeight, height - by*blockHeight);
+
+        for (int y = 0; y < countY; y++)
+        {
+            const uint8_t *src = texels + y*blockWidth*4;
+            const int offset = (by*blockHeight + y)*width + bx*blockWidth;
+
+            if (destFormat == PixelFormat::R5G6B5)
+            {
+                uint16_t *row = reinterpret_cast<uint16_t*>(dest) + offset;
+
+                for (int x = 0; x < countX; x++, src += 4)
+                {
+                    row[x] = static_cast<uint16_t>(((src[0]*31 + 127)/255 << 11) | ((src[1]*63 + 127)/255 << 5) | (src[2]*31 + 127)/255);
+                }
+            }
+            else std::memcpy(dest + offset*4, src, countX*4);
+        }
+    }
+
+}
+
+/* TEXTURE DECOMPRESSION IMPLEMENTATION */
+
+// Check if compressed format can be decoded by the CPU decoder
+bool rlgl::IsDecompressionFormatSupported(PixelFormat format)
+{
+    return IsCompressionFormatSupported(format) || (format == PixelFormat::ASTC_4x4_RGBA) || (format == PixelFormat::ASTC_8x8_RGBA);
+}
+
+// Decompress image on the CPU
+// NOTE: Rows of blocks are decoded by multiple threads
+bool rlgl::DecompressImage(const void *data, int width, int height, PixelFormat format, void *dest, PixelFormat destFormat)
+{
+    if (!IsDecompressionFormatSupported(format) || ((destFormat != PixelFormat::R8G8B8A8) && (destFormat != PixelFormat::R5G6B5)) ||
+        (data == nullptr) || (dest == nullptr) || (width <= 0) || (height <= 0))
+    {
+        TRACELOG(LogWarning, "TEXTURE: CPU decompression not supported for pixel format (%i)", format);
+        return false;
+    }
+
+    const uint8_t *blocks = static_cast<const uint8_t*>(data);
+    uint8_t *pixels = static_cast<uint8_t*>(dest);
+
+    const int blockDim = (format == PixelFormat::ASTC_8x8_RGBA)? 8 : 4;
+    const int blocksX = (width + blockDim - 1)/blockDim;
+    const int blocksY = (height + blockDim - 1)/blockDim;
+    const int blockSize = GetPixelDataSize(blockDim, blockDim, format);
+
+    ParallelFor(blocksY, [&](int begin, int end) {
+        uint8_t texels[ASTC_MAX_BLOCK_TEXELS*4];
+
+        for (int by = begin; by < end; by++)
+        {
+            for (int bx = 0; bx < blocksX; bx++)
+            {
+                const uint8_t *block = blocks + (by*blocksX + bx)*blockSize;
+
+                switch (format)
+                {
+                    case PixelFormat::DXT1_RGB: DecodeBlockBc1(block, texels, false, false); break;
+                    case PixelFormat::DXT1_RGBA: DecodeBlockBc1(block, texels, true, false); break;
+                    case PixelFormat::DXT3_RGBA: DecodeBlockBc2(block, texels); break;
+                    case PixelFormat::DXT5_RGBA: DecodeBlockBc3(block, texels); break;
+                    case PixelFormat::ETC1_RGB: DecodeBlockEtc(block, texels, false); break;
+                    case PixelFormat::ETC2_RGB: DecodeBlockEtc(block, texels, true); break;
+                    case PixelFormat::ETC2_EAC_RGBA:
+                    {
+                        DecodeBlockEtc(block + 8, texels, true);
+                        DecodeBlockEac(block, texels);
+                    } break;
+                    case PixelFormat::ASTC_4x4_RGBA: DecodeBlockAstc(block, texels, 4, 4); break;
+                    case PixelFormat::ASTC_8x8_RGBA: DecodeBlockAstc(block, texels, 8, 8); break;
+                    default: break;
+                }
+
+                StoreBlock(texels, blockDim, blockDim, bx, by, width, height, destFormat, pixels);
+            }
+        }
+    });
+
+    return true;
+}
+
+// Decompress image on the CPU
+std::vector<uint8_t> rlgl::DecompressImage(const void *data, int width, int height, PixelFormat format, PixelFormat destFormat)
+{
+    std::vector<uint8_t> pixels(GetPixelDataSize(width, height, destFormat));
+
+    if (!DecompressImage(data, width, height, format, pixels.data(), destFormat)) pixels.clear();
+
+    return pixels;
+}
+
+// Decompress every level of compressed mipmap chain
+std::vector<uint8_t> rlgl::DecompressMipmapChain(const void *data, int width, int height, int mipmapCount, PixelFormat format, PixelFormat destFormat)
+{
+    std::vector<uint8_t> chain(GetMipmapChainDataSize(width, height, destFormat, mipmapCount));
+
+    const uint8_t *srcPtr = static_cast<const uint8_t*>(data);
+    uint8_t *dstPtr = chain.data();
+
+    for (int i = 0; i < mipmapCount; i++)
+    {
+        if (!DecompressImage(srcPtr, width, height, format, dstPtr, destFormat)) return std::vector<uint8_t>();
+
+        srcPtr += GetPixelDataSize(width, height, format);
+        dstPtr += GetPixelDataSize(width, height, destFormat);
+        width = std::max(width/2, 1);
+        height = std::max(height/2, 1);
+    }
+
+    return chain;
+}
@@ -1,5 +1,6 @@
 #include "rlGLExt.hpp"
 #include "rlConfig.hpp"
+#include "rlNullGL.hpp"
 
 #if defined(GRAPHICS_API_OPENGL_ES2) && !defined(GRAPHICS_API_OPENGL_ES3)
 
@@ -29,6 +30,12 @@ void rlgl::LoadExtensions(void *loader(const char *))
 {
     if (ExtLoaded) return;  // If the extensions have already been loaded we stop here
 
+#if defined(RLGL_NULL_GL)
+    // NOTE: GL calls are routed to the null backend, the given loader is ignored
+    loader = NullGLLoader;
+    TRACELOG(TraceLogLevel::Info, "GL: Null GL backend enabled, GL calls are recorded and not executed");
+#endif
+
 #if defined(GRAPHICS_API_OPENGL_33)     // Also defined for GRAPHICS_API_OPENGL_21
 
     // NOTE: glad is generated and contains only required OpenGL 3.3 Core extensions (and lower versions)
@@ -83,10 +90,13 @@ void rlgl::LoadExtensions(void *loader(const char *))
     ExtSupported.texCompASTC = GLAD_GL_KHR_texture_compression_astc_hdr && GLAD_GL_KHR_texture_compression_astc_ldr;
     ExtSupported.texCompDXT = GLAD_GL_EXT_texture_compression_s3tc;  // Texture compression: DXT
     ExtSupported.texCompETC2 = GLAD_GL_ARB_ES3_compatibility;        // Texture compression: ETC2/EAC
+    ExtSupported.texStorage = GLAD_GL_VERSION_4_2 || GLAD_GL_ARB_texture_storage;  // Immutable texture storage
+    ExtSupported.copyImage = GLAD_GL_VERSION_4_3 || GLAD_GL_ARB_copy_image;        // Texture copies (glCopyImageSubData)
+    ExtSupported.timerQuery = GLAD_GL_VERSION_3_3 || GLAD_GL_ARB_timer_query;     // GPU timestamps (glQueryCounter)
 
 #   if defined(GRAPHICS_API_OPENGL_43)
-        ExtSupported.computeShader = GLAD_GL_ARB_compute_shader;
-        ExtSupported.ssbo = GLAD_GL_ARB_shader_storage_buffer_object;
+        ExtSupported.computeShader = GLAD_GL_VERSION_4_3 || GLAD_GL_ARB_compute_shader;
+        ExtSupported.ssbo = GLAD_GL_VERSION_4_3 || GLAD_GL_ARB_shader_storage_buffer_object;
 #   endif
 
 #endif  // GRAPHICS_API_OPENGL_33
@@ -105,6 +115,7 @@ void rlgl::LoadExtensions(void *loader(const char *))
     ExtSupported.maxDepthBits = 24;
     ExtSupported.texAnisoFilter = true;
     ExtSupported.texMirrorClamp = true;
+    ExtSupported.texStorage = true;
     // TODO: Check for additional OpenGL ES 3.0 supported extensions:
     //ExtSupported.texCompDXT = true;
     //ExtSupported.texCompETC1 = true;
@@ -232,6 +243,9 @@ void rlgl::LoadExtensions(void *loader(const char *))
 
         // Check clamp mirror wrap mode support
         if (std::strcmp(extList[i], (const char *)"GL_EXT_texture_mirror_clamp") == 0) ExtSupported.texMirrorClamp = true;
+
+        // Check GPU timestamp queries support
+        if (std::strcmp(extList[i], (const char *)"GL_EXT_disjoint_timer_query") == 0) ExtSupported.timerQuery = true;
     }
 
     // Free extensions pointers
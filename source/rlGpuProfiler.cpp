@@ -0,0 +1,281 @@
+#include "rlGpuProfiler.hpp"
+#include "rlGLExt.hpp"
+#include "rlUtils.hpp"
+#include "rlgl.hpp"
+
+#include <algorithm>
+#include <cstdio>
+
+using namespace rlgl;
+
+#if defined(GRAPHICS_API_OPENGL_33) || (defined(GRAPHICS_API_OPENGL_ES2) && defined(GL_EXT_disjoint_timer_query))
+    #define RLGL_TIMER_QUERIES
+#endif
+
+namespace {
+
+    constexpr int MIN_POOL_QUERIES = 16;            // Timestamp queries allocated at once when a frame pool grows
+
+    //----------------------------------------------------------------------------------
+
+#if defined(RLGL_TIMER_QUERIES)
+
+    // Timestamp queries entry points (core on OpenGL 3.3, extension on OpenGL ES)
+#   if defined(GRAPHICS_API_OPENGL_33)
+        void GenQueries(int count, uint32_t *ids) { glGenQueries(count, ids); }
+        void DeleteQueries(int count, const uint32_t *ids) { glDeleteQueries(count, ids); }
+        void QueryTimestamp(uint32_t id) { glQueryCounter(id, GL_TIMESTAMP); }
+        bool IsQueryAvailable(uint32_t id) { GLuint available = GL_FALSE; glGetQueryObjectuiv(id, GL_QUERY_RESULT_AVAILABLE, &available); return (available == GL_TRUE); }
+        uint64_t GetQueryTimestamp(uint32_t id) { GLuint64 time = 0; glGetQueryObjectui64v(id, GL_QUERY_RESULT, &time); return time; }
+        bool IsDisjoint() { return false; }
+#   else
+        void GenQueries(int count, uint32_t *ids) { glGenQueriesEXT(count, ids); }
+        void DeleteQueries(int count, const uint32_t *ids) { glDeleteQueriesEXT(count, ids); }
+        void QueryTimestamp(uint32_t id) { glQueryCounterEXT(id, GL_TIMESTAMP_EXT); }
+        bool IsQueryAvailable(uint32_t id) { GLuint available = GL_FALSE; glGetQueryObjectuivEXT(id, GL_QUERY_RESULT_AVAILABLE_EXT, &available); return (available == GL_TRUE); }
+        uint64_t GetQueryTimestamp(uint32_t id) { GLuint64 time = 0; glGetQueryObjectui64vEXT(id, GL_QUERY_RESULT_EXT, &time); return time; }
+        bool IsDisjoint() { GLint disjoint = 0; glGetIntegerv(GL_GPU_DISJOINT_EXT, &disjoint); return (disjoint != 0); }
+#   endif
+
+#endif  // RLGL_TIMER_QUERIES
+
+    // Append a complete trace event (times in nanoseconds, written in microseconds)
+    void AppendTraceEvent(std::string& json, const std::string& name, int64_t start, uint64_t duration)
+    {
+        char times[64];
+        std::snprintf(times, sizeof(times), "%.3f,\"dur\":%.3f", start/1000.0, duration/1000.0);
+
+        json += ",\n{\"name\":";
+        AppendJsonString(json, name.c_str());
+        json += ",\"cat\":\"gpu\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":";
+        json += times;
+        json += '}';
+    }
+
+}
+
+/* GPU PROFILER IMPLEMENTATION */
+
+GpuProfiler::GpuProfiler(Context& rlCtx, int latency, int historySize)
+: rlCtx(&rlCtx), ready(false), historySize(std::max(historySize, 1))
+, pools(std::max(latency, 1)), frameCounter(0), frameActive(false)
+{
+#if defined(RLGL_TIMER_QUERIES)
+    if (!GetExtensions().timerQuery)
+    {
+        TRACELOG(LogWarning, "PROFILER: Timer queries not supported, GPU profiler not loaded");
+        return;
+    }
+
+    ready = true;
+    rlCtx.SetGpuProfiler(this);
+
+    TRACELOG(LogInfo, "PROFILER: GPU profiler loaded (%i frames latency)", static_cast<int>(pools.size()));
+#else
+    TRACELOG(LogWarning, "PROFILER: Timer queries not supported, GPU profiler not loaded");
+#endif
+}
+
+GpuProfiler::~GpuProfiler()
+{
+    Unload();
+}
+
+GpuProfiler::GpuProfiler(GpuProfiler&& other) noexcept
+: rlCtx(other.rlCtx), ready(other.ready), historySize(other.historySize)
+, pools(std::move(other.pools)), openScopes(std::move(other.openScopes))
+, frameCounter(other.frameCounter), frameActive(other.frameActive), frames(std::move(other.frames))
+{
+    if (rlCtx->GetGpuProfiler() == &other) rlCtx->SetGpuProfiler(this);
+
+    other.ready = false;
+    other.pools.clear();
+    other.frameActive = false;
+}
+
+GpuProfiler& GpuProfiler::operator=(GpuProfiler&& other) noexcept
+{
+    if (this != &other)
+    {
+        Unload();
+
+        rlCtx = other.rlCtx;
+        ready = other.ready;
+        historySize = other.historySize;
+        pools = std::move(other.pools);
+        openScopes = std::move(other.openScopes);
+        frameCounter = other.frameCounter;
+        frameActive = other.frameActive;
+        frames = std::move(other.frames);
+
+        if (rlCtx->GetGpuProfiler() == &other) rlCtx->SetGpuProfiler(this);
+
+        other.ready = false;
+        other.pools.clear();
+        other.frameActive = false;
+    }
+    return *this;
+}
+
+void GpuProfiler::BeginFrame()
+{
+    if (!ready) return;
+    if (frameActive) EndFrame();
+
+    FrameQueries &frame = pools[frameCounter%pools.size()];
+
+    // The pool is needed again, results not available yet are dropped (never wait for the GPU)
+    if (frame.pending && !CollectFrame(frame))
+    {
+        TRACELOG(LogWarning, "PROFILER: Frame %i results not available after %i frames, dropped", static_cast<int>(frame.index), static_cast<int>(pools.size()));
+        frame.pending = false;
+    }
+
+    frame.queryCount = 0;
+    frame.scopes.clear();
+    frame.index = frameCounter;
+
+    frameActive = true;
+    RecordTimestamp(frame);     // Frame start (first query of the pool)
+}
+
+void GpuProfiler::EndFrame()
+{
+    if (!frameActive) return;
+
+    while (!openScopes.empty()) EndScope();
+
+    FrameQueries &frame = pools[frameCounter%pools.size()];
+    RecordTimestamp(frame);     // Frame end (last query of the pool)
+    frame.pending = true;
+
+    frameActive = false;
+    frameCounter++;
+
+    // Collect the frames in flight, oldest first, GPU commands complete in order
+    for (std::size_t i = 0; i < pools.size(); i++)
+    {
+        FrameQueries &pending = pools[(frameCounter + i)%pools.size()];
+        if (pending.pending && !CollectFrame(pending)) break;
+    }
+}
+
+void GpuProfiler::BeginScope(const char *name)
+{
+    if (!frameActive) return;
+
+    FrameQueries &frame = pools[frameCounter%pools.size()];
+
+    Scope scope;
+    scope.name = name;
+    scope.depth = static_cast<int>(openScopes.size());
+    scope.beginQuery = RecordTimestamp(frame);
+
+    openScopes.push_back(static_cast<int>(frame.scopes.size()));
+    frame.scopes.push_back(std::move(scope));
+}
+
+void GpuProfiler::EndScope()
+{
+    if (!frameActive || openScopes.empty()) return;
+
+    FrameQueries &frame = pools[frameCounter%pools.size()];
+
+    frame.scopes[openScopes.back()].endQuery = RecordTimestamp(frame);
+    openScopes.pop_back();
+}
+
+std::string GpuProfiler::ExportChromeTrace() const
+{
+    std::string json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"
+        "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"GPU\"}}";
+
+    const uint64_t base = frames.empty() ? 0 : frames.front().timestamp;
+
+    for (const GpuProfileFrame& frame : frames)
+    {
+        const int64_t frameStart = static_cast<int64_t>(frame.timestamp - base);
+        AppendTraceEvent(json, "Frame " + std::to_string(frame.index), frameStart, frame.duration);
+
+        for (const GpuProfileScope& scope : frame.scopes)
+        {
+            AppendTraceEvent(json, scope.name, frameStart + static_cast<int64_t>(scope.start), scope.duration);
+        }
+    }
+
+    json += "\n]}\n";
+
+    return json;
+}
+
+int GpuProfiler::RecordTimestamp(FrameQueries& frame)
+{
+#if defined(RLGL_TIMER_QUERIES)
+    if (frame.queryCount == static_cast<int>(frame.queries.size()))
+    {
+        const int count = std::max(static_cast<int>(frame.queries.size()), MIN_POOL_QUERIES);
+        frame.queries.resize(frame.queries.size() + count);
+        GenQueries(count, frame.queries.data() + frame.queryCount);
+    }
+
+    QueryTimestamp(frame.queries[frame.queryCount]);
+#endif
+
+    return frame.queryCount++;
+}
+
+bool GpuProfiler::CollectFrame(FrameQueries& frame)
+{
+#if defined(RLGL_TIMER_QUERIES)
+    // Frame end is the last query, all the previous ones are available with it
+    if (!IsQueryAvailable(frame.queries[frame.queryCount - 1])) return false;
+
+    frame.pending = false;
+
+    // Timestamps are meaningless after a disjoint operation (i.e. GPU frequency change)
+    if (IsDisjoint()) return true;
+
+    std::vector<uint64_t> timestamps(frame.queryCount);
+    for (int i = 0; i < frame.queryCount; i++) timestamps[i] = GetQueryTimestamp(frame.queries[i]);
+
+    GpuProfileFrame result;
+    result.index = frame.index;
+    result.timestamp = timestamps.front();
+    result.duration = timestamps.back() - timestamps.front();
+    result.scopes.reserve(frame.scopes.size());
+
+    for (const Scope& scope : frame.scopes)
+    {
+        GpuProfileScope region;
+        region.name = scope.name;
+        region.depth = scope.depth;
+        region.start = timestamps[scope.beginQuery] - timestamps.front();
+        region.duration = timestamps[scope.endQuery] - timestamps[scope.beginQuery];
+        result.scopes.push_back(std::move(region));
+    }
+
+    frames.push_back(std::move(result));
+    while (static_cast<int>(frames.size()) > historySize) frames.pop_front();
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+void GpuProfiler::Unload()
+{
+    if (rlCtx->GetGpuProfiler() == this) rlCtx->SetGpuProfiler(nullptr);
+
+#if defined(RLGL_TIMER_QUERIES)
+    for (FrameQueries& frame : pools)
+    {
+        if (!frame.queries.empty()) DeleteQueries(static_cast<int>(frame.queries.size()), frame.queries.data());
+        frame.queries.clear();
+    }
+#endif
+
+    ready = false;
+    frameActive = false;
+    openScopes.clear();
+}
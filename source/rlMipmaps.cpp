@@ -0,0 +1,588 @@
+#include "rlMipmaps.hpp"
+#include "rlConfig.hpp"
+#include "rlUtils.hpp"
+#include "rlMath.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <memory>
+#include <functional>
+#include <thread>
+
+#if defined(RLGL_SIMD_SSE2)
+    #include <emmintrin.h>
+#elif defined(RLGL_SIMD_NEON)
+    #include <arm_neon.h>
+#endif
+
+using namespace rlgl;
+
+namespace {
+
+    constexpr int SRGB_ENCODE_TABLE_SIZE = 16384;       ///< Number of entries of the linear to sRGB table
+    constexpr float KAISER_WIDTH = 3.0f;                ///< Kaiser filter half-width (in destination pixels)
+    constexpr float KAISER_ALPHA = 4.0f;                ///< Kaiser window shape parameter
+    constexpr int MIN_THREAD_PIXELS = 16384;            ///< Minimum pixels processed per thread (smaller levels use fewer threads)
+
+    // Check if the floating point working memory of a chain can be addressed
+    // NOTE: Levels are filtered in RGBA floats (16 bytes per pixel), the temporary and destination
+    // levels of a step never exceed the size of the base level converted to floats
+    bool IsWorkingSetAddressable(int width, int height)
+    {
+        return (static_cast<uint64_t>(width)*height*4 <= SIZE_MAX/sizeof(float));
+    }
+
+    // Get the number of threads used to process a level, small levels do not pay for the thread creation
+    int GetLevelThreadCount(int64_t pixelCount)
+    {
+        const int64_t maxThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        return static_cast<int>(std::max<int64_t>(1, std::min(pixelCount/MIN_THREAD_PIXELS, maxThreads)));
+    }
+
+    // Half float <-> float conversions
+    //-----------------------------------------------------------------------------------------
+
+    float HalfToFloat(uint16_t h)
+    {
+        const uint32_t sign = (h & 0x8000u) << 16;
+        uint32_t exponent = (h >> 10) & 0x1f;
+        uint32_t mantissa = h & 0x3ff;
+        uint32_t bits = 0;
+
+        if (exponent == 0)
+        {
+            if (mantissa != 0)
+            {
+                // Denormalized half, normalize it
+                exponent = 127 - 15 + 1;
+                while ((mantissa & 0x400) == 0) { mantissa <<= 1; exponent--; }
+                bits = sign | (exponent << 23) | ((mantissa & 0x3ff) << 13);
+            }
+            else bits = sign;
+        }
+        else if (exponent == 0x1f) bits = sign | 0x7f800000u | (mantissa << 13);   // Inf/NaN
+        else bits = sign | ((exponent + 127 - 15) << 23) | (mantissa << 13);
+
+        float f;
+        std::memcpy(&f, &bits, sizeof(float));
+        return f;
+    }
+
+    uint16_t FloatToHalf(float f)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &f, sizeof(float));
+
+        const uint16_t sign = (bits >> 16) & 0x8000;
+        const int exponent = static_cast<int>((bits >> 23) & 0xff) - 127 + 15;
+        uint32_t mantissa = bits & 0x7fffff;
+
+        if (((bits >> 23) & 0xff) == 0xff) return sign | 0x7c00 | (mantissa ? 0x200 : 0);  // Inf/NaN
+        if (exponent >= 0x1f) return sign | 0x7c00;                                         // Overflow, to Inf
+        if (exponent <= 0)
+        {
+            if (exponent < -10) return sign;                                                // Underflow, to zero
+            mantissa |= 0x800000;
+            const int shift = 14 - exponent;
+            return sign | static_cast<uint16_t>((mantissa + (1u << (shift - 1))) >> shift);
+        }
+
+        // Round to nearest (carry into the exponent is valid)
+        return static_cast<uint16_t>(sign | ((exponent << 10) + ((mantissa + 0x1000) >> 13)));
+    }
+
+    // sRGB <-> linear conversions
+    //-----------------------------------------------------------------------------------------
+
+    float SrgbToLinear(float c)
+    {
+        return (c <= 0.04045f) ? c/12.92f : std::pow((c + 0.055f)/1.055f, 2.4f);
+    }
+
+    float LinearToSrgb(float c)
+    {
+        return (c <= 0.0031308f) ? c*12.92f : 1.055f*std::pow(c, 1.0f/2.4f) - 0.055f;
+    }
+
+    struct SrgbTables
+    {
+        float toLinear[256];                            ///< 8-bit sRGB to linear
+        uint8_t toSrgb[SRGB_ENCODE_TABLE_SIZE];         ///< Linear (quantized) to 8-bit sRGB
+
+        SrgbTables()
+        {
+            for (int i = 0; i < 256; i++) toLinear[i] = SrgbToLinear(i/255.0f);
+            for (int i = 0; i < SRGB_ENCODE_TABLE_SIZE; i++)
+            {
+                toSrgb[i] = static_cast<uint8_t>(LinearToSrgb(i/static_cast<float>(SRGB_ENCODE_TABLE_SIZE - 1))*255.0f + 0.5f);
+            }
+        }
+
+        static const SrgbTables& Get()
+        {
+            static const SrgbTables tables;     // NOTE: Thread-safe initialization (C++11)
+            return tables;
+        }
+    };
+
+    // Pixel conversions to/from floating point RGBA
+    //-----------------------------------------------------------------------------------------
+
+    int GetChannelCount(PixelFormat format)
+    {
+        switch (format)
+        {
+            case PixelFormat::R32:
+            case PixelFormat::R16:              return 1;
+            case PixelFormat::R32G32B32:
+            case PixelFormat::R16G16B16:        return 3;
+            default:                            return 4;
+        }
+    }
+
+    float Unorm(uint32_t value, uint32_t max, bool srgb)
+    {
+        const float c = value/static_cast<float>(max);
+        return srgb ? SrgbToLinear(c) : c;
+    }
+
+    uint32_t ToUnorm(float value, uint32_t max, bool srgb)
+    {
+        float c = std::min(std::max(value, 0.0f), 1.0f);
+        if (srgb) c = LinearToSrgb(c);
+        return static_cast<uint32_t>(c*max + 0.5f);
+    }
+
+    uint8_t ToUnorm8(float value, const SrgbTables *tables)
+    {
+        const float c = std::min(std::max(value, 0.0f), 1.0f);
+        if (tables != nullptr) return tables->toSrgb[static_cast<int>(c*(SRGB_ENCODE_TABLE_SIZE - 1) + 0.5f)];
+        return static_cast<uint8_t>(c*255.0f + 0.5f);
+    }
+
+    void DecodePixels(const uint8_t *src, float *dst, int count, PixelFormat format, bool srgb)
+    {
+        const SrgbTables *tables = srgb ? &SrgbTables::Get() : nullptr;
+
+        auto unorm8 = [tables](uint8_t v) { return (tables != nullptr) ? tables->toLinear[v] : v/255.0f; };
+
+        for (int i = 0; i < count; i++, dst += 4)
+        {
+            switch (format)
+            {
+                case PixelFormat::Grayscale:
+                {
+                    dst[0] = dst[1] = dst[2] = unorm8(src[i]);
+                    dst[3] = 1.0f;
+                } break;
+                case PixelFormat::GrayAlpha:
+                {
+                    dst[0] = dst[1] = dst[2] = unorm8(src[i*2]);
+                    dst[3] = src[i*2 + 1]/255.0f;
+                } break;
+                case PixelFormat::R8G8B8:
+                {
+                    for (int c = 0; c < 3; c++) dst[c] = unorm8(src[i*3 + c]);
+                    dst[3] = 1.0f;
+                } break;
+                case PixelFormat::R8G8B8A8:
+                {
+                    for (int c = 0; c < 3; c++) dst[c] = unorm8(src[i*4 + c]);
+                    dst[3] = src[i*4 + 3]/255.0f;
+                } break;
+                case PixelFormat::R5G6B5:
+                {
+                    uint16_t p; std::memcpy(&p, src + i*2, 2);
+                    dst[0] = Unorm((p >> 11) & 0x1f, 31, srgb);
+                    dst[1] = Unorm((p >> 5) & 0x3f, 63, srgb);
+                    dst[2] = Unorm(p & 0x1f, 31, srgb);
+                    dst[3] = 1.0f;
+                } break;
+                case PixelFormat::R5G5B5A1:
+                {
+                    uint16_t p; std::memcpy(&p, src + i*2, 2);
+                    dst[0] = Unorm((p >> 11) & 0x1f, 31, srgb);
+                    dst[1] = Unorm((p >> 6) & 0x1f, 31, srgb);
+                    dst[2] = Unorm((p >> 1) & 0x1f, 31, srgb);
+                    dst[3] = static_cast<float>(p & 0x1);
+                } break;
+                case PixelFormat::R4G4B4A4:
+                {
+                    uint16_t p; std::memcpy(&p, src + i*2, 2);
+                    dst[0] = Unorm((p >> 12) & 0xf, 15, srgb);
+                    dst[1] = Unorm((p >> 8) & 0xf, 15, srgb);
+                    dst[2] = Unorm((p >> 4) & 0xf, 15, srgb);
+                    dst[3] = Unorm(p & 0xf, 15, false);
+                } break;
+                case PixelFormat::R32:
+                case PixelFormat::R32G32B32:
+                case PixelFormat::R32G32B32A32:
+                {
+                    const int channels = GetChannelCount(format);
+                    float p[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+                    std::memcpy(p, src + i*channels*4, channels*4);
+                    std::memcpy(dst, p, sizeof(p));
+                } break;
+                case PixelFormat::R16:
+                case PixelFormat::R16G16B16:
+                case PixelFormat::R16G16B16A16:
+                {
+                    const int channels = GetChannelCount(format);
+                    uint16_t p[4] = { 0, 0, 0, 0x3c00 };
+                    std::memcpy(p, src + i*channels*2, channels*2);
+                    for (int c = 0; c < 4; c++) dst[c] = HalfToFloat(p[c]);
+                } break;
+                default: break;
+            }
+        }
+    }
+
+    void EncodePixels(const float *src, uint8_t *dst, int count, PixelFormat format, bool srgb)
+    {
+        const SrgbTables *tables = srgb ? &SrgbTables::Get() : nullptr;
+
+        for (int i = 0; i < count; i++, src += 4)
+        {
+            switch (format)
+            {
+                case PixelFormat::Grayscale: dst[i] = ToUnorm8(src[0], tables); break;
+                case PixelFormat::GrayAlpha:
+                {
+                    dst[i*2] = ToUnorm8(src[0], tables);
+                    dst[i*2 + 1] = ToUnorm8(src[3], nullptr);
+                } break;
+                case PixelFormat::R8G8B8:
+                {
+                    for (int c = 0; c < 3; c++) dst[i*3 + c] = ToUnorm8(src[c], tables);
+                } break;
+                case PixelFormat::R8G8B8A8:
+                {
+                    for (int c = 0; c < 3; c++) dst[i*4 + c] = ToUnorm8(src[c], tables);
+                    dst[i*4 + 3] = ToUnorm8(src[3], nullptr);
+                } break;
+                case PixelFormat::R5G6B5:
+                {
+                    const uint16_t p = (ToUnorm(src[0], 31, srgb) << 11) | (ToUnorm(src[1], 63, srgb) << 5) | ToUnorm(src[2], 31, srgb);
+                    std::memcpy(dst + i*2, &p, 2);
+                } break;
+                case PixelFormat::R5G5B5A1:
+                {
+                    const uint16_t p = (ToUnorm(src[0], 31, srgb) << 11) | (ToUnorm(src[1], 31, srgb) << 6) | (ToUnorm(src[2], 31, srgb) << 1) | ((src[3] >= 0.5f) ? 1 : 0);
+                    std::memcpy(dst + i*2, &p, 2);
+                } break;
+                case PixelFormat::R4G4B4A4:
+                {
+                    const uint16_t p = (ToUnorm(src[0], 15, srgb) << 12) | (ToUnorm(src[1], 15, srgb) << 8) | (ToUnorm(src[2], 15, srgb) << 4) | ToUnorm(src[3], 15, false);
+                    std::memcpy(dst + i*2, &p, 2);
+                } break;
+                case PixelFormat::R32: std::memcpy(dst + i*4, src, 4); break;
+                case PixelFormat::R32G32B32: std::memcpy(dst + i*12, src, 12); break;
+                case PixelFormat::R32G32B32A32: std::memcpy(dst + i*16, src, 16); break;
+                case PixelFormat::R16:
+                case PixelFormat::R16G16B16:
+                case PixelFormat::R16G16B16A16:
+                {
+                    const int channels = GetChannelCount(format);
+                    for (int c = 0; c < channels; c++)
+                    {
+                        const uint16_t h = FloatToHalf(src[c]);
+                        std::memcpy(dst + (i*channels + c)*2, &h, 2);
+                    }
+                } break;
+                default: break;
+            }
+        }
+    }
+
+    // Filter taps computation
+    //-----------------------------------------------------------------------------------------
+
+    // Modified Bessel function of the first kind (order 0), used by the Kaiser window
+    float BesselI0(float x)
+    {
+        float sum = 1.0f, term = 1.0f;
+        const float halfX = 0.5f*x;
+
+        for (int k = 1; k < 32; k++)
+        {
+            term *= (halfX/k)*(halfX/k);
+            sum += term;
+            if (term < sum*1e-8f) break;
+        }
+
+        return sum;
+    }
+
+    float KaiserSinc(float t)
+    {
+        if (std::fabs(t) >= KAISER_WIDTH) return 0.0f;
+
+        const float sinc = (std::fabs(t) < 1e-6f) ? 1.0f : std::sin(PI*t)/(PI*t);
+        const float r = t/KAISER_WIDTH;
+
+        return sinc*BesselI0(KAISER_ALPHA*std::sqrt(1.0f - r*r))/BesselI0(KAISER_ALPHA);
+    }
+
+    struct FilterTaps
+    {
+        int maxTaps = 0;                ///< Number of taps per destination pixel (stride of the arrays)
+        std::vector<int> count;         ///< Number of taps used by each destination pixel
+        std::vector<int> index;         ///< Source pixel of each tap (clamped to edges)
+        std::vector<float> weight;      ///< Normalized weight of each tap
+    };
+
+    FilterTaps ComputeTaps(int srcSize, int dstSize, MipmapFilter filter)
+    {
+        FilterTaps taps;
+
+        const float scale = srcSize/static_cast<float>(dstSize);
+        const float radius = (filter == MipmapFilter::Kaiser) ? KAISER_WIDTH*scale : 0.5f*scale;
+
+        taps.maxTaps = static_cast<int>(std::ceil(2.0f*radius)) + 2;
+        taps.count.assign(dstSize, 0);
+        taps.index.assign(dstSize*taps.maxTaps, 0);
+        taps.weight.assign(dstSize*taps.maxTaps, 0.0f);
+
+        for (int x = 0; x < dstSize; x++)
+        {
+            const float center = (x + 0.5f)*scale;
+            const int first = static_cast<int>(std::floor(center - radius));
+            const int last = static_cast<int>(std::ceil(center + radius)) - 1;
+
+            int *index = &taps.index[x*taps.maxTaps];
+            float *weight = &taps.weight[x*taps.maxTaps];
+            float total = 0.0f;
+            int k = 0;
+
+            for (int i = first; (i <= last) && (k < taps.maxTaps); i++)
+            {
+                float w = 0.0f;
+
+                if (filter == MipmapFilter::Kaiser) w = KaiserSinc((i + 0.5f - center)/scale);
+                else w = std::min(i + 1.0f, center + radius) - std::max(static_cast<float>(i), center - radius);   // Coverage
+
+                if (w == 0.0f) continue;    // Skip useless taps (borders of the box, zeros of the sinc)
+
+                index[k] = std::min(std::max(i, 0), srcSize - 1);
+                weight[k] = w;
+                total += w;
+                k++;
+            }
+
+            taps.count[x] = k;
+            if (total != 0.0f) for (int j = 0; j < k; j++) weight[j] /= total;
+        }
+
+        return taps;
+    }
+
+    // Accumulation helpers (dst += w*src)
+    //-----------------------------------------------------------------------------------------
+
+    inline void Madd4(float *dst, float w, const float *src)
+    {
+#   if defined(RLGL_SIMD_SSE2)
+        _mm_storeu_ps(dst, _mm_add_ps(_mm_loadu_ps(dst), _mm_mul_ps(_mm_set1_ps(w), _mm_loadu_ps(src))));
+#   elif defined(RLGL_SIMD_NEON)
+        vst1q_f32(dst, vmlaq_n_f32(vld1q_f32(dst), vld1q_f32(src), w));
+#   else
+        for (int c = 0; c < 4; c++) dst[c] += w*src[c];
+#   endif
+    }
+
+    inline void Mul4(float *dst, float w, const float *src)
+    {
+#   if defined(RLGL_SIMD_SSE2)
+        _mm_storeu_ps(dst, _mm_mul_ps(_mm_set1_ps(w), _mm_loadu_ps(src)));
+#   elif defined(RLGL_SIMD_NEON)
+        vst1q_f32(dst, vmulq_n_f32(vld1q_f32(src), w));
+#   else
+        for (int c = 0; c < 4; c++) dst[c] = w*src[c];
+#   endif
+    }
+
+    // NOTE: Count is always a multiple of 4 (RGBA rows)
+    void MaddRow(float *dst, float w, const float *src, int count)
+    {
+        for (int i = 0; i < count; i += 4) Madd4(dst + i, w, src + i);
+    }
+
+    void MulRow(float *dst, float w, const float *src, int count)
+    {
+        for (int i = 0; i < count; i += 4) Mul4(dst + i, w, src + i);
+    }
+
+    // Source row accessor, rows can be decoded on the fly into the scratch memory (srcWidth*4 floats)
+    using RowFetch = std::function<const float*(int y, float *scratch)>;
+
+    // Downsample a floating point RGBA level (separable filter, rows split over threads)
+    void DownsampleLevel(const RowFetch& srcRow, int srcWidth, int srcHeight, float *dst, int dstWidth, int dstHeight, MipmapFilter filter)
+    {
+        const FilterTaps tapsX = ComputeTaps(srcWidth, dstWidth, filter);
+        const FilterTaps tapsY = ComputeTaps(srcHeight, dstHeight, filter);
+
+        std::unique_ptr<float[]> tmp(new float[static_cast<std::size_t>(dstWidth)*srcHeight*4]);   // NOTE: Not initialized, fully written by the first pass
+        const int numThreads = GetLevelThreadCount(static_cast<int64_t>(srcWidth)*srcHeight);
+
+        // Horizontal pass: srcWidth x srcHeight -> dstWidth x srcHeight
+        ParallelFor(srcHeight, [&](int begin, int end) {
+            std::unique_ptr<float[]> scratch(new float[static_cast<std::size_t>(srcWidth)*4]);
+
+            for (int y = begin; y < end; y++)
+            {
+                const float *row = srcRow(y, scratch.get());
+                float *tmpRow = tmp.get() + static_cast<std::size_t>(y)*dstWidth*4;
+
+                for (int x = 0; x < dstWidth; x++)
+                {
+                    const int *index = &tapsX.index[x*tapsX.maxTaps];
+                    const float *weight = &tapsX.weight[x*tapsX.maxTaps];
+
+                    Mul4(tmpRow + x*4, weight[0], row + index[0]*4);
+                    for (int k = 1; k < tapsX.count[x]; k++) Madd4(tmpRow + x*4, weight[k], row + index[k]*4);
+                }
+            }
+        }, numThreads);
+
+        // Vertical pass: dstWidth x srcHeight -> dstWidth x dstHeight
+        ParallelFor(dstHeight, [&](int begin, int end) {
+            for (int y = begin; y < end; y++)
+            {
+                float *dstRow = dst + static_cast<std::size_t>(y)*dstWidth*4;
+
+                const int *index = &tapsY.index[y*tapsY.maxTaps];
+                const float *weight = &tapsY.weight[y*tapsY.maxTaps];
+
+                MulRow(dstRow, weight[0], tmp.get() + static_cast<std::size_t>(index[0])*dstWidth*4, dstWidth*4);
+                for (int k = 1; k < tapsY.count[y]; k++) MaddRow(dstRow, weight[k], tmp.get() + static_cast<std::size_t>(index[k])*dstWidth*4, dstWidth*4);
+            }
+        }, numThreads);
+    }
+
+}
+
+/* MIPMAPS IMPLEMENTATION */
+
+// Get number of levels of a complete mipmap chain
+int rlgl::GetMipmapCount(int width, int height)
+{
+    int count = 1;
+    for (int size = std::max(width, height); size > 1; size /= 2) count++;
+    return count;
+}
+
+// Get mipmap chain data size in bytes
+// NOTE: Chains with an invalid level or not representable in an int are reported as 0
+int rlgl::GetMipmapChainDataSize(int width, int height, PixelFormat format, int mipmapCount)
+{
+    int64_t size = 0;
+
+    for (int i = 0; i < mipmapCount; i++)
+    {
+        const int levelSize = GetPixelDataSize(width, height, format);
+        if (levelSize == 0) return 0;
+
+        size += levelSize;
+        if (size > INT_MAX) return 0;
+
+        width = std::max(width/2, 1);
+        height = std::max(height/2, 1);
+    }
+
+    return static_cast<int>(size);
+}
+
+// Generate mipmap chain on the CPU
+// NOTE: Levels are filtered from the previous level in floating point, then converted to the pixel format
+bool rlgl::GenMipmapChain(const void *data, int width, int height, PixelFormat format, int mipmapCount, void *dest, MipmapFilter filter, bool srgb)
+{
+    if ((format >= PixelFormat::DXT1_RGB) || (data == nullptr) || (width <= 0) || (height <= 0))
+    {
+        TRACELOG(LogWarning, "TEXTURE: CPU mipmaps generation not supported for pixel format (%i)", format);
+        return false;
+    }
+
+    if ((mipmapCount > 1) && !IsWorkingSetAddressable(width, height))
+    {
+        TRACELOG(LogWarning, "TEXTURE: CPU mipmaps generation working memory too large (%ix%i)", width, height);
+        return false;
+    }
+
+    // sRGB conversion only applies to normalized formats
+    if (format >= PixelFormat::R32) srgb = false;
+
+    uint8_t *dstPtr = static_cast<uint8_t*>(dest);
+    const uint8_t *srcPtr = static_cast<const uint8_t*>(data);
+
+    int levelSize = GetPixelDataSize(width, height, format);
+    std::memcpy(dstPtr, data, levelSize);
+
+    // NOTE: Base level rows are decoded on the fly by the first downsampling pass,
+    // next levels are kept in floating point to avoid precision loss along the chain
+    std::vector<float> current, next;
+
+    for (int i = 1; i < mipmapCount; i++)
+    {
+        dstPtr += levelSize;
+
+        const int mipWidth = std::max(width/2, 1);
+        const int mipHeight = std::max(height/2, 1);
+
+        next.resize(static_cast<std::size_t>(mipWidth)*mipHeight*4);
+
+        if (i == 1)
+        {
+            const int rowSize = levelSize/height;
+
+            DownsampleLevel([&](int y, float *scratch) {
+                DecodePixels(srcPtr + y*rowSize, scratch, width, format, srgb);
+                return scratch;
+            }, width, height, next.data(), mipWidth, mipHeight, filter);
+        }
+        else
+        {
+            const int srcWidth = width;
+
+            DownsampleLevel([&](int y, float *) {
+                return current.data() + static_cast<std::size_t>(y)*srcWidth*4;
+            }, width, height, next.data(), mipWidth, mipHeight, filter);
+        }
+
+        levelSize = GetPixelDataSize(mipWidth, mipHeight, format);
+        const int rowSize = levelSize/mipHeight;
+
+        ParallelFor(mipHeight, [&](int begin, int end) {
+            EncodePixels(next.data() + static_cast<std::size_t>(begin)*mipWidth*4, dstPtr + begin*rowSize, (end - begin)*mipWidth, format, srgb);
+        }, GetLevelThreadCount(static_cast<int64_t>(mipWidth)*mipHeight));
+
+        current.swap(next);
+        width = mipWidth;
+        height = mipHeight;
+    }
+
+    return true;
+}
+
+// Generate complete mipmap chain on the CPU
+std::vector<uint8_t> rlgl::GenMipmapChain(const void *data, int width, int height, PixelFormat format, int *mipmapCount, MipmapFilter filter, bool srgb)
+{
+    const int count = GetMipmapCount(width, height);
+    const int chainSize = GetMipmapChainDataSize(width, height, format, count);
+
+    // NOTE: Invalid or too large chains are reported as empty, nothing to generate into
+    if ((chainSize == 0) || ((count > 1) && !IsWorkingSetAddressable(width, height)))
+    {
+        if (mipmapCount != nullptr) *mipmapCount = 0;
+        return {};
+    }
+
+    std::vector<uint8_t> chain(chainSize);
+
+    if (!GenMipmapChain(data, width, height, format, count, chain.data(), filter, srgb)) chain.clear();
+    if (mipmapCount != nullptr) *mipmapCount = chain.empty() ? 0 : count;
+
+    return chain;
+}
@@ -0,0 +1,1523 @@
+#include "rlNullGL.hpp"
+#include "rlEnums.hpp"
+
+#if defined(GRAPHICS_API_OPENGL_33)
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+using namespace rlgl;
+
+// GL functions resolved by the null backend (every function used by rlgl)
+#define NULL_GL_FUNCTIONS(X) \
+    X(glActiveTexture, PFNGLACTIVETEXTUREPROC) \
+    X(glAttachShader, PFNGLATTACHSHADERPROC) \
+    X(glBindAttribLocation, PFNGLBINDATTRIBLOCATIONPROC) \
+    X(glBindBuffer, PFNGLBINDBUFFERPROC) \
+    X(glBindBufferBase, PFNGLBINDBUFFERBASEPROC) \
+    X(glBindFramebuffer, PFNGLBINDFRAMEBUFFERPROC) \
+    X(glBindImageTexture, PFNGLBINDIMAGETEXTUREPROC) \
+    X(glBindRenderbuffer, PFNGLBINDRENDERBUFFERPROC) \
+    X(glBindTexture, PFNGLBINDTEXTUREPROC) \
+    X(glBindVertexArray, PFNGLBINDVERTEXARRAYPROC) \
+    X(glBlendEquation, PFNGLBLENDEQUATIONPROC) \
+    X(glBlendEquationSeparate, PFNGLBLENDEQUATIONSEPARATEPROC) \
+    X(glBlendFunc, PFNGLBLENDFUNCPROC) \
+    X(glBlendFuncSeparate, PFNGLBLENDFUNCSEPARATEPROC) \
+    X(glBlitFramebuffer, PFNGLBLITFRAMEBUFFERPROC) \
+    X(glBufferData, PFNGLBUFFERDATAPROC) \
+    X(glBufferSubData, PFNGLBUFFERSUBDATAPROC) \
+    X(glCheckFramebufferStatus, PFNGLCHECKFRAMEBUFFERSTATUSPROC) \
+    X(glClear, PFNGLCLEARPROC) \
+    X(glClearBufferData, PFNGLCLEARBUFFERDATAPROC) \
+    X(glClearColor, PFNGLCLEARCOLORPROC) \
+    X(glClearDepth, PFNGLCLEARDEPTHPROC) \
+    X(glClearDepthf, PFNGLCLEARDEPTHFPROC) \
+    X(glClientWaitSync, PFNGLCLIENTWAITSYNCPROC) \
+    X(glCompileShader, PFNGLCOMPILESHADERPROC) \
+    X(glCompressedTexImage2D, PFNGLCOMPRESSEDTEXIMAGE2DPROC) \
+    X(glCompressedTexSubImage2D, PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC) \
+    X(glCopyBufferSubData, PFNGLCOPYBUFFERSUBDATAPROC) \
+    X(glCopyImageSubData, PFNGLCOPYIMAGESUBDATAPROC) \
+    X(glCreateProgram, PFNGLCREATEPROGRAMPROC) \
+    X(glCreateShader, PFNGLCREATESHADERPROC) \
+    X(glCullFace, PFNGLCULLFACEPROC) \
+    X(glDebugMessageCallback, PFNGLDEBUGMESSAGECALLBACKPROC) \
+    X(glDebugMessageControl, PFNGLDEBUGMESSAGECONTROLPROC) \
+    X(glDeleteBuffers, PFNGLDELETEBUFFERSPROC) \
+    X(glDeleteFramebuffers, PFNGLDELETEFRAMEBUFFERSPROC) \
+    X(glDeleteProgram, PFNGLDELETEPROGRAMPROC) \
+    X(glDeleteQueries, PFNGLDELETEQUERIESPROC) \
+    X(glDeleteRenderbuffers, PFNGLDELETERENDERBUFFERSPROC) \
+    X(glDeleteShader, PFNGLDELETESHADERPROC) \
+    X(glDeleteSync, PFNGLDELETESYNCPROC) \
+    X(glDeleteTextures, PFNGLDELETETEXTURESPROC) \
+    X(glDeleteVertexArrays, PFNGLDELETEVERTEXARRAYSPROC) \
+    X(glDepthFunc, PFNGLDEPTHFUNCPROC) \
+    X(glDepthMask, PFNGLDEPTHMASKPROC) \
+    X(glDetachShader, PFNGLDETACHSHADERPROC) \
+    X(glDisable, PFNGLDISABLEPROC) \
+    X(glDisableVertexAttribArray, PFNGLDISABLEVERTEXATTRIBARRAYPROC) \
+    X(glDispatchCompute, PFNGLDISPATCHCOMPUTEPROC) \
+    X(glDispatchComputeIndirect, PFNGLDISPATCHCOMPUTEINDIRECTPROC) \
+    X(glDrawArrays, PFNGLDRAWARRAYSPROC) \
+    X(glDrawArraysIndirect, PFNGLDRAWARRAYSINDIRECTPROC) \
+    X(glDrawArraysInstanced, PFNGLDRAWARRAYSINSTANCEDPROC) \
+    X(glDrawArraysInstancedEXT, PFNGLDRAWARRAYSINSTANCEDEXTPROC) \
+    X(glDrawBuffers, PFNGLDRAWBUFFERSPROC) \
+    X(glDrawElements, PFNGLDRAWELEMENTSPROC) \
+    X(glDrawElementsInstanced, PFNGLDRAWELEMENTSINSTANCEDPROC) \
+    X(glDrawElementsInstancedEXT, PFNGLDRAWELEMENTSINSTANCEDEXTPROC) \
+    X(glEnable, PFNGLENABLEPROC) \
+    X(glEnableVertexAttribArray, PFNGLENABLEVERTEXATTRIBARRAYPROC) \
+    X(glFenceSync, PFNGLFENCESYNCPROC) \
+    X(glFinish, PFNGLFINISHPROC) \
+    X(glFlush, PFNGLFLUSHPROC) \
+    X(glFramebufferRenderbuffer, PFNGLFRAMEBUFFERRENDERBUFFERPROC) \
+    X(glFramebufferTexture2D, PFNGLFRAMEBUFFERTEXTURE2DPROC) \
+    X(glFrontFace, PFNGLFRONTFACEPROC) \
+    X(glGenBuffers, PFNGLGENBUFFERSPROC) \
+    X(glGenerateMipmap, PFNGLGENERATEMIPMAPPROC) \
+    X(glGenFramebuffers, PFNGLGENFRAMEBUFFERSPROC) \
+    X(glGenQueries, PFNGLGENQUERIESPROC) \
+    X(glGenRenderbuffers, PFNGLGENRENDERBUFFERSPROC) \
+    X(glGenTextures, PFNGLGENTEXTURESPROC) \
+    X(glGenVertexArrays, PFNGLGENVERTEXARRAYSPROC) \
+    X(glGetActiveUniform, PFNGLGETACTIVEUNIFORMPROC) \
+    X(glGetAttribLocation, PFNGLGETATTRIBLOCATIONPROC) \
+    X(glGetBufferParameteri64v, PFNGLGETBUFFERPARAMETERI64VPROC) \
+    X(glGetBufferSubData, PFNGLGETBUFFERSUBDATAPROC) \
+    X(glGetError, PFNGLGETERRORPROC) \
+    X(glGetFloatv, PFNGLGETFLOATVPROC) \
+    X(glGetFramebufferAttachmentParameteriv, PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC) \
+    X(glGetIntegerv, PFNGLGETINTEGERVPROC) \
+    X(glGetProgramInfoLog, PFNGLGETPROGRAMINFOLOGPROC) \
+    X(glGetProgramiv, PFNGLGETPROGRAMIVPROC) \
+    X(glGetQueryObjectui64v, PFNGLGETQUERYOBJECTUI64VPROC) \
+    X(glGetQueryObjectuiv, PFNGLGETQUERYOBJECTUIVPROC) \
+    X(glGetShaderInfoLog, PFNGLGETSHADERINFOLOGPROC) \
+    X(glGetShaderiv, PFNGLGETSHADERIVPROC) \
+    X(glGetString, PFNGLGETSTRINGPROC) \
+    X(glGetStringi, PFNGLGETSTRINGIPROC) \
+    X(glGetTexImage, PFNGLGETTEXIMAGEPROC) \
+    X(glGetTexLevelParameteriv, PFNGLGETTEXLEVELPARAMETERIVPROC) \
+    X(glGetTexParameteriv, PFNGLGETTEXPARAMETERIVPROC) \
+    X(glGetUniformLocation, PFNGLGETUNIFORMLOCATIONPROC) \
+    X(glHint, PFNGLHINTPROC) \
+    X(glIsEnabled, PFNGLISENABLEDPROC) \
+    X(glIsVertexArray, PFNGLISVERTEXARRAYPROC) \
+    X(glLineWidth, PFNGLLINEWIDTHPROC) \
+    X(glLinkProgram, PFNGLLINKPROGRAMPROC) \
+    X(glMapBuffer, PFNGLMAPBUFFERPROC) \
+    X(glMapBufferRange, PFNGLMAPBUFFERRANGEPROC) \
+    X(glMemoryBarrier, PFNGLMEMORYBARRIERPROC) \
+    X(glPixelStorei, PFNGLPIXELSTOREIPROC) \
+    X(glPolygonMode, PFNGLPOLYGONMODEPROC) \
+    X(glQueryCounter, PFNGLQUERYCOUNTERPROC) \
+    X(glReadPixels, PFNGLREADPIXELSPROC) \
+    X(glRenderbufferStorage, PFNGLRENDERBUFFERSTORAGEPROC) \
+    X(glScissor, PFNGLSCISSORPROC) \
+    X(glShaderSource, PFNGLSHADERSOURCEPROC) \
+    X(glTexImage2D, PFNGLTEXIMAGE2DPROC) \
+    X(glTexParameterf, PFNGLTEXPARAMETERFPROC) \
+    X(glTexParameteri, PFNGLTEXPARAMETERIPROC) \
+    X(glTexParameteriv, PFNGLTEXPARAMETERIVPROC) \
+    X(glTexStorage2D, PFNGLTEXSTORAGE2DPROC) \
+    X(glTexSubImage2D, PFNGLTEXSUBIMAGE2DPROC) \
+    X(glUniform1fv, PFNGLUNIFORM1FVPROC) \
+    X(glUniform1i, PFNGLUNIFORM1IPROC) \
+    X(glUniform1iv, PFNGLUNIFORM1IVPROC) \
+    X(glUniform2fv, PFNGLUNIFORM2FVPROC) \
+    X(glUniform2iv, PFNGLUNIFORM2IVPROC) \
+    X(glUniform3fv, PFNGLUNIFORM3FVPROC) \
+    X(glUniform3iv, PFNGLUNIFORM3IVPROC) \
+    X(glUniform4f, PFNGLUNIFORM4FPROC) \
+    X(glUniform4fv, PFNGLUNIFORM4FVPROC) \
+    X(glUniform4iv, PFNGLUNIFORM4IVPROC) \
+    X(glUniformMatrix4fv, PFNGLUNIFORMMATRIX4FVPROC) \
+    X(glUnmapBuffer, PFNGLUNMAPBUFFERPROC) \
+    X(glUseProgram, PFNGLUSEPROGRAMPROC) \
+    X(glVertexAttrib1fv, PFNGLVERTEXATTRIB1FVPROC) \
+    X(glVertexAttrib2fv, PFNGLVERTEXATTRIB2FVPROC) \
+    X(glVertexAttrib3fv, PFNGLVERTEXATTRIB3FVPROC) \
+    X(glVertexAttrib4fv, PFNGLVERTEXATTRIB4FVPROC) \
+    X(glVertexAttribDivisor, PFNGLVERTEXATTRIBDIVISORPROC) \
+    X(glVertexAttribPointer, PFNGLVERTEXATTRIBPOINTERPROC) \
+    X(glViewport, PFNGLVIEWPORTPROC)
+
+namespace {
+
+    constexpr GLint NULL_MAX_VERTEX_ATTRIBS = 16;           // Vertex attributes reported (and validated)
+    constexpr GLint NULL_MAX_TEXTURE_SIZE = 16384;          // Texture size limit reported
+    constexpr const char *NULL_GL_VERSION = "4.3.0 Core Profile (rlgl null backend)";
+
+    enum NullFunction
+    {
+#   define NULL_GL_ENUM(name, proc) NULL_##name,
+        NULL_GL_FUNCTIONS(NULL_GL_ENUM)
+#   undef NULL_GL_ENUM
+        NULL_FUNCTION_COUNT
+    };
+
+    const char *const NULL_FUNCTION_NAMES[NULL_FUNCTION_COUNT] = {
+#   define NULL_GL_NAME(name, proc) #name,
+        NULL_GL_FUNCTIONS(NULL_GL_NAME)
+#   undef NULL_GL_NAME
+    };
+
+    // Objects and state tracked to answer the queries of rlgl and validate the calls
+
+    struct NullBuffer
+    {
+        GLsizeiptr size = 0;                    // Data store size
+        std::vector<uint8_t> memory;            // Memory returned by the mappings (allocated on first map)
+        bool mapped = false;                    // Buffer currently mapped
+    };
+
+    struct NullTexture
+    {
+        GLsizei width = 0;                      // Base level width
+        GLsizei height = 0;                     // Base level height
+        GLint internalFormat = 0;               // Base level internal format
+        GLint immutableLevels = 0;              // Levels allocated by glTexStorage2D() (0 for mutable textures)
+        std::unordered_map<GLenum, GLint> parameters;   // Parameters set by glTexParameter*()
+    };
+
+    struct NullProgram
+    {
+        std::unordered_map<std::string, GLint> attribs;     // Attribute locations, assigned on first query
+        std::unordered_map<std::string, GLint> uniforms;    // Uniform locations, assigned on first query
+    };
+
+    struct NullAttachment
+    {
+        GLenum type = GL_NONE;                  // GL_TEXTURE, GL_RENDERBUFFER or GL_NONE
+        GLuint name = 0;                        // Attached object
+    };
+
+    struct NullFramebuffer
+    {
+        std::unordered_map<GLenum, NullAttachment> attachments;
+    };
+
+    struct NullGLState
+    {
+        NullGLCounters counters;
+        uint64_t callCounts[NULL_FUNCTION_COUNT] = {};
+        NullGLLogCallback logCallback = nullptr;
+        void *logUserData = nullptr;
+        std::string logLine;                    // Command formatting buffer (reused)
+
+        GLenum error = GL_NO_ERROR;             // First error recorded since the last glGetError()
+        std::string lastError;                  // Function and message of the last invalid call
+        GLuint nextName = 1;                    // Names are unique across object types
+
+        std::unordered_map<GLuint, NullBuffer> buffers;
+        std::unordered_map<GLuint, NullTexture> textures;
+        std::unordered_map<GLuint, NullProgram> programs;
+        std::unordered_map<GLuint, NullFramebuffer> framebuffers;
+        std::unordered_map<GLuint, GLuint> vertexArrays = { { 0, 0 } };    // Vertex array -> element buffer bound
+        std::unordered_set<GLuint> shaders;
+        std::unordered_set<GLuint> renderbuffers;
+        std::unordered_set<GLuint> queries;
+
+        std::unordered_map<GLenum, GLuint> bufferBindings;      // Target -> buffer
+        std::unordered_map<uint64_t, GLuint> textureBindings;   // (Unit << 32 | target) -> texture
+        GLenum activeTexture = GL_TEXTURE0;
+        GLuint vertexArray = 0;
+        GLuint program = 0;
+        GLuint drawFramebuffer = 0;
+        GLuint readFramebuffer = 0;
+        GLuint renderbuffer = 0;
+
+        std::unordered_set<GLenum> capabilities;    // Enabled capabilities
+        GLint viewport[4] = {};
+        GLint scissor[4] = {};
+        GLfloat lineWidth = 1.0f;
+        GLfloat clearColor[4] = {};
+        GLint packAlignment = 4;
+        GLint unpackAlignment = 4;
+    };
+
+    NullGLState nullGL;
+
+    //----------------------------------------------------------------------------------
+
+    // Append an argument to a logged command
+    template <typename T>
+    void AppendArgument(std::string& line, T value)
+    {
+        char buffer[32];
+
+        if constexpr (std::is_pointer<T>::value)
+        {
+            if constexpr (std::is_function<typename std::remove_pointer<T>::type>::value) std::snprintf(buffer, sizeof(buffer), "%s", (value != nullptr) ? "callback" : "NULL");
+            else if (value == nullptr) std::snprintf(buffer, sizeof(buffer), "NULL");
+            else std::snprintf(buffer, sizeof(buffer), "%p", static_cast<const void*>(value));
+        }
+        else if constexpr (std::is_floating_point<T>::value) std::snprintf(buffer, sizeof(buffer), "%g", static_cast<double>(value));
+        else if constexpr (std::is_signed<T>::value) std::snprintf(buffer, sizeof(buffer), "%" PRId64, static_cast<int64_t>(value));
+        else std::snprintf(buffer, sizeof(buffer), "%" PRIu64, static_cast<uint64_t>(value));
+
+        if (line.back() != '(') line += ", ";
+        line += buffer;
+    }
+
+    // Count a call and send it to the log callback
+    template <typename... Args>
+    void RecordCall(NullFunction function, Args... args)
+    {
+        nullGL.counters.calls++;
+        nullGL.callCounts[function]++;
+
+        if (nullGL.logCallback == nullptr) return;
+
+        std::string &line = nullGL.logLine;
+
+        line = NULL_FUNCTION_NAMES[function];
+        line += '(';
+        (AppendArgument(line, args), ...);
+        line += ')';
+
+        nullGL.logCallback(line.c_str(), nullGL.logUserData);
+    }
+
+    // Record an invalid call, the first error is kept until glGetError() is called
+    void SetError(NullFunction function, GLenum error, const char *message)
+    {
+        if (nullGL.error == GL_NO_ERROR) nullGL.error = error;
+        nullGL.counters.errors++;
+
+        nullGL.lastError = NULL_FUNCTION_NAMES[function];
+        nullGL.lastError += ": ";
+        nullGL.lastError += message;
+
+        TRACELOG(LogWarning, "NULLGL: %s", nullGL.lastError.c_str());
+    }
+
+    bool CheckCount(NullFunction function, GLsizei count)
+    {
+        if (count >= 0) return true;
+
+        SetError(function, GL_INVALID_VALUE, "Negative count");
+        return false;
+    }
+
+    bool CheckAttribIndex(NullFunction function, GLuint index)
+    {
+        if (index < static_cast<GLuint>(NULL_MAX_VERTEX_ATTRIBS)) return true;
+
+        SetError(function, GL_INVALID_VALUE, "Vertex attribute index out of range");
+        return false;
+    }
+
+    template <typename Objects>
+    bool CheckName(NullFunction function, GLuint name, const Objects& objects)
+    {
+        if ((name == 0) || (objects.count(name) > 0)) return true;
+
+        SetError(function, GL_INVALID_OPERATION, "Object name not generated");
+        return false;
+    }
+
+    void AddObject(std::unordered_set<GLuint>& objects, GLuint name) { objects.insert(name); }
+
+    template <typename T>
+    void AddObject(std::unordered_map<GLuint, T>& objects, GLuint name) { objects.emplace(name, T()); }
+
+    template <typename Objects>
+    void GenObjects(NullFunction function, GLsizei n, GLuint *names, Objects& objects)
+    {
+        if (!CheckCount(function, n)) return;
+
+        for (GLsizei i = 0; i < n; i++)
+        {
+            names[i] = nullGL.nextName++;
+            AddObject(objects, names[i]);
+        }
+    }
+
+    // Delete objects (unused names and name 0 are silently ignored)
+    template <typename Objects>
+    void DeleteObjects(NullFunction function, GLsizei n, const GLuint *names, Objects& objects)
+    {
+        if (!CheckCount(function, n)) return;
+
+        for (GLsizei i = 0; i < n; i++)
+        {
+            if (names[i] != 0) objects.erase(names[i]);
+        }
+    }
+
+    // Get the buffer bound to a target
+    NullBuffer *GetBoundBuffer(NullFunction function, GLenum target)
+    {
+        const auto binding = nullGL.bufferBindings.find(target);
+
+        if ((binding == nullGL.bufferBindings.end()) || (binding->second == 0))
+        {
+            SetError(function, GL_INVALID_OPERATION, "No buffer bound to the target");
+            return nullptr;
+        }
+
+        return &nullGL.buffers[binding->second];
+    }
+
+    bool IsBufferBound(GLenum target)
+    {
+        const auto binding = nullGL.bufferBindings.find(target);
+        return (binding != nullGL.bufferBindings.end()) && (binding->second != 0);
+    }
+
+    bool CheckRange(NullFunction function, const NullBuffer& buffer, GLintptr offset, GLsizeiptr size)
+    {
+        if ((offset >= 0) && (size >= 0) && (offset + size <= buffer.size)) return true;
+
+        SetError(function, GL_INVALID_VALUE, "Range out of the buffer data store");
+        return false;
+    }
+
+    // Get the texture bound to a target of the active texture unit
+    NullTexture *GetBoundTexture(GLenum target)
+    {
+        // Cubemap faces are bound through the cubemap target
+        if ((target >= GL_TEXTURE_CUBE_MAP_POSITIVE_X) && (target <= GL_TEXTURE_CUBE_MAP_NEGATIVE_Z)) target = GL_TEXTURE_CUBE_MAP;
+
+        const auto binding = nullGL.textureBindings.find((static_cast<uint64_t>(nullGL.activeTexture - GL_TEXTURE0) << 32) | target);
+        if ((binding == nullGL.textureBindings.end()) || (binding->second == 0)) return nullptr;
+
+        const auto texture = nullGL.textures.find(binding->second);
+        return (texture != nullGL.textures.end()) ? &texture->second : nullptr;
+    }
+
+    // Get the bytes of a pixel (tightly packed)
+    int64_t GetPixelSize(GLenum format, GLenum type)
+    {
+        switch (type)
+        {
+            case GL_UNSIGNED_SHORT_5_6_5:
+            case GL_UNSIGNED_SHORT_4_4_4_4:
+            case GL_UNSIGNED_SHORT_5_5_5_1: return 2;
+            case GL_UNSIGNED_INT_24_8:
+            case GL_UNSIGNED_INT_2_10_10_10_REV:
+            case GL_UNSIGNED_INT_10F_11F_11F_REV:
+            case GL_UNSIGNED_INT_5_9_9_9_REV: return 4;
+            case GL_FLOAT_32_UNSIGNED_INT_24_8_REV: return 8;
+            default: break;
+        }
+
+        int64_t components = 4;
+        switch (format)
+        {
+            case GL_RED:
+            case GL_RED_INTEGER:
+            case GL_DEPTH_COMPONENT:
+            case GL_STENCIL_INDEX: components = 1; break;
+            case GL_RG:
+            case GL_RG_INTEGER: components = 2; break;
+            case GL_RGB:
+            case GL_BGR:
+            case GL_RGB_INTEGER: components = 3; break;
+            default: break;
+        }
+
+        switch (type)
+        {
+            case GL_SHORT:
+            case GL_UNSIGNED_SHORT:
+            case GL_HALF_FLOAT: return components*2;
+            case GL_INT:
+            case GL_UNSIGNED_INT:
+            case GL_FLOAT: return components*4;
+            default: return components;
+        }
+    }
+
+    bool CheckDraw(NullFunction function, GLsizei count, GLsizei instances)
+    {
+        if ((count < 0) || (instances < 0))
+        {
+            SetError(function, GL_INVALID_VALUE, "Negative count");
+            return false;
+        }
+
+        // NOTE: Core profile contexts have no default vertex array object
+        if (nullGL.vertexArray == 0)
+        {
+            SetError(function, GL_INVALID_OPERATION, "No vertex array bound");
+            return false;
+        }
+
+        nullGL.counters.drawCalls++;
+        return true;
+    }
+
+    void CheckUniform(NullFunction function, GLsizei count)
+    {
+        if (nullGL.program == 0) SetError(function, GL_INVALID_OPERATION, "No program in use");
+        else CheckCount(function, count);
+    }
+
+    void CheckRectangle(NullFunction function, GLsizei width, GLsizei height)
+    {
+        if ((width < 0) || (height < 0)) SetError(function, GL_INVALID_VALUE, "Negative size");
+    }
+
+    //----------------------------------------------------------------------------------
+    // Generic null functions: the call is only recorded, non void functions return 0
+    //----------------------------------------------------------------------------------
+
+    template <int Function> struct NullProcType;
+
+#   define NULL_GL_PROC_TYPE(name, proc) template <> struct NullProcType<NULL_##name> { using Type = proc; };
+    NULL_GL_FUNCTIONS(NULL_GL_PROC_TYPE)
+#   undef NULL_GL_PROC_TYPE
+
+    template <int Function, typename Proc = typename NullProcType<Function>::Type>
+    struct NullProc;
+
+    template <int Function, typename R, typename... Args>
+    struct NullProc<Function, R (GLAD_API_PTR *)(Args...)>
+    {
+        static R GLAD_API_PTR Call(Args... args)
+        {
+            RecordCall(static_cast<NullFunction>(Function), args...);
+            return R();
+        }
+    };
+
+    // Null function with a specific behavior (replaces the generic one), the function
+    // index is available in the body as 'function'
+#   define NULL_GL_IMPL(name, ret, params) \
+        template <> struct NullProc<NULL_##name> { static constexpr NullFunction function = NULL_##name; static ret GLAD_API_PTR Call params; }; \
+        ret GLAD_API_PTR NullProc<NULL_##name>::Call params
+
+    //----------------------------------------------------------------------------------
+    // Queries
+    //----------------------------------------------------------------------------------
+
+    NULL_GL_IMPL(glGetError, GLenum, (void))
+    {
+        RecordCall(function);
+
+        const GLenum error = nullGL.error;
+        nullGL.error = GL_NO_ERROR;
+        return error;
+    }
+
+    NULL_GL_IMPL(glGetString, const GLubyte *, (GLenum name))
+    {
+        RecordCall(function, name);
+
+        switch (name)
+        {
+            case GL_VENDOR: return reinterpret_cast<const GLubyte*>("rlgl");
+            case GL_RENDERER: return reinterpret_cast<const GLubyte*>("Null GL backend");
+            case GL_VERSION: return reinterpret_cast<const GLubyte*>(NULL_GL_VERSION);
+            case GL_SHADING_LANGUAGE_VERSION: return reinterpret_cast<const GLubyte*>("4.30");
+            case GL_EXTENSIONS: return reinterpret_cast<const GLubyte*>("");
+            default: SetError(function, GL_INVALID_ENUM, "Unknown string"); return nullptr;
+        }
+    }
+
+    NULL_GL_IMPL(glGetStringi, const GLubyte *, (GLenum name, GLuint index))
+    {
+        RecordCall(function, name, index);
+
+        // No extension is reported (GL_NUM_EXTENSIONS is 0)
+        SetError(function, GL_INVALID_VALUE, "Index out of range");
+        return nullptr;
+    }
+
+    NULL_GL_IMPL(glGetIntegerv, void, (GLenum pname, GLint *data))
+    {
+        RecordCall(function, pname, data);
+
+        switch (pname)
+        {
+            case GL_MAJOR_VERSION: *data = 4; break;
+            case GL_MINOR_VERSION: *data = 3; break;
+            case GL_MAX_TEXTURE_SIZE:
+            case GL_MAX_CUBE_MAP_TEXTURE_SIZE:
+            case GL_MAX_RENDERBUFFER_SIZE: *data = NULL_MAX_TEXTURE_SIZE; break;
+            case GL_MAX_VERTEX_ATTRIBS:
+            case GL_MAX_VERTEX_ATTRIB_BINDINGS:
+            case GL_MAX_TEXTURE_IMAGE_UNITS: *data = NULL_MAX_VERTEX_ATTRIBS; break;
+            case GL_MAX_DRAW_BUFFERS:
+            case GL_MAX_COLOR_ATTACHMENTS: *data = 8; break;
+            case GL_MAX_UNIFORM_LOCATIONS: *data = 1024; break;
+            case GL_MAX_UNIFORM_BLOCK_SIZE: *data = 65536; break;
+            case GL_COMPRESSED_TEXTURE_FORMATS: break;      // No format reported
+            case GL_ACTIVE_TEXTURE: *data = static_cast<GLint>(nullGL.activeTexture); break;
+            case GL_CURRENT_PROGRAM: *data = static_cast<GLint>(nullGL.program); break;
+            case GL_VERTEX_ARRAY_BINDING: *data = static_cast<GLint>(nullGL.vertexArray); break;
+            case GL_DRAW_FRAMEBUFFER_BINDING: *data = static_cast<GLint>(nullGL.drawFramebuffer); break;
+            case GL_READ_FRAMEBUFFER_BINDING: *data = static_cast<GLint>(nullGL.readFramebuffer); break;
+            case GL_RENDERBUFFER_BINDING: *data = static_cast<GLint>(nullGL.renderbuffer); break;
+            case GL_ARRAY_BUFFER_BINDING: *data = static_cast<GLint>(nullGL.bufferBindings[GL_ARRAY_BUFFER]); break;
+            case GL_ELEMENT_ARRAY_BUFFER_BINDING: *data = static_cast<GLint>(nullGL.bufferBindings[GL_ELEMENT_ARRAY_BUFFER]); break;
+            case GL_TEXTURE_BINDING_2D: *data = static_cast<GLint>(nullGL.textureBindings[(static_cast<uint64_t>(nullGL.activeTexture - GL_TEXTURE0) << 32) | GL_TEXTURE_2D]); break;
+            case GL_VIEWPORT: std::copy(nullGL.viewport, nullGL.viewport + 4, data); break;
+            case GL_SCISSOR_BOX: std::copy(nullGL.scissor, nullGL.scissor + 4, data); break;
+            case GL_PACK_ALIGNMENT: *data = nullGL.packAlignment; break;
+            case GL_UNPACK_ALIGNMENT: *data = nullGL.unpackAlignment; break;
+            default: *data = 0; break;      // GL_NUM_EXTENSIONS, GL_NUM_COMPRESSED_TEXTURE_FORMATS...
+        }
+    }
+
+    NULL_GL_IMPL(glGetFloatv, void, (GLenum pname, GLfloat *data))
+    {
+        RecordCall(function, pname, data);
+
+        switch (pname)
+        {
+            case GL_MAX_TEXTURE_MAX_ANISOTROPY: *data = 16.0f; break;
+            case GL_LINE_WIDTH: *data = nullGL.lineWidth; break;
+            case GL_COLOR_CLEAR_VALUE: std::copy(nullGL.clearColor, nullGL.clearColor + 4, data); break;
+            default: *data = 0.0f; break;
+        }
+    }
+
+    NULL_GL_IMPL(glIsEnabled, GLboolean, (GLenum cap))
+    {
+        RecordCall(function, cap);
+        return (nullGL.capabilities.count(cap) > 0) ? GL_TRUE : GL_FALSE;
+    }
+
+    NULL_GL_IMPL(glIsVertexArray, GLboolean, (GLuint array))
+    {
+        RecordCall(function, array);
+        return ((array != 0) && (nullGL.vertexArrays.count(array) > 0)) ? GL_TRUE : GL_FALSE;
+    }
+
+    //----------------------------------------------------------------------------------
+    // State
+    //----------------------------------------------------------------------------------
+
+    NULL_GL_IMPL(glEnable, void, (GLenum cap))
+    {
+        RecordCall(function, cap);
+        nullGL.capabilities.insert(cap);
+    }
+
+    NULL_GL_IMPL(glDisable, void, (GLenum cap))
+    {
+        RecordCall(function, cap);
+        nullGL.capabilities.erase(cap);
+    }
+
+    NULL_GL_IMPL(glViewport, void, (GLint x, GLint y, GLsizei width, GLsizei height))
+    {
+        RecordCall(function, x, y, width, height);
+        CheckRectangle(function, width, height);
+
+        nullGL.viewport[0] = x; nullGL.viewport[1] = y;
+        nullGL.viewport[2] = width; nullGL.viewport[3] = height;
+    }
+
+    NULL_GL_IMPL(glScissor, void, (GLint x, GLint y, GLsizei width, GLsizei height))
+    {
+        RecordCall(function, x, y, width, height);
+        CheckRectangle(function, width, height);
+
+        nullGL.scissor[0] = x; nullGL.scissor[1] = y;
+        nullGL.scissor[2] = width; nullGL.scissor[3] = height;
+    }
+
+    NULL_GL_IMPL(glLineWidth, void, (GLfloat width))
+    {
+        RecordCall(function, width);
+
+        if (width <= 0.0f) SetError(function, GL_INVALID_VALUE, "Line width must be positive");
+        else nullGL.lineWidth = width;
+    }
+
+    NULL_GL_IMPL(glPixelStorei, void, (GLenum pname, GLint param))
+    {
+        RecordCall(function, pname, param);
+
+        if ((param != 1) && (param != 2) && (param != 4) && (param != 8)) SetError(function, GL_INVALID_VALUE, "Alignment must be 1, 2, 4 or 8");
+        else if (pname == GL_PACK_ALIGNMENT) nullGL.packAlignment = param;
+        else if (pname == GL_UNPACK_ALIGNMENT) nullGL.unpackAlignment = param;
+        else SetError(function, GL_INVALID_ENUM, "Unknown pixel store parameter");
+    }
+
+    NULL_GL_IMPL(glClearColor, void, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha))
+    {
+        RecordCall(function, red, green, blue, alpha);
+
+        nullGL.clearColor[0] = red; nullGL.clearColor[1] = green;
+        nullGL.clearColor[2] = blue; nullGL.clearColor[3] = alpha;
+    }
+
+    //----------------------------------------------------------------------------------
+    // Objects
+    //----------------------------------------------------------------------------------
+
+    NULL_GL_IMPL(glGenBuffers, void, (GLsizei n, GLuint *buffers))
+    {
+        RecordCall(function, n, buffers);
+        GenObjects(function, n, buffers, nullGL.buffers);
+    }
+
+    NULL_GL_IMPL(glDeleteBuffers, void, (GLsizei n, const GLuint *buffers))
+    {
+        RecordCall(function, n, buffers);
+        DeleteObjects(function, n, buffers, nullGL.buffers);
+
+        // Deleted buffers are unbound
+        for (GLsizei i = 0; i < n; i++)
+        {
+            for (auto& binding : nullGL.bufferBindings) if (binding.second == buffers[i]) binding.second = 0;
+            for (auto& vertexArray : nullGL.vertexArrays) if (vertexArray.second == buffers[i]) vertexArray.second = 0;
+        }
+    }
+
+    NULL_GL_IMPL(glGenTextures, void, (GLsizei n, GLuint *textures))
+    {
+        RecordCall(function, n, textures);
+        GenObjects(function, n, textures, nullGL.textures);
+    }
+
+    NULL_GL_IMPL(glDeleteTextures, void, (GLsizei n, const GLuint *textures))
+    {
+        RecordCall(function, n, textures);
+        DeleteObjects(function, n, textures, nullGL.textures);
+
+        for (GLsizei i = 0; i < n; i++)
+        {
+            for (auto& binding : nullGL.textureBindings) if (binding.second == textures[i]) binding.second = 0;
+        }
+    }
+
+    NULL_GL_IMPL(glGenVertexArrays, void, (GLsizei n, GLuint *arrays))
+    {
+        RecordCall(function, n, arrays);
+        GenObjects(function, n, arrays, nullGL.vertexArrays);
+    }
+
+    NULL_GL_IMPL(glDeleteVertexArrays, void, (GLsizei n, const GLuint *arrays))
+    {
+        RecordCall(function, n, arrays);
+        DeleteObjects(function, n, arrays, nullGL.vertexArrays);
+
+        // Deleting the bound vertex array binds the default one
+        if (nullGL.vertexArrays.count(nullGL.vertexArray) == 0)
+        {
+            nullGL.vertexArray = 0;
+            nullGL.bufferBindings[GL_ELEMENT_ARRAY_BUFFER] = nullGL.vertexArrays[0];
+        }
+    }
+
+    NULL_GL_IMPL(glGenFramebuffers, void, (GLsizei n, GLuint *framebuffers))
+    {
+        RecordCall(function, n, framebuffers);
+        GenObjects(function, n, framebuffers, nullGL.framebuffers);
+    }
+
+    NULL_GL_IMPL(glDeleteFramebuffers, void, (GLsizei n, const GLuint *framebuffers))
+    {
+        RecordCall(function, n, framebuffers);
+        DeleteObjects(function, n, framebuffers, nullGL.framebuffers);
+
+        if (nullGL.framebuffers.count(nullGL.drawFramebuffer) == 0) nullGL.drawFramebuffer = 0;
+        if (nullGL.framebuffers.count(nullGL.readFramebuffer) == 0) nullGL.readFramebuffer = 0;
+    }
+
+    NULL_GL_IMPL(glGenRenderbuffers, void, (GLsizei n, GLuint *renderbuffers))
+    {
+        RecordCall(function, n, renderbuffers);
+        GenObjects(function, n, renderbuffers, nullGL.renderbuffers);
+    }
+
+    NULL_GL_IMPL(glDeleteRenderbuffers, void, (GLsizei n, const GLuint *renderbuffers))
+    {
+        RecordCall(function, n, renderbuffers);
+        DeleteObjects(function, n, renderbuffers, nullGL.renderbuffers);
+
+        if (nullGL.renderbuffers.count(nullGL.renderbuffer) == 0) nullGL.renderbuffer = 0;
+    }
+
+    NULL_GL_IMPL(glGenQueries, void, (GLsizei n, GLuint *ids))
+    {
+        RecordCall(function, n, ids);
+        GenObjects(function, n, ids, nullGL.queries);
+    }
+
+    NULL_GL_IMPL(glDeleteQueries, void, (GLsizei n, const GLuint *ids))
+    {
+        RecordCall(function, n, ids);
+        DeleteObjects(function, n, ids, nullGL.queries);
+    }
+
+    NULL_GL_IMPL(glCreateShader, GLuint, (GLenum type))
+    {
+        RecordCall(function, type);
+
+        const GLuint shader = nullGL.nextName++;
+        nullGL.shaders.insert(shader);
+        return shader;
+    }
+
+    NULL_GL_IMPL(glDeleteShader, void, (GLuint shader))
+    {
+        RecordCall(function, shader);
+        if (CheckName(function, shader, nullGL.shaders)) nullGL.shaders.erase(shader);
+    }
+
+    NULL_GL_IMPL(glCreateProgram, GLuint, (void))
+    {
+        RecordCall(function);
+
+        const GLuint program = nullGL.nextName++;
+        nullGL.programs.emplace(program, NullProgram());
+        return program;
+    }
+
+    NULL_GL_IMPL(glDeleteProgram, void, (GLuint program))
+    {
+        RecordCall(function, program);
+
+        // NOTE: The program in use is only deleted once it is not used anymore
+        if (CheckName(function, program, nullGL.programs) && (program != nullGL.program)) nullGL.programs.erase(program);
+    }
+
+    //----------------------------------------------------------------------------------
+    // Bindings
+    //----------------------------------------------------------------------------------
+
+    NULL_GL_IMPL(glBindBuffer, void, (GLenum target, GLuint buffer))
+    {
+        RecordCall(function, target, buffer);
+        if (!CheckName(function, buffer, nullGL.buffers)) return;
+
+        nullGL.bufferBindings[target] = buffer;
+
+        // The element buffer binding is part of the vertex array state
+        if (target == GL_ELEMENT_ARRAY_BUFFER) nullGL.vertexArrays[nullGL.vertexArray] = buffer;
+    }
+
+    NULL_GL_IMPL(glBindBufferBase, void, (GLenum target, GLuint index, GLuint buffer))
+    {
+        RecordCall(function, target, index, buffer);
+        if (CheckName(function, buffer, nullGL.buffers)) nullGL.bufferBindings[target] = buffer;
+    }
+
+    NULL_GL_IMPL(glActiveTexture, void, (GLenum texture))
+    {
+        RecordCall(function, texture);
+
+        if ((texture < GL_TEXTURE0) || (texture >= GL_TEXTURE0 + NULL_MAX_VERTEX_ATTRIBS)) SetError(function, GL_INVALID_ENUM, "Texture unit out of range");
+        else nullGL.activeTexture = texture;
+    }
+
+    NULL_GL_IMPL(glBindTexture, void, (GLenum target, GLuint texture))
+    {
+        RecordCall(function, target, texture);
+
+        if (CheckName(function, texture, nullGL.textures))
+        {
+            nullGL.textureBindings[(static_cast<uint64_t>(nullGL.activeTexture - GL_TEXTURE0) << 32) | target] = texture;
+        }
+    }
+
+    NULL_GL_IMPL(glBindVertexArray, void, (GLuint array))
+    {
+        RecordCall(function, array);
+        if (!CheckName(function, array, nullGL.vertexArrays)) return;
+
+        nullGL.vertexArray = array;
+        nullGL.bufferBindings[GL_ELEMENT_ARRAY_BUFFER] = nullGL.vertexArrays[array];
+    }
+
+    NULL_GL_IMPL(glBindFramebuffer, void, (GLenum target, GLuint framebuffer))
+    {
+        RecordCall(function, target, framebuffer);
+        if (!CheckName(function, framebuffer, nullGL.framebuffers)) return;
+
+        if (target != GL_READ_FRAMEBUFFER) nullGL.drawFramebuffer = framebuffer;
+        if (target != GL_DRAW_FRAMEBUFFER) nullGL.readFramebuffer = framebuffer;
+    }
+
+    NULL_GL_IMPL(glBindRenderbuffer, void, (GLenum target, GLuint renderbuffer))
+    {
+        RecordCall(function, target, renderbuffer);
+        if (CheckName(function, renderbuffer, nullGL.renderbuffers)) nullGL.renderbuffer = renderbuffer;
+    }
+
+    NULL_GL_IMPL(glUseProgram, void, (GLuint program))
+    {
+        RecordCall(function, program);
+
+        if ((program != 0) && (nullGL.programs.count(program) == 0)) SetError(function, GL_INVALID_VALUE, "Program name not created");
+        else nullGL.program = program;
+    }
+
+    //----------------------------------------------------------------------------------
+    // Shaders
+    //----------------------------------------------------------------------------------
+
+    NULL_GL_IMPL(glGetShaderiv, void, (GLuint shader, GLenum pname, GLint *params))
+    {
+        RecordCall(function, shader, pname, params);
+
+        if (nullGL.shaders.count(shader) == 0) SetError(function, GL_INVALID_VALUE, "Shader name not created");
+        else *params = (pname == GL_COMPILE_STATUS) ? GL_TRUE : 0;     // Shaders always compile, no info log
+    }
+
+    NULL_GL_IMPL(glGetProgramiv, void, (GLuint program, GLenum pname, GLint *params))
+    {
+        RecordCall(function, program, pname, params);
+
+        if (nullGL.programs.count(program) == 0) SetError(function, GL_INVALID_VALUE, "Program name not created");
+        else *params = ((pname == GL_LINK_STATUS) || (pname == GL_VALIDATE_STATUS)) ? GL_TRUE : 0;
+    }
+
+    NULL_GL_IMPL(glGetShaderInfoLog, void, (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog))
+    {
+        RecordCall(function, shader, bufSize, length, infoLog);
+
+        if (length != nullptr) *length = 0;
+        if (bufSize > 0) infoLog[0] = '\0';
+    }
+
+    NULL_GL_IMPL(glGetProgramInfoLog, void, (GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog))
+    {
+        RecordCall(function, program, bufSize, length, infoLog);
+
+        if (length != nullptr) *length = 0;
+        if (bufSize > 0) infoLog[0] = '\0';
+    }
+
+    NULL_GL_IMPL(glGetUniformLocation, GLint, (GLuint program, const GLchar *name))
+    {
+        RecordCall(function, program, name);
+
+        const auto found = nullGL.programs.find(program);
+        if (found == nullGL.programs.end())
+        {
+            SetError(function, GL_INVALID_VALUE, "Program name not created");
+            return -1;
+        }
+
+        // Every uniform exists, locations are assigned in query order
+        auto &uniforms = found->second.uniforms;
+        return uniforms.emplace(name, static_cast<GLint>(uniforms.size())).first->second;
+    }
+
+    NULL_GL_IMPL(glGetAttribLocation, GLint, (GLuint program, const GLchar *name))
+    {
+        RecordCall(function, program, name);
+
+        const auto found = nullGL.programs.find(program);
+        if (found == nullGL.programs.end())
+        {
+            SetError(function, GL_INVALID_VALUE, "Program name not created");
+            return -1;
+        }
+
+        auto &attribs = found->second.attribs;
+        const auto attrib = attribs.find(name);
+        if (attrib != attribs.end()) return attrib->second;
+        if (static_cast<GLint>(attribs.size()) >= NULL_MAX_VERTEX_ATTRIBS) return -1;
+
+        return attribs.emplace(name, static_cast<GLint>(attribs.size())).first->second;
+    }
+
+    NULL_GL_IMPL(glUniform1i, void, (GLint location, GLint v0))
+    {
+        RecordCall(function, location, v0);
+        CheckUniform(function, 1);
+    }
+
+    NULL_GL_IMPL(glUniform4f, void, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3))
+    {
+        RecordCall(function, location, v0, v1, v2, v3);
+        CheckUniform(function, 1);
+    }
+
+    NULL_GL_IMPL(glUniform1fv, void, (GLint location, GLsizei count, const GLfloat *value)) { RecordCall(function, location, count, value); CheckUniform(function, count); }
+    NULL_GL_IMPL(glUniform2fv, void, (GLint location, GLsizei count, const GLfloat *value)) { RecordCall(function, location, count, value); CheckUniform(function, count); }
+    NULL_GL_IMPL(glUniform3fv, void, (GLint location, GLsizei count, const GLfloat *value)) { RecordCall(function, location, count, value); CheckUniform(function, count); }
+    NULL_GL_IMPL(glUniform4fv, void, (GLint location, GLsizei count, const GLfloat *value)) { RecordCall(function, location, count, value); CheckUniform(function, count); }
+    NULL_GL_IMPL(glUniform1iv, void, (GLint location, GLsizei count, const GLint *value)) { RecordCall(function, location, count, value); CheckUniform(function, count); }
+    NULL_GL_IMPL(glUniform2iv, void, (GLint location, GLsizei count, const GLint *value)) { RecordCall(function, location, count, value); CheckUniform(function, count); }
+    NULL_GL_IMPL(glUniform3iv, void, (GLint location, GLsizei count, const GLint *value)) { RecordCall(function, location, count, value); CheckUniform(function, count); }
+    NULL_GL_IMPL(glUniform4iv, void, (GLint location, GLsizei count, const GLint *value)) { RecordCall(function, location, count, value); CheckUniform(function, count); }
+
+    NULL_GL_IMPL(glUniformMatrix4fv, void, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value))
+    {
+        RecordCall(function, location, count, transpose, value);
+        CheckUniform(function, count);
+    }
+
+    //----------------------------------------------------------------------------------
+    // Buffers
+    //----------------------------------------------------------------------------------
+
+    NULL_GL_IMPL(glBufferData, void, (GLenum target, GLsizeiptr size, const void *data, GLenum usage))
+    {
+        RecordCall(function, target, size, data, usage);
+
+        NullBuffer *buffer = GetBoundBuffer(function, target);
+        if (buffer == nullptr) return;
+
+        if (size < 0)
+        {
+            SetError(function, GL_INVALID_VALUE, "Negative size");
+            return;
+        }
+
+        buffer->size = size;
+        buffer->mapped = false;
+        if (data != nullptr) nullGL.counters.bytesUploaded += size;
+    }
+
+    NULL_GL_IMPL(glBufferSubData, void, (GLenum target, GLintptr offset, GLsizeiptr size, const void *data))
+    {
+        RecordCall(function, target, offset, size, data);
+
+        NullBuffer *buffer = GetBoundBuffer(function, target);
+        if ((buffer != nullptr) && CheckRange(function, *buffer, offset, size)) nullGL.counters.bytesUploaded += size;
+    }
+
+    NULL_GL_IMPL(glGetBufferSubData, void, (GLenum target, GLintptr offset, GLsizeiptr size, void *data))
+    {
+        RecordCall(function, target, offset, size, data);
+
+        NullBuffer *buffer = GetBoundBuffer(function, target);
+        if ((buffer == nullptr) || !CheckRange(function, *buffer, offset, size)) return;
+
+        // Data written through mappings is returned, zeros otherwise
+        if (static_cast<GLsizeiptr>(buffer->memory.size()) >= offset + size) std::memcpy(data, buffer->memory.data() + offset, size);
+        else std::memset(data, 0, size);
+    }
+
+    NULL_GL_IMPL(glCopyBufferSubData, void, (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size))
+    {
+        RecordCall(function, readTarget, writeTarget, readOffset, writeOffset, size);
+
+        NullBuffer *src = GetBoundBuffer(function, readTarget);
+        NullBuffer *dst = GetBoundBuffer(function, writeTarget);
+        if ((src != nullptr) && (dst != nullptr) && CheckRange(function, *src, readOffset, size)) CheckRange(function, *dst, writeOffset, size);
+    }
+
+    NULL_GL_IMPL(glMapBufferRange, void *, (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access))
+    {
+        RecordCall(function, target, offset, length, access);
+
+        NullBuffer *buffer = GetBoundBuffer(function, target);
+        if ((buffer == nullptr) || !CheckRange(function, *buffer, offset, length)) return nullptr;
+
+        if (buffer->mapped)
+        {
+            SetError(function, GL_INVALID_OPERATION, "Buffer already mapped");
+            return nullptr;
+        }
+
+        buffer->memory.resize(buffer->size);
+        buffer->mapped = true;
+        return buffer->memory.data() + offset;
+    }
+
+    NULL_GL_IMPL(glMapBuffer, void *, (GLenum target, GLenum access))
+    {
+        RecordCall(function, target, access);
+
+        NullBuffer *buffer = GetBoundBuffer(function, target);
+        if (buffer == nullptr) return nullptr;
+
+        if (buffer->mapped)
+        {
+            SetError(function, GL_INVALID_OPERATION, "Buffer already mapped");
+            return nullptr;
+        }
+
+        buffer->memory.resize(buffer->size);
+        buffer->mapped = true;
+        return buffer->memory.data();
+    }
+
+    NULL_GL_IMPL(glUnmapBuffer, GLboolean, (GLenum target))
+    {
+        RecordCall(function, target);
+
+        NullBuffer *buffer = GetBoundBuffer(function, target);
+        if (buffer == nullptr) return GL_FALSE;
+
+        if (!buffer->mapped)
+        {
+            SetError(function, GL_INVALID_OPERATION, "Buffer not mapped");
+            return GL_FALSE;
+        }
+
+        buffer->mapped = false;
+        return GL_TRUE;
+    }
+
+    NULL_GL_IMPL(glGetBufferParameteri64v, void, (GLenum target, GLenum pname, GLint64 *params))
+    {
+        RecordCall(function, target, pname, params);
+
+        NullBuffer *buffer = GetBoundBuffer(function, target);
+        if (buffer == nullptr) return;
+
+        switch (pname)
+        {
+            case GL_BUFFER_SIZE: *params = buffer->size; break;
+            case GL_BUFFER_MAPPED: *params = buffer->mapped ? GL_TRUE : GL_FALSE; break;
+            default: *params = 0; break;
+        }
+    }
+
+    //----------------------------------------------------------------------------------
+    // Textures and framebuffers
+    //----------------------------------------------------------------------------------
+
+    NULL_GL_IMPL(glTexImage2D, void, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels))
+    {
+        RecordCall(function, target, level, internalformat, width, height, border, format, type, pixels);
+
+        if ((level < 0) || (width < 0) || (height < 0) || (border != 0))
+        {
+            SetError(function, GL_INVALID_VALUE, "Invalid level, size or border");
+            return;
+        }
+
+        NullTexture *texture = GetBoundTexture(target);
+        if ((texture != nullptr) && (texture->immutableLevels > 0))
+        {
+            SetError(function, GL_INVALID_OPERATION, "Texture storage is immutable");
+            return;
+        }
+
+        if ((texture != nullptr) && (level == 0))
+        {
+            texture->width = width;
+            texture->height = height;
+            texture->internalFormat = internalformat;
+        }
+
+        if ((pixels != nullptr) && !IsBufferBound(GL_PIXEL_UNPACK_BUFFER)) nullGL.counters.bytesUploaded += width*static_cast<int64_t>(height)*GetPixelSize(format, type);
+    }
+
+    NULL_GL_IMPL(glTexSubImage2D, void, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels))
+    {
+        RecordCall(function, target, level, xoffset, yoffset, width, height, format, type, pixels);
+
+        const NullTexture *texture = GetBoundTexture(target);
+        const GLsizei levelWidth = (texture != nullptr) ? std::max(texture->width >> level, 1) : 0;
+        const GLsizei levelHeight = (texture != nullptr) ? std::max(texture->height >> level, 1) : 0;
+
+        if ((xoffset < 0) || (yoffset < 0) || (width < 0) || (height < 0) ||
+            ((texture != nullptr) && ((xoffset + width > levelWidth) || (yoffset + height > levelHeight))))
+        {
+            SetError(function, GL_INVALID_VALUE, "Region out of the texture level");
+            return;
+        }
+
+        if ((pixels != nullptr) && !IsBufferBound(GL_PIXEL_UNPACK_BUFFER)) nullGL.counters.bytesUploaded += width*static_cast<int64_t>(height)*GetPixelSize(format, type);
+    }
+
+    NULL_GL_IMPL(glCompressedTexImage2D, void, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data))
+    {
+        RecordCall(function, target, level, internalformat, width, height, border, imageSize, data);
+
+        if ((level < 0) || (width < 0) || (height < 0) || (border != 0) || (imageSize < 0))
+        {
+            SetError(function, GL_INVALID_VALUE, "Invalid level, size or border");
+            return;
+        }
+
+        NullTexture *texture = GetBoundTexture(target);
+        if ((texture != nullptr) && (level == 0))
+        {
+            texture->width = width;
+            texture->height = height;
+            texture->internalFormat = static_cast<GLint>(internalformat);
+        }
+
+        if ((data != nullptr) && !IsBufferBound(GL_PIXEL_UNPACK_BUFFER)) nullGL.counters.bytesUploaded += imageSize;
+    }
+
+    NULL_GL_IMPL(glCompressedTexSubImage2D, void, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data))
+    {
+        RecordCall(function, target, level, xoffset, yoffset, width, height, format, imageSize, data);
+
+        if ((xoffset < 0) || (yoffset < 0) || (width < 0) || (height < 0) || (imageSize < 0))
+        {
+            SetError(function, GL_INVALID_VALUE, "Negative offset or size");
+            return;
+        }
+
+        if ((data != nullptr) && !IsBufferBound(GL_PIXEL_UNPACK_BUFFER)) nullGL.counters.bytesUploaded += imageSize;
+    }
+
+    NULL_GL_IMPL(glTexStorage2D, void, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height))
+    {
+        RecordCall(function, target, levels, internalformat, width, height);
+
+        if ((levels < 1) || (width < 1) || (height < 1))
+        {
+            SetError(function, GL_INVALID_VALUE, "Invalid levels or size");
+            return;
+        }
+
+        NullTexture *texture = GetBoundTexture(target);
+        if ((texture == nullptr) || (texture->immutableLevels > 0))
+        {
+            SetError(function, GL_INVALID_OPERATION, "No texture bound or texture storage already immutable");
+            return;
+        }
+
+        texture->width = width;
+        texture->height = height;
+        texture->internalFormat = static_cast<GLint>(internalformat);
+        texture->immutableLevels = levels;
+    }
+
+    NULL_GL_IMPL(glTexParameteri, void, (GLenum target, GLenum pname, GLint param))
+    {
+        RecordCall(function, target, pname, param);
+
+        NullTexture *texture = GetBoundTexture(target);
+        if (texture != nullptr) texture->parameters[pname] = param;
+    }
+
+    NULL_GL_IMPL(glTexParameterf, void, (GLenum target, GLenum pname, GLfloat param))
+    {
+        RecordCall(function, target, pname, param);
+
+        NullTexture *texture = GetBoundTexture(target);
+        if (texture != nullptr) texture->parameters[pname] = static_cast<GLint>(param);
+    }
+
+    NULL_GL_IMPL(glTexParameteriv, void, (GLenum target, GLenum pname, const GLint *params))
+    {
+        RecordCall(function, target, pname, params);
+
+        NullTexture *texture = GetBoundTexture(target);
+        if (texture != nullptr) texture->parameters[pname] = params[0];
+    }
+
+    NULL_GL_IMPL(glGetTexParameteriv, void, (GLenum target, GLenum pname, GLint *params))
+    {
+        RecordCall(function, target, pname, params);
+
+        const NullTexture *texture = GetBoundTexture(target);
+        *params = 0;
+        if (texture == nullptr) return;
+
+        if (pname == GL_TEXTURE_IMMUTABLE_FORMAT) *params = (texture->immutableLevels > 0) ? GL_TRUE : GL_FALSE;
+        else if (pname == GL_TEXTURE_IMMUTABLE_LEVELS) *params = texture->immutableLevels;
+        else
+        {
+            const auto parameter = texture->parameters.find(pname);
+            if (parameter != texture->parameters.end()) *params = parameter->second;
+        }
+    }
+
+    NULL_GL_IMPL(glGetTexLevelParameteriv, void, (GLenum target, GLint level, GLenum pname, GLint *params))
+    {
+        RecordCall(function, target, level, pname, params);
+
+        const NullTexture *texture = GetBoundTexture(target);
+        *params = 0;
+        if ((texture == nullptr) || (texture->width == 0)) return;
+
+        switch (pname)
+        {
+            case GL_TEXTURE_WIDTH: *params = std::max(texture->width >> level, 1); break;
+            case GL_TEXTURE_HEIGHT: *params = std::max(texture->height >> level, 1); break;
+            case GL_TEXTURE_INTERNAL_FORMAT: *params = texture->internalFormat; break;
+            default: break;
+        }
+    }
+
+    NULL_GL_IMPL(glGetTexImage, void, (GLenum target, GLint level, GLenum format, GLenum type, void *pixels))
+    {
+        RecordCall(function, target, level, format, type, pixels);
+
+        const NullTexture *texture = GetBoundTexture(target);
+        if ((texture == nullptr) || (texture->width == 0) || IsBufferBound(GL_PIXEL_PACK_BUFFER)) return;
+
+        const int64_t width = std::max(texture->width >> level, 1);
+        const int64_t height = std::max(texture->height >> level, 1);
+        std::memset(pixels, 0, width*height*GetPixelSize(format, type));
+    }
+
+    NULL_GL_IMPL(glReadPixels, void, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels))
+    {
+        RecordCall(function, x, y, width, height, format, type, pixels);
+
+        if ((width < 0) || (height < 0))
+        {
+            SetError(function, GL_INVALID_VALUE, "Negative size");
+            return;
+        }
+
+        const int64_t size = width*static_cast<int64_t>(height)*GetPixelSize(format, type);
+
+        // Reads into a pixel pack buffer take an offset in the buffer
+        if (IsBufferBound(GL_PIXEL_PACK_BUFFER))
+        {
+            NullBuffer *buffer = GetBoundBuffer(function, GL_PIXEL_PACK_BUFFER);
+            CheckRange(function, *buffer, reinterpret_cast<GLintptr>(pixels), size);
+        }
+        else std::memset(pixels, 0, size);
+    }
+
+    NULL_GL_IMPL(glFramebufferTexture2D, void, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level))
+    {
+        RecordCall(function, target, attachment, textarget, texture, level);
+
+        const GLuint framebuffer = (target == GL_READ_FRAMEBUFFER) ? nullGL.readFramebuffer : nullGL.drawFramebuffer;
+        if (framebuffer == 0)
+        {
+            SetError(function, GL_INVALID_OPERATION, "Default framebuffer bound");
+            return;
+        }
+
+        if (CheckName(function, texture, nullGL.textures))
+        {
+            nullGL.framebuffers[framebuffer].attachments[attachment] = { (texture != 0) ? static_cast<GLenum>(GL_TEXTURE) : static_cast<GLenum>(GL_NONE), texture };
+        }
+    }
+
+    NULL_GL_IMPL(glFramebufferRenderbuffer, void, (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer))
+    {
+        RecordCall(function, target, attachment, renderbuffertarget, renderbuffer);
+
+        const GLuint framebuffer = (target == GL_READ_FRAMEBUFFER) ? nullGL.readFramebuffer : nullGL.drawFramebuffer;
+        if (framebuffer == 0)
+        {
+            SetError(function, GL_INVALID_OPERATION, "Default framebuffer bound");
+            return;
+        }
+
+        if (CheckName(function, renderbuffer, nullGL.renderbuffers))
+        {
+            nullGL.framebuffers[framebuffer].attachments[attachment] = { (renderbuffer != 0) ? static_cast<GLenum>(GL_RENDERBUFFER) : static_cast<GLenum>(GL_NONE), renderbuffer };
+        }
+    }
+
+    NULL_GL_IMPL(glGetFramebufferAttachmentParameteriv, void, (GLenum target, GLenum attachment, GLenum pname, GLint *params))
+    {
+        RecordCall(function, target, attachment, pname, params);
+
+        const GLuint framebuffer = (target == GL_READ_FRAMEBUFFER) ? nullGL.readFramebuffer : nullGL.drawFramebuffer;
+        NullAttachment bound;
+
+        if (framebuffer == 0) bound.type = GL_FRAMEBUFFER_DEFAULT;
+        else
+        {
+            const auto &attachments = nullGL.framebuffers[framebuffer].attachments;
+            const auto found = attachments.find(attachment);
+            if (found != attachments.end()) bound = found->second;
+        }
+
+        switch (pname)
+        {
+            case GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE: *params = static_cast<GLint>(bound.type); break;
+            case GL_FRAMEBUFFER_ATTACHMENT_OBJECT_NAME: *params = static_cast<GLint>(bound.name); break;
+            default: *params = 0; break;
+        }
+    }
+
+    NULL_GL_IMPL(glCheckFramebufferStatus, GLenum, (GLenum target))
+    {
+        RecordCall(function, target);
+        return GL_FRAMEBUFFER_COMPLETE;
+    }
+
+    //----------------------------------------------------------------------------------
+    // Drawing
+    //----------------------------------------------------------------------------------
+
+    NULL_GL_IMPL(glDrawArrays, void, (GLenum mode, GLint first, GLsizei count))
+    {
+        RecordCall(function, mode, first, count);
+        CheckDraw(function, count, 1);
+    }
+
+    NULL_GL_IMPL(glDrawArraysInstanced, void, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount))
+    {
+        RecordCall(function, mode, first, count, instancecount);
+        CheckDraw(function, count, instancecount);
+    }
+
+    NULL_GL_IMPL(glDrawArraysInstancedEXT, void, (GLenum mode, GLint start, GLsizei count, GLsizei primcount))
+    {
+        RecordCall(function, mode, start, count, primcount);
+        CheckDraw(function, count, primcount);
+    }
+
+    NULL_GL_IMPL(glDrawArraysIndirect, void, (GLenum mode, const void *indirect))
+    {
+        RecordCall(function, mode, indirect);
+
+        if (!IsBufferBound(GL_DRAW_INDIRECT_BUFFER)) SetError(function, GL_INVALID_OPERATION, "No draw indirect buffer bound");
+        else CheckDraw(function, 0, 0);
+    }
+
+    NULL_GL_IMPL(glDrawElements, void, (GLenum mode, GLsizei count, GLenum type, const void *indices))
+    {
+        RecordCall(function, mode, count, type, indices);
+
+        if (!IsBufferBound(GL_ELEMENT_ARRAY_BUFFER)) SetError(function, GL_INVALID_OPERATION, "No element buffer bound");
+        else CheckDraw(function, count, 1);
+    }
+
+    NULL_GL_IMPL(glDrawElementsInstanced, void, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount))
+    {
+        RecordCall(function, mode, count, type, indices, instancecount);
+
+        if (!IsBufferBound(GL_ELEMENT_ARRAY_BUFFER)) SetError(function, GL_INVALID_OPERATION, "No element buffer bound");
+        else CheckDraw(function, count, instancecount);
+    }
+
+    NULL_GL_IMPL(glDrawElementsInstancedEXT, void, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei primcount))
+    {
+        RecordCall(function, mode, count, type, indices, primcount);
+
+        if (!IsBufferBound(GL_ELEMENT_ARRAY_BUFFER)) SetError(function, GL_INVALID_OPERATION, "No element buffer bound");
+        else CheckDraw(function, count, primcount);
+    }
+
+    NULL_GL_IMPL(glVertexAttribPointer, void, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer))
+    {
+        RecordCall(function, index, size, type, normalized, stride, pointer);
+        if (!CheckAttribIndex(function, index)) return;
+
+        if ((size < 1) || ((size > 4) && (size != GL_BGRA)) || (stride < 0)) SetError(function, GL_INVALID_VALUE, "Invalid size or stride");
+        else if ((nullGL.vertexArray != 0) && !IsBufferBound(GL_ARRAY_BUFFER) && (pointer != nullptr))
+        {
+            SetError(function, GL_INVALID_OPERATION, "Client memory attribute with a vertex array bound");
+        }
+    }
+
+    NULL_GL_IMPL(glEnableVertexAttribArray, void, (GLuint index))
+    {
+        RecordCall(function, index);
+        CheckAttribIndex(function, index);
+    }
+
+    NULL_GL_IMPL(glDisableVertexAttribArray, void, (GLuint index))
+    {
+        RecordCall(function, index);
+        CheckAttribIndex(function, index);
+    }
+
+    NULL_GL_IMPL(glVertexAttribDivisor, void, (GLuint index, GLuint divisor))
+    {
+        RecordCall(function, index, divisor);
+        CheckAttribIndex(function, index);
+    }
+
+    //----------------------------------------------------------------------------------
+    // Synchronization and queries (the null GPU completes everything immediately)
+    //----------------------------------------------------------------------------------
+
+    NULL_GL_IMPL(glFenceSync, GLsync, (GLenum condition, GLbitfield flags))
+    {
+        RecordCall(function, condition, flags);
+        return reinterpret_cast<GLsync>(&nullGL);
+    }
+
+    NULL_GL_IMPL(glClientWaitSync, GLenum, (GLsync sync, GLbitfield flags, GLuint64 timeout))
+    {
+        RecordCall(function, sync, flags, timeout);
+        return GL_ALREADY_SIGNALED;
+    }
+
+    NULL_GL_IMPL(glQueryCounter, void, (GLuint id, GLenum target))
+    {
+        RecordCall(function, id, target);
+        if (id == 0) SetError(function, GL_INVALID_OPERATION, "Query name is 0");
+        else CheckName(function, id, nullGL.queries);
+    }
+
+    NULL_GL_IMPL(glGetQueryObjectuiv, void, (GLuint id, GLenum pname, GLuint *params))
+    {
+        RecordCall(function, id, pname, params);
+        *params = (pname == GL_QUERY_RESULT_AVAILABLE) ? GL_TRUE : 0;
+    }
+
+    NULL_GL_IMPL(glGetQueryObjectui64v, void, (GLuint id, GLenum pname, GLuint64 *params))
+    {
+        RecordCall(function, id, pname, params);
+        *params = (pname == GL_QUERY_RESULT_AVAILABLE) ? GL_TRUE : 0;
+    }
+
+#   undef NULL_GL_IMPL
+
+    //----------------------------------------------------------------------------------
+
+    struct NullEntry
+    {
+        const char *name;
+        GLADapiproc proc;
+    };
+
+    // NOTE: The cast to the glad function type checks the signature of every null function
+    const NullEntry NULL_ENTRIES[NULL_FUNCTION_COUNT] = {
+#   define NULL_GL_ENTRY(name, proc) { #name, reinterpret_cast<GLADapiproc>(static_cast<proc>(&NullProc<NULL_##name>::Call)) },
+        NULL_GL_FUNCTIONS(NULL_GL_ENTRY)
+#   undef NULL_GL_ENTRY
+    };
+
+    const NullEntry *FindEntry(const char *name)
+    {
+        const NullEntry *entry = std::find_if(std::begin(NULL_ENTRIES), std::end(NULL_ENTRIES),
+            [name](const NullEntry& e) { return std::strcmp(e.name, name) == 0; });
+
+        return (entry != std::end(NULL_ENTRIES)) ? entry : nullptr;
+    }
+
+}
+
+/* NULL GL BACKEND IMPLEMENTATION */
+
+void *rlgl::NullGLLoader(const char *name)
+{
+    const NullEntry *entry = FindEntry(name);
+    return (entry != nullptr) ? reinterpret_cast<void*>(entry->proc) : nullptr;
+}
+
+const NullGLCounters& rlgl::GetNullGLCounters()
+{
+    return nullGL.counters;
+}
+
+const char *rlgl::GetNullGLLastError()
+{
+    return nullGL.lastError.c_str();
+}
+
+uint64_t rlgl::GetNullGLCallCount(const char *function)
+{
+    const NullEntry *entry = FindEntry(function);
+    return (entry != nullptr) ? nullGL.callCounts[entry - NULL_ENTRIES] : 0;
+}
+
+void rlgl::SetNullGLLogCallback(NullGLLogCallback callback, void *userData)
+{
+    nullGL.logCallback = callback;
+    nullGL.logUserData = userData;
+}
+
+void rlgl::ResetNullGLCounters()
+{
+    nullGL.counters = NullGLCounters();
+    nullGL.lastError.clear();
+    std::fill(std::begin(nullGL.callCounts), std::end(nullGL.callCounts), 0);
+}
+
+#endif  // GRAPHICS_API_OPENGL_33
@@ -0,0 +1,495 @@
+#include "rlParticleSystem.hpp"
+#include "rlGLExt.hpp"
+#include "rlUtils.hpp"
+#include "rlgl.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+using namespace rlgl;
+
+namespace {
+
+    constexpr int SCAN_BLOCK_SIZE = 256;            // Work group size of the compute shaders (elements per scan block)
+    constexpr int MAX_SCAN_LEVELS = 4;              // Scan levels supported (256^4 elements)
+    constexpr uint32_t STATE_DRAW_OFFSET = 16;      // Offset of the indirect draw parameters in the state buffer
+    constexpr uint32_t STATE_DISPATCH_OFFSET = 32;  // Offset of the indirect dispatch parameters in the state buffer (16 bytes per level)
+
+    // Declarations shared by all the particle compute shaders
+    constexpr const char *PARTICLE_COMPUTE_HEADER =
+        "#version 430\n"
+        "layout(local_size_x = 256) in;"
+        "struct Particle { vec4 position; vec4 velocity; };"                // Position and remaining life, velocity and total life
+        "layout(std430, binding = 0) buffer Particles { Particle particles[]; };"
+        "layout(std430, binding = 1) buffer Scan { uint scanData[]; };"
+        "layout(std430, binding = 2) buffer State"
+        "{"
+            "uint aliveCount;"
+            "uint totalCount;"
+            "uint nextAliveCount;"
+            "uint statePadding;"
+            "uint drawCommand[4];"                                          // DrawArraysIndirectCommand
+            "uvec4 dispatchSize[];"                                         // Dispatch sizes of every scan level
+        "};"
+        "layout(std430, binding = 3) buffer Compacted { Particle compacted[]; };"
+        "uint CountAtLevel(int level)"
+        "{"
+            "uint count = totalCount;"
+            "for (int i = 0; i < level; i++) count = (count + 255u)/256u;"
+            "return count;"
+        "}\n";
+
+    // Particles to simulate (alive + emitted) and dispatch sizes
+    constexpr const char *PARTICLE_PREPARE_CODE =
+        "uniform int emitCount;"
+        "uniform int capacity;"
+        "uniform int levelCount;"
+        "void main()"
+        "{"
+            "if (gl_LocalInvocationIndex != 0u) return;"
+            "totalCount = min(aliveCount + uint(emitCount), uint(capacity));"
+            "uint count = totalCount;"
+            "for (int i = 0; i < levelCount; i++)"
+            "{"
+                "count = (count + 255u)/256u;"
+                "dispatchSize[i] = uvec4(max(count, 1u), 1u, 1u, 0u);"
+            "}"
+        "}";
+
+    // Particles emission and simulation, alive flags are written for the scan
+    constexpr const char *PARTICLE_SIMULATE_CODE =
+        "uniform float deltaTime;"
+        "uniform vec3 gravity;"
+        "uniform float drag;"
+        "uniform int seed;"
+        "uniform vec3 emitterPosition;"
+        "uniform vec3 emitterPositionSpread;"
+        "uniform vec3 emitterVelocity;"
+        "uniform vec3 emitterVelocitySpread;"
+        "uniform vec2 emitterLife;"
+        "uint Hash(uint x)"
+        "{"
+            "x ^= x >> 16; x *= 0x7feb352du;"
+            "x ^= x >> 15; x *= 0x846ca68bu;"
+            "x ^= x >> 16;"
+            "return x;"
+        "}"
+        "float Random(inout uint state)"
+        "{"
+            "state = Hash(state);"
+            "return float(state >> 8)/16777215.0;"
+        "}"
+        "vec3 RandomSigned(inout uint state)"
+        "{"
+            "return vec3(Random(state), Random(state), Random(state))*2.0 - 1.0;"
+        "}"
+        "void main()"
+        "{"
+            "uint i = gl_GlobalInvocationID.x;"
+            "if (i >= totalCount) return;"
+            "Particle p;"
+            "if (i < aliveCount)"
+            "{"
+                "p = particles[i];"
+                "p.velocity.xyz += (gravity - drag*p.velocity.xyz)*deltaTime;"
+                "p.position.xyz += p.velocity.xyz*deltaTime;"
+                "p.position.w -= deltaTime;"
+            "}"
+            "else"
+            "{"
+                "uint state = Hash(i ^ Hash(uint(seed)));"
+                "float life = mix(emitterLife.x, emitterLife.y, Random(state));"
+                "p.position = vec4(emitterPosition + RandomSigned(state)*emitterPositionSpread, life);"
+                "p.velocity = vec4(emitterVelocity + RandomSigned(state)*emitterVelocitySpread, life);"
+            "}"
+            "particles[i] = p;"
+            "scanData[i] = (p.position.w > 0.0)? 1u : 0u;"
+        "}";
+
+    // Exclusive scan of the 256 elements blocks of a level, block sums are written to the next level
+    constexpr const char *PARTICLE_SCAN_CODE =
+        "uniform int level;"
+        "uniform int levelOffset;"
+        "uniform int nextOffset;"
+        "uniform int lastLevel;"
+        "shared uint temp[256];"
+        "void main()"
+        "{"
+            "uint count = CountAtLevel(level);"
+            "uint i = gl_GlobalInvocationID.x;"
+            "uint li = gl_LocalInvocationID.x;"
+            "uint value = (i < count)? scanData[uint(levelOffset) + i] : 0u;"
+            "temp[li] = value;"
+            "barrier();"
+            "for (uint offset = 1u; offset < 256u; offset <<= 1)"
+            "{"
+                "uint previous = (li >= offset)? temp[li - offset] : 0u;"
+                "barrier();"
+                "temp[li] += previous;"
+                "barrier();"
+            "}"
+            "if (i < count) scanData[uint(levelOffset) + i] = temp[li] - value;"
+            "if (li == 255u)"
+            "{"
+                "if (lastLevel != 0) nextAliveCount = temp[255];"
+                "else scanData[uint(nextOffset) + gl_WorkGroupID.x] = temp[255];"
+            "}"
+        "}";
+
+    // Add the scanned block sums of the next level to the elements of a level
+    constexpr const char *PARTICLE_ADD_CODE =
+        "uniform int level;"
+        "uniform int levelOffset;"
+        "uniform int nextOffset;"
+        "void main()"
+        "{"
+            "uint i = gl_GlobalInvocationID.x;"
+            "if (i >= CountAtLevel(level)) return;"
+            "scanData[uint(levelOffset) + i] += scanData[uint(nextOffset) + i/256u];"
+        "}";
+
+    // Alive particles are moved to their scanned index
+    constexpr const char *PARTICLE_SCATTER_CODE =
+        "void main()"
+        "{"
+            "uint i = gl_GlobalInvocationID.x;"
+            "if (i >= totalCount) return;"
+            "Particle p = particles[i];"
+            "if (p.position.w > 0.0) compacted[scanData[i]] = p;"
+        "}";
+
+    constexpr const char *PARTICLE_FINALIZE_CODE =
+        "void main()"
+        "{"
+            "if (gl_LocalInvocationIndex != 0u) return;"
+            "aliveCount = nextAliveCount;"
+            "drawCommand[0] = 6u;"
+            "drawCommand[1] = nextAliveCount;"
+            "drawCommand[2] = 0u;"
+            "drawCommand[3] = 0u;"
+        "}";
+
+    // Camera facing quads, particles are read from the storage buffer by instance
+    constexpr const char *PARTICLE_VSHADER_CODE =
+        "#version 430\n"
+        "struct Particle { vec4 position; vec4 velocity; };"
+        "layout(std430, binding = 0) readonly buffer Particles { Particle particles[]; };"
+        "in vec2 vertexPosition;"
+        "uniform mat4 mvp;"
+        "uniform vec3 viewRight;"
+        "uniform vec3 viewUp;"
+        "uniform vec4 colorStart;"
+        "uniform vec4 colorEnd;"
+        "uniform vec2 size;"
+        "out vec2 fragTexCoord;"
+        "out vec4 fragColor;"
+        "void main()"
+        "{"
+            "Particle p = particles[gl_InstanceID];"
+            "float t = 1.0 - clamp(p.position.w/max(p.velocity.w, 1e-6), 0.0, 1.0);"
+            "float s = mix(size.x, size.y, t);"
+            "vec3 position = p.position.xyz + (viewRight*(vertexPosition.x - 0.5) + viewUp*(vertexPosition.y - 0.5))*s;"
+            "fragTexCoord = vec2(vertexPosition.x, 1.0 - vertexPosition.y);"
+            "fragColor = mix(colorStart, colorEnd, t);"
+            "gl_Position = mvp*vec4(position, 1.0);"
+        "}";
+
+    constexpr float QUAD_VERTICES[12] = {
+        0.0f, 0.0f,  1.0f, 0.0f,  1.0f, 1.0f,
+        0.0f, 0.0f,  1.0f, 1.0f,  0.0f, 1.0f
+    };
+
+    //----------------------------------------------------------------------------------
+
+    void SetUniformFloat(Context& rlCtx, uint32_t programId, const char *name, const float *value, ShaderUniformType type)
+    {
+        rlCtx.SetUniform(rlCtx.GetLocationUniform(programId, name), value, type, 1);
+    }
+
+}
+
+/* PARTICLE SYSTEM IMPLEMENTATION */
+
+ParticleSystem::ParticleSystem(Context& rlCtx, int capacity)
+: rlCtx(&rlCtx), capacity(std::max(capacity, 1)), ready(false)
+, gravity{ 0.0f, -9.81f, 0.0f }, drag(0.0f), pendingEmit(0), frameSeed(0)
+, particleBuffers{ 0, 0 }, current(0), scanBuffer(0), stateBuffer(0)
+, prepareProgram(0), simulateProgram(0), scanProgram(0), addProgram(0), scatterProgram(0), finalizeProgram(0)
+, drawShader(0), vaoId(0), quadVboId(0)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    if (!GetExtensions().computeShader || !GetExtensions().ssbo)
+    {
+        TRACELOG(LogWarning, "PARTICLES: Compute shaders not supported, particle system not loaded");
+        return;
+    }
+
+    // Scan levels, the last one fits in a single block
+    int levelSize = this->capacity;
+    int scanSize = 0;
+
+    while (true)
+    {
+        scanLevelOffsets.push_back(scanSize);
+        scanSize += levelSize;
+        if (levelSize <= SCAN_BLOCK_SIZE) break;
+        levelSize = (levelSize + SCAN_BLOCK_SIZE - 1)/SCAN_BLOCK_SIZE;
+    }
+
+    const uint32_t particleSize = 8*sizeof(float);
+
+    // NOTE: Buffer sizes are 32-bit, a wrapped size would load buffers smaller than the dispatches
+    if ((static_cast<int>(scanLevelOffsets.size()) > MAX_SCAN_LEVELS) ||
+        (static_cast<uint64_t>(this->capacity)*particleSize > UINT32_MAX))
+    {
+        TRACELOG(LogWarning, "PARTICLES: Capacity too large (%i particles)", this->capacity);
+        scanLevelOffsets.clear();
+        return;
+    }
+
+    particleBuffers[0] = rlCtx.LoadShaderBuffer(this->capacity*particleSize, nullptr, BufferUsage::DynamicCopy);
+    particleBuffers[1] = rlCtx.LoadShaderBuffer(this->capacity*particleSize, nullptr, BufferUsage::DynamicCopy);
+    scanBuffer = rlCtx.LoadShaderBuffer(scanSize*sizeof(uint32_t), nullptr, BufferUsage::DynamicCopy);
+    stateBuffer = rlCtx.LoadShaderBuffer(STATE_DISPATCH_OFFSET + MAX_SCAN_LEVELS*4*sizeof(uint32_t), nullptr, BufferUsage::DynamicCopy);
+
+    prepareProgram = LoadComputeProgram(rlCtx, PARTICLE_COMPUTE_HEADER, "", PARTICLE_PREPARE_CODE);
+    simulateProgram = LoadComputeProgram(rlCtx, PARTICLE_COMPUTE_HEADER, "", PARTICLE_SIMULATE_CODE);
+    scanProgram = LoadComputeProgram(rlCtx, PARTICLE_COMPUTE_HEADER, "", PARTICLE_SCAN_CODE);
+    addProgram = LoadComputeProgram(rlCtx, PARTICLE_COMPUTE_HEADER, "", PARTICLE_ADD_CODE);
+    scatterProgram = LoadComputeProgram(rlCtx, PARTICLE_COMPUTE_HEADER, "", PARTICLE_SCATTER_CODE);
+    finalizeProgram = LoadComputeProgram(rlCtx, PARTICLE_COMPUTE_HEADER, "", PARTICLE_FINALIZE_CODE);
+
+    // NOTE: Default fragment shader is used (texture0*colDiffuse*fragColor)
+    drawShader = rlCtx.LoadShaderCode(PARTICLE_VSHADER_CODE, nullptr);
+
+    vaoId = rlCtx.LoadVertexArray();
+    rlCtx.EnableVertexArray(vaoId);
+    quadVboId = rlCtx.LoadVertexBuffer(QUAD_VERTICES, sizeof(QUAD_VERTICES), false);
+    rlCtx.SetVertexAttribute(0, 2, DataType::Float, false, 0, nullptr);
+    rlCtx.EnableVertexAttribute(0);
+    rlCtx.DisableVertexArray();
+
+    ready = (prepareProgram != 0) && (simulateProgram != 0) && (scanProgram != 0) && (addProgram != 0) &&
+        (scatterProgram != 0) && (finalizeProgram != 0) && (drawShader != rlCtx.GetShaderIdDefault());
+
+    if (ready) TRACELOG(LogInfo, "PARTICLES: Particle system loaded successfully (%i particles, %i scan levels)", this->capacity, static_cast<int>(scanLevelOffsets.size()));
+    else TRACELOG(LogWarning, "PARTICLES: Failed to load particle system shaders");
+#else
+    TRACELOG(LogWarning, "PARTICLES: Particle system requires OpenGL 4.3 (GRAPHICS_API_OPENGL_43)");
+#endif
+}
+
+ParticleSystem::~ParticleSystem()
+{
+    Unload();
+}
+
+ParticleSystem::ParticleSystem(ParticleSystem&& other) noexcept
+: rlCtx(other.rlCtx), capacity(other.capacity), ready(other.ready)
+, emitter(other.emitter), gravity{ other.gravity[0], other.gravity[1], other.gravity[2] }, drag(other.drag)
+, pendingEmit(other.pendingEmit), frameSeed(other.frameSeed)
+, particleBuffers{ other.particleBuffers[0], other.particleBuffers[1] }, current(other.current)
+, scanBuffer(other.scanBuffer), stateBuffer(other.stateBuffer), scanLevelOffsets(std::move(other.scanLevelOffsets))
+, prepareProgram(other.prepareProgram), simulateProgram(other.simulateProgram), scanProgram(other.scanProgram)
+, addProgram(other.addProgram), scatterProgram(other.scatterProgram), finalizeProgram(other.finalizeProgram)
+, drawShader(other.drawShader), vaoId(other.vaoId), quadVboId(other.quadVboId)
+{
+    other.ready = false;
+    other.particleBuffers[0] = other.particleBuffers[1] = 0;
+    other.scanBuffer = other.stateBuffer = 0;
+    other.prepareProgram = other.simulateProgram = other.scanProgram = 0;
+    other.addProgram = other.scatterProgram = other.finalizeProgram = 0;
+    other.drawShader = other.vaoId = other.quadVboId = 0;
+}
+
+ParticleSystem& ParticleSystem::operator=(ParticleSystem&& other) noexcept
+{
+    if (this != &other)
+    {
+        Unload();
+
+        rlCtx = other.rlCtx;
+        capacity = other.capacity;
+        ready = other.ready;
+        emitter = other.emitter;
+        std::copy(other.gravity, other.gravity + 3, gravity);
+        drag = other.drag;
+        pendingEmit = other.pendingEmit;
+        frameSeed = other.frameSeed;
+        particleBuffers[0] = other.particleBuffers[0];
+        particleBuffers[1] = other.particleBuffers[1];
+        current = other.current;
+        scanBuffer = other.scanBuffer;
+        stateBuffer = other.stateBuffer;
+        scanLevelOffsets = std::move(other.scanLevelOffsets);
+        prepareProgram = other.prepareProgram;
+        simulateProgram = other.simulateProgram;
+        scanProgram = other.scanProgram;
+        addProgram = other.addProgram;
+        scatterProgram = other.scatterProgram;
+        finalizeProgram = other.finalizeProgram;
+        drawShader = other.drawShader;
+        vaoId = other.vaoId;
+        quadVboId = other.quadVboId;
+
+        other.ready = false;
+        other.particleBuffers[0] = other.particleBuffers[1] = 0;
+        other.scanBuffer = other.stateBuffer = 0;
+        other.prepareProgram = other.simulateProgram = other.scanProgram = 0;
+        other.addProgram = other.scatterProgram = other.finalizeProgram = 0;
+        other.drawShader = other.vaoId = other.quadVboId = 0;
+    }
+    return *this;
+}
+
+void ParticleSystem::Emit(int count)
+{
+    pendingEmit = std::min(pendingEmit + std::max(count, 0), capacity);
+}
+
+void ParticleSystem::Update(float deltaTime)
+{
+    if (!ready) return;
+
+    const int levelCount = static_cast<int>(scanLevelOffsets.size());
+
+    rlCtx->DrawRenderBatchActive();
+
+    rlCtx->BindShaderBuffer(particleBuffers[current], 0);
+    rlCtx->BindShaderBuffer(scanBuffer, 1);
+    rlCtx->BindShaderBuffer(stateBuffer, 2);
+    rlCtx->BindShaderBuffer(particleBuffers[1 - current], 3);
+
+    // Count the particles to simulate and compute the dispatch sizes
+    rlCtx->EnableShader(prepareProgram);
+    SetUniformInt(*rlCtx, prepareProgram, "emitCount", pendingEmit);
+    SetUniformInt(*rlCtx, prepareProgram, "capacity", capacity);
+    SetUniformInt(*rlCtx, prepareProgram, "levelCount", levelCount);
+    rlCtx->ComputeShaderDispatch(1, 1, 1);
+    rlCtx->ComputeShaderBarrier();
+
+    // Emit and simulate
+    const float emitterLife[2] = { emitter.lifeMin, emitter.lifeMax };
+
+    rlCtx->EnableShader(simulateProgram);
+    SetUniformFloat(*rlCtx, simulateProgram, "deltaTime", &deltaTime, ShaderUniformType::Float);
+    SetUniformFloat(*rlCtx, simulateProgram, "gravity", gravity, ShaderUniformType::Vec3);
+    SetUniformFloat(*rlCtx, simulateProgram, "drag", &drag, ShaderUniformType::Float);
+    SetUniformInt(*rlCtx, simulateProgram, "seed", static_cast<int>(frameSeed++));
+    SetUniformFloat(*rlCtx, simulateProgram, "emitterPosition", emitter.position, ShaderUniformType::Vec3);
+    SetUniformFloat(*rlCtx, simulateProgram, "emitterPositionSpread", emitter.positionSpread, ShaderUniformType::Vec3);
+    SetUniformFloat(*rlCtx, simulateProgram, "emitterVelocity", emitter.velocity, ShaderUniformType::Vec3);
+    SetUniformFloat(*rlCtx, simulateProgram, "emitterVelocitySpread", emitter.velocitySpread, ShaderUniformType::Vec3);
+    SetUniformFloat(*rlCtx, simulateProgram, "emitterLife", emitterLife, ShaderUniformType::Vec2);
+    rlCtx->ComputeShaderDispatchIndirect(stateBuffer, STATE_DISPATCH_OFFSET);
+    rlCtx->ComputeShaderBarrier();
+
+    // Scan the alive flags (block scans up the levels, then block offsets down the levels)
+    rlCtx->EnableShader(scanProgram);
+
+    for (int i = 0; i < levelCount; i++)
+    {
+        SetUniformInt(*rlCtx, scanProgram, "level", i);
+        SetUniformInt(*rlCtx, scanProgram, "levelOffset", scanLevelOffsets[i]);
+        SetUniformInt(*rlCtx, scanProgram, "nextOffset", (i + 1 < levelCount)? scanLevelOffsets[i + 1] : 0);
+        SetUniformInt(*rlCtx, scanProgram, "lastLevel", (i + 1 == levelCount)? 1 : 0);
+        rlCtx->ComputeShaderDispatchIndirect(stateBuffer, STATE_DISPATCH_OFFSET + 16*i);
+        rlCtx->ComputeShaderBarrier();
+    }
+
+    rlCtx->EnableShader(addProgram);
+
+    for (int i = levelCount - 2; i >= 0; i--)
+    {
+        SetUniformInt(*rlCtx, addProgram, "level", i);
+        SetUniformInt(*rlCtx, addProgram, "levelOffset", scanLevelOffsets[i]);
+        SetUniformInt(*rlCtx, addProgram, "nextOffset", scanLevelOffsets[i + 1]);
+        rlCtx->ComputeShaderDispatchIndirect(stateBuffer, STATE_DISPATCH_OFFSET + 16*i);
+        rlCtx->ComputeShaderBarrier();
+    }
+
+    // Compact the alive particles into the other buffer
+    rlCtx->EnableShader(scatterProgram);
+    rlCtx->ComputeShaderDispatchIndirect(stateBuffer, STATE_DISPATCH_OFFSET);
+    rlCtx->ComputeShaderBarrier();
+
+    rlCtx->EnableShader(finalizeProgram);
+    rlCtx->ComputeShaderDispatch(1, 1, 1);
+    rlCtx->ComputeShaderBarrier();
+
+    rlCtx->DisableShader();
+
+    current = 1 - current;
+    pendingEmit = 0;
+}
+
+void ParticleSystem::Draw(uint32_t textureId)
+{
+    if (!ready) return;
+
+    rlCtx->DrawRenderBatchActive();
+
+    const Matrix modelview = rlCtx->GetMatrixModelview();
+    const Matrix mvp = modelview*rlCtx->GetMatrixProjection();
+
+    // Camera axes in world space (rows of the modelview rotation)
+    const float viewRight[3] = { modelview.m[0], modelview.m[4], modelview.m[8] };
+    const float viewUp[3] = { modelview.m[1], modelview.m[5], modelview.m[9] };
+    const float size[2] = { emitter.sizeStart, emitter.sizeEnd };
+    const float white[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+
+    rlCtx->EnableShader(drawShader);
+    rlCtx->SetUniformMatrix(rlCtx->GetLocationUniform(drawShader, RL_DEFAULT_SHADER_UNIFORM_NAME_MVP), mvp);
+    SetUniformFloat(*rlCtx, drawShader, "viewRight", viewRight, ShaderUniformType::Vec3);
+    SetUniformFloat(*rlCtx, drawShader, "viewUp", viewUp, ShaderUniformType::Vec3);
+    SetUniformFloat(*rlCtx, drawShader, "colorStart", emitter.colorStart, ShaderUniformType::Vec4);
+    SetUniformFloat(*rlCtx, drawShader, "colorEnd", emitter.colorEnd, ShaderUniformType::Vec4);
+    SetUniformFloat(*rlCtx, drawShader, "size", size, ShaderUniformType::Vec2);
+    SetUniformFloat(*rlCtx, drawShader, RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR, white, ShaderUniformType::Vec4);
+    SetUniformInt(*rlCtx, drawShader, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0, 0);
+
+    rlCtx->ActiveTextureSlot(0);
+    rlCtx->EnableTexture((textureId != 0)? textureId : rlCtx->GetTextureIdDefault());
+    rlCtx->BindShaderBuffer(particleBuffers[current], 0);
+
+    rlCtx->EnableVertexArray(vaoId);
+    rlCtx->DrawVertexArrayInstancedIndirect(stateBuffer, STATE_DRAW_OFFSET);
+    rlCtx->DisableVertexArray();
+
+    rlCtx->DisableTexture();
+    rlCtx->DisableShader();
+}
+
+int ParticleSystem::ReadAliveCount() const
+{
+    uint32_t aliveCount = 0;
+    if (ready) rlCtx->ReadShaderBuffer(stateBuffer, &aliveCount, sizeof(aliveCount), 0);
+
+    return static_cast<int>(aliveCount);
+}
+
+void ParticleSystem::Unload()
+{
+    for (uint32_t& buffer : particleBuffers)
+    {
+        if (buffer != 0) rlCtx->UnloadShaderBuffer(buffer);
+        buffer = 0;
+    }
+
+    if (scanBuffer != 0) rlCtx->UnloadShaderBuffer(scanBuffer);
+    if (stateBuffer != 0) rlCtx->UnloadShaderBuffer(stateBuffer);
+
+    for (uint32_t program : { prepareProgram, simulateProgram, scanProgram, addProgram, scatterProgram, finalizeProgram })
+    {
+        if (program != 0) rlCtx->UnloadShaderProgram(program);
+    }
+
+    if ((drawShader != 0) && (drawShader != rlCtx->GetShaderIdDefault())) rlCtx->UnloadShaderProgram(drawShader);
+    if (vaoId != 0) rlCtx->UnloadVertexArray(vaoId);
+    if (quadVboId != 0) rlCtx->UnloadVertexBuffer(quadVboId);
+
+    scanBuffer = stateBuffer = 0;
+    prepareProgram = simulateProgram = scanProgram = addProgram = scatterProgram = finalizeProgram = 0;
+    drawShader = vaoId = quadVboId = 0;
+    ready = false;
+}
@@ -2,20 +2,29 @@
 #include "rlException.hpp"
 #include "rlEnums.hpp"
 #include "rlGLExt.hpp"
+#include "rlTrace.hpp"
 #include "rlgl.hpp"
 
+#include <algorithm>
+
 using namespace rlgl;
 
 /* DRAW CALL IMPLEMENTATION */
 
-void DrawCall::Render(int& vertexOffset)
+void DrawCall::Render(int& vertexOffset, int instances)
 {
     // Bind current draw call texture, activated as GL_TEXTURE0 and Bound to sampler2D texture0 by default
     glBindTexture(GL_TEXTURE_2D, textureId);
 
     if (mode == DrawMode::Lines || mode == DrawMode::Triangles)
     {
-        glDrawArrays(static_cast<int>(mode), vertexOffset, vertexCount);
+#       if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+            if (instances > 1) glDrawArraysInstanced(static_cast<int>(mode), vertexOffset, vertexCount, instances);
+            else glDrawArrays(static_cast<int>(mode), vertexOffset, vertexCount);
+#       else
+            (void)instances;    // Single-pass stereo requires instancing (see EnableStereoRender())
+            glDrawArrays(static_cast<int>(mode), vertexOffset, vertexCount);
+#       endif
     }
     else
     {
@@ -23,13 +32,17 @@ void DrawCall::Render(int& vertexOffset)
             // We need to define the number of indices to be processed: elementCount*6
             // NOTE: The final parameter tells the GPU the offset in bytes from the
             // start of the index buffer to the location of the first index to process
-            glDrawElements(GL_TRIANGLES, vertexCount/4*6, GL_UNSIGNED_INT,
-                reinterpret_cast<const void*>(vertexOffset/4*6*sizeof(GLuint)));
+            const void *indexOffset = reinterpret_cast<const void*>(vertexOffset/4*6*sizeof(GLuint));
+
+            if (instances > 1) glDrawElementsInstanced(GL_TRIANGLES, vertexCount/4*6, GL_UNSIGNED_INT, indexOffset, instances);
+            else glDrawElements(GL_TRIANGLES, vertexCount/4*6, GL_UNSIGNED_INT, indexOffset);
 #       endif
 
 #       if defined(GRAPHICS_API_OPENGL_ES2)
-            glDrawElements(GL_TRIANGLES, draws[i].vertexCount/4*6, GL_UNSIGNED_SHORT,
-                reinterpret_cast<const void*>(vertexOffset/4*6*sizeof(GLushort)));
+            const void *indexOffset = reinterpret_cast<const void*>(vertexOffset/4*6*sizeof(GLushort));
+
+            if (instances > 1) glDrawElementsInstanced(GL_TRIANGLES, vertexCount/4*6, GL_UNSIGNED_SHORT, indexOffset, instances);
+            else glDrawElements(GL_TRIANGLES, vertexCount/4*6, GL_UNSIGNED_SHORT, indexOffset);
 #       endif
     }
 
@@ -62,7 +75,9 @@ RenderBatch::RenderBatch(const Context& rlCtx, int numBuffers, int bufferElement
     //--------------------------------------------------------------------------------------------
 
     // Initializes the first DrawCall in the draw call queue
-    drawQueue.push(DrawCall(rlCtx.GetTextureIdDefault()));
+    // NOTE: Storage is reserved for the draw calls limit, the queue is not reallocated while drawing
+    drawQueue.reserve(drawCallsLimit);
+    drawQueue.emplace_back(rlCtx.GetTextureIdDefault());
 
 #endif
 }
@@ -79,9 +94,10 @@ RenderBatch::~RenderBatch()
 }
 
 RenderBatch::RenderBatch(RenderBatch&& other) noexcept
-: currentBuffer(other.currentBuffer)
-, vertexBuffer(std::move(other.vertexBuffer))
+: vertexBuffer(std::move(other.vertexBuffer))
+, currentBuffer(other.currentBuffer)
 , drawQueue(std::move(other.drawQueue))
+, drawQueueLimit(other.drawQueueLimit)
 , currentDepth(other.currentDepth)
 { }
 
@@ -92,13 +108,46 @@ RenderBatch& RenderBatch::operator=(RenderBatch&& other) noexcept
         currentBuffer = other.currentBuffer;
         vertexBuffer = std::move(other.vertexBuffer);
         drawQueue = std::move(other.drawQueue);
+        drawQueueLimit = other.drawQueueLimit;
         currentDepth = other.currentDepth;
     }
     return *this;
 }
 
-void RenderBatch::Draw(Context& rlCtx)
+void RenderBatch::Resize(const Context& rlCtx, int bufferElements, int drawCallsLimit)
+{
+    drawQueueLimit = drawCallsLimit;
+    drawQueue.reserve(drawCallsLimit);
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+
+    if (bufferElements == GetBufferElements()) return;
+
+    // NOTE: Vertex arrays are configured with the default shader locations,
+    // a custom shader can be active between frames
+    const int *shaderLocs = rlCtx.GetState().defaultShaderLocs;
+    const std::size_t numBuffers = vertexBuffer.size();
+
+    vertexBuffer.clear();
+    vertexBuffer.reserve(numBuffers);
+
+    for (std::size_t i = 0; i < numBuffers; i++)
+    {
+        vertexBuffer.emplace_back(shaderLocs, bufferElements);
+    }
+
+    currentBuffer = 0;
+
+    // Unbind the current VAO
+    if (GetExtensions().vao) glBindVertexArray(0);
+
+#endif
+}
+
+void RenderBatch::Draw(Context& rlCtx, FrameStats *stats)
 {
+    RLGL_TRACE_ZONE("RenderBatch::Draw");
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 
     const VertexBuffer &curBuffer = vertexBuffer[currentBuffer];
@@ -109,11 +158,39 @@ void RenderBatch::Draw(Context& rlCtx)
     // TODO: If no data changed on the CPU arrays --> No need to re-update GPU arrays (use a change detector flag?)
     if (rlState.vertexCounter > 0) curBuffer.Update(rlState.vertexCounter);
 
+    if ((stats != nullptr) && (rlState.vertexCounter > 0))
+    {
+        RLGL_STAT(stats->bytesUploaded += rlState.vertexCounter*(3*sizeof(float) + 2*sizeof(float) + 4*sizeof(unsigned char)));
+    }
+
     // Draw batch vertex buffers (considering VR stereo if required)
     Matrix matProjection = rlCtx.GetMatrixProjection();
     Matrix matModelView = rlCtx.GetMatrixModelview();
 
-    const int eyeCount = rlState.stereoRender ? 2 : 1;
+    // Single-pass stereo: both eyes are drawn by one instanced draw per draw call,
+    // the default shader is replaced by its stereo variant, custom shaders must support it
+    uint32_t shaderId = rlState.currentShaderId;
+    const int *shaderLocs = rlState.currentShaderLocs;
+    bool singlePassStereo = false;
+
+    if (rlState.stereoRender && rlState.stereoSinglePass)
+    {
+        if (shaderId == rlState.defaultShaderId)
+        {
+            shaderId = rlState.defaultStereoShaderId;
+            shaderLocs = rlState.defaultStereoShaderLocs;
+        }
+
+        singlePassStereo = (shaderLocs[LocMatrixMVPStereo] != -1);
+
+        if (!singlePassStereo)
+        {
+            shaderId = rlState.currentShaderId;
+            shaderLocs = rlState.currentShaderLocs;
+        }
+    }
+
+    const int eyeCount = (rlState.stereoRender && !singlePassStereo) ? 2 : 1;
     for (int eye = 0; eye < eyeCount; eye++)
     {
         if (eyeCount == 2)
@@ -127,18 +204,37 @@ void RenderBatch::Draw(Context& rlCtx)
         if (rlState.vertexCounter > 0)
         {
             // Set current shader and upload current MVP matrix
-            glUseProgram(rlState.currentShaderId);
+            glUseProgram(shaderId);
 
-            // Create modelview-projection matrix and upload to shader
-            glUniformMatrix4fv(rlState.currentShaderLocs[LocMatrixMVP], 1, false,
-                (rlState.modelview * rlState.projection).m); // MVP
+            if (singlePassStereo)
+            {
+                // Create modelview-projection matrices of both eyes and upload to shader
+                float mvpStereo[32];
+                for (int i = 0; i < 2; i++)
+                {
+                    const Matrix mvp = (matModelView * rlState.viewOffsetStereo[i]) * rlState.projectionStereo[i];
+                    std::copy(mvp.m, mvp.m + 16, mvpStereo + 16*i);
+                }
+
+                glUniformMatrix4fv(shaderLocs[LocMatrixMVPStereo], 2, false, mvpStereo);
+
+#           if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+                glEnable(GL_CLIP_DISTANCE0);    // Clip every eye to its half of the framebuffer
+#           endif
+            }
+            else
+            {
+                // Create modelview-projection matrix and upload to shader
+                glUniformMatrix4fv(shaderLocs[LocMatrixMVP], 1, false,
+                    (rlState.modelview * rlState.projection).m); // MVP
+            }
 
             // Binds VertexBuffer (position, texcoords, colors)
-            curBuffer.Bind(rlState.currentShaderLocs);
+            curBuffer.Bind(shaderLocs);
 
             // Setup some default shader values
-            glUniform4f(rlState.currentShaderLocs[LocColorDiffuse], 1.0f, 1.0f, 1.0f, 1.0f);
-            glUniform1i(rlState.currentShaderLocs[LocMapDiffuse], 0);  // Active default sampler2D: texture0
+            glUniform4f(shaderLocs[LocColorDiffuse], 1.0f, 1.0f, 1.0f, 1.0f);
+            glUniform1i(shaderLocs[LocMapDiffuse], 0);  // Active default sampler2D: texture0
 
             // Activate additional sampler textures
             // Those additional textures will be common for all draw calls of the batch
@@ -148,6 +244,7 @@ void RenderBatch::Draw(Context& rlCtx)
                 {
                     glActiveTexture(GL_TEXTURE0 + 1 + i);
                     glBindTexture(GL_TEXTURE_2D, rlState.activeTextureId[i]);
+                    if (stats != nullptr) RLGL_STAT(stats->textureBinds++);
                 }
             }
 
@@ -155,12 +252,25 @@ void RenderBatch::Draw(Context& rlCtx)
             // NOTE: Batch system accumulates calls by texture0 changes, additional textures are enabled for all the draw calls
             glActiveTexture(GL_TEXTURE0);
 
-            for (int vertexOffset = 0; !drawQueue.empty();)
+            // Every draw call binds its texture and draws all the vertices of the batch once per instance
+            const int instances = singlePassStereo ? 2 : 1;
+
+            if (stats != nullptr)
             {
-                drawQueue.front().Render(vertexOffset);
-                if (eye == eyeCount - 1) drawQueue.pop();
+                RLGL_STAT(stats->drawCalls += static_cast<uint32_t>(drawQueue.size()));
+                RLGL_STAT(stats->textureBinds += static_cast<uint32_t>(drawQueue.size()));
+                RLGL_STAT(stats->vertices += static_cast<uint64_t>(rlState.vertexCounter)*instances);
             }
 
+            // NOTE: Draw calls are kept for the next eye, they are cleared after the last one
+            int vertexOffset = 0;
+            for (DrawCall &drawCall : drawQueue) drawCall.Render(vertexOffset, instances);
+            if (eye == eyeCount - 1) drawQueue.clear();
+
+#       if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+            if (singlePassStereo) glDisable(GL_CLIP_DISTANCE0);
+#       endif
+
             if (!GetExtensions().vao)
             {
                 glBindBuffer(GL_ARRAY_BUFFER, 0);
@@ -187,7 +297,7 @@ void RenderBatch::Draw(Context& rlCtx)
     rlCtx.SetMatrixModelview(matModelView);
 
     // If all drawCalls have been dequeued, we are resetting one
-    if (drawQueue.size() == 0) drawQueue.push(DrawCall(rlCtx.GetTextureIdDefault()));
+    if (drawQueue.size() == 0) drawQueue.emplace_back(rlCtx.GetTextureIdDefault());
 
     // Change to next buffer in the list (in case of multi-buffering)
     if ((++currentBuffer) >= vertexBuffer.size()) currentBuffer = 0;
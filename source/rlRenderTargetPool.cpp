@@ -0,0 +1,166 @@
+#include "rlRenderTargetPool.hpp"
+#include "rlGLExt.hpp"
+#include "rlUtils.hpp"
+#include "rlgl.hpp"
+
+#include <algorithm>
+
+using namespace rlgl;
+
+/* RENDER TARGET POOL IMPLEMENTATION */
+
+RenderTargetPool::RenderTargetPool(Context& rlCtx, int maxUnusedFrames)
+: rlCtx(&rlCtx), maxUnusedFrames(std::max(maxUnusedFrames, 0))
+, frameCounter(0), memoryUsage(0), peakMemoryUsage(0)
+{ }
+
+RenderTargetPool::~RenderTargetPool()
+{
+    Clear();
+}
+
+RenderTargetPool::RenderTargetPool(RenderTargetPool&& other) noexcept
+: rlCtx(other.rlCtx), targets(std::move(other.targets))
+, maxUnusedFrames(other.maxUnusedFrames), frameCounter(other.frameCounter)
+, memoryUsage(other.memoryUsage), peakMemoryUsage(other.peakMemoryUsage)
+{
+    other.targets.clear();
+    other.memoryUsage = 0;
+}
+
+RenderTargetPool& RenderTargetPool::operator=(RenderTargetPool&& other) noexcept
+{
+    if (this != &other)
+    {
+        Clear();
+
+        rlCtx = other.rlCtx;
+        targets = std::move(other.targets);
+        maxUnusedFrames = other.maxUnusedFrames;
+        frameCounter = other.frameCounter;
+        memoryUsage = other.memoryUsage;
+        peakMemoryUsage = other.peakMemoryUsage;
+
+        other.targets.clear();
+        other.memoryUsage = 0;
+    }
+    return *this;
+}
+
+RenderTarget RenderTargetPool::Acquire(int width, int height, PixelFormat format, bool depth)
+{
+    // Reuse a free target with the same key
+    for (auto &entry : targets)
+    {
+        if (!entry.inUse && (entry.target.width == width) && (entry.target.height == height)
+            && (entry.target.format == format) && (entry.depth == depth))
+        {
+            entry.inUse = true;
+            entry.lastFrame = frameCounter;
+            return entry.target;
+        }
+    }
+
+    // No target available, load a new one
+    Entry entry;
+    entry.target.width = width;
+    entry.target.height = height;
+    entry.target.format = format;
+    entry.depth = depth;
+
+    entry.target.framebuffer = rlCtx->LoadFramebuffer(width, height);
+    if (entry.target.framebuffer == 0)
+    {
+        TRACELOG(LogWarning, "FBO: Failed to load pooled render target (%ix%i)", width, height);
+        return RenderTarget();
+    }
+
+    entry.target.colorTexture = rlCtx->LoadTexture(nullptr, width, height, format, 1);
+    rlCtx->FramebufferAttach(entry.target.framebuffer, entry.target.colorTexture, FramebufferAttachType::ColorChannel0, FramebufferAttachTextureType::Texture2D, 0);
+    entry.size = GetPixelDataSize(width, height, format);
+
+    if (depth)
+    {
+        // NOTE: A depth texture is used when supported so it can be sampled by the next passes,
+        // the type of attachment is queried back when the framebuffer is unloaded
+        const bool useRenderBuffer = !GetExtensions().texDepth;
+        entry.target.depthTexture = rlCtx->LoadTextureDepth(width, height, useRenderBuffer);
+        rlCtx->FramebufferAttach(entry.target.framebuffer, entry.target.depthTexture, FramebufferAttachType::Depth,
+            useRenderBuffer ? FramebufferAttachTextureType::RenderBuffer : FramebufferAttachTextureType::Texture2D, 0);
+        entry.size += static_cast<std::size_t>(width)*height*4;     // Assume 32 bits per depth sample
+    }
+
+    if (!rlCtx->FramebufferComplete(entry.target.framebuffer))
+    {
+        UnloadEntry(entry);
+        return RenderTarget();
+    }
+
+    entry.inUse = true;
+    entry.lastFrame = frameCounter;
+
+    memoryUsage += entry.size;
+    peakMemoryUsage = std::max(peakMemoryUsage, memoryUsage);
+
+    TRACELOG(LogInfo, "FBO: [ID %i] Pooled render target loaded (%ix%i, %i targets, %i KB)",
+        entry.target.framebuffer, width, height, static_cast<int>(targets.size() + 1), static_cast<int>(memoryUsage/1024));
+
+    targets.push_back(entry);
+
+    return entry.target;
+}
+
+void RenderTargetPool::Release(const RenderTarget& target)
+{
+    for (auto &entry : targets)
+    {
+        if (entry.target.framebuffer == target.framebuffer)
+        {
+            entry.inUse = false;
+            return;
+        }
+    }
+
+    TRACELOG(LogWarning, "FBO: [ID %i] Render target released is not part of the pool", target.framebuffer);
+}
+
+void RenderTargetPool::BeginFrame()
+{
+    EndFrame();
+
+    // Unload targets unused for too many frames
+    for (auto it = targets.begin(); it != targets.end();)
+    {
+        if (!it->inUse && ((frameCounter - it->lastFrame) > static_cast<uint64_t>(maxUnusedFrames)))
+        {
+            memoryUsage -= it->size;
+            UnloadEntry(*it);
+            it = targets.erase(it);
+        }
+        else ++it;
+    }
+
+    frameCounter++;
+}
+
+void RenderTargetPool::EndFrame()
+{
+    for (auto &entry : targets) entry.inUse = false;
+}
+
+void RenderTargetPool::Clear()
+{
+    for (auto &entry : targets) UnloadEntry(entry);
+
+    targets.clear();
+    memoryUsage = 0;
+}
+
+void RenderTargetPool::UnloadEntry(Entry& entry)
+{
+    // NOTE: Depth attachment is unloaded with the framebuffer
+    rlCtx->UnloadFramebuffer(entry.target.framebuffer);
+    if (entry.target.colorTexture != 0) rlCtx->UnloadTexture(entry.target.colorTexture);
+
+    entry.target = RenderTarget();
+}
@@ -0,0 +1,294 @@
+#include "rlSpriteBatch.hpp"
+#include "rlGLExt.hpp"
+#include "rlUtils.hpp"
+#include "rlgl.hpp"
+
+#include <algorithm>
+
+using namespace rlgl;
+
+namespace {
+
+    // Sprite vertex shader, quads are expanded from the instance data
+    constexpr const char *SPRITE_VSHADER_CODE =
+#if defined(GRAPHICS_API_OPENGL_33)
+        "#version 330\n"
+        "in vec2 vertexPosition;"           // Unit quad corner
+        "in vec4 instanceRect;"             // Position (xy), size (zw)
+        "in vec3 instanceTransform;"        // Origin (xy), rotation in degrees (z)
+        "in vec4 instanceTexCoord;"         // Texture coordinates rectangle (u0, v0, u1, v1)
+        "in vec4 instanceColor;"
+        "out vec2 fragTexCoord;"
+        "out vec4 fragColor;"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+        "#version 100\n"
+        "precision mediump float;"
+        "attribute vec2 vertexPosition;"
+        "attribute vec4 instanceRect;"
+        "attribute vec3 instanceTransform;"
+        "attribute vec4 instanceTexCoord;"
+        "attribute vec4 instanceColor;"
+        "varying vec2 fragTexCoord;"
+        "varying vec4 fragColor;"
+#else
+        ""
+#endif
+        "uniform mat4 mvp;"
+        "void main()"
+        "{"
+            "vec2 local = vertexPosition*instanceRect.zw - instanceTransform.xy;"
+            "float angle = radians(instanceTransform.z);"
+            "float c = cos(angle);"
+            "float s = sin(angle);"
+            "vec2 position = instanceRect.xy + vec2(local.x*c - local.y*s, local.x*s + local.y*c);"
+            "fragTexCoord = mix(instanceTexCoord.xy, instanceTexCoord.zw, vertexPosition);"
+            "fragColor = instanceColor;"
+            "gl_Position = mvp*vec4(position, 0.0, 1.0);"
+        "}";
+
+    // Unit quad (two triangles, counter-clockwise in screen space)
+    constexpr float QUAD_VERTICES[12] = {
+        0.0f, 0.0f,  0.0f, 1.0f,  1.0f, 1.0f,
+        0.0f, 0.0f,  1.0f, 1.0f,  1.0f, 0.0f
+    };
+
+}
+
+/* SPRITE BATCH IMPLEMENTATION */
+
+SpriteBatch::SpriteBatch(Context& rlCtx, int capacity)
+: rlCtx(&rlCtx), capacity(std::max(capacity, 1)), textureId(0)
+, defaultShaderId(0), shaderId(0), locMVP(-1), locColor(-1), locTexture(-1), locAttribs{ -1, -1, -1, -1, -1 }
+, vaoId(0), quadVboId(0), instanceVboId(0), drawCalls(0)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!GetExtensions().instancing)
+    {
+        TRACELOG(LogWarning, "SPRITES: Instancing not supported, sprite batch not loaded");
+        return;
+    }
+
+    instances.reserve(this->capacity);
+
+    // NOTE: Default fragment shader is used (texture0*colDiffuse*fragColor)
+    defaultShaderId = rlCtx.LoadShaderCode(SPRITE_VSHADER_CODE, nullptr);
+
+    vaoId = rlCtx.LoadVertexArray();
+    rlCtx.EnableVertexArray(vaoId);
+    quadVboId = rlCtx.LoadVertexBuffer(QUAD_VERTICES, sizeof(QUAD_VERTICES), false);
+    instanceVboId = rlCtx.LoadVertexBuffer(nullptr, this->capacity*static_cast<int>(sizeof(SpriteInstance)), true);
+
+    LoadShader(defaultShaderId);
+
+    rlCtx.DisableVertexArray();
+
+    TRACELOG(LogInfo, "SPRITES: Sprite batch loaded successfully (%i sprites per draw call)", this->capacity);
+#endif
+}
+
+SpriteBatch::~SpriteBatch()
+{
+    if (vaoId != 0) rlCtx->UnloadVertexArray(vaoId);
+    if (quadVboId != 0) rlCtx->UnloadVertexBuffer(quadVboId);
+    if (instanceVboId != 0) rlCtx->UnloadVertexBuffer(instanceVboId);
+    if (defaultShaderId != 0) rlCtx->UnloadShaderProgram(defaultShaderId);
+}
+
+SpriteBatch::SpriteBatch(SpriteBatch&& other) noexcept
+: rlCtx(other.rlCtx), instances(std::move(other.instances)), capacity(other.capacity), textureId(other.textureId)
+, defaultShaderId(other.defaultShaderId), shaderId(other.shaderId), locMVP(other.locMVP), locColor(other.locColor)
+, locTexture(other.locTexture), vaoId(other.vaoId), quadVboId(other.quadVboId), instanceVboId(other.instanceVboId)
+, drawCalls(other.drawCalls)
+{
+    std::copy(other.locAttribs, other.locAttribs + 5, locAttribs);
+
+    other.defaultShaderId = 0;
+    other.vaoId = 0;
+    other.quadVboId = 0;
+    other.instanceVboId = 0;
+}
+
+SpriteBatch& SpriteBatch::operator=(SpriteBatch&& other) noexcept
+{
+    if (this != &other)
+    {
+        if (vaoId != 0) rlCtx->UnloadVertexArray(vaoId);
+        if (quadVboId != 0) rlCtx->UnloadVertexBuffer(quadVboId);
+        if (instanceVboId != 0) rlCtx->UnloadVertexBuffer(instanceVboId);
+        if (defaultShaderId != 0) rlCtx->UnloadShaderProgram(defaultShaderId);
+
+        rlCtx = other.rlCtx;
+        instances = std::move(other.instances);
+        capacity = other.capacity;
+        textureId = other.textureId;
+        defaultShaderId = other.defaultShaderId;
+        shaderId = other.shaderId;
+        locMVP = other.locMVP;
+        locColor = other.locColor;
+        locTexture = other.locTexture;
+        std::copy(other.locAttribs, other.locAttribs + 5, locAttribs);
+        vaoId = other.vaoId;
+        quadVboId = other.quadVboId;
+        instanceVboId = other.instanceVboId;
+        drawCalls = other.drawCalls;
+
+        other.defaultShaderId = 0;
+        other.vaoId = 0;
+        other.quadVboId = 0;
+        other.instanceVboId = 0;
+    }
+    return *this;
+}
+
+void SpriteBatch::SetTexture(uint32_t id)
+{
+    if (id != textureId)
+    {
+        Flush();
+        textureId = id;
+    }
+}
+
+void SpriteBatch::Draw(const SpriteInstance& sprite)
+{
+    if (static_cast<int>(instances.size()) >= capacity) Flush();
+    instances.push_back(sprite);
+}
+
+void SpriteBatch::Draw(const SpriteInstance *sprites, int count)
+{
+    while (count > 0)
+    {
+        if (static_cast<int>(instances.size()) >= capacity) Flush();
+
+        const int copied = std::min(count, capacity - static_cast<int>(instances.size()));
+        instances.insert(instances.end(), sprites, sprites + copied);
+
+        sprites += copied;
+        count -= copied;
+    }
+}
+
+void SpriteBatch::Flush()
+{
+    if (instances.empty()) return;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (shaderId == 0)
+    {
+        instances.clear();
+        return;
+    }
+
+    // Internal batch is drawn first, it could contain previous drawings
+    rlCtx->DrawRenderBatchActive();
+
+    const float white[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    const int textureSlot = 0;
+
+    rlCtx->EnableShader(shaderId);
+    rlCtx->SetUniformMatrix(locMVP, rlCtx->GetMatrixModelview()*rlCtx->GetMatrixProjection());
+    rlCtx->SetUniform(locColor, white, ShaderUniformType::Vec4, 1);
+    rlCtx->SetUniform(locTexture, &textureSlot, ShaderUniformType::Int, 1);
+
+    rlCtx->ActiveTextureSlot(0);
+    rlCtx->EnableTexture((textureId != 0)? textureId : rlCtx->GetTextureIdDefault());
+
+    // NOTE: Buffer is orphaned first, so the driver does not wait for the previous draw call using it
+    glBindBuffer(GL_ARRAY_BUFFER, instanceVboId);
+    glBufferData(GL_ARRAY_BUFFER, capacity*sizeof(SpriteInstance), nullptr, GL_STREAM_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, instances.size()*sizeof(SpriteInstance), instances.data());
+
+    const bool useVao = rlCtx->EnableVertexArray(vaoId);
+    if (!useVao) BindAttributes();
+
+    rlCtx->DrawVertexArrayInstanced(0, 6, static_cast<int>(instances.size()));
+
+    if (useVao) rlCtx->DisableVertexArray();
+    else
+    {
+        // Instance divisors are part of the global vertex state without VAO
+        for (int i = 0; i < 5; i++)
+        {
+            if (locAttribs[i] < 0) continue;
+            rlCtx->SetVertexAttributeDivisor(locAttribs[i], 0);
+            rlCtx->DisableVertexAttribute(locAttribs[i]);
+        }
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    rlCtx->DisableTexture();
+    rlCtx->DisableShader();
+
+    drawCalls++;
+#endif
+
+    instances.clear();
+}
+
+void SpriteBatch::SetShader(uint32_t shaderId)
+{
+    if (shaderId == 0) shaderId = defaultShaderId;
+    if ((shaderId == this->shaderId) || (defaultShaderId == 0)) return;
+
+    Flush();
+
+    rlCtx->EnableVertexArray(vaoId);
+    LoadShader(shaderId);
+    rlCtx->DisableVertexArray();
+}
+
+const char *SpriteBatch::GetVertexShaderCode()
+{
+    return SPRITE_VSHADER_CODE;
+}
+
+// Get the shader locations and set the attributes of the vertex array
+void SpriteBatch::LoadShader(uint32_t shaderId)
+{
+    this->shaderId = shaderId;
+
+    locMVP = rlCtx->GetLocationUniform(shaderId, RL_DEFAULT_SHADER_UNIFORM_NAME_MVP);
+    locColor = rlCtx->GetLocationUniform(shaderId, RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR);
+    locTexture = rlCtx->GetLocationUniform(shaderId, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0);
+
+    locAttribs[0] = rlCtx->GetLocationAttrib(shaderId, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION);
+    locAttribs[1] = rlCtx->GetLocationAttrib(shaderId, "instanceRect");
+    locAttribs[2] = rlCtx->GetLocationAttrib(shaderId, "instanceTransform");
+    locAttribs[3] = rlCtx->GetLocationAttrib(shaderId, "instanceTexCoord");
+    locAttribs[4] = rlCtx->GetLocationAttrib(shaderId, "instanceColor");
+
+    // NOTE: Attributes are stored in the vertex array once, they are set on every draw call without VAO support
+    if (GetExtensions().vao) BindAttributes();
+}
+
+// Set the unit quad and instance attributes
+void SpriteBatch::BindAttributes() const
+{
+    constexpr int stride = sizeof(SpriteInstance);
+    const struct { int size; DataType type; bool normalized; std::size_t offset; } instanceAttribs[4] = {
+        { 4, DataType::Float, false, offsetof(SpriteInstance, x) },
+        { 3, DataType::Float, false, offsetof(SpriteInstance, originX) },
+        { 4, DataType::Float, false, offsetof(SpriteInstance, u0) },
+        { 4, DataType::UnsignedByte, true, offsetof(SpriteInstance, color) }
+    };
+
+    if (locAttribs[0] >= 0)
+    {
+        rlCtx->EnableVertexBuffer(quadVboId);
+        rlCtx->SetVertexAttribute(locAttribs[0], 2, DataType::Float, false, 0, nullptr);
+        rlCtx->EnableVertexAttribute(locAttribs[0]);
+    }
+
+    rlCtx->EnableVertexBuffer(instanceVboId);
+
+    for (int i = 0; i < 4; i++)
+    {
+        if (locAttribs[i + 1] < 0) continue;
+
+        rlCtx->SetVertexAttribute(locAttribs[i + 1], instanceAttribs[i].size, instanceAttribs[i].type, instanceAttribs[i].normalized,
+            stride, reinterpret_cast<const void*>(instanceAttribs[i].offset));
+        rlCtx->EnableVertexAttribute(locAttribs[i + 1]);
+        rlCtx->SetVertexAttributeDivisor(locAttribs[i + 1], 1);
+    }
+}
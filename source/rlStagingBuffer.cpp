@@ -0,0 +1,447 @@
+#include "rlStagingBuffer.hpp"
+#include "rlGLExt.hpp"
+#include "rlEnums.hpp"
+#include "rlUtils.hpp"
+#include <algorithm>
+#include <cstring>
+
+using namespace rlgl;
+
+// NOTE: Pixel buffer objects are core on OpenGL 2.1+ and OpenGL ES 3.0,
+// on OpenGL ES 2.0 the staging memory is just a CPU memory block
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+    #define RLGL_PIXEL_BUFFERS_SUPPORTED
+#endif
+
+// NOTE: Fence sync objects are core on OpenGL 3.2+ and OpenGL ES 3.0, on OpenGL 2.1
+// the driver synchronizes when the buffer is mapped, so readbacks are always reported ready
+#if defined(RLGL_PIXEL_BUFFERS_SUPPORTED) && !defined(GRAPHICS_API_OPENGL_21)
+    #define RLGL_FENCE_SYNC_SUPPORTED
+#endif
+
+/* UPLOAD BUFFER IMPLEMENTATION */
+
+UploadBuffer::UploadBuffer(int numBuffers)
+: currentBuffer(0), mapped(nullptr)
+{
+#if defined(RLGL_PIXEL_BUFFERS_SUPPORTED)
+
+    pboId.resize(std::max(numBuffers, 1));
+    pboSize.resize(pboId.size(), 0);
+
+    glGenBuffers(static_cast<int>(pboId.size()), pboId.data());
+
+    TRACELOG(LogInfo, "PBO: %i upload staging buffers loaded successfully", static_cast<int>(pboId.size()));
+
+#endif
+}
+
+UploadBuffer::~UploadBuffer()
+{
+#if defined(RLGL_PIXEL_BUFFERS_SUPPORTED)
+
+    if (!pboId.empty())
+    {
+        if (mapped != nullptr) Unmap();
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        glDeleteBuffers(static_cast<int>(pboId.size()), pboId.data());
+    }
+
+#endif
+}
+
+UploadBuffer::UploadBuffer(UploadBuffer&& other) noexcept
+: pboId(std::move(other.pboId))
+, pboSize(std::move(other.pboSize))
+, memory(std::move(other.memory))
+, currentBuffer(other.currentBuffer)
+, mapped(other.mapped)
+{
+    other.pboId.clear();
+    other.pboSize.clear();
+    other.mapped = nullptr;
+}
+
+UploadBuffer& UploadBuffer::operator=(UploadBuffer&& other) noexcept
+{
+    if (this != &other)
+    {
+        pboId = std::move(other.pboId);
+        pboSize = std::move(other.pboSize);
+        memory = std::move(other.memory);
+        currentBuffer = other.currentBuffer;
+        mapped = other.mapped;
+
+        other.pboId.clear();
+        other.pboSize.clear();
+        other.mapped = nullptr;
+    }
+    return *this;
+}
+
+void *UploadBuffer::Map(uint32_t size)
+{
+    if (mapped != nullptr)
+    {
+        TRACELOG(LogWarning, "PBO: Upload staging buffer already mapped, previous data discarded");
+        Unmap();
+    }
+
+#if defined(RLGL_PIXEL_BUFFERS_SUPPORTED)
+
+    // Move to the next buffer of the ring, the previous one could still be read by the GPU
+    if ((++currentBuffer) >= static_cast<int>(pboId.size())) currentBuffer = 0;
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pboId[currentBuffer]);
+
+    // Orphan previous storage: if a transfer is still reading from it, the driver
+    // gives us a new memory block instead of synchronizing with the GPU
+    size = std::max(size, pboSize[currentBuffer]);
+    glBufferData(GL_PIXEL_UNPACK_BUFFER, size, nullptr, GL_STREAM_DRAW);
+    pboSize[currentBuffer] = size;
+
+#   if defined(GRAPHICS_API_OPENGL_21)
+        mapped = glMapBuffer(GL_PIXEL_UNPACK_BUFFER, GL_WRITE_ONLY);
+#   else
+        mapped = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+#   endif
+
+    if (mapped == nullptr)
+    {
+        TRACELOG(LogWarning, "PBO: [ID %i] Failed to map upload staging buffer", pboId[currentBuffer]);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    }
+
+#else
+
+    if (memory.size() < size) memory.resize(size);
+    mapped = memory.data();
+
+#endif
+
+    return mapped;
+}
+
+bool UploadBuffer::Unmap()
+{
+    bool valid = (mapped != nullptr);
+    mapped = nullptr;
+
+#if defined(RLGL_PIXEL_BUFFERS_SUPPORTED)
+
+    // NOTE: Buffer content can be lost while mapped (i.e. display mode change),
+    // in that case glUnmapBuffer() returns false and data must be uploaded again
+    if (valid) valid = (glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER) == GL_TRUE);
+
+#endif
+
+    return valid;
+}
+
+void UploadBuffer::Unbind() const
+{
+#if defined(RLGL_PIXEL_BUFFERS_SUPPORTED)
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+#endif
+}
+
+const void *UploadBuffer::GetPixels() const
+{
+#if defined(RLGL_PIXEL_BUFFERS_SUPPORTED)
+    return nullptr;     // Offset 0 into the bound GL_PIXEL_UNPACK_BUFFER
+#else
+    return memory.data();
+#endif
+}
+
+/* READBACK IMPLEMENTATION */
+
+bool Readback::IsValid() const
+{
+    return (owner != nullptr) && (owner->slots[slot].serial == serial);
+}
+
+bool Readback::IsReady() const
+{
+    return IsValid() && owner->Poll(slot, serial);
+}
+
+bool Readback::Resolve(void *dest)
+{
+    if (!IsValid()) return false;
+
+    bool result = owner->Resolve(slot, serial, dest);
+    owner = nullptr;
+
+    return result;
+}
+
+std::vector<uint8_t> Readback::Resolve()
+{
+    std::vector<uint8_t> data;
+
+    if (IsValid())
+    {
+        data.resize(GetDataSize());
+        if (!Resolve(data.data())) data.clear();
+    }
+
+    return data;
+}
+
+int Readback::GetWidth() const
+{
+    return IsValid() ? owner->slots[slot].width : 0;
+}
+
+int Readback::GetHeight() const
+{
+    return IsValid() ? owner->slots[slot].height : 0;
+}
+
+uint32_t Readback::GetDataSize() const
+{
+    return IsValid() ? owner->slots[slot].rowSize*owner->slots[slot].height : 0;
+}
+
+/* READBACK BUFFER IMPLEMENTATION */
+
+ReadbackBuffer::ReadbackBuffer(int numBuffers)
+: slots(std::max(numBuffers, 1)), currentSlot(0), serialCounter(0)
+{
+#if defined(RLGL_PIXEL_BUFFERS_SUPPORTED)
+
+    for (auto &slot : slots) glGenBuffers(1, &slot.pboId);
+
+    TRACELOG(LogInfo, "PBO: %i readback staging buffers loaded successfully", static_cast<int>(slots.size()));
+
+#endif
+}
+
+ReadbackBuffer::~ReadbackBuffer()
+{
+    for (int i = 0; i < static_cast<int>(slots.size()); i++)
+    {
+        Release(i);
+
+#   if defined(RLGL_PIXEL_BUFFERS_SUPPORTED)
+        glDeleteBuffers(1, &slots[i].pboId);
+#   endif
+    }
+}
+
+Readback ReadbackBuffer::ReadPixels(int x, int y, int width, int height, uint32_t glFormat, uint32_t glType, int pixelSize, bool flipY, bool opaque)
+{
+    // Move to the next slot of the ring, a pending readback in it is dropped
+    if ((++currentSlot) >= static_cast<int>(slots.size())) currentSlot = 0;
+    Slot &slot = slots[currentSlot];
+
+    Release(currentSlot);
+
+    const int rowSize = width*pixelSize;
+    const uint32_t size = rowSize*height;
+
+    // Staging rows are tightly packed, the application pack alignment is restored after the read
+    int prevPackAlignment = 4;
+    glGetIntegerv(GL_PACK_ALIGNMENT, &prevPackAlignment);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+
+#if defined(RLGL_PIXEL_BUFFERS_SUPPORTED)
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pboId);
+
+    // NOTE: Storage is only reallocated when growing, the fence of the slot
+    // guarantees the previous copy into it is done before it is reused
+    if (slot.capacity < size)
+    {
+        glBufferData(GL_PIXEL_PACK_BUFFER, size, nullptr, GL_STREAM_READ);
+        slot.capacity = size;
+    }
+
+    // With a pixel pack buffer bound, the data pointer is an offset into the buffer
+    // and the function returns without waiting for the GPU to finish the rendering
+    glReadPixels(x, y, width, height, glFormat, glType, nullptr);
+
+#   if defined(RLGL_FENCE_SYNC_SUPPORTED)
+        slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+#   endif
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+#else
+
+    if (slot.memory.size() < size) slot.memory.resize(size);
+    glReadPixels(x, y, width, height, glFormat, glType, slot.memory.data());
+
+#endif
+
+    glPixelStorei(GL_PACK_ALIGNMENT, prevPackAlignment);
+
+    return Push(width, height, rowSize, flipY, opaque);
+}
+
+Readback ReadbackBuffer::ReadBuffer(uint32_t bufferId, uint32_t offset, uint32_t size)
+{
+#if defined(RLGL_PIXEL_BUFFERS_SUPPORTED)
+
+    if ((++currentSlot) >= static_cast<int>(slots.size())) currentSlot = 0;
+    Slot &slot = slots[currentSlot];
+
+    Release(currentSlot);
+
+    glBindBuffer(GL_COPY_READ_BUFFER, bufferId);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, slot.pboId);
+
+    if (slot.capacity < size)
+    {
+        glBufferData(GL_COPY_WRITE_BUFFER, size, nullptr, GL_STREAM_READ);
+        slot.capacity = size;
+    }
+
+    // The copy is queued on the GPU, the CPU only waits on resolve if the fence is not signaled yet
+    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, offset, 0, size);
+
+#   if defined(RLGL_FENCE_SYNC_SUPPORTED)
+        slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+#   endif
+
+    glBindBuffer(GL_COPY_READ_BUFFER, 0);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+    return Push(static_cast<int>(size), 1, static_cast<int>(size), false, false);
+
+#else
+
+    TRACELOG(LogWarning, "PBO: [ID %i] Buffer readback not supported", bufferId);
+    return Readback();
+
+#endif
+}
+
+Readback ReadbackBuffer::Push(int width, int height, int rowSize, bool flipY, bool opaque)
+{
+    Slot &slot = slots[currentSlot];
+
+    if ((++serialCounter) == 0) serialCounter = 1;      // Zero is reserved for free slots
+
+    slot.serial = serialCounter;
+    slot.width = width;
+    slot.height = height;
+    slot.rowSize = rowSize;
+    slot.flipY = flipY;
+    slot.opaque = opaque;
+
+    Readback readback;
+    readback.owner = this;
+    readback.slot = currentSlot;
+    readback.serial = slot.serial;
+
+    return readback;
+}
+
+bool ReadbackBuffer::Poll(int slot, uint32_t serial) const
+{
+    if (slots[slot].serial != serial) return false;
+
+#if defined(RLGL_FENCE_SYNC_SUPPORTED)
+
+    if (slots[slot].fence != nullptr)
+    {
+        // NOTE: Timeout of zero only checks the fence status, it never blocks
+        GLenum status = glClientWaitSync(static_cast<GLsync>(slots[slot].fence), 0, 0);
+        return (status == GL_ALREADY_SIGNALED) || (status == GL_CONDITION_SATISFIED);
+    }
+
+#endif
+
+    return true;
+}
+
+bool ReadbackBuffer::Resolve(int slot, uint32_t serial, void *dest)
+{
+    Slot &s = slots[slot];
+    if (s.serial != serial) return false;
+
+    bool result = true;
+    const uint8_t *src = nullptr;
+
+#if defined(RLGL_PIXEL_BUFFERS_SUPPORTED)
+
+#   if defined(RLGL_FENCE_SYNC_SUPPORTED)
+        if (s.fence != nullptr)
+        {
+            // Flush the command stream on the first try so the fence is guaranteed to signal,
+            // then wait by steps of 1ms up to the timeout (the fence never signals on a lost context)
+            GLenum status = glClientWaitSync(static_cast<GLsync>(s.fence), GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+            for (int i = 0; (i < RL_READBACK_FENCE_TIMEOUT) && (status == GL_TIMEOUT_EXPIRED); i++)
+            {
+                status = glClientWaitSync(static_cast<GLsync>(s.fence), 0, 1000000);
+            }
+
+            if ((status == GL_TIMEOUT_EXPIRED) || (status == GL_WAIT_FAILED))
+            {
+                TRACELOG(LogWarning, "PBO: [ID %i] Failed to wait for readback fence", s.pboId);
+                Release(slot);
+                return false;
+            }
+        }
+#   endif
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, s.pboId);
+
+#   if defined(GRAPHICS_API_OPENGL_21)
+        src = static_cast<const uint8_t*>(glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY));
+#   else
+        src = static_cast<const uint8_t*>(glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, s.rowSize*s.height, GL_MAP_READ_BIT));
+#   endif
+
+    if (src == nullptr)
+    {
+        TRACELOG(LogWarning, "PBO: [ID %i] Failed to map readback staging buffer", s.pboId);
+        result = false;
+    }
+
+#else
+
+    src = s.memory.data();
+
+#endif
+
+    if (src != nullptr)
+    {
+        uint8_t *dst = static_cast<uint8_t*>(dest);
+
+        // NOTE: glReadPixels returns image flipped vertically -> (0,0) is the bottom left corner of the framebuffer
+        if (s.flipY) CopyPixelsFlipped(dst, src, s.rowSize, s.height);
+        else std::memcpy(dst, src, s.rowSize*s.height);
+
+        // Set alpha component value to 255 (no trasparent image retrieval)
+        if (s.opaque) SetPixelsOpaque(dst, s.width*s.height);
+    }
+
+#if defined(RLGL_PIXEL_BUFFERS_SUPPORTED)
+
+    if (src != nullptr) glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+#endif
+
+    Release(slot);
+
+    return result;
+}
+
+void ReadbackBuffer::Release(int slot)
+{
+#if defined(RLGL_FENCE_SYNC_SUPPORTED)
+
+    if (slots[slot].fence != nullptr)
+    {
+        glDeleteSync(static_cast<GLsync>(slots[slot].fence));
+        slots[slot].fence = nullptr;
+    }
+
+#endif
+
+    slots[slot].serial = 0;
+}
@@ -0,0 +1,312 @@
+#include "rlTextureAtlas.hpp"
+#include "rlUtils.hpp"
+#include "rlgl.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace rlgl;
+
+/* TEXTURE ATLAS IMPLEMENTATION */
+
+TextureAtlas::TextureAtlas(Context& rlCtx, int pageSize, int maxPages, PixelFormat format, int padding)
+: rlCtx(&rlCtx), format(format), pageSize(std::max(pageSize, 1)), maxPages(std::max(maxPages, 1))
+, padding(std::max(padding, 0)), frameCounter(0), evictionCount(0)
+{
+    if (format >= PixelFormat::DXT1_RGB)
+    {
+        TRACELOG(LogWarning, "ATLAS: Compressed pixel formats are not supported, using R8G8B8A8");
+        this->format = PixelFormat::R8G8B8A8;
+    }
+}
+
+TextureAtlas::~TextureAtlas()
+{
+    Clear();
+}
+
+TextureAtlas::TextureAtlas(TextureAtlas&& other) noexcept
+: rlCtx(other.rlCtx), pages(std::move(other.pages)), entries(std::move(other.entries))
+, uploadBuffer(std::move(other.uploadBuffer)), format(other.format), pageSize(other.pageSize)
+, maxPages(other.maxPages), padding(other.padding), frameCounter(other.frameCounter)
+, evictionCount(other.evictionCount)
+{
+    other.pages.clear();
+    other.entries.clear();
+}
+
+TextureAtlas& TextureAtlas::operator=(TextureAtlas&& other) noexcept
+{
+    if (this != &other)
+    {
+        Clear();
+
+        rlCtx = other.rlCtx;
+        pages = std::move(other.pages);
+        entries = std::move(other.entries);
+        uploadBuffer = std::move(other.uploadBuffer);
+        format = other.format;
+        pageSize = other.pageSize;
+        maxPages = other.maxPages;
+        padding = other.padding;
+        frameCounter = other.frameCounter;
+        evictionCount = other.evictionCount;
+
+        other.pages.clear();
+        other.entries.clear();
+    }
+    return *this;
+}
+
+AtlasRegion TextureAtlas::Insert(uint64_t key, int width, int height, const void *pixels)
+{
+    if (entries.find(key) != entries.end()) return Find(key);
+
+    const int paddedWidth = width + 2*padding;
+    const int paddedHeight = height + 2*padding;
+
+    if ((pixels == nullptr) || (width <= 0) || (height <= 0) || (paddedWidth > pageSize) || (paddedHeight > pageSize))
+    {
+        TRACELOG(LogWarning, "ATLAS: Image size not valid (%ix%i, page size: %i)", width, height, pageSize);
+        return AtlasRegion();
+    }
+
+    int pageIndex = -1;
+    int x = 0, y = 0;
+
+    // Try the existing pages first
+    for (int i = 0; i < static_cast<int>(pages.size()); i++)
+    {
+        if (PackRect(pages[i], paddedWidth, paddedHeight, &x, &y)) { pageIndex = i; break; }
+    }
+
+    // Load a new page if allowed, clear the least recently used page otherwise
+    if (pageIndex < 0)
+    {
+        if (static_cast<int>(pages.size()) < maxPages)
+        {
+            Page page;
+            page.textureId = rlCtx->LoadTexture(nullptr, pageSize, pageSize, format, 1);
+            if (page.textureId == 0) return AtlasRegion();
+
+            rlCtx->TextureParameters(page.textureId, TextureParam::Wrap_S, TextureWrap::Clamp);
+            rlCtx->TextureParameters(page.textureId, TextureParam::Wrap_T, TextureWrap::Clamp);
+            page.skyline.push_back({ 0, 0, pageSize });
+
+            pages.push_back(std::move(page));
+            pageIndex = static_cast<int>(pages.size()) - 1;
+        }
+        else
+        {
+            for (int i = 0; i < static_cast<int>(pages.size()); i++)
+            {
+                if (pages[i].lastFrame >= frameCounter) continue;
+                if ((pageIndex < 0) || (pages[i].lastFrame < pages[pageIndex].lastFrame)) pageIndex = i;
+            }
+
+            if (pageIndex < 0)
+            {
+                TRACELOG(LogWarning, "ATLAS: All pages are used during the current frame, image not inserted");
+                return AtlasRegion();
+            }
+
+            ResetPage(pageIndex);
+            evictionCount++;
+        }
+
+        PackRect(pages[pageIndex], paddedWidth, paddedHeight, &x, &y);
+    }
+
+    Page& page = pages[pageIndex];
+
+    // Copy the image with its edges repeated in the padding
+    const int pixelSize = GetPixelDataSize(1, 1, format);
+    const uint8_t *src = static_cast<const uint8_t*>(pixels);
+    const uint8_t *uploadData = src;
+
+    if (padding > 0)
+    {
+        uploadBuffer.resize(static_cast<std::size_t>(paddedWidth)*paddedHeight*pixelSize);
+
+        for (int j = 0; j < paddedHeight; j++)
+        {
+            const int srcY = std::min(std::max(j - padding, 0), height - 1);
+            const uint8_t *srcRow = src + static_cast<std::size_t>(srcY)*width*pixelSize;
+            uint8_t *dstRow = uploadBuffer.data() + static_cast<std::size_t>(j)*paddedWidth*pixelSize;
+
+            for (int i = 0; i < padding; i++)
+            {
+                std::memcpy(dstRow + i*pixelSize, srcRow, pixelSize);
+                std::memcpy(dstRow + (padding + width + i)*pixelSize, srcRow + (width - 1)*pixelSize, pixelSize);
+            }
+
+            std::memcpy(dstRow + padding*pixelSize, srcRow, static_cast<std::size_t>(width)*pixelSize);
+        }
+
+        uploadData = uploadBuffer.data();
+    }
+
+    rlCtx->UpdateTextureAsync(page.textureId, x, y, paddedWidth, paddedHeight, format, uploadData);
+
+    Entry entry;
+    entry.page = pageIndex;
+    entry.region.textureId = page.textureId;
+    entry.region.x = x + padding;
+    entry.region.y = y + padding;
+    entry.region.width = width;
+    entry.region.height = height;
+    entry.region.u0 = static_cast<float>(entry.region.x)/pageSize;
+    entry.region.v0 = static_cast<float>(entry.region.y)/pageSize;
+    entry.region.u1 = static_cast<float>(entry.region.x + width)/pageSize;
+    entry.region.v1 = static_cast<float>(entry.region.y + height)/pageSize;
+
+    page.entryCount++;
+    page.usedArea += static_cast<std::size_t>(paddedWidth)*paddedHeight;
+    page.lastFrame = frameCounter;
+
+    entries[key] = entry;
+
+    return entry.region;
+}
+
+AtlasRegion TextureAtlas::Find(uint64_t key)
+{
+    auto it = entries.find(key);
+    if (it == entries.end()) return AtlasRegion();
+
+    pages[it->second.page].lastFrame = frameCounter;
+
+    return it->second.region;
+}
+
+void TextureAtlas::Remove(uint64_t key)
+{
+    auto it = entries.find(key);
+    if (it == entries.end()) return;
+
+    Page& page = pages[it->second.page];
+    page.entryCount--;
+    page.usedArea -= static_cast<std::size_t>(it->second.region.width + 2*padding)*(it->second.region.height + 2*padding);
+
+    entries.erase(it);
+
+    // Empty pages are packed again from scratch
+    if (page.entryCount == 0) page.skyline.assign(1, { 0, 0, pageSize });
+}
+
+void TextureAtlas::EndFrame()
+{
+    frameCounter++;
+}
+
+void TextureAtlas::Clear()
+{
+    for (const Page& page : pages) rlCtx->UnloadTexture(page.textureId);
+
+    pages.clear();
+    entries.clear();
+}
+
+float TextureAtlas::GetOccupancy() const
+{
+    if (pages.empty()) return 0.0f;
+
+    std::size_t usedArea = 0;
+    for (const Page& page : pages) usedArea += page.usedArea;
+
+    return static_cast<float>(usedArea)/(static_cast<float>(pageSize)*pageSize*pages.size());
+}
+
+// Pack a rectangle in a page (skyline bottom-left, best fit)
+bool TextureAtlas::PackRect(Page& page, int width, int height, int *x, int *y)
+{
+    int bestIndex = -1;
+    int bestX = 0, bestY = pageSize + 1, bestWidth = pageSize + 1;
+
+    for (int i = 0; i < static_cast<int>(page.skyline.size()); i++)
+    {
+        const int top = FindSkylinePosition(page, i, width, height);
+        if (top < 0) continue;
+
+        // Lowest top edge first, then narrowest segment to limit wasted space
+        if ((top + height < bestY) || ((top + height == bestY) && (page.skyline[i].width < bestWidth)))
+        {
+            bestIndex = i;
+            bestX = page.skyline[i].x;
+            bestY = top + height;
+            bestWidth = page.skyline[i].width;
+        }
+    }
+
+    if (bestIndex < 0) return false;
+
+    // Insert the new segment and shrink the segments below it
+    page.skyline.insert(page.skyline.begin() + bestIndex, { bestX, bestY, width });
+
+    for (int i = bestIndex + 1; i < static_cast<int>(page.skyline.size()); i++)
+    {
+        SkylineNode& node = page.skyline[i];
+        const int previousEnd = page.skyline[i - 1].x + page.skyline[i - 1].width;
+
+        if (node.x >= previousEnd) break;
+
+        const int shrink = previousEnd - node.x;
+        node.x += shrink;
+        node.width -= shrink;
+
+        if (node.width > 0) break;
+
+        page.skyline.erase(page.skyline.begin() + i);
+        i--;
+    }
+
+    // Merge segments at the same height
+    for (int i = 0; i < static_cast<int>(page.skyline.size()) - 1; i++)
+    {
+        if (page.skyline[i].y == page.skyline[i + 1].y)
+        {
+            page.skyline[i].width += page.skyline[i + 1].width;
+            page.skyline.erase(page.skyline.begin() + i + 1);
+            i--;
+        }
+    }
+
+    *x = bestX;
+    *y = bestY - height;
+
+    return true;
+}
+
+// Get the top of a rectangle placed at a skyline segment, -1 if it does not fit
+int TextureAtlas::FindSkylinePosition(const Page& page, int index, int width, int height) const
+{
+    const int x = page.skyline[index].x;
+    if (x + width > pageSize) return -1;
+
+    int y = page.skyline[index].y;
+    int remaining = width;
+
+    for (int i = index; (remaining > 0) && (i < static_cast<int>(page.skyline.size())); i++)
+    {
+        y = std::max(y, page.skyline[i].y);
+        if (y + height > pageSize) return -1;
+
+        remaining -= page.skyline[i].width;
+    }
+
+    return y;
+}
+
+// Remove all the images of a page and reset its skyline
+void TextureAtlas::ResetPage(int index)
+{
+    for (auto it = entries.begin(); it != entries.end();)
+    {
+        if (it->second.page == index) it = entries.erase(it);
+        else ++it;
+    }
+
+    pages[index].skyline.assign(1, { 0, 0, pageSize });
+    pages[index].entryCount = 0;
+    pages[index].usedArea = 0;
+}
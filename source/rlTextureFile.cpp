@@ -0,0 +1,651 @@
+#include "rlTextureFile.hpp"
+#include "rlConfig.hpp"
+#include "rlMipmaps.hpp"
+#include "rlUtils.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(_WIN32)
+#   ifndef WIN32_LEAN_AND_MEAN
+#       define WIN32_LEAN_AND_MEAN
+#   endif
+#   ifndef NOMINMAX
+#       define NOMINMAX
+#   endif
+#   include <windows.h>
+#else
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+using namespace rlgl;
+
+namespace {
+
+    // KTX2 file identifier and header layout
+    constexpr uint8_t KTX2_IDENTIFIER[12] = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+    constexpr size_t KTX2_HEADER_SIZE = 80;         // Identifier, header and index (level index follows)
+    constexpr size_t KTX2_LEVEL_SIZE = 24;          // byteOffset, byteLength, uncompressedByteLength (uint64)
+
+    // DDS header layout (offsets from the start of the file, after the "DDS " magic)
+    constexpr size_t DDS_HEADER_SIZE = 128;         // Magic and DDS_HEADER
+    constexpr size_t DDS_HEADER_DX10_SIZE = 20;     // DDS_HEADER_DXT10
+
+    // Largest dimension accepted from a file header, sizes are validated before any level size is computed
+    constexpr uint32_t MAX_TEXTURE_FILE_SIZE = 32768;
+
+    constexpr uint32_t DDSD_PITCH = 0x8;
+    constexpr uint32_t DDSD_MIPMAPCOUNT = 0x20000;
+    constexpr uint32_t DDPF_ALPHAPIXELS = 0x1;
+    constexpr uint32_t DDPF_FOURCC = 0x4;
+    constexpr uint32_t DDPF_RGB = 0x40;
+    constexpr uint32_t DDPF_LUMINANCE = 0x20000;
+    constexpr uint32_t DDSCAPS2_CUBEMAP = 0x200;
+    constexpr uint32_t DDSCAPS2_VOLUME = 0x200000;
+
+    //----------------------------------------------------------------------------------
+
+    uint32_t ReadU32(const uint8_t *data)
+    {
+        uint32_t value;
+        std::memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    uint64_t ReadU64(const uint8_t *data)
+    {
+        uint64_t value;
+        std::memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    constexpr uint32_t FourCC(char a, char b, char c, char d)
+    {
+        return static_cast<uint32_t>(a) | (static_cast<uint32_t>(b) << 8) | (static_cast<uint32_t>(c) << 16) | (static_cast<uint32_t>(d) << 24);
+    }
+
+    //----------------------------------------------------------------------------------
+
+    // Get the pixel format of a Vulkan format (KTX2)
+    bool GetVulkanFormat(uint32_t vkFormat, PixelFormat *format, bool *srgb)
+    {
+        *srgb = false;
+
+        switch (vkFormat)
+        {
+            case 2: *format = PixelFormat::R4G4B4A4; break;         // VK_FORMAT_R4G4B4A4_UNORM_PACK16
+            case 4: *format = PixelFormat::R5G6B5; break;           // VK_FORMAT_R5G6B5_UNORM_PACK16
+            case 6: *format = PixelFormat::R5G5B5A1; break;         // VK_FORMAT_R5G5B5A1_UNORM_PACK16
+            case 9: *format = PixelFormat::Grayscale; break;        // VK_FORMAT_R8_UNORM
+            case 16: *format = PixelFormat::GrayAlpha; break;       // VK_FORMAT_R8G8_UNORM
+            case 23: *format = PixelFormat::R8G8B8; break;          // VK_FORMAT_R8G8B8_UNORM
+            case 29: *format = PixelFormat::R8G8B8; *srgb = true; break;
+            case 37: *format = PixelFormat::R8G8B8A8; break;        // VK_FORMAT_R8G8B8A8_UNORM
+            case 43: *format = PixelFormat::R8G8B8A8; *srgb = true; break;
+            case 76: *format = PixelFormat::R16; break;             // VK_FORMAT_R16_SFLOAT
+            case 90: *format = PixelFormat::R16G16B16; break;       // VK_FORMAT_R16G16B16_SFLOAT
+            case 97: *format = PixelFormat::R16G16B16A16; break;    // VK_FORMAT_R16G16B16A16_SFLOAT
+            case 100: *format = PixelFormat::R32; break;            // VK_FORMAT_R32_SFLOAT
+            case 106: *format = PixelFormat::R32G32B32; break;      // VK_FORMAT_R32G32B32_SFLOAT
+            case 109: *format = PixelFormat::R32G32B32A32; break;   // VK_FORMAT_R32G32B32A32_SFLOAT
+            case 131: *format = PixelFormat::DXT1_RGB; break;       // VK_FORMAT_BC1_RGB_UNORM_BLOCK
+            case 132: *format = PixelFormat::DXT1_RGB; *srgb = true; break;
+            case 133: *format = PixelFormat::DXT1_RGBA; break;      // VK_FORMAT_BC1_RGBA_UNORM_BLOCK
+            case 134: *format = PixelFormat::DXT1_RGBA; *srgb = true; break;
+            case 135: *format = PixelFormat::DXT3_RGBA; break;      // VK_FORMAT_BC2_UNORM_BLOCK
+            case 136: *format = PixelFormat::DXT3_RGBA; *srgb = true; break;
+            case 137: *format = PixelFormat::DXT5_RGBA; break;      // VK_FORMAT_BC3_UNORM_BLOCK
+            case 138: *format = PixelFormat::DXT5_RGBA; *srgb = true; break;
+            case 147: *format = PixelFormat::ETC2_RGB; break;       // VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK
+            case 148: *format = PixelFormat::ETC2_RGB; *srgb = true; break;
+            case 151: *format = PixelFormat::ETC2_EAC_RGBA; break;  // VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK
+            case 152: *format = PixelFormat::ETC2_EAC_RGBA; *srgb = true; break;
+            case 157: *format = PixelFormat::ASTC_4x4_RGBA; break;  // VK_FORMAT_ASTC_4x4_UNORM_BLOCK
+            case 158: *format = PixelFormat::ASTC_4x4_RGBA; *srgb = true; break;
+            case 171: *format = PixelFormat::ASTC_8x8_RGBA; break;  // VK_FORMAT_ASTC_8x8_UNORM_BLOCK
+            case 172: *format = PixelFormat::ASTC_8x8_RGBA; *srgb = true; break;
+            default: return false;
+        }
+
+        return true;
+    }
+
+    // Get the pixel format of a DXGI format (DDS DX10 header)
+    bool GetDxgiFormat(uint32_t dxgiFormat, PixelFormat *format, bool *srgb)
+    {
+        *srgb = false;
+
+        switch (dxgiFormat)
+        {
+            case 2: *format = PixelFormat::R32G32B32A32; break;     // DXGI_FORMAT_R32G32B32A32_FLOAT
+            case 6: *format = PixelFormat::R32G32B32; break;        // DXGI_FORMAT_R32G32B32_FLOAT
+            case 10: *format = PixelFormat::R16G16B16A16; break;    // DXGI_FORMAT_R16G16B16A16_FLOAT
+            case 28: *format = PixelFormat::R8G8B8A8; break;        // DXGI_FORMAT_R8G8B8A8_UNORM
+            case 29: *format = PixelFormat::R8G8B8A8; *srgb = true; break;
+            case 41: *format = PixelFormat::R32; break;             // DXGI_FORMAT_R32_FLOAT
+            case 49: *format = PixelFormat::GrayAlpha; break;       // DXGI_FORMAT_R8G8_UNORM
+            case 54: *format = PixelFormat::R16; break;             // DXGI_FORMAT_R16_FLOAT
+            case 61: *format = PixelFormat::Grayscale; break;       // DXGI_FORMAT_R8_UNORM
+            case 71: *format = PixelFormat::DXT1_RGBA; break;       // DXGI_FORMAT_BC1_UNORM
+            case 72: *format = PixelFormat::DXT1_RGBA; *srgb = true; break;
+            case 74: *format = PixelFormat::DXT3_RGBA; break;       // DXGI_FORMAT_BC2_UNORM
+            case 75: *format = PixelFormat::DXT3_RGBA; *srgb = true; break;
+            case 77: *format = PixelFormat::DXT5_RGBA; break;       // DXGI_FORMAT_BC3_UNORM
+            case 78: *format = PixelFormat::DXT5_RGBA; *srgb = true; break;
+            case 85: *format = PixelFormat::R5G6B5; break;          // DXGI_FORMAT_B5G6R5_UNORM (same bit layout)
+            default: return false;
+        }
+
+        return true;
+    }
+
+    // Map a read-only view of a file
+    void *MapFile(const char *fileName, size_t *size)
+    {
+        void *mapped = nullptr;
+        *size = 0;
+
+#   if defined(_WIN32)
+        HANDLE file = CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return nullptr;
+
+        LARGE_INTEGER fileSize;
+        if (GetFileSizeEx(file, &fileSize) && (fileSize.QuadPart > 0))
+        {
+            HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+            if (mapping != nullptr)
+            {
+                // NOTE: The view keeps a reference to the mapping object, handles can be closed
+                mapped = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                if (mapped != nullptr) *size = static_cast<size_t>(fileSize.QuadPart);
+                CloseHandle(mapping);
+            }
+        }
+
+        CloseHandle(file);
+#   else
+        int fd = open(fileName, O_RDONLY);
+        if (fd < 0) return nullptr;
+
+        struct stat st;
+        if ((fstat(fd, &st) == 0) && (st.st_size > 0))
+        {
+            mapped = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+
+            if (mapped == MAP_FAILED) mapped = nullptr;
+            else
+            {
+                *size = static_cast<size_t>(st.st_size);
+
+                // Levels are read once from the first to the last page
+                madvise(mapped, *size, MADV_SEQUENTIAL);
+            }
+        }
+
+        // NOTE: The mapping stays valid after closing the file descriptor
+        close(fd);
+#   endif
+
+        return mapped;
+    }
+
+    void UnmapFile(void *mapped, size_t size)
+    {
+#   if defined(_WIN32)
+        (void)size;
+        UnmapViewOfFile(mapped);
+#   else
+        munmap(mapped, size);
+#   endif
+    }
+
+}
+
+/* TEXTURE FILE IMPLEMENTATION */
+
+TextureFile::TextureFile(const char *fileName)
+{
+    Load(fileName);
+}
+
+TextureFile::~TextureFile()
+{
+    Unload();
+}
+
+TextureFile::TextureFile(TextureFile&& other) noexcept
+    : mapped(other.mapped)
+    , mappedSize(other.mappedSize)
+    , levels(std::move(other.levels))
+    , levelSizes(std::move(other.levelSizes))
+    , converted(std::move(other.converted))
+    , width(other.width)
+    , height(other.height)
+    , format(other.format)
+    , srgb(other.srgb)
+{
+    other.mapped = nullptr;
+    other.mappedSize = 0;
+    other.Unload();
+}
+
+TextureFile& TextureFile::operator=(TextureFile&& other) noexcept
+{
+    if (this != &other)
+    {
+        Unload();
+
+        mapped = other.mapped;
+        mappedSize = other.mappedSize;
+        levels = std::move(other.levels);
+        levelSizes = std::move(other.levelSizes);
+        converted = std::move(other.converted);
+        width = other.width;
+        height = other.height;
+        format = other.format;
+        srgb = other.srgb;
+
+        other.mapped = nullptr;
+        other.mappedSize = 0;
+        other.Unload();
+    }
+
+    return *this;
+}
+
+bool TextureFile::Load(const char *fileName)
+{
+    Unload();
+
+    size_t size = 0;
+    void *data = MapFile(fileName, &size);
+
+    if (data == nullptr)
+    {
+        TRACELOG(LogWarning, "FILEIO: [%s] Failed to map texture file", fileName);
+        return false;
+    }
+
+    mapped = data;
+    mappedSize = size;
+
+    if (!LoadFromMemory(data, size))
+    {
+        TRACELOG(LogWarning, "FILEIO: [%s] Failed to load texture file", fileName);
+        Unload();
+        return false;
+    }
+
+    // Converted pixels do not refer to the file anymore
+    if (!converted.empty())
+    {
+        UnmapFile(mapped, mappedSize);
+        mapped = nullptr;
+        mappedSize = 0;
+    }
+
+    TRACELOG(LogInfo, "FILEIO: [%s] Texture file loaded successfully (%ix%i | %s | %i mipmaps)", fileName, width, height, GetPixelFormatName(format), GetMipmapCount());
+
+    return true;
+}
+
+bool TextureFile::LoadFromMemory(const void *data, size_t size)
+{
+    levels.clear();
+    levelSizes.clear();
+    converted.clear();
+
+    const uint8_t *bytes = static_cast<const uint8_t*>(data);
+    if (bytes == nullptr) return false;
+
+    bool result = false;
+
+    if ((size >= sizeof(KTX2_IDENTIFIER)) && (std::memcmp(bytes, KTX2_IDENTIFIER, sizeof(KTX2_IDENTIFIER)) == 0)) result = ParseKTX2(bytes, size);
+    else if ((size >= 4) && (ReadU32(bytes) == FourCC('D', 'D', 'S', ' '))) result = ParseDDS(bytes, size);
+    else TRACELOG(LogWarning, "TEXTURE: Unknown texture container, only KTX2 and DDS are supported");
+
+    if (!result)
+    {
+        levels.clear();
+        levelSizes.clear();
+        converted.clear();
+    }
+
+    return result;
+}
+
+void TextureFile::Unload()
+{
+    if (mapped != nullptr) UnmapFile(mapped, mappedSize);
+
+    mapped = nullptr;
+    mappedSize = 0;
+
+    levels.clear();
+    levelSizes.clear();
+    converted.clear();
+    converted.shrink_to_fit();
+
+    width = 0;
+    height = 0;
+    format = PixelFormat::R8G8B8A8;
+    srgb = false;
+}
+
+const void *TextureFile::GetLevelData(int level) const
+{
+    return ((level >= 0) && (level < GetMipmapCount()))? levels[level] : nullptr;
+}
+
+uint32_t TextureFile::GetLevelSize(int level) const
+{
+    return ((level >= 0) && (level < GetMipmapCount()))? levelSizes[level] : 0;
+}
+
+// Parse a KTX2 container
+// NOTE: Levels are stored from the smallest to the base level, offsets are read from the level index
+bool TextureFile::ParseKTX2(const uint8_t *data, size_t size)
+{
+    if (size < KTX2_HEADER_SIZE)
+    {
+        TRACELOG(LogWarning, "TEXTURE: KTX2 file is truncated");
+        return false;
+    }
+
+    const uint32_t vkFormat = ReadU32(data + 12);
+    const uint32_t pixelWidth = ReadU32(data + 20);
+    const uint32_t pixelHeight = ReadU32(data + 24);
+    const uint32_t pixelDepth = ReadU32(data + 28);
+    const uint32_t layerCount = ReadU32(data + 32);
+    const uint32_t faceCount = ReadU32(data + 36);
+    const uint32_t levelCount = std::max(ReadU32(data + 40), 1u);     // Zero means mipmaps have to be generated
+    const uint32_t supercompression = ReadU32(data + 44);
+
+    if (supercompression != 0)
+    {
+        TRACELOG(LogWarning, "TEXTURE: KTX2 supercompression scheme %i not supported", supercompression);
+        return false;
+    }
+
+    if ((pixelWidth == 0) || (pixelHeight == 0) || (pixelDepth > 1) || (layerCount > 1) || (faceCount != 1))
+    {
+        TRACELOG(LogWarning, "TEXTURE: KTX2 file is not a 2D texture (only 2D textures supported)");
+        return false;
+    }
+
+    if ((pixelWidth > MAX_TEXTURE_FILE_SIZE) || (pixelHeight > MAX_TEXTURE_FILE_SIZE))
+    {
+        TRACELOG(LogWarning, "TEXTURE: KTX2 texture size %ux%u is not supported", pixelWidth, pixelHeight);
+        return false;
+    }
+
+    if (!GetVulkanFormat(vkFormat, &format, &srgb))
+    {
+        TRACELOG(LogWarning, "TEXTURE: KTX2 format %i not supported", vkFormat);
+        return false;
+    }
+
+    width = static_cast<int>(pixelWidth);
+    height = static_cast<int>(pixelHeight);
+
+    if ((levelCount > static_cast<uint32_t>(rlgl::GetMipmapCount(width, height))) || (size < KTX2_HEADER_SIZE + static_cast<uint64_t>(levelCount)*KTX2_LEVEL_SIZE))
+    {
+        TRACELOG(LogWarning, "TEXTURE: KTX2 level index is not valid");
+        return false;
+    }
+
+    levels.resize(levelCount);
+    levelSizes.resize(levelCount);
+
+    for (uint32_t i = 0; i < levelCount; i++)
+    {
+        const uint8_t *entry = data + KTX2_HEADER_SIZE + i*KTX2_LEVEL_SIZE;
+        const uint64_t byteOffset = ReadU64(entry);
+        const uint64_t byteLength = ReadU64(entry + 8);
+
+        const uint64_t levelSize = static_cast<uint64_t>(GetPixelDataSize(std::max(width >> i, 1), std::max(height >> i, 1), format));
+
+        if ((levelSize == 0) || (byteLength < levelSize) || (byteOffset > size) || (levelSize > size - byteOffset))
+        {
+            TRACELOG(LogWarning, "TEXTURE: KTX2 mipmap level %i is out of the file", i);
+            return false;
+        }
+
+        levels[i] = data + byteOffset;
+        levelSizes[i] = static_cast<uint32_t>(levelSize);
+    }
+
+    return true;
+}
+
+// Parse a DDS container
+// NOTE: Levels are stored one after the other from the base level, uncompressed rows are expected to be tightly packed
+bool TextureFile::ParseDDS(const uint8_t *data, size_t size)
+{
+    if ((size < DDS_HEADER_SIZE) || (ReadU32(data + 4) != 124))
+    {
+        TRACELOG(LogWarning, "TEXTURE: DDS file header is not valid");
+        return false;
+    }
+
+    const uint32_t flags = ReadU32(data + 8);
+    const uint32_t pitch = ReadU32(data + 20);
+    const uint32_t pfFlags = ReadU32(data + 80);
+    const uint32_t fourCC = ReadU32(data + 84);
+    const uint32_t bitCount = ReadU32(data + 88);
+    const uint32_t masks[4] = { ReadU32(data + 92), ReadU32(data + 96), ReadU32(data + 100), ReadU32(data + 104) };
+    const uint32_t caps2 = ReadU32(data + 112);
+
+    const uint32_t pixelHeight = ReadU32(data + 12);
+    const uint32_t pixelWidth = ReadU32(data + 16);
+    const uint32_t levelCount = (flags & DDSD_MIPMAPCOUNT)? std::max(ReadU32(data + 28), 1u) : 1;
+
+    if ((pixelWidth == 0) || (pixelHeight == 0) || (caps2 & (DDSCAPS2_CUBEMAP | DDSCAPS2_VOLUME)))
+    {
+        TRACELOG(LogWarning, "TEXTURE: DDS file is not a 2D texture (only 2D textures supported)");
+        return false;
+    }
+
+    if ((pixelWidth > MAX_TEXTURE_FILE_SIZE) || (pixelHeight > MAX_TEXTURE_FILE_SIZE))
+    {
+        TRACELOG(LogWarning, "TEXTURE: DDS texture size %ux%u is not supported", pixelWidth, pixelHeight);
+        return false;
+    }
+
+    width = static_cast<int>(pixelWidth);
+    height = static_cast<int>(pixelHeight);
+
+    if (levelCount > static_cast<uint32_t>(rlgl::GetMipmapCount(width, height)))
+    {
+        TRACELOG(LogWarning, "TEXTURE: DDS mipmap count is not valid");
+        return false;
+    }
+
+    const int mipmapCount = static_cast<int>(levelCount);
+
+    size_t offset = DDS_HEADER_SIZE;
+    srgb = false;
+
+    if (pfFlags & DDPF_FOURCC)
+    {
+        switch (fourCC)
+        {
+            case FourCC('D', 'X', 'T', '1'): format = (pfFlags & DDPF_ALPHAPIXELS)? PixelFormat::DXT1_RGBA : PixelFormat::DXT1_RGB; break;
+            case FourCC('D', 'X', 'T', '3'): format = PixelFormat::DXT3_RGBA; break;
+            case FourCC('D', 'X', 'T', '5'): format = PixelFormat::DXT5_RGBA; break;
+            case 111: format = PixelFormat::R16; break;             // D3DFMT_R16F
+            case 113: format = PixelFormat::R16G16B16A16; break;    // D3DFMT_A16B16G16R16F
+            case 114: format = PixelFormat::R32; break;             // D3DFMT_R32F
+            case 116: format = PixelFormat::R32G32B32A32; break;    // D3DFMT_A32B32G32R32F
+            case FourCC('D', 'X', '1', '0'):
+            {
+                if (size < DDS_HEADER_SIZE + DDS_HEADER_DX10_SIZE)
+                {
+                    TRACELOG(LogWarning, "TEXTURE: DDS file is truncated");
+                    return false;
+                }
+
+                const uint32_t dxgiFormat = ReadU32(data + 128);
+                const uint32_t dimension = ReadU32(data + 132);
+                const uint32_t miscFlag = ReadU32(data + 136);
+                const uint32_t arraySize = ReadU32(data + 140);
+
+                // NOTE: D3D10_RESOURCE_DIMENSION_TEXTURE2D and no DDS_RESOURCE_MISC_TEXTURECUBE
+                if ((dimension != 3) || (miscFlag & 0x4) || (arraySize > 1))
+                {
+                    TRACELOG(LogWarning, "TEXTURE: DDS file is not a 2D texture (only 2D textures supported)");
+                    return false;
+                }
+
+                if (!GetDxgiFormat(dxgiFormat, &format, &srgb))
+                {
+                    TRACELOG(LogWarning, "TEXTURE: DDS DXGI format %i not supported", dxgiFormat);
+                    return false;
+                }
+
+                offset += DDS_HEADER_DX10_SIZE;
+            } break;
+            default:
+            {
+                TRACELOG(LogWarning, "TEXTURE: DDS FourCC 0x%08x not supported", fourCC);
+                return false;
+            }
+        }
+    }
+    else if (pfFlags & (DDPF_RGB | DDPF_LUMINANCE))
+    {
+        const bool alpha = (pfFlags & DDPF_ALPHAPIXELS) != 0;
+        const uint32_t alphaMask = alpha? masks[3] : 0;
+        const uint32_t layoutMasks[4] = { masks[0], masks[1], masks[2], alphaMask };
+
+        if ((pfFlags & DDPF_LUMINANCE) && (bitCount == 8)) format = PixelFormat::Grayscale;
+        else if ((pfFlags & DDPF_LUMINANCE) && (bitCount == 16) && (masks[0] == 0xff) && (alphaMask == 0xff00)) format = PixelFormat::GrayAlpha;
+        else if ((bitCount == 16) && (masks[0] == 0xf800) && (masks[1] == 0x07e0) && (masks[2] == 0x001f)) format = PixelFormat::R5G6B5;
+        else if ((bitCount == 32) && (masks[0] == 0xff) && (masks[1] == 0xff00) && (masks[2] == 0xff0000) && (alphaMask == 0xff000000)) format = PixelFormat::R8G8B8A8;
+        else if ((bitCount == 24) && (masks[0] == 0xff) && (masks[1] == 0xff00) && (masks[2] == 0xff0000)) format = PixelFormat::R8G8B8;
+        else return ConvertDDS(data, size, offset, mipmapCount, static_cast<int>(bitCount), layoutMasks);
+    }
+    else
+    {
+        TRACELOG(LogWarning, "TEXTURE: DDS pixel format not supported");
+        return false;
+    }
+
+    if ((format < PixelFormat::DXT1_RGB) && (flags & DDSD_PITCH) && (pitch != static_cast<uint32_t>(GetPixelDataSize(width, 1, format))))
+    {
+        TRACELOG(LogWarning, "TEXTURE: DDS rows with padding not supported");
+        return false;
+    }
+
+    return SetLevels(data, size, offset, mipmapCount);
+}
+
+// Convert the BGR(A) layouts of a DDS file to the matching pixel format
+// NOTE: A zero alpha mask means the layout has no alpha, converted pixels are then opaque
+bool TextureFile::ConvertDDS(const uint8_t *data, size_t size, size_t offset, int levelCount, int bitCount, const uint32_t masks[4])
+{
+    enum class Layout { BGRA8, BGRX8, BGR8, A1R5G5B5, A4R4G4B4 } layout;
+
+    if ((bitCount == 32) && (masks[0] == 0xff0000) && (masks[1] == 0xff00) && (masks[2] == 0xff)) layout = (masks[3] == 0xff000000)? Layout::BGRA8 : Layout::BGRX8;
+    else if ((bitCount == 24) && (masks[0] == 0xff0000) && (masks[1] == 0xff00) && (masks[2] == 0xff)) layout = Layout::BGR8;
+    else if ((bitCount == 16) && (masks[0] == 0x7c00) && (masks[1] == 0x03e0) && (masks[2] == 0x001f)) layout = Layout::A1R5G5B5;
+    else if ((bitCount == 16) && (masks[0] == 0x0f00) && (masks[1] == 0x00f0) && (masks[2] == 0x000f)) layout = Layout::A4R4G4B4;
+    else
+    {
+        TRACELOG(LogWarning, "TEXTURE: DDS pixel layout not supported (%i bpp)", bitCount);
+        return false;
+    }
+
+    switch (layout)
+    {
+        case Layout::BGRA8:
+        case Layout::BGRX8: format = PixelFormat::R8G8B8A8; break;
+        case Layout::BGR8: format = PixelFormat::R8G8B8; break;
+        case Layout::A1R5G5B5: format = PixelFormat::R5G5B5A1; break;
+        case Layout::A4R4G4B4: format = PixelFormat::R4G4B4A4; break;
+    }
+
+    // NOTE: Source and converted pixels have the same size
+    const size_t dataSize = static_cast<size_t>(GetMipmapChainDataSize(width, height, format, levelCount));
+
+    if ((dataSize == 0) || (offset > size) || (dataSize > size - offset))
+    {
+        TRACELOG(LogWarning, "TEXTURE: DDS file is truncated");
+        return false;
+    }
+
+    converted.resize(dataSize);
+
+    const uint8_t *src = data + offset;
+    uint8_t *dst = converted.data();
+
+    switch (layout)
+    {
+        case Layout::BGRA8:
+        case Layout::BGRX8:
+        {
+            for (size_t i = 0; i < dataSize; i += 4)
+            {
+                dst[i] = src[i + 2];
+                dst[i + 1] = src[i + 1];
+                dst[i + 2] = src[i];
+                dst[i + 3] = (layout == Layout::BGRA8)? src[i + 3] : 255;
+            }
+        } break;
+        case Layout::BGR8:
+        {
+            for (size_t i = 0; i < dataSize; i += 3)
+            {
+                dst[i] = src[i + 2];
+                dst[i + 1] = src[i + 1];
+                dst[i + 2] = src[i];
+            }
+        } break;
+        case Layout::A1R5G5B5:
+        case Layout::A4R4G4B4:
+        {
+            for (size_t i = 0; i < dataSize; i += 2)
+            {
+                const uint16_t value = static_cast<uint16_t>(src[i] | (src[i + 1] << 8));
+
+                // Move alpha from the high bits to the low bits
+                uint16_t result = (layout == Layout::A1R5G5B5)? static_cast<uint16_t>((value << 1) | (value >> 15)) :
+                                                                static_cast<uint16_t>((value << 4) | (value >> 12));
+
+                if (masks[3] == 0) result |= (layout == Layout::A1R5G5B5)? 0x1 : 0xf;
+
+                std::memcpy(dst + i, &result, sizeof(result));
+            }
+        } break;
+    }
+
+    return SetLevels(converted.data(), converted.size(), 0, levelCount);
+}
+
+// Set the levels of a contiguous mipmap chain
+bool TextureFile::SetLevels(const uint8_t *data, size_t size, size_t offset, int levelCount)
+{
+    levels.resize(levelCount);
+    levelSizes.resize(levelCount);
+
+    for (int i = 0; i < levelCount; i++)
+    {
+        const size_t levelSize = static_cast<size_t>(GetPixelDataSize(std::max(width >> i, 1), std::max(height >> i, 1), format));
+
+        if ((levelSize == 0) || (offset > size) || (levelSize > size - offset))
+        {
+            TRACELOG(LogWarning, "TEXTURE: Mipmap level %i is out of the file", i);
+            return false;
+        }
+
+        levels[i] = data + offset;
+        levelSizes[i] = static_cast<uint32_t>(levelSize);
+        offset += levelSize;
+    }
+
+    return true;
+}
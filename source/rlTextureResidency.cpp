@@ -0,0 +1,396 @@
+#include "rlTextureResidency.hpp"
+#include "rlGLExt.hpp"
+#include "rlMipmaps.hpp"
+#include "rlUtils.hpp"
+#include "rlgl.hpp"
+
+#include <algorithm>
+
+using namespace rlgl;
+
+/* TEXTURE RESIDENCY IMPLEMENTATION */
+
+TextureResidency::TextureResidency(Context& rlCtx, std::size_t budget, int maxDroppedLevels)
+: rlCtx(&rlCtx), budget(budget), maxDroppedLevels(std::max(maxDroppedLevels, 0))
+, frameCounter(0), evictionCount(0), memoryUsage(0), peakMemoryUsage(0)
+{ }
+
+TextureResidency::~TextureResidency()
+{
+    Clear();
+}
+
+TextureResidency::TextureResidency(TextureResidency&& other) noexcept
+: rlCtx(other.rlCtx), textures(std::move(other.textures)), freeHandles(std::move(other.freeHandles))
+, remapCallback(std::move(other.remapCallback)), budget(other.budget), maxDroppedLevels(other.maxDroppedLevels)
+, frameCounter(other.frameCounter), evictionCount(other.evictionCount)
+, memoryUsage(other.memoryUsage), peakMemoryUsage(other.peakMemoryUsage)
+{
+    other.textures.clear();
+    other.freeHandles.clear();
+    other.memoryUsage = 0;
+}
+
+TextureResidency& TextureResidency::operator=(TextureResidency&& other) noexcept
+{
+    if (this != &other)
+    {
+        Clear();
+
+        rlCtx = other.rlCtx;
+        textures = std::move(other.textures);
+        freeHandles = std::move(other.freeHandles);
+        remapCallback = std::move(other.remapCallback);
+        budget = other.budget;
+        maxDroppedLevels = other.maxDroppedLevels;
+        frameCounter = other.frameCounter;
+        evictionCount = other.evictionCount;
+        memoryUsage = other.memoryUsage;
+        peakMemoryUsage = other.peakMemoryUsage;
+
+        other.textures.clear();
+        other.freeHandles.clear();
+        other.memoryUsage = 0;
+    }
+    return *this;
+}
+
+uint32_t TextureResidency::Load(const TextureDesc& desc)
+{
+    // NOTE: Compressed formats not supported by the driver are decoded, memory is counted with the decoded format
+    const PixelFormat format = rlCtx->GetTextureLoadFormat(desc.format);
+    MakeRoom(GetMipmapChainDataSize(desc.width, desc.height, format, std::max(desc.mipmapCount, 1)));
+
+    const uint32_t id = rlCtx->LoadTexture(desc);
+    if (id == 0) return 0;
+
+    return AddEntry(id, desc.width, desc.height, format, std::max(desc.mipmapCount, 1));
+}
+
+uint32_t TextureResidency::Load(const TextureFile& file)
+{
+    if (!file.IsValid()) return 0;
+
+    TextureDesc desc;
+    desc.levels = file.GetLevels();
+    desc.width = file.GetWidth();
+    desc.height = file.GetHeight();
+    desc.format = file.GetFormat();
+    desc.mipmapCount = file.GetMipmapCount();
+
+    return Load(desc);
+}
+
+uint32_t TextureResidency::Register(uint32_t id, int width, int height, PixelFormat format, int mipmapCount)
+{
+    if (id == 0) return 0;
+
+    const uint32_t handle = AddEntry(id, width, height, format, std::max(mipmapCount, 1));
+    MakeRoom(0);
+
+    return handle;
+}
+
+bool TextureResidency::Reload(uint32_t handle, const TextureDesc& desc)
+{
+    Entry *entry = GetEntry(handle);
+    if (entry == nullptr) return false;
+
+    const uint32_t oldId = entry->id;
+
+    // Release the current texture first, its memory is then available for the new one
+    if (oldId != 0)
+    {
+        rlCtx->UnloadTexture(oldId);
+        memoryUsage -= entry->size;
+        entry->id = 0;
+        entry->size = 0;
+    }
+
+    // NOTE: The texture is marked as used so it can not be evicted to make room for itself
+    entry->lastFrame = frameCounter;
+
+    const PixelFormat format = rlCtx->GetTextureLoadFormat(desc.format);
+    MakeRoom(GetMipmapChainDataSize(desc.width, desc.height, format, std::max(desc.mipmapCount, 1)));
+
+    const uint32_t id = rlCtx->LoadTexture(desc);
+
+    entry = GetEntry(handle);
+    entry->id = id;
+    entry->width = desc.width;
+    entry->height = desc.height;
+    entry->format = format;
+    entry->mipmapCount = std::max(desc.mipmapCount, 1);
+    entry->droppedLevels = 0;
+    entry->size = (id != 0)? GetMipmapChainDataSize(entry->width, entry->height, entry->format, entry->mipmapCount) : 0;
+
+    memoryUsage += entry->size;
+    peakMemoryUsage = std::max(peakMemoryUsage, memoryUsage);
+
+    if (remapCallback && (id != oldId)) remapCallback(handle, oldId, id);
+
+    return id != 0;
+}
+
+void TextureResidency::Unload(uint32_t handle)
+{
+    Entry *entry = GetEntry(handle);
+    if (entry == nullptr) return;
+
+    if (entry->id != 0) rlCtx->UnloadTexture(entry->id);
+    memoryUsage -= entry->size;
+
+    *entry = Entry();
+    freeHandles.push_back(handle);
+}
+
+uint32_t TextureResidency::Use(uint32_t handle)
+{
+    Entry *entry = GetEntry(handle);
+    if (entry == nullptr) return 0;
+
+    entry->lastFrame = frameCounter;
+    return entry->id;
+}
+
+void TextureResidency::EndFrame()
+{
+    frameCounter++;
+
+    // NOTE: No texture is used yet in the new frame, all of them can be trimmed or evicted
+    MakeRoom(0);
+}
+
+void TextureResidency::Clear()
+{
+    for (auto &entry : textures)
+    {
+        if (entry.registered && (entry.id != 0)) rlCtx->UnloadTexture(entry.id);
+    }
+
+    textures.clear();
+    freeHandles.clear();
+    memoryUsage = 0;
+}
+
+void TextureResidency::SetRemapCallback(RemapCallback callback)
+{
+    remapCallback = std::move(callback);
+}
+
+void TextureResidency::SetBudget(std::size_t newBudget)
+{
+    budget = newBudget;
+}
+
+uint32_t TextureResidency::GetTextureId(uint32_t handle) const
+{
+    const Entry *entry = GetEntry(handle);
+    return (entry != nullptr)? entry->id : 0;
+}
+
+bool TextureResidency::IsResident(uint32_t handle) const
+{
+    return GetTextureId(handle) != 0;
+}
+
+int TextureResidency::GetDroppedLevels(uint32_t handle) const
+{
+    const Entry *entry = GetEntry(handle);
+    return (entry != nullptr)? entry->droppedLevels : 0;
+}
+
+int TextureResidency::GetResidentCount() const
+{
+    return static_cast<int>(std::count_if(textures.begin(), textures.end(), [](const Entry& entry) { return entry.registered && (entry.id != 0); }));
+}
+
+TextureResidency::Entry *TextureResidency::GetEntry(uint32_t handle)
+{
+    if ((handle == 0) || (handle > textures.size()) || !textures[handle - 1].registered) return nullptr;
+    return &textures[handle - 1];
+}
+
+const TextureResidency::Entry *TextureResidency::GetEntry(uint32_t handle) const
+{
+    if ((handle == 0) || (handle > textures.size()) || !textures[handle - 1].registered) return nullptr;
+    return &textures[handle - 1];
+}
+
+uint32_t TextureResidency::AddEntry(uint32_t id, int width, int height, PixelFormat format, int mipmapCount)
+{
+    Entry entry;
+    entry.id = id;
+    entry.width = width;
+    entry.height = height;
+    entry.format = format;
+    entry.mipmapCount = mipmapCount;
+    entry.lastFrame = frameCounter;
+    entry.size = GetMipmapChainDataSize(width, height, format, mipmapCount);
+    entry.registered = true;
+
+    memoryUsage += entry.size;
+    peakMemoryUsage = std::max(peakMemoryUsage, memoryUsage);
+
+    uint32_t handle = 0;
+
+    if (!freeHandles.empty())
+    {
+        handle = freeHandles.back();
+        freeHandles.pop_back();
+        textures[handle - 1] = entry;
+    }
+    else
+    {
+        textures.push_back(entry);
+        handle = static_cast<uint32_t>(textures.size());
+    }
+
+    return handle;
+}
+
+// Trim and evict textures not used in the current frame until the required size fits in the budget
+// NOTE: Least recently used textures are evicted until dropping the top levels of the remaining ones is enough,
+// top levels are then dropped one level per texture and per pass so the resolution decreases evenly
+void TextureResidency::MakeRoom(std::size_t size)
+{
+    if (memoryUsage + size <= budget) return;
+
+    std::vector<uint32_t> candidates;
+
+    for (uint32_t i = 0; i < textures.size(); i++)
+    {
+        const Entry& entry = textures[i];
+        if (entry.registered && (entry.id != 0) && (entry.lastFrame < frameCounter)) candidates.push_back(i + 1);
+    }
+
+    std::stable_sort(candidates.begin(), candidates.end(), [this](uint32_t a, uint32_t b) { return textures[a - 1].lastFrame < textures[b - 1].lastFrame; });
+
+    // Memory that can be freed by dropping top levels (copies are skipped when they would not be enough)
+    std::vector<std::size_t> savings(candidates.size(), 0);
+    std::size_t totalSavings = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (GetExtensions().copyImage)
+    {
+        for (std::size_t i = 0; i < candidates.size(); i++)
+        {
+            const Entry& entry = textures[candidates[i] - 1];
+            const int levels = std::min(maxDroppedLevels - entry.droppedLevels, entry.mipmapCount - 1);
+
+            if (levels > 0)
+            {
+                savings[i] = entry.size - GetMipmapChainDataSize(std::max(entry.width >> levels, 1), std::max(entry.height >> levels, 1),
+                    entry.format, entry.mipmapCount - levels);
+                totalSavings += savings[i];
+            }
+        }
+    }
+#endif
+
+    std::size_t next = 0;
+
+    for (; (next < candidates.size()) && (memoryUsage + size > budget + totalSavings); next++)
+    {
+        Evict(candidates[next]);
+        totalSavings -= savings[next];
+    }
+
+    bool dropped = true;
+
+    while (dropped && (memoryUsage + size > budget))
+    {
+        dropped = false;
+
+        for (std::size_t i = next; i < candidates.size(); i++)
+        {
+            if (memoryUsage + size <= budget) break;
+            if (DropTopLevel(candidates[i])) dropped = true;
+        }
+    }
+
+    if (memoryUsage + size > budget)
+    {
+        TRACELOG(LogWarning, "TEXTURE: Texture memory budget exceeded by textures used in the current frame (%i KB / %i KB)",
+            static_cast<int>((memoryUsage + size)/1024), static_cast<int>(budget/1024));
+    }
+}
+
+// Replace a texture by a copy without its top mipmap level
+// NOTE: Levels are copied on the GPU with glCopyImageSubData() (OpenGL 4.3, GL_ARB_copy_image)
+bool TextureResidency::DropTopLevel(uint32_t handle)
+{
+    Entry *entry = GetEntry(handle);
+    if ((entry == nullptr) || (entry->id == 0) || (entry->mipmapCount <= 1) || (entry->droppedLevels >= maxDroppedLevels)) return false;
+
+    bool result = false;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (!GetExtensions().copyImage) return false;
+
+    TextureDesc desc;
+    desc.width = std::max(entry->width/2, 1);
+    desc.height = std::max(entry->height/2, 1);
+    desc.format = entry->format;
+    desc.mipmapCount = entry->mipmapCount - 1;
+
+    const uint32_t oldId = entry->id;
+    const uint32_t id = rlCtx->LoadTexture(desc);
+    if (id == 0) return false;
+
+    for (int i = 0; i < desc.mipmapCount; i++)
+    {
+        glCopyImageSubData(oldId, GL_TEXTURE_2D, i + 1, 0, 0, 0, id, GL_TEXTURE_2D, i, 0, 0, 0,
+            std::max(desc.width >> i, 1), std::max(desc.height >> i, 1), 1);
+    }
+
+    // Keep the sampling parameters of the previous texture
+    constexpr GLenum params[] = { GL_TEXTURE_WRAP_S, GL_TEXTURE_WRAP_T, GL_TEXTURE_MIN_FILTER, GL_TEXTURE_MAG_FILTER };
+    GLint values[4] = { 0 };
+
+    glBindTexture(GL_TEXTURE_2D, oldId);
+    for (int i = 0; i < 4; i++) glGetTexParameteriv(GL_TEXTURE_2D, params[i], &values[i]);
+
+    glBindTexture(GL_TEXTURE_2D, id);
+    for (int i = 0; i < 4; i++) glTexParameteri(GL_TEXTURE_2D, params[i], values[i]);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    rlCtx->UnloadTexture(oldId);
+
+    memoryUsage -= entry->size;
+
+    entry->id = id;
+    entry->width = desc.width;
+    entry->height = desc.height;
+    entry->mipmapCount = desc.mipmapCount;
+    entry->droppedLevels++;
+    entry->size = GetMipmapChainDataSize(desc.width, desc.height, desc.format, desc.mipmapCount);
+
+    memoryUsage += entry->size;
+
+    TRACELOGD("TEXTURE: [ID %i] Top mipmap level dropped, reloaded as [ID %i] (%ix%i)", oldId, id, desc.width, desc.height);
+
+    if (remapCallback) remapCallback(handle, oldId, id);
+
+    result = true;
+#endif
+
+    return result;
+}
+
+void TextureResidency::Evict(uint32_t handle)
+{
+    Entry *entry = GetEntry(handle);
+    if ((entry == nullptr) || (entry->id == 0)) return;
+
+    const uint32_t oldId = entry->id;
+
+    rlCtx->UnloadTexture(oldId);
+    memoryUsage -= entry->size;
+
+    entry->id = 0;
+    entry->size = 0;
+    evictionCount++;
+
+    if (remapCallback) remapCallback(handle, oldId, 0);
+}
@@ -0,0 +1,154 @@
+#include "rlTrace.hpp"
+#include "rlUtils.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+using namespace rlgl;
+
+namespace {
+
+    // Completed zone
+    struct TraceEvent
+    {
+        const char *name;                   // Zone name
+        uint64_t start;                     // Start time (in nanoseconds)
+        uint64_t duration;                  // Duration (in nanoseconds)
+    };
+
+    // Ring buffer of a thread
+    struct ThreadTrace
+    {
+        std::vector<TraceEvent> events;     // Ring buffer storage (allocated on the first event)
+        uint64_t written = 0;               // Number of events written since the last clear
+        int threadIndex = 0;                // Thread index in the trace
+        std::string name;                   // Thread name (empty for the default name)
+        bool exited = false;                // Thread exited, buffer removed on next clear
+    };
+
+    // Registered thread buffers (the registry mutex is only locked to register, export and clear)
+    std::mutex traceMutex;
+    std::vector<std::shared_ptr<ThreadTrace>> traceThreads;
+    int traceThreadCounter = 0;
+
+    // Buffer of the calling thread, registered on first use and flagged when the thread exits
+    struct ThreadTraceHandle
+    {
+        std::shared_ptr<ThreadTrace> trace;
+
+        ~ThreadTraceHandle()
+        {
+            if (trace != nullptr)
+            {
+                std::lock_guard<std::mutex> lock(traceMutex);
+                trace->exited = true;
+            }
+        }
+    };
+
+    thread_local ThreadTraceHandle threadTrace;
+
+    //----------------------------------------------------------------------------------
+
+    ThreadTrace& GetThreadTrace()
+    {
+        if (threadTrace.trace == nullptr)
+        {
+            threadTrace.trace = std::make_shared<ThreadTrace>();
+            threadTrace.trace->events.resize(RL_TRACE_BUFFER_EVENTS);
+
+            std::lock_guard<std::mutex> lock(traceMutex);
+            threadTrace.trace->threadIndex = traceThreadCounter++;
+            traceThreads.push_back(threadTrace.trace);
+        }
+
+        return *threadTrace.trace;
+    }
+
+}
+
+/* TRACING IMPLEMENTATION */
+
+uint64_t rlgl::GetTraceTime()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void rlgl::RecordTraceEvent(const char *name, uint64_t start, uint64_t duration)
+{
+    ThreadTrace &trace = GetThreadTrace();
+
+    trace.events[trace.written%trace.events.size()] = { name, start, duration };
+    trace.written++;
+}
+
+void rlgl::SetTraceThreadName(const char *name)
+{
+    ThreadTrace &trace = GetThreadTrace();
+
+    std::lock_guard<std::mutex> lock(traceMutex);
+    trace.name = name;
+}
+
+std::string rlgl::ExportTrace()
+{
+    std::lock_guard<std::mutex> lock(traceMutex);
+
+    std::string json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    char buffer[128];
+
+    for (const auto& trace : traceThreads)
+    {
+        // NOTE: CPU threads are numbered from 2, thread 1 is used by the GPU profiler trace
+        const int tid = trace->threadIndex + 2;
+
+        json += first ? "\n" : ",\n";
+        first = false;
+
+        std::snprintf(buffer, sizeof(buffer), "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%i,\"args\":{\"name\":", tid);
+        json += buffer;
+
+        if (trace->name.empty())
+        {
+            std::snprintf(buffer, sizeof(buffer), "\"rlgl thread %i\"", trace->threadIndex);
+            json += buffer;
+        }
+        else AppendJsonString(json, trace->name.c_str());
+
+        json += "}}";
+
+        // Events kept by the ring buffer, oldest first
+        const uint64_t capacity = trace->events.size();
+        const uint64_t count = std::min(trace->written, capacity);
+
+        for (uint64_t i = trace->written - count; i < trace->written; i++)
+        {
+            const TraceEvent &event = trace->events[i%capacity];
+
+            json += ",\n{\"name\":";
+            AppendJsonString(json, event.name);
+            std::snprintf(buffer, sizeof(buffer), ",\"cat\":\"rlgl\",\"ph\":\"X\",\"pid\":1,\"tid\":%i,\"ts\":%.3f,\"dur\":%.3f}",
+                tid, event.start/1000.0, event.duration/1000.0);
+            json += buffer;
+        }
+    }
+
+    json += "\n]}\n";
+
+    return json;
+}
+
+void rlgl::ClearTrace()
+{
+    std::lock_guard<std::mutex> lock(traceMutex);
+
+    traceThreads.erase(std::remove_if(traceThreads.begin(), traceThreads.end(),
+        [](const std::shared_ptr<ThreadTrace>& trace) { return trace->exited; }), traceThreads.end());
+
+    for (const auto& trace : traceThreads) trace->written = 0;
+}
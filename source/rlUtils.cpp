@@ -2,6 +2,21 @@
 #include "rlGLExt.hpp"
 #include "rlEnums.hpp"
 #include "rlConfig.hpp"
+#include "rlgl.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(RLGL_SIMD_SSE2)
+    #include <emmintrin.h>
+#elif defined(RLGL_SIMD_NEON)
+    #include <arm_neon.h>
+#endif
 
 // Get current OpenGL version
 rlgl::GlVersion rlgl::GetVersion(void)
@@ -63,10 +78,13 @@ const char *rlgl::GetPixelFormatName(PixelFormat format)
 }
 
 // Get pixel data size in bytes (image or texture)
-// NOTE: Size depends on pixel format
+// NOTE: Size depends on pixel format, it is computed in 64 bit and sizes that are not
+// representable in an int (or non positive dimensions) are reported as 0
 int rlgl::GetPixelDataSize(int width, int height, PixelFormat format)
 {
-    int dataSize = 0;       // Size in bytes
+    if ((width <= 0) || (height <= 0)) return 0;
+
+    int64_t dataSize = 0;   // Size in bytes
     int bpp = 0;            // Bits per pixel
 
     switch (format)
@@ -98,17 +116,24 @@ int rlgl::GetPixelDataSize(int width, int height, PixelFormat format)
         default: break;
     }
 
-    dataSize = width*height*bpp/8;  // Total data size in bytes
+    dataSize = static_cast<int64_t>(width)*height*bpp/8;  // Total data size in bytes
 
-    // Most compressed formats works on 4x4 blocks,
-    // if texture is smaller, minimum dataSize is 8 or 16
-    if ((width < 4) && (height < 4))
+    // Block compressed formats store whole blocks (4x4 pixels, 8x8 for ASTC 8x8),
+    // partial blocks on the right and bottom borders use a full block
+    if ((format >= PixelFormat::DXT1_RGB) && (format <= PixelFormat::ASTC_8x8_RGBA) &&
+        (format != PixelFormat::PVRT_RGB) && (format != PixelFormat::PVRT_RGBA))
+    {
+        const int blockDim = (format == PixelFormat::ASTC_8x8_RGBA)? 8 : 4;
+        const int blockSize = blockDim*blockDim*bpp/8;
+        dataSize = static_cast<int64_t>((width - 1)/blockDim + 1)*((height - 1)/blockDim + 1)*blockSize;
+    }
+    else if ((format == PixelFormat::PVRT_RGB) || (format == PixelFormat::PVRT_RGBA))
     {
-        if ((format >= PixelFormat::DXT1_RGB) && (format < PixelFormat::DXT3_RGBA)) dataSize = 8;
-        else if ((format >= PixelFormat::DXT3_RGBA) && (format < PixelFormat::ASTC_8x8_RGBA)) dataSize = 16;
+        // PVRTC works on 4x4 blocks, if texture is smaller, minimum dataSize is 8
+        if ((width < 4) && (height < 4)) dataSize = 8;
     }
 
-    return dataSize;
+    return (dataSize <= INT_MAX)? static_cast<int>(dataSize) : 0;
 }
 
 // Get OpenGL internal formats and data type from raylib PixelFormat
@@ -184,6 +209,99 @@ void rlgl::GetGlTextureFormats(rlgl::PixelFormat format, unsigned int *glInterna
     }
 }
 
+// Get OpenGL sized internal format from raylib PixelFormat
+// NOTE: Immutable storage (glTexStorage2D) only accepts sized formats, OpenGL 3.3 formats are already sized,
+// OpenGL 2.1 and OpenGL ES 3.0 use unsized formats for compatibility with OpenGL ES 2.0 so they are mapped here
+uint32_t rlgl::GetGlSizedInternalFormat(PixelFormat format)
+{
+    uint32_t glInternalFormat = 0, glFormat = 0, glType = 0;
+    GetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+    if (glInternalFormat == 0) return 0;
+
+#if defined(GRAPHICS_API_OPENGL_21) || defined(GRAPHICS_API_OPENGL_ES3)
+    switch (format)
+    {
+        case PixelFormat::Grayscale:
+        case PixelFormat::GrayAlpha: glInternalFormat = 0; break;  // NOTE: Luminance formats have no sized equivalent (core)
+        case PixelFormat::R5G6B5: glInternalFormat = GL_RGB565; break;
+        case PixelFormat::R8G8B8: glInternalFormat = GL_RGB8; break;
+        case PixelFormat::R5G5B5A1: glInternalFormat = GL_RGB5_A1; break;
+        case PixelFormat::R4G4B4A4: glInternalFormat = GL_RGBA4; break;
+        case PixelFormat::R8G8B8A8: glInternalFormat = GL_RGBA8; break;
+    #if defined(GRAPHICS_API_OPENGL_21)
+        case PixelFormat::R32:
+        case PixelFormat::R32G32B32:
+        case PixelFormat::R32G32B32A32:
+        case PixelFormat::R16:
+        case PixelFormat::R16G16B16:
+        case PixelFormat::R16G16B16A16: glInternalFormat = 0; break;
+    #endif
+        default: break;     // Float formats (OpenGL ES 3.0) and compressed formats are already sized
+    }
+#elif !defined(GRAPHICS_API_OPENGL_33)
+    glInternalFormat = 0;   // No immutable storage support
+#endif
+
+    return glInternalFormat;
+}
+
+// Flip image rows in place
+// NOTE: Rows are swapped two by two, no temporary image is required
+void rlgl::FlipPixelsVertical(void *pixels, int rowSize, int height)
+{
+    uint8_t *top = static_cast<uint8_t*>(pixels);
+    uint8_t *bottom = top + (height - 1)*rowSize;
+
+    for (; top < bottom; top += rowSize, bottom -= rowSize)
+    {
+        std::swap_ranges(top, top + rowSize, bottom);
+    }
+}
+
+// Copy image rows in reverse order (source and destination must not overlap)
+void rlgl::CopyPixelsFlipped(void *dest, const void *src, int rowSize, int height)
+{
+    uint8_t *dst = static_cast<uint8_t*>(dest);
+    const uint8_t *srcRow = static_cast<const uint8_t*>(src) + (height - 1)*rowSize;
+
+    for (int y = 0; y < height; y++, dst += rowSize, srcRow -= rowSize)
+    {
+        std::memcpy(dst, srcRow, rowSize);
+    }
+}
+
+// Set alpha component of R8G8B8A8 pixels to 255
+// NOTE: 4 pixels are processed at once with a byte mask (OR 0xff on every 4th byte)
+void rlgl::SetPixelsOpaque(uint8_t *pixels, int pixelCount)
+{
+    int i = 0;
+
+#if defined(RLGL_SIMD_SSE2)
+
+    const __m128i alphaMask = _mm_set1_epi32(static_cast<int>(0xff000000));
+
+    for (; i + 4 <= pixelCount; i += 4)
+    {
+        __m128i *p = reinterpret_cast<__m128i*>(pixels + i*4);
+        _mm_storeu_si128(p, _mm_or_si128(_mm_loadu_si128(p), alphaMask));
+    }
+
+#elif defined(RLGL_SIMD_NEON)
+
+    const uint8x16_t alphaMask = vreinterpretq_u8_u32(vdupq_n_u32(0xff000000));
+
+    for (; i + 4 <= pixelCount; i += 4)
+    {
+        uint8_t *p = pixels + i*4;
+        vst1q_u8(p, vorrq_u8(vld1q_u8(p), alphaMask));
+    }
+
+#endif
+
+    for (; i < pixelCount; i++) pixels[i*4 + 3] = 255;
+}
+
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 // Get compressed format official GL identifier name
 const char *rlgl::GetCompressedFormatName(int format)
@@ -259,3 +377,81 @@ const char *rlgl::GetCompressedFormatName(int format)
     }
 }
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
+
+// Split a range of jobs over multiple threads and wait for them
+// NOTE: The calling thread takes the first part of the range
+void rlgl::ParallelFor(int count, const std::function<void(int begin, int end)>& job, int numThreads)
+{
+    if (count <= 0) return;
+
+    if (numThreads <= 0) numThreads = static_cast<int>(std::thread::hardware_concurrency());
+    numThreads = std::max(1, std::min(numThreads, count));
+
+    if (numThreads == 1)
+    {
+        job(0, count);
+        return;
+    }
+
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads - 1);
+
+    const int step = (count + numThreads - 1)/numThreads;
+
+    for (int begin = step; begin < count; begin += step)
+    {
+        threads.emplace_back(job, begin, std::min(begin + step, count));
+    }
+
+    job(0, std::min(step, count));
+
+    for (auto &thread : threads) thread.join();
+}
+
+// Append a string to a JSON document, quoted and escaped (control characters are written as \u escapes)
+void rlgl::AppendJsonString(std::string& json, const char *str)
+{
+    json += '"';
+
+    for (; *str != '\0'; str++)
+    {
+        const char c = *str;
+
+        if ((c == '"') || (c == '\\'))
+        {
+            json += '\\';
+            json += c;
+        }
+        else if (static_cast<unsigned char>(c) < 0x20)
+        {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned char>(c));
+            json += escaped;
+        }
+        else json += c;
+    }
+
+    json += '"';
+}
+
+// Set an int uniform of a shader program by name
+void rlgl::SetUniformInt(Context& rlCtx, uint32_t programId, const char *name, int value)
+{
+    rlCtx.SetUniform(rlCtx.GetLocationUniform(programId, name), &value, ShaderUniformType::Int, 1);
+}
+
+#if defined(GRAPHICS_API_OPENGL_43)
+// Compile and link a compute shader program, the source is the header (version and work group size),
+// the defines and the code of the shader
+uint32_t rlgl::LoadComputeProgram(Context& rlCtx, const char *header, const char *defines, const char *code)
+{
+    const std::string source = std::string(header) + defines + code;
+    const uint32_t shaderId = rlCtx.CompileShader(source.c_str(), static_cast<int>(ShaderType::Compute));
+    if (shaderId == 0) return 0;
+
+    const uint32_t programId = rlCtx.LoadComputeShaderProgram(shaderId);
+    glDeleteShader(shaderId);   // Shader object is released with the program
+
+    return programId;
+}
+#endif
@@ -1,6 +1,7 @@
 #include "rlVertexBuffer.hpp"
 #include "rlException.hpp"
 #include "rlGLExt.hpp"
+#include "rlTrace.hpp"
 #include "rlgl.hpp"
 #include <cstring>
 
@@ -155,6 +156,8 @@ VertexBuffer& VertexBuffer::operator=(VertexBuffer&& other) noexcept
 
 void VertexBuffer::Update(int vertexCounter) const
 {
+    RLGL_TRACE_ZONE("VertexBuffer::Update");
+
     // Activate elements VAO
     if (GetExtensions().vao) glBindVertexArray(vaoId);
 
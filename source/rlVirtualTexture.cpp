@@ -0,0 +1,508 @@
+#include "rlVirtualTexture.hpp"
+#include "rlGLExt.hpp"
+#include "rlUtils.hpp"
+#include "rlgl.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <cmath>
+
+using namespace rlgl;
+
+namespace {
+
+    constexpr uint64_t NO_PAGE = UINT64_MAX;
+
+    constexpr const char *VT_SHADER_CODE = R"(
+uniform sampler2D vtIndirection;
+uniform sampler2D vtCache;
+uniform vec4 vtParams;          // Virtual texture size (xy), page size (z), page border (w)
+uniform vec4 vtLayout;          // Indirection size in pages (xy), cache size in pages (z), last level (w)
+uniform float vtFeedbackBias;   // Level bias of the feedback pass (log2 of the feedback scale)
+
+float vtMipLevel(vec2 uv)
+{
+    vec2 dx = dFdx(uv*vtParams.xy);
+    vec2 dy = dFdy(uv*vtParams.xy);
+    return 0.5*log2(max(max(dot(dx, dx), dot(dy, dy)), 1e-8));
+}
+
+vec4 vtSample(vec2 uv)
+{
+    float level = clamp(floor(vtMipLevel(uv)), 0.0, vtLayout.w);
+    vec4 entry = floor(textureLod(vtIndirection, uv*vtParams.xy/(vtLayout.xy*vtParams.z), level)*255.0 + 0.5);
+    vec2 inPage = fract(uv*vtParams.xy/(vtParams.z*exp2(entry.b)));
+    float stride = vtParams.z + 2.0*vtParams.w;
+    vec2 texel = entry.rg*stride + vtParams.w + inPage*vtParams.z;
+    return textureLod(vtCache, texel/(vtLayout.z*stride), 0.0);
+}
+
+vec4 vtFeedback(vec2 uv)
+{
+    float level = clamp(floor(vtMipLevel(uv) - vtFeedbackBias), 0.0, vtLayout.w);
+    vec2 pages = max(floor(vtLayout.xy/exp2(level)), 1.0);
+    vec2 page = clamp(floor(uv*vtParams.xy/(vtParams.z*exp2(level))), vec2(0.0), pages - 1.0);
+    return vec4(mod(page, 256.0), floor(page.x/256.0) + 16.0*floor(page.y/256.0), level)/255.0;
+}
+)";
+
+    //----------------------------------------------------------------------------------
+
+    int NextPowerOfTwo(int value)
+    {
+        int result = 1;
+        while (result < value) result *= 2;
+        return result;
+    }
+
+    int GetPageLevel(uint64_t page)
+    {
+        return static_cast<int>(page >> 56);
+    }
+
+    int GetPageX(uint64_t page)
+    {
+        return static_cast<int>(page & 0xfffffff);
+    }
+
+    int GetPageY(uint64_t page)
+    {
+        return static_cast<int>((page >> 28) & 0xfffffff);
+    }
+
+}
+
+/* VIRTUAL TEXTURE IMPLEMENTATION */
+
+VirtualTexture::VirtualTexture(Context& rlCtx, const VirtualTextureDesc& desc, PageLoader loader)
+: rlCtx(&rlCtx), desc(desc), loader(std::move(loader))
+, levelCount(1), pagesX(1), pagesY(1), pageStride(0)
+, cacheTexture(0), indirectionTexture(0)
+, frameCounter(0), uploadedPages(0)
+, feedbackFramebuffer(0), feedbackTexture(0), feedbackWidth(0), feedbackHeight(0)
+, clearColor{ 0.0f, 0.0f, 0.0f, 0.0f }, colorBlend(true)
+, loadingPage(NO_PAGE), stopThread(false)
+{
+    this->desc.pageSize = std::max(this->desc.pageSize, 1);
+    this->desc.pageBorder = std::max(this->desc.pageBorder, 0);
+    this->desc.cachePages = std::min(std::max(this->desc.cachePages, 1), 256);   // Cache coordinates are stored in 8 bits
+    this->desc.feedbackScale = std::max(this->desc.feedbackScale, 1);
+    this->desc.uploadsPerFrame = std::max(this->desc.uploadsPerFrame, 1);
+
+    const VirtualTextureDesc& vt = this->desc;
+
+    // NOTE: The page grid is rounded up to a power of two, so the indirection texture is a complete mipmap chain
+    // and the single page of the last level covers the whole virtual texture
+    pagesX = NextPowerOfTwo((vt.width + vt.pageSize - 1)/vt.pageSize);
+    pagesY = NextPowerOfTwo((vt.height + vt.pageSize - 1)/vt.pageSize);
+    levelCount = 1 + static_cast<int>(std::log2(std::max(pagesX, pagesY)));
+    pageStride = vt.pageSize + 2*vt.pageBorder;
+
+    if ((pagesX > 4096) || (pagesY > 4096) || (levelCount > 255))
+    {
+        TRACELOG(LogWarning, "VTEX: Virtual texture too large (%ix%i pages, 4096x4096 max)", pagesX, pagesY);
+        return;
+    }
+
+    // Page cache texture (bilinear, pages include borders)
+    const int cacheSize = vt.cachePages*pageStride;
+    cacheTexture = rlCtx.LoadTexture(nullptr, cacheSize, cacheSize, PixelFormat::R8G8B8A8, 1);
+    rlCtx.TextureParameters(cacheTexture, TextureParam::MinFilter, TextureFilter::Linear);
+    rlCtx.TextureParameters(cacheTexture, TextureParam::MagFilter, TextureFilter::Linear);
+    rlCtx.TextureParameters(cacheTexture, TextureParam::Wrap_S, TextureWrap::Clamp);
+    rlCtx.TextureParameters(cacheTexture, TextureParam::Wrap_T, TextureWrap::Clamp);
+
+    // Indirection texture (one level per virtual level, texels are never filtered)
+    TextureDesc indirectionDesc;
+    indirectionDesc.width = pagesX;
+    indirectionDesc.height = pagesY;
+    indirectionDesc.mipmapCount = levelCount;
+    indirectionTexture = rlCtx.LoadTexture(indirectionDesc);
+    rlCtx.TextureParameters(indirectionTexture, TextureParam::MinFilter, TextureFilter::MipNearest);
+    rlCtx.TextureParameters(indirectionTexture, TextureParam::MagFilter, TextureFilter::Nearest);
+    rlCtx.TextureParameters(indirectionTexture, TextureParam::Wrap_S, TextureWrap::Clamp);
+    rlCtx.TextureParameters(indirectionTexture, TextureParam::Wrap_T, TextureWrap::Clamp);
+
+    indirection.resize(levelCount);
+    indirectionDirty.assign(levelCount, true);
+    for (int i = 0; i < levelCount; i++) indirection[i].assign(std::max(pagesX >> i, 1)*std::max(pagesY >> i, 1), 0);
+
+    slots.resize(vt.cachePages*vt.cachePages);
+
+    // The last level page is loaded now and never evicted, it is the fallback of every page
+    LoadedPage root;
+    root.page = GetPageKey(levelCount - 1, 0, 0);
+    root.pixels.resize(static_cast<std::size_t>(pageStride)*pageStride*4);
+
+    if (!this->loader(levelCount - 1, -vt.pageBorder, -vt.pageBorder, pageStride, pageStride, root.pixels.data())) root.pixels.clear();
+    UploadPage(root);
+    Update();
+
+    thread = std::thread(&VirtualTexture::LoaderThread, this);
+
+    TRACELOG(LogInfo, "VTEX: Virtual texture loaded (%ix%i | %i levels | %ix%i pages cache)", vt.width, vt.height, levelCount, vt.cachePages, vt.cachePages);
+}
+
+VirtualTexture::~VirtualTexture()
+{
+    if (thread.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopThread = true;
+        }
+
+        condition.notify_all();
+        thread.join();
+    }
+
+    if (feedbackReadback.IsValid()) feedbackReadback.Resolve();
+
+    if (feedbackFramebuffer != 0) rlCtx->UnloadFramebuffer(feedbackFramebuffer);
+    if (feedbackTexture != 0) rlCtx->UnloadTexture(feedbackTexture);
+    if (cacheTexture != 0) rlCtx->UnloadTexture(cacheTexture);
+    if (indirectionTexture != 0) rlCtx->UnloadTexture(indirectionTexture);
+}
+
+void VirtualTexture::BeginFeedback(int screenWidth, int screenHeight)
+{
+    const int width = std::max((screenWidth + desc.feedbackScale - 1)/desc.feedbackScale, 1);
+    const int height = std::max((screenHeight + desc.feedbackScale - 1)/desc.feedbackScale, 1);
+
+    rlCtx->DrawRenderBatchActive();
+
+    // Feedback framebuffer follows the screen size
+    if ((width != feedbackWidth) || (height != feedbackHeight))
+    {
+        // NOTE: Depth renderbuffer is unloaded with the framebuffer
+        if (feedbackFramebuffer != 0) rlCtx->UnloadFramebuffer(feedbackFramebuffer);
+        if (feedbackTexture != 0) rlCtx->UnloadTexture(feedbackTexture);
+
+        feedbackFramebuffer = rlCtx->LoadFramebuffer(width, height);
+        feedbackTexture = rlCtx->LoadTexture(nullptr, width, height, PixelFormat::R8G8B8A8, 1);
+        const uint32_t depth = rlCtx->LoadTextureDepth(width, height, true);
+
+        rlCtx->FramebufferAttach(feedbackFramebuffer, feedbackTexture, FramebufferAttachType::ColorChannel0, FramebufferAttachTextureType::Texture2D, 0);
+        rlCtx->FramebufferAttach(feedbackFramebuffer, depth, FramebufferAttachType::Depth, FramebufferAttachTextureType::RenderBuffer, 0);
+        if (!rlCtx->FramebufferComplete(feedbackFramebuffer)) TRACELOG(LogWarning, "VTEX: Feedback framebuffer is not complete");
+
+        feedbackWidth = width;
+        feedbackHeight = height;
+    }
+
+    rlCtx->EnableFramebuffer(feedbackFramebuffer);
+    rlCtx->Viewport(0, 0, feedbackWidth, feedbackHeight);
+
+    // NOTE: Alpha 255 is not a valid level, pixels without virtual texture do not request any page
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glGetFloatv(GL_COLOR_CLEAR_VALUE, clearColor);
+    colorBlend = (glIsEnabled(GL_BLEND) == GL_TRUE);
+#endif
+    rlCtx->ClearColor(255, 255, 255, 255);
+    rlCtx->ClearScreenBuffers();
+
+    // Feedback pixels are written as is (level is stored in alpha)
+    rlCtx->DisableColorBlend();
+}
+
+void VirtualTexture::EndFeedback()
+{
+    rlCtx->DrawRenderBatchActive();
+    rlCtx->DisableFramebuffer();
+    rlCtx->Viewport(0, 0, rlCtx->GetFramebufferWidth(), rlCtx->GetFramebufferHeight());
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glClearColor(clearColor[0], clearColor[1], clearColor[2], clearColor[3]);
+#endif
+    if (colorBlend) rlCtx->EnableColorBlend();
+
+    // Only one feedback is in flight, the next one is read once the previous one is processed
+    if (!feedbackReadback.IsValid()) feedbackReadback = rlCtx->ReadTexturePixelsAsync(feedbackTexture, feedbackWidth, feedbackHeight, PixelFormat::R8G8B8A8);
+}
+
+void VirtualTexture::Update()
+{
+    if (indirection.empty()) return;    // Virtual texture not loaded
+
+    frameCounter++;
+
+    if (feedbackReadback.IsValid() && feedbackReadback.IsReady())
+    {
+        feedbackPixels.resize(feedbackReadback.GetDataSize());
+        if (feedbackReadback.Resolve(feedbackPixels.data())) ProcessFeedback(feedbackPixels.data(), static_cast<int>(feedbackPixels.size()/4));
+    }
+
+    // Upload the pages loaded by the loader thread
+    std::vector<LoadedPage> uploads;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        const std::size_t count = std::min(loadedPages.size(), static_cast<std::size_t>(desc.uploadsPerFrame));
+        uploads.assign(std::make_move_iterator(loadedPages.begin()), std::make_move_iterator(loadedPages.begin() + count));
+        loadedPages.erase(loadedPages.begin(), loadedPages.begin() + count);
+    }
+
+    for (const LoadedPage& loaded : uploads) UploadPage(loaded);
+
+    // Upload modified indirection levels
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (std::find(indirectionDirty.begin(), indirectionDirty.end(), true) == indirectionDirty.end()) return;
+
+    // Indirection rows are tightly packed, the application unpack alignment is restored after the uploads
+    int prevUnpackAlignment = 4;
+    glGetIntegerv(GL_UNPACK_ALIGNMENT, &prevUnpackAlignment);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glBindTexture(GL_TEXTURE_2D, indirectionTexture);
+
+    for (int i = 0; i < levelCount; i++)
+    {
+        if (!indirectionDirty[i]) continue;
+
+        glTexSubImage2D(GL_TEXTURE_2D, i, 0, 0, std::max(pagesX >> i, 1), std::max(pagesY >> i, 1), GL_RGBA, GL_UNSIGNED_BYTE, indirection[i].data());
+        indirectionDirty[i] = false;
+    }
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, prevUnpackAlignment);
+#endif
+}
+
+void VirtualTexture::SetShaderValues(uint32_t shaderId)
+{
+    const float params[4] = { static_cast<float>(desc.width), static_cast<float>(desc.height), static_cast<float>(desc.pageSize), static_cast<float>(desc.pageBorder) };
+    const float layout[4] = { static_cast<float>(pagesX), static_cast<float>(pagesY), static_cast<float>(desc.cachePages), static_cast<float>(levelCount - 1) };
+    const float feedbackBias = std::log2(static_cast<float>(desc.feedbackScale));
+
+    rlCtx->EnableShader(shaderId);
+    rlCtx->SetUniform(rlCtx->GetLocationUniform(shaderId, "vtParams"), params, ShaderUniformType::Vec4, 1);
+    rlCtx->SetUniform(rlCtx->GetLocationUniform(shaderId, "vtLayout"), layout, ShaderUniformType::Vec4, 1);
+    rlCtx->SetUniform(rlCtx->GetLocationUniform(shaderId, "vtFeedbackBias"), &feedbackBias, ShaderUniformType::Float, 1);
+    rlCtx->SetUniformSampler(rlCtx->GetLocationUniform(shaderId, "vtIndirection"), indirectionTexture);
+    rlCtx->SetUniformSampler(rlCtx->GetLocationUniform(shaderId, "vtCache"), cacheTexture);
+}
+
+const char *VirtualTexture::GetShaderCode()
+{
+    return VT_SHADER_CODE;
+}
+
+int VirtualTexture::GetPendingPageCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return static_cast<int>(requests.size() + loadedPages.size() + ((loadingPage != NO_PAGE)? 1 : 0));
+}
+
+uint64_t VirtualTexture::GetPageKey(int level, int x, int y) const
+{
+    return (static_cast<uint64_t>(level) << 56) | (static_cast<uint64_t>(y) << 28) | static_cast<uint64_t>(x);
+}
+
+// Mark the required pages as used and request the missing ones
+// NOTE: Ancestors of a required page are required too, they are the fallback while the page is loading
+void VirtualTexture::ProcessFeedback(const uint8_t *pixels, int count)
+{
+    std::vector<uint64_t> required;
+    required.reserve(64);
+
+    uint32_t previous = 0xffffffff;
+
+    for (int i = 0; i < count; i++)
+    {
+        const uint8_t *pixel = pixels + i*4;
+        if (pixel[3] >= levelCount) continue;
+
+        // Neighbor pixels usually request the same page
+        uint32_t value;
+        std::memcpy(&value, pixel, sizeof(value));
+        if (value == previous) continue;
+        previous = value;
+
+        const int level = pixel[3];
+        const int x = pixel[0] | ((pixel[2] & 0xf) << 8);
+        const int y = pixel[1] | ((pixel[2] >> 4) << 8);
+
+        if ((x < std::max(pagesX >> level, 1)) && (y < std::max(pagesY >> level, 1))) required.push_back(GetPageKey(level, x, y));
+    }
+
+    std::sort(required.begin(), required.end());
+    required.erase(std::unique(required.begin(), required.end()), required.end());
+
+    std::vector<uint64_t> missing;
+
+    for (uint64_t page : required)
+    {
+        int level = GetPageLevel(page);
+        int x = GetPageX(page);
+        int y = GetPageY(page);
+
+        for (; level < levelCount; level++, x >>= 1, y >>= 1)
+        {
+            const uint64_t key = GetPageKey(level, x, y);
+            auto it = pageSlots.find(key);
+
+            if (it != pageSlots.end()) slots[it->second].lastFrame = frameCounter;
+            else missing.push_back(key);
+        }
+    }
+
+    std::sort(missing.begin(), missing.end());
+    missing.erase(std::unique(missing.begin(), missing.end()), missing.end());
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        // Pages not required anymore are dropped from the queue
+        requests.clear();
+
+        for (uint64_t page : missing)
+        {
+            if ((page == loadingPage) || std::binary_search(failedPages.begin(), failedPages.end(), page)) continue;
+            if (std::any_of(loadedPages.begin(), loadedPages.end(), [page](const LoadedPage& loaded) { return loaded.page == page; })) continue;
+
+            requests.push_back(page);
+        }
+    }
+
+    condition.notify_one();
+}
+
+// Upload a loaded page to the least recently used cache slot
+void VirtualTexture::UploadPage(const LoadedPage& loaded)
+{
+    const int level = GetPageLevel(loaded.page);
+    const int x = GetPageX(loaded.page);
+    const int y = GetPageY(loaded.page);
+
+    if (loaded.pixels.empty())
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        failedPages.insert(std::upper_bound(failedPages.begin(), failedPages.end(), loaded.page), loaded.page);
+        return;
+    }
+
+    if (pageSlots.count(loaded.page) > 0) return;
+
+    // Free slot first, then the least recently used page not required by the current frames
+    // NOTE: The last level page is never evicted
+    int slot = -1;
+
+    for (int i = 0; i < static_cast<int>(slots.size()); i++)
+    {
+        if (slots[i].page == NO_PAGE) { slot = i; break; }
+        if ((GetPageLevel(slots[i].page) == levelCount - 1) || (slots[i].lastFrame + 1 >= frameCounter)) continue;
+        if ((slot < 0) || (slots[i].lastFrame < slots[slot].lastFrame)) slot = i;
+    }
+
+    if (slot < 0)
+    {
+        TRACELOGD("VTEX: Page cache is full, page [%i: %i, %i] not uploaded", level, x, y);
+        return;
+    }
+
+    if (slots[slot].page != NO_PAGE)
+    {
+        const uint64_t evicted = slots[slot].page;
+        pageSlots.erase(evicted);
+
+        // Evicted page entries fall back to the closest resident ancestor
+        int parentLevel = GetPageLevel(evicted) + 1;
+        int parentX = GetPageX(evicted) >> 1;
+        int parentY = GetPageY(evicted) >> 1;
+        uint32_t entry = 0;
+
+        for (; parentLevel < levelCount; parentLevel++, parentX >>= 1, parentY >>= 1)
+        {
+            auto it = pageSlots.find(GetPageKey(parentLevel, parentX, parentY));
+
+            if (it != pageSlots.end())
+            {
+                entry = indirection[parentLevel][parentY*std::max(pagesX >> parentLevel, 1) + parentX];
+                break;
+            }
+        }
+
+        FillIndirection(GetPageLevel(evicted), GetPageX(evicted), GetPageY(evicted), entry);
+    }
+
+    const int slotX = slot%desc.cachePages;
+    const int slotY = slot/desc.cachePages;
+
+    rlCtx->UpdateTextureAsync(cacheTexture, slotX*pageStride, slotY*pageStride, pageStride, pageStride, PixelFormat::R8G8B8A8, loaded.pixels.data());
+
+    slots[slot].page = loaded.page;
+    slots[slot].lastFrame = frameCounter;
+    pageSlots[loaded.page] = slot;
+    uploadedPages++;
+
+    FillIndirection(level, x, y, static_cast<uint32_t>(slotX) | (static_cast<uint32_t>(slotY) << 8) | (static_cast<uint32_t>(level) << 16) | 0xff000000u);
+}
+
+// Set the indirection entry of a page and of its descendants not resident
+void VirtualTexture::FillIndirection(int level, int x, int y, uint32_t entry)
+{
+    const int width = std::max(pagesX >> level, 1);
+    const int height = std::max(pagesY >> level, 1);
+    if ((x >= width) || (y >= height)) return;
+
+    // Resident descendants keep their own entry (and so do their descendants)
+    auto it = pageSlots.find(GetPageKey(level, x, y));
+    if ((it != pageSlots.end()) && (static_cast<int>((entry >> 16) & 0xff) != level)) return;
+
+    indirection[level][y*width + x] = entry;
+    indirectionDirty[level] = true;
+
+    if (level == 0) return;
+
+    // NOTE: Levels with a single row or column of pages have a single child on that axis
+    const int childWidth = std::max(pagesX >> (level - 1), 1);
+    const int childHeight = std::max(pagesY >> (level - 1), 1);
+    const int childX = (childWidth > width)? 2*x : x;
+    const int childY = (childHeight > height)? 2*y : y;
+    const int lastX = (childWidth > width)? childX + 1 : childX;
+    const int lastY = (childHeight > height)? childY + 1 : childY;
+
+    for (int j = childY; j <= lastY; j++)
+    {
+        for (int i = childX; i <= lastX; i++) FillIndirection(level - 1, i, j, entry);
+    }
+}
+
+void VirtualTexture::LoaderThread()
+{
+    std::vector<uint8_t> pixels;
+
+    while (true)
+    {
+        uint64_t page = NO_PAGE;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.wait(lock, [this]() { return stopThread || !requests.empty(); });
+
+            if (stopThread) break;
+
+            // Coarser pages first, they are the fallback of the finer ones
+            auto it = std::max_element(requests.begin(), requests.end(), [](uint64_t a, uint64_t b) { return GetPageLevel(a) < GetPageLevel(b); });
+            page = *it;
+            requests.erase(it);
+            loadingPage = page;
+        }
+
+        pixels.resize(static_cast<std::size_t>(pageStride)*pageStride*4);
+
+        const int level = GetPageLevel(page);
+        const bool loaded = loader(level, GetPageX(page)*desc.pageSize - desc.pageBorder, GetPageY(page)*desc.pageSize - desc.pageBorder,
+            pageStride, pageStride, pixels.data());
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            LoadedPage result;
+            result.page = page;
+            if (loaded) result.pixels = std::move(pixels);
+
+            loadedPages.push_back(std::move(result));
+            loadingPage = NO_PAGE;
+        }
+    }
+}
@@ -1,10 +1,12 @@
 #include "rlgl.hpp"
+#include "rlCapture.hpp"
 
 #include "rlEnums.hpp"
 #include "rlUtils.hpp"
 #include "rlGLExt.hpp"
 #include "rlException.hpp"
 #include "rlRenderBatch.hpp"
+#include "rlTrace.hpp"
 
 #include <cmath>
 #include <string>
@@ -14,9 +16,14 @@
 
 using namespace rlgl;
 
-Context::Context(int width, int height, void *extLoader(const char *)) : state()
+Context::Context(int width, int height, void *extLoader(const char *), const BatchConfig& config) : state(), batchConfig(config)
 {
     // Load OpenGL extensions automatically if a loader is given
+    // NOTE: The null backend does not need a loader, GL calls are always routed to it
+#   if defined(RLGL_NULL_GL)
+        if (extLoader == nullptr) extLoader = NullGLLoader;
+#   endif
+
     if (extLoader != nullptr && !IsExtensionsLoaded())
     {
         LoadExtensions(extLoader);
@@ -61,7 +68,14 @@ Context::Context(int width, int height, void *extLoader(const char *)) : state()
         state.currentShaderLocs = state.defaultShaderLocs;
 
         // Init default vertex arrays buffers
-        defaultBatch = std::make_unique<RenderBatch>(*this, RL_DEFAULT_BATCH_BUFFERS, RL_DEFAULT_BATCH_BUFFER_ELEMENTS, RL_DEFAULT_BATCH_DRAWCALLS);
+        // NOTE: Batch buffers elements are limited by the index type (16 bit on OpenGL ES 2.0)
+        batchConfig.bufferCount = std::max(batchConfig.bufferCount, 1);
+        batchConfig.bufferElements = std::clamp(batchConfig.bufferElements, 1, RL_MAX_BATCH_BUFFER_ELEMENTS);
+        batchConfig.drawCallsLimit = std::max(batchConfig.drawCallsLimit, 1);
+        batchConfig.maxBufferElements = std::clamp(batchConfig.maxBufferElements, 1, RL_MAX_BATCH_BUFFER_ELEMENTS);
+        batchConfig.minBufferElements = std::clamp(batchConfig.minBufferElements, 1, batchConfig.maxBufferElements);
+
+        defaultBatch = std::make_unique<RenderBatch>(*this, batchConfig.bufferCount, batchConfig.bufferElements, batchConfig.drawCallsLimit);
         currentBatch = defaultBatch.get();
 
         // Init counters
@@ -128,6 +142,19 @@ Context::~Context()
     UnloadShaderDefault();                          // Unload default shader
     glDeleteTextures(1, &state.defaultTextureId);   // Unload default texture
 
+    readbackBuffer.reset();                         // Unload readback staging buffers
+    uploadBuffer.reset();                           // Unload upload staging buffers
+
+#   if defined(RLGL_RENDER_TEXTURES_HINT)
+        if (readFramebuffer != 0) glDeleteFramebuffers(1, &readFramebuffer);
+#   endif
+
+    // Unload utility geometry
+    if (drawQuadVao != 0) glDeleteVertexArrays(1, &drawQuadVao);
+    if (drawQuadVbo != 0) glDeleteBuffers(1, &drawQuadVbo);
+    if (drawCubeVao != 0) glDeleteVertexArrays(1, &drawCubeVao);
+    if (drawCubeVbo != 0) glDeleteBuffers(1, &drawCubeVbo);
+
     TRACELOG(LogInfo, "TEXTURE: [ID %i] Default texture unloaded successfully", state.defaultTextureId);
 
 #endif
@@ -139,6 +166,8 @@ Context::~Context()
 
 void Context::MatrixMode(enum MatrixMode mode)
 {
+    RLGL_CAPTURE(MatrixMode, mode);
+
     switch (mode)
     {
         case MatrixMode::Projection: glMatrixMode(GL_PROJECTION);   break;
@@ -150,46 +179,55 @@ void Context::MatrixMode(enum MatrixMode mode)
 
 void Context::Frustum(double left, double right, double bottom, double top, double znear, double zfar)
 {
+    RLGL_CAPTURE(Frustum, left, right, bottom, top, znear, zfar);
     glFrustum(left, right, bottom, top, znear, zfar);
 }
 
 void Context::Ortho(double left, double right, double bottom, double top, double znear, double zfar)
 {
+    RLGL_CAPTURE(Ortho, left, right, bottom, top, znear, zfar);
     glOrtho(left, right, bottom, top, znear, zfar);
 }
 
 void Context::PushMatrix()
 {
+    RLGL_CAPTURE(PushMatrix);
     glPushMatrix();
 }
 
 void Context::PopMatrix()
 {
+    RLGL_CAPTURE(PopMatrix);
     glPopMatrix();
 }
 
 void Context::LoadIdentity()
 {
+    RLGL_CAPTURE(LoadIdentity);
     glLoadIdentity();
 }
 
 void Context::Translate(float x, float y, float z)
 {
+    RLGL_CAPTURE(Translate, x, y, z);
     glTranslatef(x, y, z);
 }
 
 void Context::Rotate(float angle, float x, float y, float z)
 {
+    RLGL_CAPTURE(Rotate, angle, x, y, z);
     glRotatef(angle, x, y, z);
 }
 
 void Context::Scale(float x, float y, float z)
 {
+    RLGL_CAPTURE(Scale, x, y, z);
     glScalef(x, y, z);
 }
 
 void Context::MultMatrix(const float *matf)
 {
+    RLGL_CAPTURE(MultMatrix, CaptureData{ matf, 16*sizeof(float) });
     glMultMatrixf(matf);
 }
 
@@ -200,6 +238,8 @@ void Context::MultMatrix(const float *matf)
 // Choose the current matrix to be transformed
 void Context::MatrixMode(enum MatrixMode mode)
 {
+    RLGL_CAPTURE(MatrixMode, mode);
+
     switch (mode)
     {
         case MatrixMode::Projection:
@@ -221,6 +261,8 @@ void Context::MatrixMode(enum MatrixMode mode)
 // Push the current matrix into state.stack
 void Context::PushMatrix()
 {
+    RLGL_CAPTURE(PushMatrix);
+
     if (state.stackCounter >= RL_MAX_MATRIX_STACK_SIZE)
     {
         TRACELOG(LogError, "RLGL: Matrix stack overflow (RL_MAX_MATRIX_STACK_SIZE)");
@@ -239,6 +281,8 @@ void Context::PushMatrix()
 // Pop lattest inserted matrix from state.stack
 void Context::PopMatrix()
 {
+    RLGL_CAPTURE(PopMatrix);
+
     if (state.stackCounter > 0)
     {
         Matrix mat = state.stack[state.stackCounter - 1];
@@ -256,12 +300,15 @@ void Context::PopMatrix()
 // Reset current matrix to identity matrix
 void Context::LoadIdentity()
 {
+    RLGL_CAPTURE(LoadIdentity);
     *state.currentMatrix = Matrix::Identity();
 }
 
 // Multiply the current matrix by a translation matrix
 void Context::Translate(float x, float y, float z)
 {
+    RLGL_CAPTURE(Translate, x, y, z);
+
     // NOTE: We transpose matrix with multiplication order
     *state.currentMatrix = Matrix::Translate(x, y, z) * (*state.currentMatrix);
 }
@@ -270,6 +317,8 @@ void Context::Translate(float x, float y, float z)
 // NOTE: The provided angle must be in degrees
 void Context::Rotate(float angle, float x, float y, float z)
 {
+    RLGL_CAPTURE(Rotate, angle, x, y, z);
+
     // Axis vector (x, y, z) normalization
     float lengthSquared = x*x + y*y + z*z;
     if ((lengthSquared != 1.0f) && (lengthSquared != 0.0f))
@@ -287,6 +336,8 @@ void Context::Rotate(float angle, float x, float y, float z)
 // Multiply the current matrix by a scaling matrix
 void Context::Scale(float x, float y, float z)
 {
+    RLGL_CAPTURE(Scale, x, y, z);
+
     // NOTE: We transpose matrix with multiplication order
     *state.currentMatrix = Matrix::Scale(x, y, z) * (*state.currentMatrix);
 }
@@ -294,18 +345,21 @@ void Context::Scale(float x, float y, float z)
 // Multiply the current matrix by another matrix
 void Context::MultMatrix(const float *matf)
 {
+    RLGL_CAPTURE(MultMatrix, CaptureData{ matf, 16*sizeof(float) });
     *state.currentMatrix = (*state.currentMatrix) * matf;
 }
 
 // Multiply the current matrix by a perspective matrix generated by parameters
 void Context::Frustum(double left, double right, double bottom, double top, double znear, double zfar)
 {
+    RLGL_CAPTURE(Frustum, left, right, bottom, top, znear, zfar);
     *state.currentMatrix = (*state.currentMatrix) * Matrix::Frustum(left, right, bottom, top, znear, zfar);
 }
 
 // Multiply the current matrix by an orthographic matrix generated by parameters
 void Context::Ortho(double left, double right, double bottom, double top, double znear, double zfar)
 {
+    RLGL_CAPTURE(Ortho, left, right, bottom, top, znear, zfar);
     *state.currentMatrix = (*state.currentMatrix) * Matrix::Ortho(left, right, bottom, top, znear, zfar);
 }
 
@@ -315,7 +369,9 @@ void Context::Ortho(double left, double right, double bottom, double top, double
 // NOTE: We store current viewport dimensions
 void Context::Viewport(int x, int y, int width, int height)
 {
+    RLGL_CAPTURE(Viewport, x, y, width, height);
     glViewport(x, y, width, height);
+    RLGL_STAT(frameStats.stateChanges++);
 }
 
 //----------------------------------------------------------------------------------
@@ -328,6 +384,8 @@ void Context::Viewport(int x, int y, int width, int height)
 
 void Context::Begin(DrawMode mode)
 {
+    RLGL_CAPTURE(Begin, mode);
+
     switch (mode)
     {
         case DrawMode::Lines:       glBegin(GL_LINES);          break;
@@ -339,46 +397,55 @@ void Context::Begin(DrawMode mode)
 
 void Context::End()
 {
+    RLGL_CAPTURE(End);
     glEnd();
 }
 
 void Context::Vertex(int x, int y)
 {
+    RLGL_CAPTURE(Vertex2i, x, y);
     glVertex2i(x, y);
 }
 
 void Context::Vertex(float x, float y)
 {
+    RLGL_CAPTURE(Vertex2f, x, y);
     glVertex2f(x, y);
 }
 
 void Context::Vertex(float x, float y, float z)
 {
+    RLGL_CAPTURE(Vertex3f, x, y, z);
     glVertex3f(x, y, z);
 }
 
 void Context::TexCoord(float x, float y)
 {
+    RLGL_CAPTURE(TexCoord, x, y);
     glTexCoord2f(x, y);
 }
 
 void Context::Normal(float x, float y, float z)
 {
+    RLGL_CAPTURE(Normal, x, y, z);
     glNormal3f(x, y, z);
 }
 
 void Context::Color(uint8_t r, uint8_t g, uint8_t b, uint8_t a)
 {
+    RLGL_CAPTURE(Color4ub, r, g, b, a);
     glColor4ub(r, g, b, a);
 }
 
 void Context::Color(float x, float y, float z)
 {
+    RLGL_CAPTURE(Color3f, x, y, z);
     glColor3f(x, y, z);
 }
 
 void Context::Color(float x, float y, float z, float w)
 {
+    RLGL_CAPTURE(Color4f, x, y, z, w);
     glColor4f(x, y, z, w);
 }
 
@@ -389,6 +456,8 @@ void Context::Color(float x, float y, float z, float w)
 // Initialize drawing mode (how to organize vertex)
 void Context::Begin(DrawMode mode)
 {
+    RLGL_CAPTURE(Begin, mode);
+
     DrawCall *drawCall = currentBatch->GetLastDrawCall();
 
     // Draw mode can be RL_LINES, RL_TRIANGLES and RL_QUADS
@@ -424,7 +493,7 @@ void Context::Begin(DrawMode mode)
 
         if (currentBatch->GetDrawCallCounter() >= currentBatch->GetDrawCallLimit())
         {
-            DrawRenderBatch(currentBatch);
+            DrawRenderBatch(currentBatch, FlushReason::DrawCallLimit);
             drawCall = currentBatch->GetLastDrawCall();
         }
 
@@ -438,6 +507,8 @@ void Context::Begin(DrawMode mode)
 // Finish vertex providing
 void Context::End()
 {
+    RLGL_CAPTURE(End);
+
     // NOTE: Depth increment is dependant on Context::Ortho(): z-near and z-far values,
     // as well as depth buffer bit-depth (16bit or 24bit or 32bit)
     // Correct increment formula would be: depthInc = (zfar - znear)/pow(2, bits)
@@ -448,6 +519,8 @@ void Context::End()
 // NOTE: Vertex position data is the basic information required for drawing
 void Context::Vertex(float x, float y, float z)
 {
+    RLGL_CAPTURE(Vertex3f, x, y, z);
+
     DrawCall *drawCall = currentBatch->GetLastDrawCall();
     VertexBuffer *curBuffer = currentBatch->GetCurrentBuffer();
 
@@ -509,12 +582,14 @@ void Context::Vertex(float x, float y, float z)
 // Define one vertex (position)
 void Context::Vertex(float x, float y)
 {
+    RLGL_CAPTURE(Vertex2f, x, y);
     Vertex(x, y, currentBatch->GetCurrentDepth());
 }
 
 // Define one vertex (position)
 void Context::Vertex(int x, int y)
 {
+    RLGL_CAPTURE(Vertex2i, x, y);
     Vertex(static_cast<float>(x), static_cast<float>(y), currentBatch->GetCurrentDepth());
 }
 
@@ -522,6 +597,7 @@ void Context::Vertex(int x, int y)
 // NOTE: Texture coordinates are limited to QUADS only
 void Context::TexCoord(float x, float y)
 {
+    RLGL_CAPTURE(TexCoord, x, y);
     state.texcoordx = x;
     state.texcoordy = y;
 }
@@ -530,6 +606,7 @@ void Context::TexCoord(float x, float y)
 // NOTE: Normals limited to TRIANGLES only?
 void Context::Normal(float x, float y, float z)
 {
+    RLGL_CAPTURE(Normal, x, y, z);
     state.normalx = x;
     state.normaly = y;
     state.normalz = z;
@@ -538,6 +615,8 @@ void Context::Normal(float x, float y, float z)
 // Define one vertex (color)
 void Context::Color(uint8_t x, uint8_t y, uint8_t z, uint8_t w)
 {
+    RLGL_CAPTURE(Color4ub, x, y, z, w);
+
     state.colorr = x;
     state.colorg = y;
     state.colorb = z;
@@ -547,6 +626,8 @@ void Context::Color(uint8_t x, uint8_t y, uint8_t z, uint8_t w)
 // Define one vertex (color)
 void Context::Color(float r, float g, float b, float a)
 {
+    RLGL_CAPTURE(Color4f, r, g, b, a);
+
     Color(static_cast<uint8_t>(r*255),
           static_cast<uint8_t>(g*255),
           static_cast<uint8_t>(b*255),
@@ -556,6 +637,8 @@ void Context::Color(float r, float g, float b, float a)
 // Define one vertex (color)
 void Context::Color(float x, float y, float z)
 {
+    RLGL_CAPTURE(Color3f, x, y, z);
+
     Color(static_cast<uint8_t>(x*255),
           static_cast<uint8_t>(y*255),
           static_cast<uint8_t>(z*255),
@@ -571,6 +654,8 @@ void Context::Color(float x, float y, float z)
 // Set current texture to use
 void Context::SetTexture(uint32_t id)
 {
+    RLGL_CAPTURE(SetTexture, id);
+
 #if defined(GRAPHICS_API_OPENGL_11)
 
     (id == 0 ? DisableTexture() : EnableTexture(id));
@@ -581,7 +666,7 @@ void Context::SetTexture(uint32_t id)
     {
         if (state.vertexCounter >= currentBatch->GetCurrentBuffer()->elementCount*4)
         {
-            DrawRenderBatch(currentBatch);
+            DrawRenderBatch(currentBatch, FlushReason::VertexLimit);
         }
         return;
     }
@@ -622,7 +707,7 @@ void Context::SetTexture(uint32_t id)
 
     if (currentBatch->GetDrawCallCounter() >= currentBatch->GetDrawCallLimit())
     {
-        DrawRenderBatch(currentBatch);
+        DrawRenderBatch(currentBatch, FlushReason::DrawCallLimit);
         drawCall = currentBatch->GetLastDrawCall();
     }
 
@@ -635,6 +720,7 @@ void Context::SetTexture(uint32_t id)
 // Select and active a texture slot
 void Context::ActiveTextureSlot(int slot)
 {
+    RLGL_CAPTURE(ActiveTextureSlot, slot);
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glActiveTexture(GL_TEXTURE0 + slot);
 #endif
@@ -643,16 +729,21 @@ void Context::ActiveTextureSlot(int slot)
 // Enable texture
 void Context::EnableTexture(uint32_t id)
 {
+    RLGL_CAPTURE(EnableTexture, id);
+
 #   if defined(GRAPHICS_API_OPENGL_11)
         glEnable(GL_TEXTURE_2D);
 #   endif
 
     glBindTexture(GL_TEXTURE_2D, id);
+    RLGL_STAT(frameStats.textureBinds++);
 }
 
 // Disable texture
 void Context::DisableTexture()
 {
+    RLGL_CAPTURE(DisableTexture);
+
 #   if defined(GRAPHICS_API_OPENGL_11)
         glDisable(GL_TEXTURE_2D);
 #   endif
@@ -663,14 +754,18 @@ void Context::DisableTexture()
 // Enable texture cubemap
 void Context::EnableTextureCubemap(uint32_t id)
 {
+    RLGL_CAPTURE(EnableTextureCubemap, id);
+
 #   if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
         glBindTexture(GL_TEXTURE_CUBE_MAP, id);
+        RLGL_STAT(frameStats.textureBinds++);
 #   endif
 }
 
 // Disable texture cubemap
 void Context::DisableTextureCubemap()
 {
+    RLGL_CAPTURE(DisableTextureCubemap);
 #   if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
         glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
 #   endif
@@ -679,6 +774,8 @@ void Context::DisableTextureCubemap()
 // Set texture parameters (wrap mode)
 void Context::TextureParameters(uint32_t id, TextureParam param, TextureWrap wrap)
 {
+    RLGL_CAPTURE(TextureParameterWrap, id, param, wrap);
+
     if (param == TextureParam::Wrap_S || param == TextureParam::Wrap_T)
     {
         glBindTexture(GL_TEXTURE_2D, id);
@@ -703,6 +800,8 @@ void Context::TextureParameters(uint32_t id, TextureParam param, TextureWrap wra
 // Set texture parameters (filter mode)
 void Context::TextureParameters(uint32_t id, TextureParam param, TextureFilter filter)
 {
+    RLGL_CAPTURE(TextureParameterFilter, id, param, filter);
+
     if (param == TextureParam::MagFilter || param == TextureParam::MinFilter)
     {
         glBindTexture(GL_TEXTURE_2D, id);
@@ -715,6 +814,8 @@ void Context::TextureParameters(uint32_t id, TextureParam param, TextureFilter f
 // Set texture parameters
 void Context::TextureParameters(uint32_t id, TextureParam param, float value)
 {
+    RLGL_CAPTURE(TextureParameterFloat, id, param, value);
+
     if (param == TextureParam::Anisotropy)
     {
 #       if !defined(GRAPHICS_API_OPENGL_11)
@@ -753,6 +854,8 @@ void Context::TextureParameters(uint32_t id, TextureParam param, float value)
 // Set cubemap parameters (wrap mode)
 void Context::CubemapParameters(uint32_t id, TextureParam param, TextureWrap wrap)
 {
+    RLGL_CAPTURE(CubemapParameterWrap, id, param, wrap);
+
 #if !defined(GRAPHICS_API_OPENGL_11)
 
     if (param == TextureParam::Wrap_S || param == TextureParam::Wrap_T)
@@ -781,6 +884,8 @@ void Context::CubemapParameters(uint32_t id, TextureParam param, TextureWrap wra
 // Set cubemap parameters (filter mode)
 void Context::CubemapParameters(uint32_t id, TextureParam param, TextureFilter filter)
 {
+    RLGL_CAPTURE(CubemapParameterFilter, id, param, filter);
+
 #if !defined(GRAPHICS_API_OPENGL_11)
 
     if (param == TextureParam::MagFilter || param == TextureParam::MinFilter)
@@ -797,6 +902,8 @@ void Context::CubemapParameters(uint32_t id, TextureParam param, TextureFilter f
 // Set cubemap parameters
 void Context::CubemapParameters(uint32_t id, TextureParam param, float value)
 {
+    RLGL_CAPTURE(CubemapParameterFloat, id, param, value);
+
 #if !defined(GRAPHICS_API_OPENGL_11)
 
     if (param == TextureParam::Anisotropy)
@@ -835,38 +942,51 @@ void Context::CubemapParameters(uint32_t id, TextureParam param, float value)
 // Enable shader program
 void Context::EnableShader(uint32_t id)
 {
+    RLGL_CAPTURE(EnableShader, id);
+
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
     glUseProgram(id);
+    RLGL_STAT(frameStats.stateChanges++);
 #endif
 }
 
 // Disable shader program
 void Context::DisableShader()
 {
+    RLGL_CAPTURE(DisableShader);
+
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
     glUseProgram(0);
+    RLGL_STAT(frameStats.stateChanges++);
 #endif
 }
 
 // Enable rendering to texture (fbo)
 void Context::EnableFramebuffer(uint32_t id)
 {
+    RLGL_CAPTURE(EnableFramebuffer, id);
+
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
     glBindFramebuffer(GL_FRAMEBUFFER, id);
+    RLGL_STAT(frameStats.stateChanges++);
 #endif
 }
 
 // Disable rendering to texture
 void Context::DisableFramebuffer()
 {
+    RLGL_CAPTURE(DisableFramebuffer);
+
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    RLGL_STAT(frameStats.stateChanges++);
 #endif
 }
 
 // Blit active framebuffer to main framebuffer
 void Context::BlitFramebuffer(int srcX, int srcY, int srcWidth, int srcHeight, int dstX, int dstY, int dstWidth, int dstHeight, int bufferMask)
 {
+    RLGL_CAPTURE(BlitFramebuffer, srcX, srcY, srcWidth, srcHeight, dstX, dstY, dstWidth, dstHeight, bufferMask);
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)) && defined(RLGL_RENDER_TEXTURES_HINT)
     glBlitFramebuffer(srcX, srcY, srcWidth, srcHeight, dstX, dstY, dstWidth, dstHeight, bufferMask, GL_NEAREST);
 #endif
@@ -876,6 +996,8 @@ void Context::BlitFramebuffer(int srcX, int srcY, int srcWidth, int srcHeight, i
 // NOTE: One color buffer is always active by default
 void Context::ActiveDrawBuffers(int count)
 {
+    RLGL_CAPTURE(ActiveDrawBuffers, count);
+
 #if ((defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)) && defined(RLGL_RENDER_TEXTURES_HINT))
 
     // NOTE: Maximum number of draw buffers supported is implementation dependant,
@@ -934,110 +1056,146 @@ void Context::ActiveDrawBuffers(int count)
 // Enable color blending
 void Context::EnableColorBlend()
 {
+    RLGL_CAPTURE(EnableColorBlend);
     glEnable(GL_BLEND);
+    RLGL_STAT(frameStats.stateChanges++);
 }
 
 // Disable color blending
 void Context::DisableColorBlend()
 {
+    RLGL_CAPTURE(DisableColorBlend);
     glDisable(GL_BLEND);
+    RLGL_STAT(frameStats.stateChanges++);
 }
 
 // Enable depth test
 void Context::EnableDepthTest()
 {
+    RLGL_CAPTURE(EnableDepthTest);
     glEnable(GL_DEPTH_TEST);
+    RLGL_STAT(frameStats.stateChanges++);
 }
 
 // Disable depth test
 void Context::DisableDepthTest()
 {
+    RLGL_CAPTURE(DisableDepthTest);
     glDisable(GL_DEPTH_TEST);
+    RLGL_STAT(frameStats.stateChanges++);
 }
 
 // Enable depth write
 void Context::EnableDepthMask()
 {
+    RLGL_CAPTURE(EnableDepthMask);
     glDepthMask(GL_TRUE);
+    RLGL_STAT(frameStats.stateChanges++);
 }
 
 // Disable depth write
 void Context::DisableDepthMask()
 {
+    RLGL_CAPTURE(DisableDepthMask);
     glDepthMask(GL_FALSE);
+    RLGL_STAT(frameStats.stateChanges++);
 }
 
 // Enable backface culling
 void Context::EnableBackfaceCulling()
 {
+    RLGL_CAPTURE(EnableBackfaceCulling);
     glEnable(GL_CULL_FACE);
+    RLGL_STAT(frameStats.stateChanges++);
 }
 
 // Disable backface culling
 void Context::DisableBackfaceCulling()
 {
+    RLGL_CAPTURE(DisableBackfaceCulling);
     glDisable(GL_CULL_FACE);
+    RLGL_STAT(frameStats.stateChanges++);
 }
 
 // Set face culling mode
 void Context::SetCullFace(CullMode mode)
 {
+    RLGL_CAPTURE(SetCullFace, mode);
+
     switch (mode)
     {
         case CullMode::FaceBack: glCullFace(GL_BACK); break;
         case CullMode::FaceFront: glCullFace(GL_FRONT); break;
         default: break;
     }
+
+    RLGL_STAT(frameStats.stateChanges++);
 }
 
 // Enable scissor test
 void Context::EnableScissorTest()
 {
+    RLGL_CAPTURE(EnableScissorTest);
     glEnable(GL_SCISSOR_TEST);
+    RLGL_STAT(frameStats.stateChanges++);
 }
 
 // Disable scissor test
 void Context::DisableScissorTest()
 {
+    RLGL_CAPTURE(DisableScissorTest);
     glDisable(GL_SCISSOR_TEST);
+    RLGL_STAT(frameStats.stateChanges++);
 }
 
 // Scissor test
 void Context::Scissor(int x, int y, int width, int height)
 {
+    RLGL_CAPTURE(Scissor, x, y, width, height);
     glScissor(x, y, width, height);
+    RLGL_STAT(frameStats.stateChanges++);
 }
 
 // Enable wire mode
 void Context::EnableWireMode()
 {
+    RLGL_CAPTURE(EnableWireMode);
+
 #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
     // NOTE: glPolygonMode() not available on OpenGL ES
     glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
+    RLGL_STAT(frameStats.stateChanges++);
 #endif
 }
 
 void Context::EnablePointMode()
 {
+    RLGL_CAPTURE(EnablePointMode);
+
 #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
     // NOTE: glPolygonMode() not available on OpenGL ES
     glPolygonMode(GL_FRONT_AND_BACK, GL_POINT);
     glEnable(GL_PROGRAM_POINT_SIZE);
+    RLGL_STAT(frameStats.stateChanges++);
 #endif
 }
 
 // Disable wire mode
 void Context::DisableWireMode()
 {
+    RLGL_CAPTURE(DisableWireMode);
+
 #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
     // NOTE: glPolygonMode() not available on OpenGL ES
     glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+    RLGL_STAT(frameStats.stateChanges++);
 #endif
 }
 
 // Set the line drawing width
 void Context::SetLineWidth(float width)
 {
+    RLGL_CAPTURE(SetLineWidth, width);
     glLineWidth(width);
 }
 
@@ -1052,6 +1210,7 @@ float Context::GetLineWidth() const
 // Enable line aliasing
 void Context::EnableSmoothLines()
 {
+    RLGL_CAPTURE(EnableSmoothLines);
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_11)
     glEnable(GL_LINE_SMOOTH);
 #endif
@@ -1060,22 +1219,37 @@ void Context::EnableSmoothLines()
 // Disable line aliasing
 void Context::DisableSmoothLines()
 {
+    RLGL_CAPTURE(DisableSmoothLines);
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_11)
     glDisable(GL_LINE_SMOOTH);
 #endif
 }
 
 // Enable stereo rendering
-void Context::EnableStereoRender()
+void Context::EnableStereoRender(bool singlePass)
 {
+    RLGL_CAPTURE(EnableStereoRender, singlePass);
+
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
     state.stereoRender = true;
+    state.stereoSinglePass = false;
+
+#   if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+        if (singlePass)
+        {
+            if (state.defaultStereoShaderId == 0) LoadShaderStereo();
+            state.stereoSinglePass = (state.defaultStereoShaderId != 0);
+        }
+#   endif
+
+    if (singlePass && !state.stereoSinglePass) TRACELOG(LogWarning, "RLGL: Single-pass stereo rendering not supported, using one pass per eye");
 #endif
 }
 
 // Disable stereo rendering
 void Context::DisableStereoRender()
 {
+    RLGL_CAPTURE(DisableStereoRender);
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
     state.stereoRender = false;
 #endif
@@ -1091,9 +1265,39 @@ bool Context::IsStereoRenderEnabled()
 #endif
 }
 
+// Get default single-pass stereo vertex shader code
+const char *Context::GetShaderStereoVertexCode()
+{
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    // NOTE: Eye 0 is drawn on the left half of the framebuffer, eye 1 on the right half (same as multi-pass stereo)
+    return
+        "#version 330\n"
+        "in vec3 vertexPosition;"
+        "in vec2 vertexTexCoord;"
+        "in vec4 vertexColor;"
+        "out vec2 fragTexCoord;"
+        "out vec4 fragColor;"
+        "uniform mat4 mvpStereo[2];"
+        "void main()"
+        "{"
+            "int eye = gl_InstanceID;"
+            "fragTexCoord = vertexTexCoord;"
+            "fragColor = vertexColor;"
+            "vec4 position = mvpStereo[eye]*vec4(vertexPosition, 1.0);"
+            "position.x = position.x*0.5 + ((eye == 0)? -0.5 : 0.5)*position.w;"
+            "gl_ClipDistance[0] = (eye == 0)? -position.x : position.x;"
+            "gl_Position = position;"
+        "}";
+#else
+    return nullptr;
+#endif
+}
+
 // Clear color buffer with color
 void Context::ClearColor(uint8_t r, uint8_t g, uint8_t b, uint8_t a)
 {
+    RLGL_CAPTURE(ClearColor, r, g, b, a);
+
     // Color values clamp to 0.0f(0) and 1.0f(255)
     glClearColor(r/255.0f, g/255.0f, b/255.0f, a/255.0f);
 }
@@ -1101,6 +1305,7 @@ void Context::ClearColor(uint8_t r, uint8_t g, uint8_t b, uint8_t a)
 // Clear used screen buffers (color and depth)
 void Context::ClearScreenBuffers()
 {
+    RLGL_CAPTURE(ClearScreenBuffers);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);     // Clear used buffers: Color and Depth (Depth is used for 3D)
     //glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);     // Stencil buffer not used...
 }
@@ -1132,10 +1337,13 @@ void Context::CheckErrors()
 // Set blend mode
 void Context::SetBlendMode(BlendMode mode)
 {
+    RLGL_CAPTURE(SetBlendMode, mode);
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if ((state.currentBlendMode != mode) || ((mode == BlendMode::Custom || mode == BlendMode::CustomSeparate) && state.glCustomBlendModeModified))
     {
-        DrawRenderBatch(currentBatch);
+        DrawRenderBatch(currentBatch, FlushReason::BlendModeChange);
+        RLGL_STAT(frameStats.stateChanges++);
 
         switch (mode)
         {
@@ -1170,6 +1378,8 @@ void Context::SetBlendMode(BlendMode mode)
 // Set blending mode factor and equation
 void Context::SetBlendFactors(int glSrcFactor, int glDstFactor, int glEquation)
 {
+    RLGL_CAPTURE(SetBlendFactors, glSrcFactor, glDstFactor, glEquation);
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if ((state.glBlendSrcFactor != glSrcFactor) ||
         (state.glBlendDstFactor != glDstFactor) ||
@@ -1187,6 +1397,8 @@ void Context::SetBlendFactors(int glSrcFactor, int glDstFactor, int glEquation)
 // Set blending mode factor and equation separately for RGB and alpha
 void Context::SetBlendFactorsSeparate(int glSrcRGB, int glDstRGB, int glSrcAlpha, int glDstAlpha, int glEqRGB, int glEqAlpha)
 {
+    RLGL_CAPTURE(SetBlendFactorsSeparate, glSrcRGB, glDstRGB, glSrcAlpha, glDstAlpha, glEqRGB, glEqAlpha);
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if ((state.glBlendSrcFactorRGB != glSrcRGB) ||
         (state.glBlendDestFactorRGB != glDstRGB) ||
@@ -1274,6 +1486,7 @@ static void GLAPIENTRY DebugMessageCallback(GLenum source, GLenum type, GLuint i
 // Set current framebuffer width
 void Context::SetFramebufferWidth(int width)
 {
+    RLGL_CAPTURE(SetFramebufferWidth, width);
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     state.framebufferWidth = width;
 #endif
@@ -1282,6 +1495,7 @@ void Context::SetFramebufferWidth(int width)
 // Set current framebuffer height
 void Context::SetFramebufferHeight(int height)
 {
+    RLGL_CAPTURE(SetFramebufferHeight, height);
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     state.framebufferHeight = height;
 #endif
@@ -1345,25 +1559,63 @@ const int *Context::GetShaderLocsDefault() const
 // NOTE: We require a pointer to reset batch and increase current buffer (multi-buffer)
 void Context::DrawRenderBatch(RenderBatch* batch)
 {
+    RLGL_CAPTURE(DrawRenderBatch);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    DrawRenderBatch(batch, FlushReason::Explicit);
+#endif
+}
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Draw render batch, the reason is only used by the frame statistics
+void Context::DrawRenderBatch(RenderBatch* batch, FlushReason reason)
+{
+    RLGL_TRACE_ZONE("Context::DrawRenderBatch");
+
+    const bool measured = (gpuProfiler != nullptr) && (state.vertexCounter > 0);
+
+    if (state.vertexCounter > 0)
+    {
+        RLGL_STAT(frameStats.flushes++);
+        RLGL_STAT(frameStats.flushReasons[static_cast<int>(reason)]++);
+    }
+
+    // Usage of the default batch, a flush forced by a limit continues the run in the next batch draw
+    if (batchConfig.autoTune && (batch == defaultBatch.get()) && (state.vertexCounter > 0))
+    {
+        batchUsage.runVertices += state.vertexCounter;
+        batchUsage.runDrawCalls += static_cast<int>(batch->GetDrawCallCounter());
+        batchUsage.peakVertices = std::max(batchUsage.peakVertices, batchUsage.runVertices);
+        batchUsage.peakDrawCalls = std::max(batchUsage.peakDrawCalls, batchUsage.runDrawCalls);
+
+        if (reason == FlushReason::VertexLimit) batchUsage.vertexOverflows++;
+        else if (reason == FlushReason::DrawCallLimit) batchUsage.drawCallOverflows++;
+        else
+        {
+            batchUsage.runVertices = 0;
+            batchUsage.runDrawCalls = 0;
+        }
+    }
 
-    batch->Draw(*this);
+    if (measured) gpuProfiler->BeginScope("RenderBatch");
+    batch->Draw(*this, &frameStats);
+    if (measured) gpuProfiler->EndScope();
 
     // Reset vertex counter for next frame
     state.vertexCounter = 0;
 
     // Reset active texture units for next batch
     std::fill(state.activeTextureId, state.activeTextureId + RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS, 0);
-
-#endif
 }
+#endif
 
 // Set the active render batch for rlgl
 void Context::SetRenderBatchActive(RenderBatch* batch)
 {
+    RLGL_CAPTURE(SetRenderBatchActive);
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 
-    DrawRenderBatch(currentBatch);
+    DrawRenderBatch(currentBatch, FlushReason::BatchChange);
     currentBatch = defaultBatch.get();
 
     if (batch == nullptr)
@@ -1384,6 +1636,7 @@ void Context::SetRenderBatchActive(RenderBatch* batch)
 // Update and draw internal render batch
 void Context::DrawRenderBatchActive()
 {
+    RLGL_CAPTURE(DrawRenderBatchActive);
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     DrawRenderBatch(currentBatch);    // NOTE: Stereo rendering is checked inside
 #endif
@@ -1393,6 +1646,8 @@ void Context::DrawRenderBatchActive()
 // and force a Context::RenderBatch draw call if required
 bool Context::CheckRenderBatchLimit(int vCount)
 {
+    RLGL_CAPTURE(CheckRenderBatchLimit, vCount);
+
     bool overflow = false;
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
@@ -1406,7 +1661,7 @@ bool Context::CheckRenderBatchLimit(int vCount)
         int currentTexture = drawCall->textureId;
         DrawMode currentMode = drawCall->mode;
 
-        DrawRenderBatch(currentBatch);    // NOTE: Stereo rendering is checked inside
+        DrawRenderBatch(currentBatch, FlushReason::VertexLimit);    // NOTE: Stereo rendering is checked inside
 
         // Restore state of last batch so we can continue adding vertices
         drawCall = currentBatch->GetLastDrawCall();
@@ -1419,22 +1674,231 @@ bool Context::CheckRenderBatchLimit(int vCount)
     return overflow;
 }
 
+// Resize the default render batch from the usage of the frames (auto-tuning)
+// NOTE: Sizes are powers of two so a growing frame does not reallocate the buffers every frame
+bool Context::TuneRenderBatch()
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+
+    if (!batchConfig.autoTune || (defaultBatch == nullptr)) return false;
+
+    // Vertex buffers can only be reallocated once drawn
+    if ((currentBatch == defaultBatch.get()) && (state.vertexCounter > 0)) return false;
+
+    RLGL_TRACE_ZONE("Context::TuneRenderBatch");
+
+    auto nextPowerOfTwo = [](int value)
+    {
+        int power = 1;
+        while ((power < value) && (power < (1 << 30))) power <<= 1;
+        return power;
+    };
+
+    const int bufferElements = batchConfig.bufferElements;
+    const int peakElements = (batchUsage.peakVertices + 3)/4;
+    int elements = bufferElements;
+    int drawCalls = batchConfig.drawCallsLimit;
+
+    if (batchUsage.vertexOverflows > 0)
+    {
+        // Grow to hold the vertices of the largest run in one batch draw
+        elements = std::max(nextPowerOfTwo(peakElements), 2*bufferElements);
+        batchUsage.idleFrames = 0;
+    }
+    else if (4*peakElements <= bufferElements)
+    {
+        // Shrink after enough frames using less than a quarter of the buffers (half of them used after shrinking)
+        batchUsage.idleFrames++;
+        batchUsage.idlePeakVertices = std::max(batchUsage.idlePeakVertices, batchUsage.peakVertices);
+
+        if (batchUsage.idleFrames >= RL_BATCH_TUNE_SHRINK_FRAMES)
+        {
+            elements = nextPowerOfTwo(2*((batchUsage.idlePeakVertices + 3)/4));
+            batchUsage.idleFrames = 0;
+        }
+    }
+    else batchUsage.idleFrames = 0;
+
+    if (batchUsage.idleFrames == 0) batchUsage.idlePeakVertices = 0;
+
+    elements = std::clamp(elements, batchConfig.minBufferElements, batchConfig.maxBufferElements);
+
+    // Draw calls only cost the queue entries, the limit is never shrunk
+    if (batchUsage.drawCallOverflows > 0) drawCalls = std::min(std::max(nextPowerOfTwo(batchUsage.peakDrawCalls), 2*drawCalls), RL_MAX_BATCH_DRAWCALLS);
+
+    const bool resized = (elements != bufferElements) || (drawCalls != batchConfig.drawCallsLimit);
+
+    if (resized)
+    {
+        defaultBatch->Resize(*this, elements, drawCalls);
+        batchConfig.bufferElements = elements;
+        batchConfig.drawCallsLimit = drawCalls;
+
+        RLGL_STAT(frameStats.batchResizes++);
+        TRACELOG(LogInfo, "RLGL: Default render batch resized to %i elements, %i draw calls", elements, drawCalls);
+    }
+
+    const int idleFrames = batchUsage.idleFrames;
+    const int idlePeakVertices = batchUsage.idlePeakVertices;
+
+    batchUsage = BatchUsage();
+    batchUsage.idleFrames = idleFrames;
+    batchUsage.idlePeakVertices = idlePeakVertices;
+
+    return resized;
+
+#else
+    return false;
+#endif
+}
+
+const BatchConfig& Context::GetBatchConfig() const
+{
+    return batchConfig;
+}
+
 // Textures data management
 //-----------------------------------------------------------------------------------------
 // Convert image data to OpenGL texture (returns OpenGL valid Id)
+// NOTE: Immutable storage is only used when the mipmap chain is given, single level textures
+// keep mutable storage so mipmaps can still be generated later with GenTextureMipmaps()
 uint32_t Context::LoadTexture(const void *data, int width, int height, PixelFormat format, int mipmapCount)
 {
+    TextureDesc desc;
+    desc.data = data;
+    desc.width = width;
+    desc.height = height;
+    desc.format = format;
+    desc.mipmapCount = mipmapCount;
+    desc.immutable = (mipmapCount > 1);
+
+    return LoadTexture(desc);
+}
+
+// Load a described texture
+uint32_t Context::LoadTexture(const TextureDesc& textureDesc)
+{
+    RLGL_TRACE_ZONE("Context::LoadTexture");
+    RLGL_CAPTURE_SCOPE();
+
     uint32_t id = 0;
 
     glBindTexture(GL_TEXTURE_2D, 0);    // Free any old binding
 
+    TextureDesc desc = textureDesc;
+
+    std::vector<uint8_t> decoded;
+    if (!IsTextureFormatSupported(desc.format) && !DecodeTextureFallback(desc, decoded)) return id;
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    glGenTextures(1, &id); // Generate texture id
+    glBindTexture(GL_TEXTURE_2D, id);
+
+    LoadTextureLevels(desc);
+
+    // Unbind current texture
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    if (id > 0) TRACELOG(LogInfo, "TEXTURE: [ID %i] Texture loaded successfully (%ix%i | %s | %i mipmaps)", id, desc.width, desc.height, GetPixelFormatName(desc.format), desc.mipmapCount);
+    else TRACELOG(LogWarning, "TEXTURE: Failed to load texture");
+
+    RLGL_CAPTURE_RECORD(LoadTexture, id, textureDesc);
+
+    return id;
+}
+
+// Load a texture from a texture file (KTX2 or DDS)
+// NOTE: Levels are uploaded from the file mapping, pages are read from disk while the driver copies them
+uint32_t Context::LoadTexture(const TextureFile& file)
+{
+    if (!file.IsValid())
+    {
+        TRACELOG(LogWarning, "TEXTURE: Failed to load texture, texture file is not valid");
+        return 0;
+    }
+
+    TextureDesc desc;
+    desc.levels = file.GetLevels();
+    desc.width = file.GetWidth();
+    desc.height = file.GetHeight();
+    desc.format = file.GetFormat();
+    desc.mipmapCount = file.GetMipmapCount();
+    desc.immutable = true;
+
+    return LoadTexture(desc);
+}
+
+// Load multiple textures at once
+// NOTE: Texture ids are generated in a single call, unpack state is set once for all the textures
+void Context::LoadTextures(const TextureDesc *descs, int count, uint32_t *ids)
+{
+    if (count <= 0) return;
+
+    RLGL_CAPTURE_SCOPE();
+
+    glBindTexture(GL_TEXTURE_2D, 0);    // Free any old binding
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    glGenTextures(count, ids);
+
+    int loadedCount = 0;
+
+    std::vector<uint8_t> decoded;
+
+    for (int i = 0; i < count; i++)
+    {
+        TextureDesc desc = descs[i];
+
+        if (!IsTextureFormatSupported(desc.format) && !DecodeTextureFallback(desc, decoded))
+        {
+            glDeleteTextures(1, &ids[i]);
+            ids[i] = 0;
+            continue;
+        }
+
+        glBindTexture(GL_TEXTURE_2D, ids[i]);
+        LoadTextureLevels(desc);
+        loadedCount++;
+
+        TRACELOGD("TEXTURE: [ID %i] Texture loaded successfully (%ix%i | %s | %i mipmaps)", ids[i], desc.width, desc.height, GetPixelFormatName(desc.format), desc.mipmapCount);
+    }
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    // NOTE: Textures are recorded one by one, the replay loads them with LoadTexture()
+    for (int i = 0; i < count; i++)
+    {
+        if (ids[i] != 0) RLGL_CAPTURE_RECORD(LoadTexture, ids[i], descs[i]);
+    }
+
+    TRACELOG(LogInfo, "TEXTURE: %i/%i textures loaded successfully", loadedCount, count);
+}
+
+// Get the pixel format of a texture once loaded (decoded format for unsupported compressed formats)
+PixelFormat Context::GetTextureLoadFormat(PixelFormat format) const
+{
+#if RL_DECODE_COMPRESSED_TEXTURES
+    if (!IsTextureFormatSupported(format) && IsDecompressionFormatSupported(format))
+    {
+        const bool opaque = (format == PixelFormat::DXT1_RGB) || (format == PixelFormat::ETC1_RGB) || (format == PixelFormat::ETC2_RGB);
+        return (RL_DECODE_OPAQUE_TO_R5G6B5 && opaque)? PixelFormat::R5G6B5 : PixelFormat::R8G8B8A8;
+    }
+#endif
+
+    return format;
+}
+
+// Check if a texture format can be loaded with current OpenGL version and extensions
+bool Context::IsTextureFormatSupported(PixelFormat format) const
+{
     // Check texture format support by OpenGL 1.1 (compressed textures not supported)
 #   if defined(GRAPHICS_API_OPENGL_11)
 
         if (format >= PixelFormat::DXT1_RGB)
         {
             TRACELOG(LogWarning, "GL: OpenGL 1.1 does not support GPU compressed texture formats");
-            return id;
+            return false;
         }
 
 #   else
@@ -1443,7 +1907,7 @@ uint32_t Context::LoadTexture(const void *data, int width, int height, PixelForm
             (format == PixelFormat::DXT3_RGBA) || (format == PixelFormat::DXT5_RGBA)))
         {
             TRACELOG(LogWarning, "GL: DXT compressed texture format not supported");
-            return id;
+            return false;
         }
 
 #       if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
@@ -1451,35 +1915,114 @@ uint32_t Context::LoadTexture(const void *data, int width, int height, PixelForm
             if ((!GetExtensions().texCompETC1) && (format == PixelFormat::ETC1_RGB))
             {
                 TRACELOG(LogWarning, "GL: ETC1 compressed texture format not supported");
-                return id;
+                return false;
             }
 
             if ((!GetExtensions().texCompETC2) && ((format == PixelFormat::ETC2_RGB) || (format == PixelFormat::ETC2_EAC_RGBA)))
             {
                 TRACELOG(LogWarning, "GL: ETC2 compressed texture format not supported");
-                return id;
+                return false;
             }
 
             if ((!GetExtensions().texCompPVRT) && ((format == PixelFormat::PVRT_RGB) || (format == PixelFormat::PVRT_RGBA)))
             {
                 TRACELOG(LogWarning, "GL: PVRT compressed texture format not supported");
-                return id;
+                return false;
             }
 
             if ((!GetExtensions().texCompASTC) && ((format == PixelFormat::ASTC_4x4_RGBA) || (format == PixelFormat::ASTC_8x8_RGBA)))
             {
                 TRACELOG(LogWarning, "GL: ASTC compressed texture format not supported");
-                return id;
+                return false;
             }
 
 #       endif
 
 #   endif  // GRAPHICS_API_OPENGL_11
 
-    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    return true;
+}
 
-    glGenTextures(1, &id); // Generate texture id
-    glBindTexture(GL_TEXTURE_2D, id);
+// Decode compressed texture data not supported by the driver on the CPU
+// NOTE: The description is updated to refer to the decoded pixels, stored in the given vector
+bool Context::DecodeTextureFallback(TextureDesc& desc, std::vector<uint8_t>& pixels) const
+{
+#if RL_DECODE_COMPRESSED_TEXTURES
+    if (!IsDecompressionFormatSupported(desc.format)) return false;
+
+    const PixelFormat format = GetTextureLoadFormat(desc.format);
+
+    // NOTE: Textures without data (storage only) just change format
+    if (desc.levels != nullptr)
+    {
+        const int mipmapCount = std::max(desc.mipmapCount, 1);
+        pixels.resize(GetMipmapChainDataSize(desc.width, desc.height, format, mipmapCount));
+
+        // Non contiguous levels are decoded one by one
+        for (int i = 0, offset = 0; i < mipmapCount; i++)
+        {
+            const int mipWidth = std::max(desc.width >> i, 1);
+            const int mipHeight = std::max(desc.height >> i, 1);
+
+            if (!DecompressImage(desc.levels[i], mipWidth, mipHeight, desc.format, pixels.data() + offset, format)) return false;
+            offset += GetPixelDataSize(mipWidth, mipHeight, format);
+        }
+
+        desc.data = pixels.data();
+        desc.levels = nullptr;
+    }
+    else if (desc.data != nullptr)
+    {
+        pixels = DecompressMipmapChain(desc.data, desc.width, desc.height, std::max(desc.mipmapCount, 1), desc.format, format);
+        if (pixels.empty()) return false;
+
+        desc.data = pixels.data();
+    }
+
+    TRACELOG(LogInfo, "TEXTURE: Compressed format %s decoded on the CPU to %s", GetPixelFormatName(desc.format), GetPixelFormatName(format));
+
+    desc.format = format;
+    return true;
+#else
+    (void)desc;
+    (void)pixels;
+    return false;
+#endif
+}
+
+// Allocate and upload the mipmap levels of the currently bound texture, then set its parameters
+// NOTE: With immutable storage (OpenGL 4.2, GL_ARB_texture_storage, OpenGL ES 3.0) all the levels are
+// allocated at once with a sized internal format, data is then uploaded level by level
+void Context::LoadTextureLevels(const TextureDesc& desc)
+{
+    const void *data = desc.data;
+    const int width = desc.width;
+    const int height = desc.height;
+    const PixelFormat format = desc.format;
+    const int mipmapCount = std::max(desc.mipmapCount, 1);
+
+    bool immutable = false;
+
+#   if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+
+        const uint32_t glSizedFormat = GetGlSizedInternalFormat(format);
+
+        if (desc.immutable && GetExtensions().texStorage && (glSizedFormat != 0))
+        {
+            int levels = mipmapCount;
+
+            // Reserve the complete mipmap chain, so GenTextureMipmaps() can fill it later
+            if (desc.reserveMipmaps) levels = std::max(levels, 1 + static_cast<int>(std::floor(std::log2(std::max(width, height)))));
+
+            glTexStorage2D(GL_TEXTURE_2D, levels, glSizedFormat, width, height);
+
+            // Only the levels with data are sampled until mipmaps are generated
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, mipmapCount - 1);
+
+            immutable = true;
+        }
+
+#   endif
 
     int mipWidth = width;
     int mipHeight = height;
@@ -1487,12 +2030,16 @@ uint32_t Context::LoadTexture(const void *data, int width, int height, PixelForm
 
     // NOTE: Added pointer math separately from function to avoid UBSAN complaining
     const uint8_t *dataPtr = reinterpret_cast<const uint8_t*>(data);
+    const bool hasData = (data != nullptr) || (desc.levels != nullptr);
 
     // Load the different mipmap levels
     for (int i = 0; i < mipmapCount; i++)
     {
         uint32_t mipSize = GetPixelDataSize(mipWidth, mipHeight, format);
 
+        // Levels given separately are not contiguous (i.e. texture files)
+        const uint8_t *levelPtr = (desc.levels != nullptr)? reinterpret_cast<const uint8_t*>(desc.levels[i]) : dataPtr;
+
         uint32_t glInternalFormat, glFormat, glType;
         GetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
 
@@ -1500,14 +2047,23 @@ uint32_t Context::LoadTexture(const void *data, int width, int height, PixelForm
 
         if (glInternalFormat != 0)
         {
-            if (format < PixelFormat::DXT1_RGB)
+            if (immutable)
+            {
+                // NOTE: Storage is already allocated, nothing to upload without data
+                if (hasData)
+                {
+                    if (format < PixelFormat::DXT1_RGB) glTexSubImage2D(GL_TEXTURE_2D, i, 0, 0, mipWidth, mipHeight, glFormat, glType, levelPtr);
+                    else glCompressedTexSubImage2D(GL_TEXTURE_2D, i, 0, 0, mipWidth, mipHeight, glInternalFormat, mipSize, levelPtr);
+                }
+            }
+            else if (format < PixelFormat::DXT1_RGB)
             {
-                glTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, glFormat, glType, dataPtr);
+                glTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, glFormat, glType, levelPtr);
             }
 #           if !defined(GRAPHICS_API_OPENGL_11)
             else
             {
-                glCompressedTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, mipSize, dataPtr);
+                glCompressedTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, mipSize, levelPtr);
             }
 #           endif
 
@@ -1576,23 +2132,14 @@ uint32_t Context::LoadTexture(const void *data, int width, int height, PixelForm
         }
 
 #   endif
-
-    // At this point we have the texture loaded in GPU and texture parameters configured
-    // NOTE: If mipmaps were not in data, they are not generated automatically
-
-    // Unbind current texture
-    glBindTexture(GL_TEXTURE_2D, 0);
-
-    if (id > 0) TRACELOG(LogInfo, "TEXTURE: [ID %i] Texture loaded successfully (%ix%i | %s | %i mipmaps)", id, width, height, GetPixelFormatName(format), mipmapCount);
-    else TRACELOG(LogWarning, "TEXTURE: Failed to load texture");
-
-    return id;
 }
 
 // Load depth texture/renderbuffer (to be attached to fbo)
 // WARNING: OpenGL ES 2.0 requires GL_OES_depth_texture and WebGL requires WEBGL_depth_texture extensions
 uint32_t Context::LoadTextureDepth(int width, int height, bool useRenderBuffer)
 {
+    RLGL_CAPTURE_SCOPE();
+
     uint32_t id = 0;
 
 #   if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
@@ -1646,6 +2193,8 @@ uint32_t Context::LoadTextureDepth(int width, int height, bool useRenderBuffer)
     }
 #endif
 
+    if (id != 0) RLGL_CAPTURE_RECORD(LoadTextureDepth, id, width, height, useRenderBuffer);
+
     return id;
 }
 
@@ -1654,6 +2203,8 @@ uint32_t Context::LoadTextureDepth(int width, int height, bool useRenderBuffer)
 // expected the following convention: +X, -X, +Y, -Y, +Z, -Z
 uint32_t Context::LoadTextureCubemap(const void *data, int size, PixelFormat format)
 {
+    RLGL_CAPTURE_SCOPE();
+
     uint32_t id = 0;
 
 #   if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
@@ -1726,6 +2277,8 @@ uint32_t Context::LoadTextureCubemap(const void *data, int size, PixelFormat for
     if (id > 0) TRACELOG(LogInfo, "TEXTURE: [ID %i] Cubemap texture loaded successfully (%ix%i)", id, size, size);
     else TRACELOG(LogWarning, "TEXTURE: Failed to load cubemap texture");
 
+    if (id != 0) RLGL_CAPTURE_RECORD(LoadTextureCubemap, id, CaptureData{ data, (data != nullptr)? 6*static_cast<std::size_t>(GetPixelDataSize(size, size, format)) : 0 }, size, format);
+
     return id;
 }
 
@@ -1733,7 +2286,10 @@ uint32_t Context::LoadTextureCubemap(const void *data, int size, PixelFormat for
 // NOTE: We don't know safely if internal texture format is the expected one...
 void Context::UpdateTexture(uint32_t id, int offsetX, int offsetY, int width, int height, PixelFormat format, const void *data)
 {
+    RLGL_CAPTURE(UpdateTexture, id, offsetX, offsetY, width, height, format, CaptureData{ data, (data != nullptr)? static_cast<std::size_t>(GetPixelDataSize(width, height, format)) : 0 });
+
     glBindTexture(GL_TEXTURE_2D, id);
+    RLGL_STAT(frameStats.textureBinds++);
 
     uint32_t glInternalFormat, glFormat, glType;
     GetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
@@ -1741,50 +2297,227 @@ void Context::UpdateTexture(uint32_t id, int offsetX, int offsetY, int width, in
     if ((glInternalFormat != 0) && (format < PixelFormat::DXT1_RGB))
     {
         glTexSubImage2D(GL_TEXTURE_2D, 0, offsetX, offsetY, width, height, glFormat, glType, data);
+        RLGL_STAT(frameStats.bytesUploaded += GetPixelDataSize(width, height, format));
     }
     else TRACELOG(LogWarning, "TEXTURE: [ID %i] Failed to update for current texture format (%i)", id, format);
 }
 
-// Unload texture from GPU memory
-void Context::UnloadTexture(uint32_t id)
+// Begin streaming update of an already loaded texture
+// NOTE: Returned memory belongs to an upload staging buffer, it is valid until Context::EndUpdateTexture()
+void *Context::BeginUpdateTexture(uint32_t id, int offsetX, int offsetY, int width, int height, PixelFormat format)
 {
-    glDeleteTextures(1, &id);
-}
+    if (pendingTextureUpdate.id != 0)
+    {
+        TRACELOG(LogWarning, "TEXTURE: [ID %i] Previous streaming update not ended, update discarded", pendingTextureUpdate.id);
+        uploadBuffer->Unmap();
+        uploadBuffer->Unbind();
+        pendingTextureUpdate = TextureUpdate();
+    }
 
-// Generate mipmap data for selected texture
-// NOTE: Only supports GPU mipmap generation
-void Context::GenTextureMipmaps(uint32_t id, int width, int height, PixelFormat format, int *mipmaps)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindTexture(GL_TEXTURE_2D, id);
+    if (format >= PixelFormat::DXT1_RGB)
+    {
+        TRACELOG(LogWarning, "TEXTURE: [ID %i] Failed to update for current texture format (%i)", id, format);
+        return nullptr;
+    }
 
-    // Check if texture is power-of-two (POT)
-    bool texIsPOT = false;
+    if (uploadBuffer == nullptr) uploadBuffer = std::make_unique<UploadBuffer>(RL_DEFAULT_UPLOAD_BUFFERS);
+
+    void *pixels = uploadBuffer->Map(GetPixelDataSize(width, height, format));
+
+    if (pixels != nullptr)
+    {
+        pendingTextureUpdate.id = id;
+        pendingTextureUpdate.offsetX = offsetX;
+        pendingTextureUpdate.offsetY = offsetY;
+        pendingTextureUpdate.width = width;
+        pendingTextureUpdate.height = height;
+        pendingTextureUpdate.format = format;
+        pendingTextureUpdate.pixels = pixels;
+    }
+
+    return pixels;
+}
+
+// End streaming update of texture, GL copy is issued from the staging buffer
+void Context::EndUpdateTexture()
+{
+    if (pendingTextureUpdate.id == 0) return;
+
+    const TextureUpdate update = pendingTextureUpdate;
+    pendingTextureUpdate = TextureUpdate();
+
+    // NOTE: Staging data is recorded before unmapping, the update is replayed with UpdateTextureAsync()
+    RLGL_CAPTURE(UpdateTextureAsync, update.id, update.offsetX, update.offsetY, update.width, update.height, update.format,
+        CaptureData{ update.pixels, static_cast<std::size_t>(GetPixelDataSize(update.width, update.height, update.format)) });
+
+    if (uploadBuffer->Unmap())
+    {
+        // Staging rows are tightly packed, the application unpack alignment is restored after the copy
+        int prevUnpackAlignment = 4;
+        glGetIntegerv(GL_UNPACK_ALIGNMENT, &prevUnpackAlignment);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+        // NOTE: With a pixel unpack buffer bound, the data pointer is an offset into the buffer,
+        // the function returns immediately and the transfer is done by the driver
+        UpdateTexture(update.id, update.offsetX, update.offsetY, update.width, update.height, update.format, uploadBuffer->GetPixels());
+
+        glPixelStorei(GL_UNPACK_ALIGNMENT, prevUnpackAlignment);
+    }
+    else TRACELOG(LogWarning, "TEXTURE: [ID %i] Staging data lost while mapped, update discarded", update.id);
+
+    uploadBuffer->Unbind();
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+// Update already loaded texture in GPU through upload staging buffers
+void Context::UpdateTextureAsync(uint32_t id, int offsetX, int offsetY, int width, int height, PixelFormat format, const void *data)
+{
+    RLGL_CAPTURE(UpdateTextureAsync, id, offsetX, offsetY, width, height, format, CaptureData{ data, (data != nullptr)? static_cast<std::size_t>(GetPixelDataSize(width, height, format)) : 0 });
+
+    void *pixels = BeginUpdateTexture(id, offsetX, offsetY, width, height, format);
+    if (pixels == nullptr) return;
+
+    std::memcpy(pixels, data, GetPixelDataSize(width, height, format));
+    EndUpdateTexture();
+}
+
+// Unload texture from GPU memory
+void Context::UnloadTexture(uint32_t id)
+{
+    RLGL_CAPTURE(UnloadTexture, id);
+    glDeleteTextures(1, &id);
+}
+
+// Generate mipmap data for selected texture
+// NOTE: Only supports GPU mipmap generation
+void Context::GenTextureMipmaps(uint32_t id, int width, int height, PixelFormat format, int *mipmaps)
+{
+    RLGL_CAPTURE(GenTextureMipmaps, id, width, height, format);
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glBindTexture(GL_TEXTURE_2D, id);
+
+    // Check if texture is power-of-two (POT)
+    bool texIsPOT = false;
 
     if (((width > 0) && ((width & (width - 1)) == 0)) &&
         ((height > 0) && ((height & (height - 1)) == 0))) texIsPOT = true;
 
     if ((texIsPOT) || (GetExtensions().texNPOT))
     {
+        *mipmaps = 1 + std::floor(std::log(std::max(width, height))/std::log(2));
+
+#       if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+
+            // NOTE: Immutable storage can not be reallocated, mipmaps are only generated
+            // for the levels allocated on loading (see TextureDesc::reserveMipmaps)
+            int immutable = GL_FALSE;
+            if (GetExtensions().texStorage) glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_IMMUTABLE_FORMAT, &immutable);
+
+            if (immutable == GL_TRUE)
+            {
+                int levels = 0;
+                glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_IMMUTABLE_LEVELS, &levels);
+
+                if ((levels > 0) && (levels < *mipmaps))
+                {
+                    TRACELOG(LogWarning, "TEXTURE: [ID %i] Immutable storage limited to %i mipmap levels", id, levels);
+                    *mipmaps = levels;
+                }
+
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, *mipmaps - 1);
+            }
+
+#       endif
+
         //glHint(GL_GENERATE_MIPMAP_HINT, GL_DONT_CARE);   // Hint for mipmaps generation algorithm: GL_FASTEST, GL_NICEST, GL_DONT_CARE
         glGenerateMipmap(GL_TEXTURE_2D);    // Generate mipmaps automatically
 
-        *mipmaps = 1 + std::floor(std::log(std::max(width, height))/std::log(2));
         TRACELOG(LogInfo, "TEXTURE: [ID %i] Mipmaps generated automatically, total: %i", id, *mipmaps);
     }
-    else TRACELOG(LogWarning, "TEXTURE: [ID %i] Failed to generate mipmaps", id);
+    else TRACELOG(LogWarning, "TEXTURE: [ID %i] Failed to generate mipmaps (NPOT texture, generate them on CPU instead)", id);
 
     glBindTexture(GL_TEXTURE_2D, 0);
 #else
-    TRACELOG(LogWarning, "TEXTURE: [ID %i] GPU mipmap generation not supported", id);
+    TRACELOG(LogWarning, "TEXTURE: [ID %i] GPU mipmap generation not supported (generate them on CPU instead)", id);
 #endif
 }
 
+// Generate mipmap data for selected texture on the CPU
+// NOTE: Generated levels are uploaded to the texture (mutable or immutable storage)
+void Context::GenTextureMipmaps(uint32_t id, const void *data, int width, int height, PixelFormat format, int *mipmaps, MipmapFilter filter, bool srgb)
+{
+    RLGL_CAPTURE(GenTextureMipmapsData, id, CaptureData{ data, (data != nullptr)? static_cast<std::size_t>(GetPixelDataSize(width, height, format)) : 0 }, width, height, format, filter, srgb);
+
+    int mipmapCount = 0;
+    std::vector<uint8_t> chain = GenMipmapChain(data, width, height, format, &mipmapCount, filter, srgb);
+
+    if (chain.empty())
+    {
+        TRACELOG(LogWarning, "TEXTURE: [ID %i] Failed to generate mipmaps", id);
+        return;
+    }
+
+    uint32_t glInternalFormat, glFormat, glType;
+    GetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+    glBindTexture(GL_TEXTURE_2D, id);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    int levels = mipmapCount;
+    bool immutable = false;
+
+#   if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+
+        int immutableFormat = GL_FALSE;
+        if (GetExtensions().texStorage) glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_IMMUTABLE_FORMAT, &immutableFormat);
+
+        if (immutableFormat == GL_TRUE)
+        {
+            int immutableLevels = 0;
+            glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_IMMUTABLE_LEVELS, &immutableLevels);
+            if (immutableLevels > 0) levels = std::min(levels, immutableLevels);
+            immutable = true;
+        }
+
+#   endif
+
+    int mipWidth = width;
+    int mipHeight = height;
+    const uint8_t *dataPtr = chain.data();
+
+    // NOTE: Base level is already in the texture, only the next levels are uploaded
+    for (int i = 1; i < levels; i++)
+    {
+        dataPtr += GetPixelDataSize(mipWidth, mipHeight, format);
+        mipWidth = std::max(mipWidth/2, 1);
+        mipHeight = std::max(mipHeight/2, 1);
+
+        if (immutable) glTexSubImage2D(GL_TEXTURE_2D, i, 0, 0, mipWidth, mipHeight, glFormat, glType, dataPtr);
+        else glTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, glFormat, glType, dataPtr);
+    }
+
+#   if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, levels - 1);
+#   endif
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    *mipmaps = levels;
+    TRACELOG(LogInfo, "TEXTURE: [ID %i] Mipmaps generated on CPU, total: %i", id, *mipmaps);
+}
+
 // Read texture pixel data
 std::vector<uint8_t> Context::ReadTexturePixels(uint32_t id, int width, int height, PixelFormat format)
 {
+    RLGL_CAPTURE(ReadTexturePixels, id, width, height, format);
+
     std::vector<uint8_t> pixels;
 
+    // NOTE: Pixels are read with tightly packed rows, the application pack alignment is restored after the read
+    int prevPackAlignment = 4;
+    glGetIntegerv(GL_PACK_ALIGNMENT, &prevPackAlignment);
+
 #   if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
 
         glBindTexture(GL_TEXTURE_2D, id);
@@ -1826,9 +2559,7 @@ std::vector<uint8_t> Context::ReadTexturePixels(uint32_t id, int width, int heig
         // 2 - Create an fbo, activate it, render quad with texture, glReadPixels()
         // We are using Option 1, just need to care for texture format on retrieval
         // NOTE: This behaviour could be conditioned by graphic driver...
-        uint32_t fboId = LoadFramebuffer(width, height);
-
-        glBindFramebuffer(GL_FRAMEBUFFER, fboId);
+        glBindFramebuffer(GL_FRAMEBUFFER, GetReadFramebuffer());
         glBindTexture(GL_TEXTURE_2D, 0);
 
         // Attach our texture to FBO
@@ -1836,43 +2567,126 @@ std::vector<uint8_t> Context::ReadTexturePixels(uint32_t id, int width, int heig
 
         // We read data as RGBA because FBO texture is configured as RGBA, despite binding another texture format
         pixels.resize(GetPixelDataSize(width, height, PixelFormat::R8G8B8A8));
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
         glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
 
+        // Detach texture, the read fbo is reused for the next readbacks
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0);
         glBindFramebuffer(GL_FRAMEBUFFER, 0);
 
-        // Clean up temporal fbo
-        UnloadFramebuffer(fboId);
-
 #   endif
 
+    glPixelStorei(GL_PACK_ALIGNMENT, prevPackAlignment);
+
     return pixels;
 }
 
 // Read screen pixel data (color buffer)
 std::vector<uint8_t> Context::ReadScreenPixels(int width, int height)
 {
-    std::vector<uint8_t> screenData(width*height*4, 0);
+    RLGL_CAPTURE(ReadScreenPixels, width, height, true);
+
+    std::vector<uint8_t> imgData(width*height*4);
+    ReadScreenPixels(imgData.data(), width, height, true);
+
+    return imgData;
+}
+
+// Read screen pixel data (color buffer) into the given memory
+// NOTE: No memory is allocated, image is flipped in place (if required)
+void Context::ReadScreenPixels(uint8_t *dest, int width, int height, bool flipY)
+{
+    RLGL_CAPTURE(ReadScreenPixels, width, height, flipY);
+
+    RLGL_TRACE_ZONE("Context::ReadScreenPixels");
 
     // NOTE 1: glReadPixels returns image flipped vertically -> (0,0) is the bottom left corner of the framebuffer
     // NOTE 2: We are getting alpha channel! Be careful, it can be transparent if not cleared properly!
-    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, screenData.data());
+    // NOTE 3: Rows are written tightly packed, the application pack alignment is restored after the read
+    int prevPackAlignment = 4;
+    glGetIntegerv(GL_PACK_ALIGNMENT, &prevPackAlignment);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, dest);
+    glPixelStorei(GL_PACK_ALIGNMENT, prevPackAlignment);
 
     // Flip image vertically!
-    std::vector<uint8_t> imgData(screenData.size());
+    if (flipY) FlipPixelsVertical(dest, width*4, height);
 
-    for (int y = height - 1; y >= 0; y--)
-    {
-        for (int x = 0; x < (width*4); x++)
-        {
-            imgData[((height - 1) - y)*width*4 + x] = screenData[(y*width*4) + x];  // Flip line
+    // Set alpha component value to 255 (no trasparent image retrieval)
+    // NOTE: Alpha value has already been applied to RGB in framebuffer, we don't need it!
+    SetPixelsOpaque(dest, width*height);
+}
+
+// Read texture pixel data asynchronously (through readback staging buffers)
+Readback Context::ReadTexturePixelsAsync(uint32_t id, int width, int height, PixelFormat format)
+{
+    RLGL_CAPTURE(ReadTexturePixelsAsync, id, width, height, format);
+
+    Readback readback;
+
+#   if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+
+        uint32_t glInternalFormat, glFormat, glType;
+        GetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+        int pixelSize = GetPixelDataSize(1, 1, format);
 
-            // Set alpha component value to 255 (no trasparent image retrieval)
-            // NOTE: Alpha value has already been applied to RGB in framebuffer, we don't need it!
-            if (((x + 1)%4) == 0) imgData[((height - 1) - y)*width*4 + x] = 255;
+#       if defined(GRAPHICS_API_OPENGL_ES2)
+            // NOTE: Only GL_RGBA/GL_UNSIGNED_BYTE is guaranteed to be supported by glReadPixels() on OpenGL ES
+            glFormat = GL_RGBA, glType = GL_UNSIGNED_BYTE;
+            pixelSize = 4;
+#       endif
+
+        if ((glInternalFormat == 0) || (format >= PixelFormat::DXT1_RGB))
+        {
+            TRACELOG(LogWarning, "TEXTURE: [ID %i] Data retrieval not suported for pixel format (%i)", id, format);
+            return readback;
         }
-    }
 
-    return imgData;     // NOTE: image data should be freed
+        if (readbackBuffer == nullptr) readbackBuffer = std::make_unique<ReadbackBuffer>(RL_DEFAULT_READBACK_BUFFERS);
+
+#       if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+            // Only the read binding is changed, current draw framebuffer is kept
+            int prevReadFramebuffer = 0;
+            glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &prevReadFramebuffer);
+            glBindFramebuffer(GL_READ_FRAMEBUFFER, GetReadFramebuffer());
+            glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, id, 0);
+#       else
+            glBindFramebuffer(GL_FRAMEBUFFER, GetReadFramebuffer());
+            glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, id, 0);
+#       endif
+
+        readback = readbackBuffer->ReadPixels(0, 0, width, height, glFormat, glType, pixelSize, false, false);
+
+#       if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+            glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0);
+            glBindFramebuffer(GL_READ_FRAMEBUFFER, prevReadFramebuffer);
+#       else
+            glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0);
+            glBindFramebuffer(GL_FRAMEBUFFER, 0);
+#       endif
+
+#   endif
+
+    return readback;
+}
+
+// Read screen pixel data asynchronously (through readback staging buffers)
+Readback Context::ReadScreenPixelsAsync(int width, int height)
+{
+    RLGL_CAPTURE(ReadScreenPixelsAsync, width, height);
+
+    Readback readback;
+
+#   if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+
+        if (readbackBuffer == nullptr) readbackBuffer = std::make_unique<ReadbackBuffer>(RL_DEFAULT_READBACK_BUFFERS);
+
+        // NOTE: Data is flipped vertically and alpha set to 255 on resolve, same as ReadScreenPixels()
+        readback = readbackBuffer->ReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, 4, true, true);
+
+#   endif
+
+    return readback;
 }
 
 // Framebuffer management (fbo)
@@ -1881,6 +2695,8 @@ std::vector<uint8_t> Context::ReadScreenPixels(int width, int height)
 // NOTE: No textures attached
 uint32_t Context::LoadFramebuffer(int width, int height)
 {
+    RLGL_CAPTURE_SCOPE();
+
     uint32_t fboId = 0;
 
 #   if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
@@ -1888,6 +2704,8 @@ uint32_t Context::LoadFramebuffer(int width, int height)
         glBindFramebuffer(GL_FRAMEBUFFER, 0);   // Unbind any framebuffer
 #   endif
 
+    if (fboId != 0) RLGL_CAPTURE_RECORD(LoadFramebuffer, fboId, width, height);
+
     return fboId;
 }
 
@@ -1895,6 +2713,8 @@ uint32_t Context::LoadFramebuffer(int width, int height)
 // NOTE: Attach type: 0-Color, 1-Depth renderbuffer, 2-Depth texture
 void Context::FramebufferAttach(uint32_t fboId, uint32_t texId, FramebufferAttachType attachType, FramebufferAttachTextureType texType, int mipLevel)
 {
+    RLGL_CAPTURE(FramebufferAttach, fboId, texId, attachType, texType, mipLevel);
+
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
     glBindFramebuffer(GL_FRAMEBUFFER, fboId);
 
@@ -1948,6 +2768,8 @@ void Context::FramebufferAttach(uint32_t fboId, uint32_t texId, FramebufferAttac
 // Verify render texture is complete
 bool Context::FramebufferComplete(uint32_t id)
 {
+    RLGL_CAPTURE(FramebufferComplete, id);
+
     bool result = false;
 
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
@@ -1981,6 +2803,8 @@ bool Context::FramebufferComplete(uint32_t id)
 // NOTE: All attached textures/cubemaps/renderbuffers are also deleted
 void Context::UnloadFramebuffer(uint32_t id)
 {
+    RLGL_CAPTURE(UnloadFramebuffer, id);
+
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
     // Query depth attachment to automatically delete texture/renderbuffer
     int depthType = 0, depthId = 0;
@@ -2012,6 +2836,8 @@ void Context::UnloadFramebuffer(uint32_t id)
 // Load a new attributes buffer
 uint32_t Context::LoadVertexBuffer(const void *buffer, int size, bool dynamic)
 {
+    RLGL_CAPTURE_SCOPE();
+
     uint32_t id = 0;
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
@@ -2020,12 +2846,16 @@ uint32_t Context::LoadVertexBuffer(const void *buffer, int size, bool dynamic)
     glBufferData(GL_ARRAY_BUFFER, size, buffer, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
 #endif
 
+    if (id != 0) RLGL_CAPTURE_RECORD(LoadVertexBuffer, id, CaptureData{ buffer, static_cast<std::size_t>(size) }, size, dynamic);
+
     return id;
 }
 
 // Load a new attributes element buffer
 uint32_t Context::LoadVertexBufferElement(const void *buffer, int size, bool dynamic)
 {
+    RLGL_CAPTURE_SCOPE();
+
     uint32_t id = 0;
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
@@ -2034,12 +2864,15 @@ uint32_t Context::LoadVertexBufferElement(const void *buffer, int size, bool dyn
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, buffer, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
 #endif
 
+    if (id != 0) RLGL_CAPTURE_RECORD(LoadVertexBufferElement, id, CaptureData{ buffer, static_cast<std::size_t>(size) }, size, dynamic);
+
     return id;
 }
 
 // Enable vertex buffer (VBO)
 void Context::EnableVertexBuffer(uint32_t id)
 {
+    RLGL_CAPTURE(EnableVertexBuffer, id);
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glBindBuffer(GL_ARRAY_BUFFER, id);
 #endif
@@ -2048,6 +2881,7 @@ void Context::EnableVertexBuffer(uint32_t id)
 // Disable vertex buffer (VBO)
 void Context::DisableVertexBuffer()
 {
+    RLGL_CAPTURE(DisableVertexBuffer);
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glBindBuffer(GL_ARRAY_BUFFER, 0);
 #endif
@@ -2056,6 +2890,7 @@ void Context::DisableVertexBuffer()
 // Enable vertex buffer element (VBO element)
 void Context::EnableVertexBufferElement(uint32_t id)
 {
+    RLGL_CAPTURE(EnableVertexBufferElement, id);
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
 #endif
@@ -2064,6 +2899,7 @@ void Context::EnableVertexBufferElement(uint32_t id)
 // Disable vertex buffer element (VBO element)
 void Context::DisableVertexBufferElement()
 {
+    RLGL_CAPTURE(DisableVertexBufferElement);
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 #endif
@@ -2073,9 +2909,12 @@ void Context::DisableVertexBufferElement()
 // NOTE: dataSize and offset must be provided in bytes
 void Context::UpdateVertexBuffer(uint32_t id, const void *data, int dataSize, int offset)
 {
+    RLGL_CAPTURE(UpdateVertexBuffer, id, CaptureData{ data, static_cast<std::size_t>(dataSize) }, dataSize, offset);
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glBindBuffer(GL_ARRAY_BUFFER, id);
     glBufferSubData(GL_ARRAY_BUFFER, offset, dataSize, data);
+    RLGL_STAT(frameStats.bytesUploaded += dataSize);
 #endif
 }
 
@@ -2083,15 +2922,20 @@ void Context::UpdateVertexBuffer(uint32_t id, const void *data, int dataSize, in
 // NOTE: dataSize and offset must be provided in bytes
 void Context::UpdateVertexBufferElements(uint32_t id, const void *data, int dataSize, int offset)
 {
+    RLGL_CAPTURE(UpdateVertexBufferElements, id, CaptureData{ data, static_cast<std::size_t>(dataSize) }, dataSize, offset);
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
     glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, offset, dataSize, data);
+    RLGL_STAT(frameStats.bytesUploaded += dataSize);
 #endif
 }
 
 // Enable vertex array object (VAO)
 bool Context::EnableVertexArray(uint32_t vaoId)
 {
+    RLGL_CAPTURE(EnableVertexArray, vaoId);
+
     bool result = false;
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if (GetExtensions().vao)
@@ -2106,6 +2950,7 @@ bool Context::EnableVertexArray(uint32_t vaoId)
 // Disable vertex array object (VAO)
 void Context::DisableVertexArray()
 {
+    RLGL_CAPTURE(DisableVertexArray);
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if (GetExtensions().vao) glBindVertexArray(0);
 #endif
@@ -2114,6 +2959,7 @@ void Context::DisableVertexArray()
 // Enable vertex attribute index
 void Context::EnableVertexAttribute(uint32_t index)
 {
+    RLGL_CAPTURE(EnableVertexAttribute, index);
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glEnableVertexAttribArray(index);
 #endif
@@ -2122,6 +2968,7 @@ void Context::EnableVertexAttribute(uint32_t index)
 // Disable vertex attribute index
 void Context::DisableVertexAttribute(uint32_t index)
 {
+    RLGL_CAPTURE(DisableVertexAttribute, index);
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glDisableVertexAttribArray(index);
 #endif
@@ -2130,36 +2977,67 @@ void Context::DisableVertexAttribute(uint32_t index)
 // Draw vertex array
 void Context::DrawVertexArray(int offset, int count)
 {
+    RLGL_CAPTURE(DrawVertexArray, offset, count);
     glDrawArrays(GL_TRIANGLES, offset, count);
+    RLGL_STAT(frameStats.drawCalls++);
+    RLGL_STAT(frameStats.vertices += count);
 }
 
 // Draw vertex array elements
 void Context::DrawVertexArrayElements(int offset, int count, const void *buffer)
 {
+    RLGL_CAPTURE(DrawVertexArrayElements, offset, count, reinterpret_cast<uintptr_t>(buffer));
+
     // NOTE: Added pointer math separately from function to avoid UBSAN complaining
     const uint16_t *bufferPtr = reinterpret_cast<const uint16_t*>(buffer);
     if (offset > 0) bufferPtr += offset;
 
     glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, bufferPtr);
+    RLGL_STAT(frameStats.drawCalls++);
+    RLGL_STAT(frameStats.vertices += count);
 }
 
 // Draw vertex array instanced
 void Context::DrawVertexArrayInstanced(int offset, int count, int instances)
 {
+    RLGL_CAPTURE(DrawVertexArrayInstanced, offset, count, instances);
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glDrawArraysInstanced(GL_TRIANGLES, 0, count, instances);
+    RLGL_STAT(frameStats.drawCalls++);
+    RLGL_STAT(frameStats.vertices += static_cast<uint64_t>(count)*instances);
 #endif
 }
 
 // Draw vertex array elements instanced
 void Context::DrawVertexArrayElementsInstanced(int offset, int count, const void *buffer, int instances)
 {
+    RLGL_CAPTURE(DrawVertexArrayElementsInstanced, offset, count, reinterpret_cast<uintptr_t>(buffer), instances);
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     // NOTE: Added pointer math separately from function to avoid UBSAN complaining
     const uint16_t *bufferPtr = reinterpret_cast<const uint16_t*>(buffer);
     if (offset > 0) bufferPtr += offset;
 
     glDrawElementsInstanced(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, bufferPtr, instances);
+    RLGL_STAT(frameStats.drawCalls++);
+    RLGL_STAT(frameStats.vertices += static_cast<uint64_t>(count)*instances);
+#endif
+}
+
+// Draw vertex array instanced with the draw parameters stored in a buffer
+void Context::DrawVertexArrayInstancedIndirect(uint32_t bufferId, uint32_t offset)
+{
+    RLGL_CAPTURE(DrawVertexArrayInstancedIndirect, bufferId, offset);
+
+#if defined(GRAPHICS_API_OPENGL_43)
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, bufferId);
+    glDrawArraysIndirect(GL_TRIANGLES, reinterpret_cast<const void*>(static_cast<uintptr_t>(offset)));
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+    RLGL_STAT(frameStats.drawCalls++);    // NOTE: Vertex count only known by the GPU
+#else
+    (void)bufferId;
+    (void)offset;
 #endif
 }
 
@@ -2167,6 +3045,8 @@ void Context::DrawVertexArrayElementsInstanced(int offset, int count, const void
 // Enable vertex state pointer
 void Context::EnableStatePointer(int vertexAttribType, void *buffer)
 {
+    RLGL_CAPTURE(EnableStatePointer, vertexAttribType);
+
     if (buffer != nullptr) glEnableClientState(vertexAttribType);
     switch (vertexAttribType)
     {
@@ -2182,6 +3062,7 @@ void Context::EnableStatePointer(int vertexAttribType, void *buffer)
 // Disable vertex state pointer
 void Context::DisableStatePointer(int vertexAttribType)
 {
+    RLGL_CAPTURE(DisableStatePointer, vertexAttribType);
     glDisableClientState(vertexAttribType);
 }
 #endif
@@ -2189,6 +3070,8 @@ void Context::DisableStatePointer(int vertexAttribType)
 // Load vertex array object (VAO)
 uint32_t Context::LoadVertexArray()
 {
+    RLGL_CAPTURE_SCOPE();
+
     uint32_t vaoId = 0;
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if (GetExtensions().vao)
@@ -2196,12 +3079,16 @@ uint32_t Context::LoadVertexArray()
         glGenVertexArrays(1, &vaoId);
     }
 #endif
+
+    if (vaoId != 0) RLGL_CAPTURE_RECORD(LoadVertexArray, vaoId);
+
     return vaoId;
 }
 
 // Set vertex attribute
 void Context::SetVertexAttribute(uint32_t index, int compSize, DataType type, bool normalized, int stride, const void *pointer)
 {
+    RLGL_CAPTURE(SetVertexAttribute, index, compSize, type, normalized, stride, reinterpret_cast<uintptr_t>(pointer));
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glVertexAttribPointer(index, compSize, static_cast<int>(type), normalized, stride, pointer);
 #endif
@@ -2210,6 +3097,7 @@ void Context::SetVertexAttribute(uint32_t index, int compSize, DataType type, bo
 // Set vertex attribute divisor
 void Context::SetVertexAttributeDivisor(uint32_t index, int divisor)
 {
+    RLGL_CAPTURE(SetVertexAttributeDivisor, index, divisor);
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glVertexAttribDivisor(index, divisor);
 #endif
@@ -2218,6 +3106,8 @@ void Context::SetVertexAttributeDivisor(uint32_t index, int divisor)
 // Unload vertex array object (VAO)
 void Context::UnloadVertexArray(uint32_t vaoId)
 {
+    RLGL_CAPTURE(UnloadVertexArray, vaoId);
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if (GetExtensions().vao)
     {
@@ -2231,6 +3121,8 @@ void Context::UnloadVertexArray(uint32_t vaoId)
 // Unload vertex buffer (VBO)
 void Context::UnloadVertexBuffer(uint32_t vboId)
 {
+    RLGL_CAPTURE(UnloadVertexBuffer, vboId);
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glDeleteBuffers(1, &vboId);
     //TRACELOG(LogInfo, "VBO: Unloaded vertex data from VRAM (GPU)");
@@ -2243,6 +3135,10 @@ void Context::UnloadVertexBuffer(uint32_t vboId)
 // NOTE: If shader string is nullptr, using default vertex/fragment shaders
 uint32_t Context::LoadShaderCode(const char *vsCode, const char *fsCode)
 {
+    RLGL_CAPTURE_SCOPE();
+
+    RLGL_TRACE_ZONE("Context::LoadShaderCode");
+
     uint32_t id = 0;
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
@@ -2314,12 +3210,16 @@ uint32_t Context::LoadShaderCode(const char *vsCode, const char *fsCode)
     }
 #endif
 
+    if (id != 0) RLGL_CAPTURE_RECORD(LoadShaderCode, id, vsCode, fsCode);
+
     return id;
 }
 
 // Compile custom shader and return shader id
 uint32_t Context::CompileShader(const char *shaderCode, int type)
 {
+    RLGL_CAPTURE_SCOPE();
+
     uint32_t shader = 0;
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
@@ -2369,12 +3269,16 @@ uint32_t Context::CompileShader(const char *shaderCode, int type)
     }
 #endif
 
+    if (shader != 0) RLGL_CAPTURE_RECORD(CompileShader, shader, shaderCode, type);
+
     return shader;
 }
 
 // Load custom shader strings and return program id
 uint32_t Context::LoadShaderProgram(uint32_t vShaderId, uint32_t fShaderId)
 {
+    RLGL_CAPTURE_SCOPE();
+
     uint32_t program = 0;
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
@@ -2429,12 +3333,17 @@ uint32_t Context::LoadShaderProgram(uint32_t vShaderId, uint32_t fShaderId)
         TRACELOG(LogInfo, "SHADER: [ID %i] Program shader loaded successfully", program);
     }
 #endif
+
+    if (program != 0) RLGL_CAPTURE_RECORD(LoadShaderProgram, program, vShaderId, fShaderId);
+
     return program;
 }
 
 // Unload shader program
 void Context::UnloadShaderProgram(uint32_t id)
 {
+    RLGL_CAPTURE(UnloadShaderProgram, id);
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glDeleteProgram(id);
 
@@ -2471,6 +3380,8 @@ int Context::GetLocationAttrib(uint32_t shaderId, const std::string& attribName)
 // Set shader value uniform
 void Context::SetUniform(int locIndex, const void *value, ShaderUniformType uniformType, int count)
 {
+    RLGL_CAPTURE(SetUniform, locIndex, CaptureData{ value, GetUniformDataSize(uniformType, count) }, uniformType, count);
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     switch (uniformType)
     {
@@ -2491,6 +3402,8 @@ void Context::SetUniform(int locIndex, const void *value, ShaderUniformType unif
 // Set shader value attribute
 void Context::SetVertexAttributeDefault(int locIndex, const void *value, ShaderAttributeType attribType, int count)
 {
+    RLGL_CAPTURE(SetVertexAttributeDefault, locIndex, CaptureData{ value, sizeof(float)*std::max(count, 0) }, attribType, count);
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     switch (attribType)
     {
@@ -2506,6 +3419,7 @@ void Context::SetVertexAttributeDefault(int locIndex, const void *value, ShaderA
 // Set shader value uniform matrix
 void Context::SetUniformMatrix(int locIndex, const Matrix& mat)
 {
+    RLGL_CAPTURE(SetUniformMatrix, locIndex, mat);
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glUniformMatrix4fv(locIndex, 1, false, mat);
 #endif
@@ -2514,6 +3428,8 @@ void Context::SetUniformMatrix(int locIndex, const Matrix& mat)
 // Set shader value uniform sampler
 void Context::SetUniformSampler(int locIndex, uint32_t textureId)
 {
+    RLGL_CAPTURE(SetUniformSampler, locIndex, textureId);
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     // Check if texture is already active
     for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++)
@@ -2536,10 +3452,13 @@ void Context::SetUniformSampler(int locIndex, uint32_t textureId)
 // Set shader currently active (id and locations)
 void Context::SetShader(uint32_t id, const int *locs)
 {
+    RLGL_CAPTURE(SetShader, id, CaptureData{ locs, (locs != nullptr)? RL_MAX_SHADER_LOCATIONS*sizeof(int) : 0 });
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if (state.currentShaderId != id)
     {
-        DrawRenderBatch(currentBatch);
+        DrawRenderBatch(currentBatch, FlushReason::ShaderChange);
+        RLGL_STAT(frameStats.stateChanges++);
         state.currentShaderId = id;
         state.currentShaderLocs = locs;
     }
@@ -2549,6 +3468,8 @@ void Context::SetShader(uint32_t id, const int *locs)
 // Load compute shader program
 uint32_t Context::LoadComputeShaderProgram(uint32_t shaderId)
 {
+    RLGL_CAPTURE_SCOPE();
+
     uint32_t program = 0;
 
 #if defined(GRAPHICS_API_OPENGL_43)
@@ -2591,20 +3512,51 @@ uint32_t Context::LoadComputeShaderProgram(uint32_t shaderId)
     }
 #endif
 
+    if (program != 0) RLGL_CAPTURE_RECORD(LoadComputeShaderProgram, program, shaderId);
+
     return program;
 }
 
 // Dispatch compute shader (equivalent to *draw* for graphics pilepine)
 void Context::ComputeShaderDispatch(uint32_t groupX, uint32_t groupY, uint32_t groupZ)
 {
+    RLGL_CAPTURE(ComputeShaderDispatch, groupX, groupY, groupZ);
 #if defined(GRAPHICS_API_OPENGL_43)
     glDispatchCompute(groupX, groupY, groupZ);
 #endif
 }
 
+// Dispatch compute shader with group dimensions stored in a buffer
+void Context::ComputeShaderDispatchIndirect(uint32_t bufferId, uint32_t offset)
+{
+    RLGL_CAPTURE(ComputeShaderDispatchIndirect, bufferId, offset);
+
+#if defined(GRAPHICS_API_OPENGL_43)
+    glBindBuffer(GL_DISPATCH_INDIRECT_BUFFER, bufferId);
+    glDispatchComputeIndirect(static_cast<GLintptr>(offset));
+    glBindBuffer(GL_DISPATCH_INDIRECT_BUFFER, 0);
+#else
+    (void)bufferId;
+    (void)offset;
+#endif
+}
+
+// Make compute shader writes visible to buffer reads, indirect commands and vertex fetches
+void Context::ComputeShaderBarrier()
+{
+    RLGL_CAPTURE(ComputeShaderBarrier);
+
+#if defined(GRAPHICS_API_OPENGL_43)
+    glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_COMMAND_BARRIER_BIT | GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT |
+        GL_BUFFER_UPDATE_BARRIER_BIT);
+#endif
+}
+
 // Load shader storage buffer object (SSBO)
 uint32_t Context::LoadShaderBuffer(uint32_t size, const void *data, BufferUsage usageHint)
 {
+    RLGL_CAPTURE_SCOPE();
+
     uint32_t ssbo = 0;
 
 #if defined(GRAPHICS_API_OPENGL_43)
@@ -2615,12 +3567,15 @@ uint32_t Context::LoadShaderBuffer(uint32_t size, const void *data, BufferUsage
     glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
 #endif
 
+    if (ssbo != 0) RLGL_CAPTURE_RECORD(LoadShaderBuffer, ssbo, size, CaptureData{ data, (data != nullptr)? size : 0 }, usageHint);
+
     return ssbo;
 }
 
 // Unload shader storage buffer object (SSBO)
 void Context::UnloadShaderBuffer(uint32_t ssboId)
 {
+    RLGL_CAPTURE(UnloadShaderBuffer, ssboId);
 #if defined(GRAPHICS_API_OPENGL_43)
     glDeleteBuffers(1, &ssboId);
 #endif
@@ -2629,20 +3584,23 @@ void Context::UnloadShaderBuffer(uint32_t ssboId)
 // Update SSBO buffer data
 void Context::UpdateShaderBuffer(uint32_t id, const void *data, uint32_t dataSize, uint32_t offset)
 {
+    RLGL_CAPTURE(UpdateShaderBuffer, id, CaptureData{ data, dataSize }, dataSize, offset);
+
 #if defined(GRAPHICS_API_OPENGL_43)
     glBindBuffer(GL_SHADER_STORAGE_BUFFER, id);
     glBufferSubData(GL_SHADER_STORAGE_BUFFER, offset, dataSize, data);
+    RLGL_STAT(frameStats.bytesUploaded += dataSize);
 #endif
 }
 
 // Get SSBO buffer size
 uint32_t Context::GetShaderBufferSize(uint32_t id) const
 {
-    long long size = 0;
+    int64_t size = 0;
 
 #if defined(GRAPHICS_API_OPENGL_43)
     glBindBuffer(GL_SHADER_STORAGE_BUFFER, id);
-    glGetInteger64v(GL_SHADER_STORAGE_BUFFER_SIZE, &size);
+    glGetBufferParameteri64v(GL_SHADER_STORAGE_BUFFER, GL_BUFFER_SIZE, &size);
 #endif
 
     return (size > 0)? (uint32_t)size : 0;
@@ -2651,15 +3609,41 @@ uint32_t Context::GetShaderBufferSize(uint32_t id) const
 // Read SSBO buffer data (GPU->CPU)
 void Context::ReadShaderBuffer(uint32_t id, void *dest, uint32_t count, uint32_t offset)
 {
+    RLGL_CAPTURE(ReadShaderBuffer, id, count, offset);
+
 #if defined(GRAPHICS_API_OPENGL_43)
     glBindBuffer(GL_SHADER_STORAGE_BUFFER, id);
     glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, offset, count, dest);
 #endif
 }
 
+// Read SSBO buffer data asynchronously (GPU copy into a readback staging buffer)
+Readback Context::ReadShaderBufferAsync(uint32_t id, uint32_t count, uint32_t offset)
+{
+    RLGL_CAPTURE(ReadShaderBufferAsync, id, count, offset);
+
+    Readback readback;
+
+#if defined(GRAPHICS_API_OPENGL_43)
+    if (readbackBuffer == nullptr) readbackBuffer = std::make_unique<ReadbackBuffer>(RL_DEFAULT_READBACK_BUFFERS);
+
+    // Make previous shader storage writes visible to the buffer copy
+    glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+
+    readback = readbackBuffer->ReadBuffer(id, offset, count);
+#else
+    (void)id;
+    (void)count;
+    (void)offset;
+#endif
+
+    return readback;
+}
+
 // Bind SSBO buffer
 void Context::BindShaderBuffer(uint32_t id, uint32_t index)
 {
+    RLGL_CAPTURE(BindShaderBuffer, id, index);
 #if defined(GRAPHICS_API_OPENGL_43)
     glBindBufferBase(GL_SHADER_STORAGE_BUFFER, index, id);
 #endif
@@ -2668,6 +3652,8 @@ void Context::BindShaderBuffer(uint32_t id, uint32_t index)
 // Copy SSBO buffer data
 void Context::CopyShaderBuffer(uint32_t destId, uint32_t srcId, uint32_t destOffset, uint32_t srcOffset, uint32_t count)
 {
+    RLGL_CAPTURE(CopyShaderBuffer, destId, srcId, destOffset, srcOffset, count);
+
 #if defined(GRAPHICS_API_OPENGL_43)
     glBindBuffer(GL_COPY_READ_BUFFER, srcId);
     glBindBuffer(GL_COPY_WRITE_BUFFER, destId);
@@ -2678,11 +3664,14 @@ void Context::CopyShaderBuffer(uint32_t destId, uint32_t srcId, uint32_t destOff
 // Bind image texture
 void Context::BindImageTexture(uint32_t id, uint32_t index, int format, bool readonly)
 {
+    RLGL_CAPTURE(BindImageTexture, id, index, format, readonly);
+
 #if defined(GRAPHICS_API_OPENGL_43)
     uint32_t glInternalFormat = 0, glFormat = 0, glType = 0;
 
-    GetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+    GetGlTextureFormats(static_cast<PixelFormat>(format), &glInternalFormat, &glFormat, &glType);
     glBindImageTexture(index, id, 0, 0, 0, readonly? GL_READ_ONLY : GL_READ_WRITE, glInternalFormat);
+    RLGL_STAT(frameStats.textureBinds++);
 #endif
 }
 
@@ -2756,6 +3745,7 @@ Matrix Context::GetMatrixViewOffsetStereo(int eye) const
 // Set a custom modelview matrix (replaces internal modelview matrix)
 void Context::SetMatrixModelview(const Matrix& view)
 {
+    RLGL_CAPTURE(SetMatrixModelview, view);
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     state.modelview = view;
 #endif
@@ -2764,6 +3754,7 @@ void Context::SetMatrixModelview(const Matrix& view)
 // Set a custom projection matrix (replaces internal projection matrix)
 void Context::SetMatrixProjection(const Matrix& projection)
 {
+    RLGL_CAPTURE(SetMatrixProjection, projection);
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     state.projection = projection;
 #endif
@@ -2772,6 +3763,8 @@ void Context::SetMatrixProjection(const Matrix& projection)
 // Set eyes projection matrices for stereo rendering
 void Context::SetMatrixProjectionStereo(const Matrix& right, const Matrix& left)
 {
+    RLGL_CAPTURE(SetMatrixProjectionStereo, right, left);
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     state.projectionStereo[0] = right;
     state.projectionStereo[1] = left;
@@ -2781,128 +3774,82 @@ void Context::SetMatrixProjectionStereo(const Matrix& right, const Matrix& left)
 // Set eyes view offsets matrices for stereo rendering
 void Context::SetMatrixViewOffsetStereo(const Matrix& right, const Matrix& left)
 {
+    RLGL_CAPTURE(SetMatrixViewOffsetStereo, right, left);
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     state.viewOffsetStereo[0] = right;
     state.viewOffsetStereo[1] = left;
 #endif
 }
 
-// Load and draw a quad in NDC
+// Draw a quad in NDC (triangle strip, cached geometry)
 void Context::LoadDrawQuad()
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    uint32_t quadVAO = 0;
-    uint32_t quadVBO = 0;
-
-    constexpr float vertices[] = {
-         // Positions         Texcoords
-        -1.0f,  1.0f, 0.0f,   0.0f, 1.0f,
-        -1.0f, -1.0f, 0.0f,   0.0f, 0.0f,
-         1.0f,  1.0f, 0.0f,   1.0f, 1.0f,
-         1.0f, -1.0f, 0.0f,   1.0f, 0.0f,
-    };
-
-    // Gen VAO to contain VBO
-    glGenVertexArrays(1, &quadVAO);
-    glBindVertexArray(quadVAO);
-
-    // Gen and fill vertex buffer (VBO)
-    glGenBuffers(1, &quadVBO);
-    glBindBuffer(GL_ARRAY_BUFFER, quadVBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), &vertices, GL_STATIC_DRAW);
-
-    // Bind vertex attributes (position, texcoords)
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5*sizeof(float), 0); // Positions
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5*sizeof(float), reinterpret_cast<const void*>(3*sizeof(float))); // Texcoords
+    RLGL_CAPTURE(LoadDrawQuad);
 
-    // Draw quad
-    glBindVertexArray(quadVAO);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glBindVertexArray(GetDrawQuadArray());
     glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+    RLGL_STAT(frameStats.drawCalls++);
+    RLGL_STAT(frameStats.vertices += 4);
     glBindVertexArray(0);
-
-    // Delete buffers (VBO and VAO)
-    glDeleteBuffers(1, &quadVBO);
-    glDeleteVertexArrays(1, &quadVAO);
 #endif
 }
 
-// Load and draw a cube in NDC
-void Context::LoadDrawCube()
+// Draw instances of a quad in NDC (triangle strip, cached geometry)
+void Context::LoadDrawQuadInstanced(int instances)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    uint32_t cubeVAO = 0;
-    uint32_t cubeVBO = 0;
+    RLGL_CAPTURE(LoadDrawQuadInstanced, instances);
 
-    constexpr float vertices[] = {
-         // Positions          Normals               Texcoords
-        -1.0f, -1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   0.0f, 0.0f,
-         1.0f,  1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   1.0f, 1.0f,
-         1.0f, -1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   1.0f, 0.0f,
-         1.0f,  1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   1.0f, 1.0f,
-        -1.0f, -1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   0.0f, 0.0f,
-        -1.0f,  1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   0.0f, 1.0f,
-        -1.0f, -1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   0.0f, 0.0f,
-         1.0f, -1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   1.0f, 0.0f,
-         1.0f,  1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   1.0f, 1.0f,
-         1.0f,  1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   1.0f, 1.0f,
-        -1.0f,  1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   0.0f, 1.0f,
-        -1.0f, -1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   0.0f, 0.0f,
-        -1.0f,  1.0f,  1.0f,  -1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
-        -1.0f,  1.0f, -1.0f,  -1.0f,  0.0f,  0.0f,   1.0f, 1.0f,
-        -1.0f, -1.0f, -1.0f,  -1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
-        -1.0f, -1.0f, -1.0f,  -1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
-        -1.0f, -1.0f,  1.0f,  -1.0f,  0.0f,  0.0f,   0.0f, 0.0f,
-        -1.0f,  1.0f,  1.0f,  -1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
-         1.0f,  1.0f,  1.0f,   1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
-         1.0f, -1.0f, -1.0f,   1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
-         1.0f,  1.0f, -1.0f,   1.0f,  0.0f,  0.0f,   1.0f, 1.0f,
-         1.0f, -1.0f, -1.0f,   1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
-         1.0f,  1.0f,  1.0f,   1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
-         1.0f, -1.0f,  1.0f,   1.0f,  0.0f,  0.0f,   0.0f, 0.0f,
-        -1.0f, -1.0f, -1.0f,   0.0f, -1.0f,  0.0f,   0.0f, 1.0f,
-         1.0f, -1.0f, -1.0f,   0.0f, -1.0f,  0.0f,   1.0f, 1.0f,
-         1.0f, -1.0f,  1.0f,   0.0f, -1.0f,  0.0f,   1.0f, 0.0f,
-         1.0f, -1.0f,  1.0f,   0.0f, -1.0f,  0.0f,   1.0f, 0.0f,
-        -1.0f, -1.0f,  1.0f,   0.0f, -1.0f,  0.0f,   0.0f, 0.0f,
-        -1.0f, -1.0f, -1.0f,   0.0f, -1.0f,  0.0f,   0.0f, 1.0f,
-        -1.0f,  1.0f, -1.0f,   0.0f,  1.0f,  0.0f,   0.0f, 1.0f,
-         1.0f,  1.0f,  1.0f,   0.0f,  1.0f,  0.0f,   1.0f, 0.0f,
-         1.0f,  1.0f, -1.0f,   0.0f,  1.0f,  0.0f,   1.0f, 1.0f,
-         1.0f,  1.0f,  1.0f,   0.0f,  1.0f,  0.0f,   1.0f, 0.0f,
-        -1.0f,  1.0f, -1.0f,   0.0f,  1.0f,  0.0f,   0.0f, 1.0f,
-        -1.0f,  1.0f,  1.0f,   0.0f,  1.0f,  0.0f,   0.0f, 0.0f
-    };
-
-    // Gen VAO to contain VBO
-    glGenVertexArrays(1, &cubeVAO);
-    glBindVertexArray(cubeVAO);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glBindVertexArray(GetDrawQuadArray());
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, instances);
+    RLGL_STAT(frameStats.drawCalls++);
+    RLGL_STAT(frameStats.vertices += 4*instances);
+    glBindVertexArray(0);
+#endif
+}
 
-    // Gen and fill vertex buffer (VBO)
-    glGenBuffers(1, &cubeVBO);
-    glBindBuffer(GL_ARRAY_BUFFER, cubeVBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+// Draw a triangle covering the NDC square (cached geometry)
+// NOTE: Same vertex layout as the quad, texcoords are 0..1 over the screen
+void Context::DrawFullscreenTriangle()
+{
+    RLGL_CAPTURE(DrawFullscreenTriangle);
 
-    // Bind vertex attributes (position, normals, texcoords)
-    glBindVertexArray(cubeVAO);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8*sizeof(float), 0); // Positions
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8*sizeof(float), reinterpret_cast<const void*>(3*sizeof(float))); // Normals
-    glEnableVertexAttribArray(2);
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8*sizeof(float), reinterpret_cast<const void*>(6*sizeof(float))); // Texcoords
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glBindVertexArray(GetDrawQuadArray());
+    glDrawArrays(GL_TRIANGLES, 4, 3);
+    RLGL_STAT(frameStats.drawCalls++);
+    RLGL_STAT(frameStats.vertices += 3);
     glBindVertexArray(0);
+#endif
+}
+
+// Draw a cube in NDC (cached geometry)
+void Context::LoadDrawCube()
+{
+    RLGL_CAPTURE(LoadDrawCube);
 
-    // Draw cube
-    glBindVertexArray(cubeVAO);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glBindVertexArray(GetDrawCubeArray());
     glDrawArrays(GL_TRIANGLES, 0, 36);
+    RLGL_STAT(frameStats.drawCalls++);
+    RLGL_STAT(frameStats.vertices += 36);
     glBindVertexArray(0);
+#endif
+}
+
+// Draw instances of a cube in NDC (cached geometry)
+void Context::LoadDrawCubeInstanced(int instances)
+{
+    RLGL_CAPTURE(LoadDrawCubeInstanced, instances);
 
-    // Delete VBO and VAO
-    glDeleteBuffers(1, &cubeVBO);
-    glDeleteVertexArrays(1, &cubeVAO);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glBindVertexArray(GetDrawCubeArray());
+    glDrawArraysInstanced(GL_TRIANGLES, 0, 36, instances);
+    RLGL_STAT(frameStats.drawCalls++);
+    RLGL_STAT(frameStats.vertices += 36*instances);
+    glBindVertexArray(0);
 #endif
 }
 
@@ -3033,7 +3980,151 @@ void Context::UnloadShaderDefault()
 
     delete[] state.defaultShaderLocs;
 
+    if (state.defaultStereoShaderId != 0) glDeleteProgram(state.defaultStereoShaderId);
+
     TRACELOG(LogInfo, "SHADER: [ID %i] Default shader unloaded successfully", state.defaultShaderId);
 }
 
+// Load default single-pass stereo shader (stereo vertex shader + default fragment shader)
+// NOTE: Loaded: state.defaultStereoShaderId, state.defaultStereoShaderLocs
+void Context::LoadShaderStereo()
+{
+    std::fill(state.defaultStereoShaderLocs, state.defaultStereoShaderLocs + RL_MAX_SHADER_LOCATIONS, -1);
+
+    const char *vShaderCode = GetShaderStereoVertexCode();
+    if ((vShaderCode == nullptr) || !GetExtensions().instancing) return;
+
+    const uint32_t vShaderId = CompileShader(vShaderCode, GL_VERTEX_SHADER);
+    if (vShaderId == 0) return;
+
+    state.defaultStereoShaderId = LoadShaderProgram(vShaderId, state.defaultFShaderId);
+    glDeleteShader(vShaderId);  // Shader object is released with the program
+
+    if (state.defaultStereoShaderId > 0)
+    {
+        TRACELOG(LogInfo, "SHADER: [ID %i] Default stereo shader loaded successfully", state.defaultStereoShaderId);
+
+        state.defaultStereoShaderLocs[LocVertexPosition] = glGetAttribLocation(state.defaultStereoShaderId, "vertexPosition");
+        state.defaultStereoShaderLocs[LocVertexTexCoord01] = glGetAttribLocation(state.defaultStereoShaderId, "vertexTexCoord");
+        state.defaultStereoShaderLocs[LocVertexColor] = glGetAttribLocation(state.defaultStereoShaderId, "vertexColor");
+
+        state.defaultStereoShaderLocs[LocMatrixMVPStereo] = glGetUniformLocation(state.defaultStereoShaderId, RL_DEFAULT_SHADER_UNIFORM_NAME_MVP_STEREO);
+        state.defaultStereoShaderLocs[LocColorDiffuse] = glGetUniformLocation(state.defaultStereoShaderId, "colDiffuse");
+        state.defaultStereoShaderLocs[LocMapDiffuse] = glGetUniformLocation(state.defaultStereoShaderId, "texture0");
+    }
+    else TRACELOG(LogWarning, "SHADER: Failed to load default stereo shader");
+}
+
+// Get internal framebuffer used to read textures
+// NOTE: Framebuffer is created on first use and reused by all the texture readbacks
+uint32_t Context::GetReadFramebuffer()
+{
+#   if defined(RLGL_RENDER_TEXTURES_HINT)
+        if (readFramebuffer == 0) glGenFramebuffers(1, &readFramebuffer);
+#   endif
+
+    return readFramebuffer;
+}
+
+// Get the vertex array of the utility quad and fullscreen triangle (created on first use)
+uint32_t Context::GetDrawQuadArray()
+{
+    if (drawQuadVao != 0) return drawQuadVao;
+
+    constexpr float vertices[] = {
+         // Positions         Texcoords
+        -1.0f,  1.0f, 0.0f,   0.0f, 1.0f,       // Quad (triangle strip)
+        -1.0f, -1.0f, 0.0f,   0.0f, 0.0f,
+         1.0f,  1.0f, 0.0f,   1.0f, 1.0f,
+         1.0f, -1.0f, 0.0f,   1.0f, 0.0f,
+        -1.0f, -1.0f, 0.0f,   0.0f, 0.0f,       // Fullscreen triangle
+         3.0f, -1.0f, 0.0f,   2.0f, 0.0f,
+        -1.0f,  3.0f, 0.0f,   0.0f, 2.0f
+    };
+
+    glGenVertexArrays(1, &drawQuadVao);
+    glBindVertexArray(drawQuadVao);
+
+    glGenBuffers(1, &drawQuadVbo);
+    glBindBuffer(GL_ARRAY_BUFFER, drawQuadVbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+
+    // Bind vertex attributes (position, texcoords)
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5*sizeof(float), 0); // Positions
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5*sizeof(float), reinterpret_cast<const void*>(3*sizeof(float))); // Texcoords
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+
+    return drawQuadVao;
+}
+
+// Get the vertex array of the utility cube (created on first use)
+uint32_t Context::GetDrawCubeArray()
+{
+    if (drawCubeVao != 0) return drawCubeVao;
+
+    constexpr float vertices[] = {
+         // Positions          Normals               Texcoords
+        -1.0f, -1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   0.0f, 0.0f,
+         1.0f,  1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   1.0f, 1.0f,
+         1.0f, -1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   1.0f, 0.0f,
+         1.0f,  1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   1.0f, 1.0f,
+        -1.0f, -1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   0.0f, 0.0f,
+        -1.0f,  1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   0.0f, 1.0f,
+        -1.0f, -1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   0.0f, 0.0f,
+         1.0f, -1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   1.0f, 0.0f,
+         1.0f,  1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   1.0f, 1.0f,
+         1.0f,  1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   1.0f, 1.0f,
+        -1.0f,  1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   0.0f, 1.0f,
+        -1.0f, -1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   0.0f, 0.0f,
+        -1.0f,  1.0f,  1.0f,  -1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
+        -1.0f,  1.0f, -1.0f,  -1.0f,  0.0f,  0.0f,   1.0f, 1.0f,
+        -1.0f, -1.0f, -1.0f,  -1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
+        -1.0f, -1.0f, -1.0f,  -1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
+        -1.0f, -1.0f,  1.0f,  -1.0f,  0.0f,  0.0f,   0.0f, 0.0f,
+        -1.0f,  1.0f,  1.0f,  -1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
+         1.0f,  1.0f,  1.0f,   1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
+         1.0f, -1.0f, -1.0f,   1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
+         1.0f,  1.0f, -1.0f,   1.0f,  0.0f,  0.0f,   1.0f, 1.0f,
+         1.0f, -1.0f, -1.0f,   1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
+         1.0f,  1.0f,  1.0f,   1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
+         1.0f, -1.0f,  1.0f,   1.0f,  0.0f,  0.0f,   0.0f, 0.0f,
+        -1.0f, -1.0f, -1.0f,   0.0f, -1.0f,  0.0f,   0.0f, 1.0f,
+         1.0f, -1.0f, -1.0f,   0.0f, -1.0f,  0.0f,   1.0f, 1.0f,
+         1.0f, -1.0f,  1.0f,   0.0f, -1.0f,  0.0f,   1.0f, 0.0f,
+         1.0f, -1.0f,  1.0f,   0.0f, -1.0f,  0.0f,   1.0f, 0.0f,
+        -1.0f, -1.0f,  1.0f,   0.0f, -1.0f,  0.0f,   0.0f, 0.0f,
+        -1.0f, -1.0f, -1.0f,   0.0f, -1.0f,  0.0f,   0.0f, 1.0f,
+        -1.0f,  1.0f, -1.0f,   0.0f,  1.0f,  0.0f,   0.0f, 1.0f,
+         1.0f,  1.0f,  1.0f,   0.0f,  1.0f,  0.0f,   1.0f, 0.0f,
+         1.0f,  1.0f, -1.0f,   0.0f,  1.0f,  0.0f,   1.0f, 1.0f,
+         1.0f,  1.0f,  1.0f,   0.0f,  1.0f,  0.0f,   1.0f, 0.0f,
+        -1.0f,  1.0f, -1.0f,   0.0f,  1.0f,  0.0f,   0.0f, 1.0f,
+        -1.0f,  1.0f,  1.0f,   0.0f,  1.0f,  0.0f,   0.0f, 0.0f
+    };
+
+    glGenVertexArrays(1, &drawCubeVao);
+    glBindVertexArray(drawCubeVao);
+
+    glGenBuffers(1, &drawCubeVbo);
+    glBindBuffer(GL_ARRAY_BUFFER, drawCubeVbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+
+    // Bind vertex attributes (position, normals, texcoords)
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8*sizeof(float), 0); // Positions
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8*sizeof(float), reinterpret_cast<const void*>(3*sizeof(float))); // Normals
+    glEnableVertexAttribArray(2);
+    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8*sizeof(float), reinterpret_cast<const void*>(6*sizeof(float))); // Texcoords
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+
+    return drawCubeVao;
+}
+
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
@@ -0,0 +1,323 @@
+// rlgl capture replay tool
+// NOTE: Replays a capture saved with FrameCapture::Save() on a headless EGL context (i.e. Mesa llvmpipe):
+// EGL_PLATFORM=surfaceless rlgl_replay capture.rlcap --repeat 10 --json results.json
+// Every frame is replayed with the time of each call, then glFinish() is timed apart so the CPU cost
+// of the calls and the GPU work are reported separately. Built with RLGL_NULL_GL, GL calls go to the
+// null backend (no EGL, no GPU): only the CPU cost of rlgl is measured.
+
+#include "rlCapture.hpp"
+#include "rlUtils.hpp"
+#include "rlgl.hpp"
+
+#if !defined(RLGL_NULL_GL)
+    #include <EGL/egl.h>
+    #include <EGL/eglext.h>
+#endif
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace rlgl;
+
+namespace {
+
+    // Times of a replayed frame
+    struct FrameTiming
+    {
+        int repeat = 0;                 // Repetition of the frame
+        int index = 0;                  // Frame index in the capture
+        uint64_t callTime = 0;          // Time of the replayed calls (in nanoseconds)
+        uint64_t finishTime = 0;        // Time waiting for the GPU after the calls (in nanoseconds)
+        std::size_t callCount = 0;      // Replayed calls
+    };
+
+    //----------------------------------------------------------------------------------
+
+#if defined(RLGL_NULL_GL)
+
+    void *LoadProc(const char *name)
+    {
+        return NullGLLoader(name);
+    }
+
+    // No context needed by the null backend
+    bool InitEGL()
+    {
+        return true;
+    }
+
+    bool InitSurface(int, int)
+    {
+        return true;
+    }
+
+#else
+
+    EGLDisplay display = EGL_NO_DISPLAY;
+    EGLConfig config = nullptr;
+    EGLContext context = EGL_NO_CONTEXT;
+
+    void *LoadProc(const char *name)
+    {
+        return reinterpret_cast<void*>(eglGetProcAddress(name));
+    }
+
+    // Create a surfaceless OpenGL context and make it current
+    bool InitEGL()
+    {
+        auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+        display = (getPlatformDisplay != nullptr) ? getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr)
+                                                  : eglGetDisplay(EGL_DEFAULT_DISPLAY);
+
+        if ((display == EGL_NO_DISPLAY) || !eglInitialize(display, nullptr, nullptr)) return false;
+        if (!eglBindAPI(EGL_OPENGL_API)) return false;
+
+#   if defined(GRAPHICS_API_OPENGL_43)
+        const EGLint major = 4, minor = 3;
+#   else
+        const EGLint major = 3, minor = 3;
+#   endif
+
+        const EGLint configAttribs[] = {
+            EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT, EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+            EGL_RED_SIZE, 8, EGL_GREEN_SIZE, 8, EGL_BLUE_SIZE, 8, EGL_ALPHA_SIZE, 8, EGL_DEPTH_SIZE, 24, EGL_NONE
+        };
+        EGLint configCount = 0;
+        eglChooseConfig(display, configAttribs, &config, 1, &configCount);
+        if (configCount == 0) config = nullptr;
+
+        const EGLint contextAttribs[] = {
+            EGL_CONTEXT_MAJOR_VERSION, major, EGL_CONTEXT_MINOR_VERSION, minor,
+            EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT, EGL_NONE
+        };
+
+        context = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttribs);
+        if (context == EGL_NO_CONTEXT) return false;
+
+        return eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context);
+    }
+
+    // Bind a pbuffer of the captured framebuffer size, the frames drawing to the default framebuffer render to it
+    // NOTE: Without pbuffer support the replay stays surfaceless, only framebuffer objects are rendered
+    bool InitSurface(int width, int height)
+    {
+        if (config == nullptr) return false;
+
+        const EGLint surfaceAttribs[] = { EGL_WIDTH, std::max(width, 1), EGL_HEIGHT, std::max(height, 1), EGL_NONE };
+        EGLSurface surface = eglCreatePbufferSurface(display, config, surfaceAttribs);
+        if (surface == EGL_NO_SURFACE) return false;
+
+        return eglMakeCurrent(display, surface, surface, context);
+    }
+
+#endif
+
+    double ToMilliseconds(uint64_t time)
+    {
+        return static_cast<double>(time)/1.0e6;
+    }
+
+    double ToMicroseconds(uint64_t time)
+    {
+        return static_cast<double>(time)/1.0e3;
+    }
+
+    void PrintUsage()
+    {
+        std::printf("Usage: rlgl_replay <capture.rlcap> [--repeat N] [--json results.json] [--calls calls.csv]\n");
+        std::printf("  --repeat N      Replay the captured frames N times (default 1)\n");
+        std::printf("  --json FILE     Write the frame times and the command statistics as JSON\n");
+        std::printf("  --calls FILE    Write the time of every replayed call as CSV\n");
+    }
+
+    bool WriteJson(const std::string& fileName, const std::string& captureName, const CaptureReplay& replay,
+        int repeat, uint64_t setupTime, const std::vector<FrameTiming>& frames)
+    {
+        std::FILE *file = std::fopen(fileName.c_str(), "w");
+        if (file == nullptr) return false;
+
+        std::string name;
+        AppendJsonString(name, captureName.c_str());
+        std::fprintf(file, "{\n  \"capture\": %s,\n", name.c_str());
+        std::fprintf(file, "  \"width\": %i,\n  \"height\": %i,\n  \"repeat\": %i,\n", replay.GetWidth(), replay.GetHeight(), repeat);
+        std::fprintf(file, "  \"setupTime\": %llu,\n", static_cast<unsigned long long>(setupTime));
+        std::fprintf(file, "  \"unresolvedIds\": %llu,\n", static_cast<unsigned long long>(replay.GetUnresolvedIds()));
+        std::fprintf(file, "  \"skippedCommands\": %llu,\n", static_cast<unsigned long long>(replay.GetSkippedCommands()));
+
+        std::fprintf(file, "  \"frames\": [\n");
+        for (std::size_t i = 0; i < frames.size(); i++)
+        {
+            const FrameTiming &frame = frames[i];
+            std::fprintf(file, "    { \"repeat\": %i, \"index\": %i, \"calls\": %zu, \"callTime\": %llu, \"finishTime\": %llu }%s\n",
+                frame.repeat, frame.index, frame.callCount, static_cast<unsigned long long>(frame.callTime),
+                static_cast<unsigned long long>(frame.finishTime), (i + 1 < frames.size())? "," : "");
+        }
+        std::fprintf(file, "  ],\n");
+
+        const std::vector<CaptureCommandStats> &stats = replay.GetCommandStats();
+        bool first = true;
+
+        std::fprintf(file, "  \"commands\": [\n");
+        for (std::size_t i = 0; i < stats.size(); i++)
+        {
+            if (stats[i].count == 0) continue;
+
+            std::fprintf(file, "%s    { \"name\": \"%s\", \"count\": %llu, \"totalTime\": %llu, \"minTime\": %llu, \"maxTime\": %llu }",
+                first? "" : ",\n", GetCaptureCommandName(static_cast<CaptureCommand>(i)), static_cast<unsigned long long>(stats[i].count),
+                static_cast<unsigned long long>(stats[i].totalTime), static_cast<unsigned long long>(stats[i].minTime),
+                static_cast<unsigned long long>(stats[i].maxTime));
+            first = false;
+        }
+        std::fprintf(file, "\n  ]\n}\n");
+
+        return (std::fclose(file) == 0);
+    }
+
+}
+
+int main(int argc, char **argv)
+{
+    std::string captureName;
+    std::string jsonName;
+    std::string callsName;
+    int repeat = 1;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const bool hasValue = (i + 1 < argc);
+
+        if ((std::strcmp(argv[i], "--repeat") == 0) && hasValue) repeat = std::max(std::atoi(argv[++i]), 1);
+        else if ((std::strcmp(argv[i], "--json") == 0) && hasValue) jsonName = argv[++i];
+        else if ((std::strcmp(argv[i], "--calls") == 0) && hasValue) callsName = argv[++i];
+        else if ((argv[i][0] != '-') && captureName.empty()) captureName = argv[i];
+        else
+        {
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    if (captureName.empty())
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    if (!InitEGL())
+    {
+        std::fprintf(stderr, "Failed to create the OpenGL context (EGL)\n");
+        return 1;
+    }
+
+    Context rlCtx(1, 1, LoadProc);
+    CaptureReplay replay(rlCtx);
+
+    if (!replay.Load(captureName))
+    {
+        std::fprintf(stderr, "Failed to load the capture [%s]\n", captureName.c_str());
+        return 1;
+    }
+
+    if (!InitSurface(replay.GetWidth(), replay.GetHeight())) std::fprintf(stderr, "No pbuffer surface, the default framebuffer is not rendered\n");
+
+    std::FILE *callsFile = nullptr;
+    if (!callsName.empty())
+    {
+        callsFile = std::fopen(callsName.c_str(), "w");
+        if (callsFile == nullptr)
+        {
+            std::fprintf(stderr, "Failed to open [%s]\n", callsName.c_str());
+            return 1;
+        }
+
+        std::fprintf(callsFile, "repeat,frame,call,command,duration\n");
+    }
+
+    // Objects and state of the capture start
+    const uint64_t setupStart = GetTraceTime();
+    if (!replay.ReplaySetup())
+    {
+        std::fprintf(stderr, "Failed to replay the capture setup\n");
+        return 1;
+    }
+    glFinish();
+    const uint64_t setupTime = GetTraceTime() - setupStart;
+
+    std::printf("Capture %s: %ix%i, %i frames, setup %.3f ms\n\n", captureName.c_str(), replay.GetWidth(), replay.GetHeight(),
+        replay.GetFrameCount(), ToMilliseconds(setupTime));
+    std::printf("%8s %6s %8s %12s %12s\n", "repeat", "frame", "calls", "calls (ms)", "finish (ms)");
+
+    std::vector<FrameTiming> frames;
+    std::vector<CaptureCallTiming> calls;
+
+    for (int r = 0; r < repeat; r++)
+    {
+        for (int i = 0; i < replay.GetFrameCount(); i++)
+        {
+            FrameTiming frame;
+            frame.repeat = r;
+            frame.index = i;
+
+            calls.clear();
+
+            const uint64_t start = GetTraceTime();
+            if (!replay.ReplayFrame(i, &calls))
+            {
+                std::fprintf(stderr, "Failed to replay the frame %i\n", i);
+                return 1;
+            }
+            const uint64_t callsEnd = GetTraceTime();
+            glFinish();
+
+            frame.callTime = callsEnd - start;
+            frame.finishTime = GetTraceTime() - callsEnd;
+            frame.callCount = calls.size();
+            frames.push_back(frame);
+
+            std::printf("%8i %6i %8zu %12.3f %12.3f\n", r, i, frame.callCount, ToMilliseconds(frame.callTime), ToMilliseconds(frame.finishTime));
+
+            if (callsFile != nullptr)
+            {
+                for (std::size_t c = 0; c < calls.size(); c++)
+                {
+                    std::fprintf(callsFile, "%i,%i,%zu,%s,%llu\n", r, i, c, GetCaptureCommandName(calls[c].command),
+                        static_cast<unsigned long long>(calls[c].duration));
+                }
+            }
+        }
+    }
+
+    if (callsFile != nullptr) std::fclose(callsFile);
+
+    // Commands sorted by total time
+    const std::vector<CaptureCommandStats> &stats = replay.GetCommandStats();
+    std::vector<std::size_t> order;
+    for (std::size_t i = 0; i < stats.size(); i++) if (stats[i].count > 0) order.push_back(i);
+    std::sort(order.begin(), order.end(), [&stats](std::size_t a, std::size_t b) { return stats[a].totalTime > stats[b].totalTime; });
+
+    std::printf("\n%-34s %10s %12s %10s %10s %10s\n", "command", "count", "total (ms)", "avg (us)", "min (us)", "max (us)");
+    for (std::size_t i : order)
+    {
+        std::printf("%-34s %10llu %12.3f %10.3f %10.3f %10.3f\n", GetCaptureCommandName(static_cast<CaptureCommand>(i)),
+            static_cast<unsigned long long>(stats[i].count), ToMilliseconds(stats[i].totalTime),
+            ToMicroseconds(stats[i].totalTime)/static_cast<double>(stats[i].count), ToMicroseconds(stats[i].minTime), ToMicroseconds(stats[i].maxTime));
+    }
+
+    if ((replay.GetUnresolvedIds() > 0) || (replay.GetSkippedCommands() > 0))
+    {
+        std::printf("\n%llu object ids not created by the capture, %llu commands not replayed\n",
+            static_cast<unsigned long long>(replay.GetUnresolvedIds()), static_cast<unsigned long long>(replay.GetSkippedCommands()));
+    }
+
+    if (!jsonName.empty() && !WriteJson(jsonName, captureName, replay, repeat, setupTime, frames))
+    {
+        std::fprintf(stderr, "Failed to write [%s]\n", jsonName.c_str());
+        return 1;
+    }
+
+    return 0;
+}